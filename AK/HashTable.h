@@ -627,13 +627,25 @@ private:
         MUST(try_rehash(new_capacity));
     }
 
+    // OPTIMIZATION: Capacities are not powers of two, so reducing a hash with % would cost an integer
+    //               division on every lookup and insertion. This multiply-shift reduction maps the full
+    //               32-bit hash range onto [0, capacity) with a single multiplication instead.
+    ALWAYS_INLINE size_t reduce_hash_to_bucket_index(u32 hash) const
+    {
+        // NOTE: The reduction keeps the hash's high bits, so scramble the hash with a Fibonacci
+        //       multiplier first to make sure keys whose hashes only differ in their low bits still
+        //       spread across the whole table.
+        hash *= 0x9e3779b1u;
+        return static_cast<size_t>((static_cast<u64>(hash) * static_cast<u64>(m_capacity)) >> 32);
+    }
+
     template<typename TUnaryPredicate>
     [[nodiscard]] BucketType* lookup_with_hash(unsigned hash, TUnaryPredicate predicate) const
     {
         if (is_empty())
             return nullptr;
 
-        size_t bucket_index = hash % m_capacity;
+        size_t bucket_index = reduce_hash_to_bucket_index(hash);
         for (;;) {
             auto* bucket = &m_buckets[bucket_index];
             if (bucket->state == BucketState::Free)
@@ -650,7 +662,7 @@ private:
         VERIFY(bucket.state != BucketState::Free);
 
         if (bucket.state == BucketState::CalculateLength) {
-            size_t ideal_bucket_index = TraitsForT::hash(*bucket.slot()) % m_capacity;
+            size_t ideal_bucket_index = reduce_hash_to_bucket_index(TraitsForT::hash(*bucket.slot()));
 
             VERIFY(&bucket >= m_buckets);
             size_t actual_bucket_index = &bucket - m_buckets;
@@ -718,7 +730,7 @@ private:
             }
         };
 
-        auto bucket_index = hash % m_capacity;
+        auto bucket_index = reduce_hash_to_bucket_index(hash);
         size_t probe_length = 0;
         for (;;) {
             auto* bucket = &m_buckets[bucket_index];
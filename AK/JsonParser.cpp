@@ -8,6 +8,7 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
+#include <AK/NumericLimits.h>
 #include <AK/StringConversions.h>
 #include <math.h>
 
@@ -200,13 +201,10 @@ ErrorOr<JsonValue> JsonParser::parse_string()
 
 ErrorOr<JsonValue> JsonParser::parse_number()
 {
-    Vector<char, 32> number_buffer;
-
     auto start_index = tell();
 
     bool negative = false;
     if (peek() == '-') {
-        number_buffer.append('-');
         ++m_index;
         negative = true;
 
@@ -238,7 +236,11 @@ ErrorOr<JsonValue> JsonParser::parse_number()
         // start with a '.' or 'e'.
     }
 
+    // OPTIMIZATION: Accumulate the magnitude directly instead of buffering the digits and
+    //               re-parsing them through StringView::to_number() afterwards.
     bool all_zero = true;
+    u64 magnitude = 0;
+    bool magnitude_overflowed = false;
     for (;;) {
         char ch = peek();
         if (ch == '.') {
@@ -259,7 +261,11 @@ ErrorOr<JsonValue> JsonParser::parse_number()
             if (ch != '0')
                 all_zero = false;
 
-            number_buffer.append(ch);
+            u64 digit = ch - '0';
+            if (magnitude > (NumericLimits<u64>::max() - digit) / 10)
+                magnitude_overflowed = true;
+            else
+                magnitude = magnitude * 10 + digit;
             ++m_index;
             continue;
         }
@@ -271,15 +277,19 @@ ErrorOr<JsonValue> JsonParser::parse_number()
     if (negative && all_zero)
         return JsonValue(-0.0);
 
-    StringView number_string(number_buffer.data(), number_buffer.size());
+    // It's possible the value is bigger than u64 max
+    if (magnitude_overflowed)
+        return fallback_to_double_parse();
 
-    if (auto number = number_string.to_number<u64>(); number.has_value())
-        return JsonValue(*number);
-    if (auto number = number_string.to_number<i64>(); number.has_value())
-        return JsonValue(*number);
+    if (negative) {
+        if (magnitude <= static_cast<u64>(NumericLimits<i64>::max()))
+            return JsonValue(-static_cast<i64>(magnitude));
+        if (magnitude == static_cast<u64>(NumericLimits<i64>::max()) + 1)
+            return JsonValue(NumericLimits<i64>::min());
+        return fallback_to_double_parse();
+    }
 
-    // It's possible the unsigned value is bigger than u64 max
-    return fallback_to_double_parse();
+    return JsonValue(magnitude);
 }
 
 ErrorOr<JsonValue> JsonParser::parse_true()
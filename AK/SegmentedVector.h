@@ -52,13 +52,17 @@ public:
 
     void append(T&& value)
     {
-        if (m_segments.is_empty() || m_segments.last()->size() >= segment_size)
+        // OPTIMIZATION: Elements are only ever appended, so every segment except the last one is
+        //               completely full and the size alone tells us when a new segment is needed.
+        //               Each segment's inline capacity is segment_size, so appending into it can
+        //               never allocate and the capacity check can be skipped.
+        if (m_size % segment_size == 0)
             m_segments.append(make<Vector<T, segment_size>>());
 
         if constexpr (contains_reference) {
-            m_segments.last()->append(value);
+            m_segments.last()->unchecked_append(value);
         } else {
-            m_segments.last()->append(move(value));
+            m_segments.last()->unchecked_append(move(value));
         }
         ++m_size;
     }
@@ -73,6 +73,24 @@ ErrorOr<String> String::from_utf8(StringView view)
     return result;
 }
 
+ErrorOr<String> String::from_latin1(ReadonlyBytes bytes)
+{
+    if (bytes.is_empty())
+        return String {};
+
+    auto const* latin1_data = reinterpret_cast<char const*>(bytes.data());
+    auto utf8_length = simdutf::utf8_length_from_latin1(latin1_data, bytes.size());
+
+    String result;
+    TRY(result.replace_with_new_string(utf8_length, [&](Bytes buffer) -> ErrorOr<void> {
+        [[maybe_unused]] auto converted_length = simdutf::convert_latin1_to_utf8(latin1_data, bytes.size(), reinterpret_cast<char*>(buffer.data()));
+        ASSERT(converted_length == buffer.size());
+        return {};
+    }));
+
+    return result;
+}
+
 ErrorOr<String> String::from_utf16_le_with_replacement_character(ReadonlyBytes bytes)
 {
     if (bytes.is_empty())
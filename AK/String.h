@@ -66,6 +66,9 @@ public:
     [[nodiscard]] static String from_utf8_without_validation(ReadonlyBytes);
     [[nodiscard]] static String from_ascii_without_validation(ReadonlyBytes);
 
+    // Creates a new String from Latin-1 encoded bytes, i.e. each byte is the code point U+0000..U+00FF.
+    static ErrorOr<String> from_latin1(ReadonlyBytes);
+
     static ErrorOr<String> from_string_builder(Badge<StringBuilder>, StringBuilder&);
     [[nodiscard]] static String from_string_builder_without_validation(Badge<StringBuilder>, StringBuilder&);
 
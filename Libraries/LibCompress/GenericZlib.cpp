@@ -4,12 +4,44 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
+#include <AK/Math.h>
 #include <LibCompress/GenericZlib.h>
 
 #include <zlib.h>
 
 namespace Compress {
 
+bool looks_incompressible(ReadonlyBytes bytes)
+{
+    // Estimate the Shannon entropy of up to 64 KiB sampled evenly across the input. Anything close
+    // to 8 bits per byte is random or already compressed, and deflate won't make it smaller.
+    static constexpr size_t minimum_input_size = 4 * KiB;
+    static constexpr size_t maximum_sample_size = 64 * KiB;
+    static constexpr size_t chunk_size = 1 * KiB;
+
+    if (bytes.size() < minimum_input_size)
+        return false;
+
+    Array<u32, 256> histogram {};
+    size_t chunk_count = min(bytes.size(), maximum_sample_size) / chunk_size;
+    size_t stride = bytes.size() / chunk_count;
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+        for (auto byte : bytes.slice(chunk * stride, chunk_size))
+            ++histogram[byte];
+    }
+
+    auto sample_size = static_cast<float>(chunk_count * chunk_size);
+    float entropy = 0;
+    for (auto count : histogram) {
+        if (count == 0)
+            continue;
+        float probability = count / sample_size;
+        entropy -= probability * AK::log2(probability);
+    }
+    return entropy > 7.5f;
+}
+
 static Error handle_zlib_error(int ret)
 {
     switch (ret) {
@@ -136,6 +168,8 @@ ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZ
 
     int level = [&] {
         switch (compression_level) {
+        case GenericZlibCompressionLevel::None:
+            return Z_NO_COMPRESSION;
         case GenericZlibCompressionLevel::Fastest:
             return Z_BEST_SPEED;
         case GenericZlibCompressionLevel::Default:
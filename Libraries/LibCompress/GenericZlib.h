@@ -19,11 +19,15 @@ typedef struct z_stream_s z_stream;
 namespace Compress {
 
 enum class GenericZlibCompressionLevel : u8 {
+    None,
     Fastest,
     Default,
     Best,
 };
 
+// Returns true when a sample of the input looks like it won't compress (random or already-compressed data).
+bool looks_incompressible(ReadonlyBytes);
+
 class GenericZlibDecompressor : public Stream {
     AK_MAKE_NONCOPYABLE(GenericZlibDecompressor);
 
@@ -86,6 +90,12 @@ ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes bytes)
 template<class T>
 ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
+    // OPTIMIZATION: On already-compressed data, deflate spends all of its time on match finding only
+    //               for zlib to fall back to stored blocks anyway. Detect such inputs up front and
+    //               emit stored blocks directly at copy speed.
+    if (compression_level != GenericZlibCompressionLevel::None && looks_incompressible(bytes))
+        compression_level = GenericZlibCompressionLevel::None;
+
     auto output_stream = TRY(try_make<AllocatingMemoryStream>());
     auto gzip_stream = TRY(T::create(MaybeOwned { *output_stream }, compression_level));
 
@@ -409,14 +409,24 @@ try_select_again:
 
     if (error_or_marked_fd_count.value() != 0) {
         // Handle file system notifiers by making them normal events.
+        // OPTIMIZATION: poll() told us how many fds are marked, so stop scanning once we have seen
+        //               them all. With many idle sockets registered, only a handful are typically
+        //               ready in any given iteration.
+        [[maybe_unused]] size_t marked_fds_remaining = error_or_marked_fd_count.value() - (thread_data.poll_fds[0].revents != 0 ? 1 : 0);
         for (size_t i = 1; i < thread_data.poll_fds.size(); ++i) {
-            auto& notifier = *thread_data.notifiers[i];
-
 #ifdef AK_OS_ANDROID
+            auto& notifier = *thread_data.notifiers[i];
             // FIXME: Make the check work under Android, perhaps use ALooper.
             ThreadEventQueue::current().post_event(notifier, make<NotifierActivationEvent>(notifier.fd(), notifier.type()));
 #else
+            if (marked_fds_remaining == 0)
+                break;
             auto revents = thread_data.poll_fds[i].revents;
+            if (revents == 0)
+                continue;
+            --marked_fds_remaining;
+
+            auto& notifier = *thread_data.notifiers[i];
 
             NotificationType type = NotificationType::None;
             if (has_flag(revents, POLLIN))
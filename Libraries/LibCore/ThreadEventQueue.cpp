@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Vector.h>
 #include <LibCore/DeferredInvocationContext.h>
 #include <LibCore/EventLoopImplementation.h>
@@ -19,7 +20,7 @@ namespace Core {
 struct ThreadEventQueue::Private {
     struct QueuedEvent {
         AK_MAKE_NONCOPYABLE(QueuedEvent);
-        AK_MAKE_DEFAULT_MOVABLE(QueuedEvent);
+        AK_MAKE_NONMOVABLE(QueuedEvent);
 
     public:
         QueuedEvent(EventReceiver& receiver, NonnullOwnPtr<Event> event)
@@ -32,12 +33,30 @@ struct ThreadEventQueue::Private {
 
         WeakPtr<EventReceiver> receiver;
         NonnullOwnPtr<Event> event;
+        QueuedEvent* next { nullptr };
     };
 
+    // OPTIMIZATION: Queued events are kept in a lock-free multiple-producer single-consumer stack,
+    //               so that posting an event (which happens for every timer fire and deferred
+    //               invocation) doesn't have to take a mutex. The stack holds the events in
+    //               reverse posting order; process() drains it and restores the order by
+    //               reversing the list.
+    Atomic<QueuedEvent*> newest_queued_event { nullptr };
+
+    // This mutex only protects the pending promises.
     Threading::Mutex mutex;
-    Vector<QueuedEvent> queued_events;
     Vector<NonnullRefPtr<Promise<NonnullRefPtr<EventReceiver>>>, 16> pending_promises;
     bool warned_promise_count { false };
+
+    ~Private()
+    {
+        auto* queued_event = newest_queued_event.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+        while (queued_event) {
+            auto* next = queued_event->next;
+            delete queued_event;
+            queued_event = next;
+        }
+    }
 };
 
 static pthread_key_t s_current_thread_event_queue_key;
@@ -69,9 +88,10 @@ ThreadEventQueue::~ThreadEventQueue() = default;
 
 void ThreadEventQueue::post_event(Core::EventReceiver& receiver, NonnullOwnPtr<Core::Event> event)
 {
-    {
-        Threading::MutexLocker lock(m_private->mutex);
-        m_private->queued_events.empend(receiver, move(event));
+    auto* queued_event = new Private::QueuedEvent(receiver, move(event));
+    queued_event->next = m_private->newest_queued_event.load(AK::MemoryOrder::memory_order_relaxed);
+    while (!m_private->newest_queued_event.compare_exchange_strong(queued_event->next, queued_event, AK::MemoryOrder::memory_order_acq_rel)) {
+        // NOTE: On failure, compare_exchange_strong() updates queued_event->next to the current head.
     }
     Core::EventLoopManager::the().did_post_event();
 }
@@ -93,18 +113,25 @@ void ThreadEventQueue::cancel_all_pending_jobs()
 
 size_t ThreadEventQueue::process()
 {
-    decltype(m_private->queued_events) events;
+    // Take the whole stack in one go, then reverse it to get the events back in posting order.
+    auto* stack = m_private->newest_queued_event.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+    Private::QueuedEvent* first_queued_event = nullptr;
+    while (stack) {
+        auto* next = stack->next;
+        stack->next = first_queued_event;
+        first_queued_event = stack;
+        stack = next;
+    }
+
     {
         Threading::MutexLocker locker(m_private->mutex);
-        events = move(m_private->queued_events);
         m_private->pending_promises.remove_all_matching([](auto& job) { return job->is_resolved() || job->is_rejected(); });
     }
 
     size_t processed_events = 0;
-    for (size_t i = 0; i < events.size(); ++i) {
-        auto& queued_event = events.at(i);
-        auto receiver = queued_event.receiver.strong_ref();
-        auto& event = *queued_event.event;
+    for (auto* queued_event = first_queued_event; queued_event;) {
+        auto receiver = queued_event->receiver.strong_ref();
+        auto& event = *queued_event->event;
 
         if (!receiver) {
             switch (event.type()) {
@@ -120,6 +147,10 @@ size_t ThreadEventQueue::process()
             NonnullRefPtr<EventReceiver> protector(*receiver);
             receiver->dispatch_event(event);
         }
+
+        auto* next = queued_event->next;
+        delete queued_event;
+        queued_event = next;
         ++processed_events;
     }
 
@@ -135,8 +166,7 @@ size_t ThreadEventQueue::process()
 
 bool ThreadEventQueue::has_pending_events() const
 {
-    Threading::MutexLocker locker(m_private->mutex);
-    return !m_private->queued_events.is_empty();
+    return m_private->newest_queued_event.load(AK::MemoryOrder::memory_order_acquire) != nullptr;
 }
 
 }
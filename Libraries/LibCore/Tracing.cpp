@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibCore/Environment.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCore/Tracing.h>
+#include <stdlib.h>
+
+namespace Core::Trace {
+
+Atomic<bool> g_tracing_enabled { false };
+
+static constexpr size_t max_recorded_events = 64 * 1024;
+
+// NOTE: LibCore sits below LibThreading, so this uses a tiny spinlock of its own instead of a
+//       mutex. The critical sections below only copy a few words, so contention is short-lived.
+static Atomic<bool> s_events_lock { false };
+static Vector<Event>* s_events { nullptr };
+static size_t s_next_event_index { 0 };
+static bool s_events_have_wrapped { false };
+
+static Atomic<u32> s_next_thread_id { 1 };
+static thread_local u32 s_thread_id { s_next_thread_id.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) };
+
+class EventsLocker {
+public:
+    EventsLocker()
+    {
+        while (s_events_lock.exchange(true, AK::MemoryOrder::memory_order_acquire)) {
+            // Spin until the holder releases the lock.
+        }
+    }
+
+    ~EventsLocker()
+    {
+        s_events_lock.store(false, AK::MemoryOrder::memory_order_release);
+    }
+};
+
+void enable()
+{
+    EventsLocker locker;
+    if (!s_events) {
+        s_events = new Vector<Event>();
+        s_events->ensure_capacity(max_recorded_events);
+    }
+    g_tracing_enabled.store(true, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void disable()
+{
+    g_tracing_enabled.store(false, AK::MemoryOrder::memory_order_relaxed);
+}
+
+void record_event(char const* name, u64 start_in_nanoseconds, u64 duration_in_nanoseconds)
+{
+    Event event {
+        .name = name,
+        .start_in_nanoseconds = start_in_nanoseconds,
+        .duration_in_nanoseconds = duration_in_nanoseconds,
+        .thread_id = s_thread_id,
+    };
+
+    EventsLocker locker;
+    if (!s_events)
+        return;
+    if (s_events->size() < max_recorded_events) {
+        s_events->unchecked_append(event);
+    } else {
+        (*s_events)[s_next_event_index] = event;
+        s_events_have_wrapped = true;
+    }
+    s_next_event_index = (s_next_event_index + 1) % max_recorded_events;
+}
+
+Vector<Event> take_events()
+{
+    EventsLocker locker;
+    if (!s_events)
+        return {};
+
+    Vector<Event> events;
+    events.ensure_capacity(s_events->size());
+    // When the buffer has wrapped, the oldest surviving event lives at the overwrite cursor.
+    auto oldest_index = s_events_have_wrapped ? s_next_event_index : 0;
+    for (size_t i = 0; i < s_events->size(); ++i)
+        events.unchecked_append((*s_events)[(oldest_index + i) % s_events->size()]);
+
+    s_events->clear_with_capacity();
+    s_next_event_index = 0;
+    s_events_have_wrapped = false;
+    return events;
+}
+
+ErrorOr<String> export_chrome_trace()
+{
+    auto events = take_events();
+    auto pid = System::getpid();
+
+    // https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+    StringBuilder builder;
+    TRY(builder.try_append("{\"traceEvents\":["sv));
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto const& event = events[i];
+        if (i != 0)
+            TRY(builder.try_append(','));
+        // Timestamps and durations are expected in microseconds; fractions keep the nanoseconds.
+        TRY(builder.try_appendff("{{\"name\":\"{}\",\"cat\":\"ladybird\",\"ph\":\"X\",\"pid\":{},\"tid\":{},\"ts\":{}.{:03},\"dur\":{}.{:03}}}",
+            StringView { event.name, __builtin_strlen(event.name) },
+            pid,
+            event.thread_id,
+            event.start_in_nanoseconds / 1000, event.start_in_nanoseconds % 1000,
+            event.duration_in_nanoseconds / 1000, event.duration_in_nanoseconds % 1000));
+    }
+    TRY(builder.try_append("]}"sv));
+    return builder.to_string();
+}
+
+static void write_trace_file_at_exit();
+
+static struct TraceFileFromEnvironment {
+    TraceFileFromEnvironment()
+    {
+        if (!Environment::get("LADYBIRD_TRACE_FILE"sv).has_value())
+            return;
+        enable();
+        atexit(write_trace_file_at_exit);
+    }
+} s_trace_file_from_environment;
+
+static void write_trace_file_at_exit()
+{
+    auto path_prefix = Environment::get("LADYBIRD_TRACE_FILE"sv);
+    if (!path_prefix.has_value())
+        return;
+
+    auto result = [&]() -> ErrorOr<void> {
+        auto json = TRY(export_chrome_trace());
+        // Every process in the browser writes its own file, so qualify the path with the pid.
+        auto path = TRY(String::formatted("{}.{}", *path_prefix, System::getpid()));
+        auto file = TRY(File::open(path, File::OpenMode::Write));
+        TRY(file->write_until_depleted(json.bytes()));
+        return {};
+    }();
+    if (result.is_error())
+        warnln("Failed to write trace file: {}", result.error());
+}
+
+}
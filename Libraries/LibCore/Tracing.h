@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Error.h>
+#include <AK/Forward.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+
+namespace Core::Trace {
+
+// Scoped trace events for answering "where did this frame go?" in builds shipped to users.
+//
+// Recording is off by default and costs a single relaxed atomic load per scope while disabled.
+// When enabled, completed scopes are stored in a fixed-size per-process ring buffer that
+// overwrites its oldest entries, and can be serialized in the Chrome trace event format, which
+// both Perfetto and chrome://tracing load.
+//
+// Setting the LADYBIRD_TRACE_FILE environment variable enables recording at process startup and
+// writes the buffer to "<value>.<pid>" when the process exits.
+
+struct Event {
+    // Must point to a string with static storage duration; events only store the pointer.
+    char const* name { nullptr };
+    u64 start_in_nanoseconds { 0 };
+    u64 duration_in_nanoseconds { 0 };
+    u32 thread_id { 0 };
+};
+
+void enable();
+void disable();
+
+void record_event(char const* name, u64 start_in_nanoseconds, u64 duration_in_nanoseconds);
+
+// Returns the recorded events in chronological order and clears the buffer.
+Vector<Event> take_events();
+
+// Serializes the recorded events as a Chrome trace event JSON document, clearing the buffer.
+ErrorOr<String> export_chrome_trace();
+
+extern Atomic<bool> g_tracing_enabled;
+
+ALWAYS_INLINE bool is_enabled()
+{
+    return g_tracing_enabled.load(AK::MemoryOrder::memory_order_relaxed);
+}
+
+class ScopedEvent {
+    AK_MAKE_NONCOPYABLE(ScopedEvent);
+    AK_MAKE_NONMOVABLE(ScopedEvent);
+
+public:
+    ALWAYS_INLINE explicit ScopedEvent(char const* name)
+    {
+        if (is_enabled()) [[unlikely]] {
+            m_name = name;
+            m_start_in_nanoseconds = static_cast<u64>(MonotonicTime::now().nanoseconds());
+        }
+    }
+
+    ALWAYS_INLINE ~ScopedEvent()
+    {
+        if (m_name) [[unlikely]] {
+            auto end_in_nanoseconds = static_cast<u64>(MonotonicTime::now().nanoseconds());
+            record_event(m_name, m_start_in_nanoseconds, end_in_nanoseconds - m_start_in_nanoseconds);
+        }
+    }
+
+private:
+    char const* m_name { nullptr };
+    u64 m_start_in_nanoseconds { 0 };
+};
+
+}
+
+#define CORE_TRACE_CONCATENATE_IMPL(a, b) a##b
+#define CORE_TRACE_CONCATENATE(a, b) CORE_TRACE_CONCATENATE_IMPL(a, b)
+
+// Records the time spent in the enclosing scope under the given name, which must be a string literal.
+#define TRACE_SCOPE(name) ::Core::Trace::ScopedEvent const CORE_TRACE_CONCATENATE(trace_scoped_event_, __LINE__) { name }
@@ -66,6 +66,11 @@ public:
     {
     }
 
+    struct RecordWithExpiration {
+        Messages::ResourceRecord record;
+        Optional<AK::UnixDateTime> expiration;
+    };
+
     Vector<Variant<IPv4Address, IPv6Address>> cached_addresses() const
     {
         Vector<Variant<IPv4Address, IPv6Address>> result;
@@ -101,7 +106,12 @@ public:
             }
         }
 
-        if (m_cached_records.is_empty() && m_request_done)
+        if (m_negative_expiration.has_value() && *m_negative_expiration < now) {
+            dbgln_if(DNS_DEBUG, "DNS: Negative cache entry for {} expired", m_name.to_string());
+            m_negative_expiration.clear();
+        }
+
+        if (m_cached_records.is_empty() && !m_negative_expiration.has_value() && m_request_done)
             m_valid = false;
     }
 
@@ -112,6 +122,20 @@ public:
         m_cached_records.append({ move(record), move(expiration) });
     }
 
+    // RFC 2308: Cache the absence of records, so repeated lookups for missing names don't go back
+    //           to the network until the negative entry expires.
+    void set_negative(AK::UnixDateTime expiration)
+    {
+        m_valid = true;
+        m_negative_expiration = expiration;
+    }
+    bool is_negative() const { return m_negative_expiration.has_value(); }
+
+    Vector<RecordWithExpiration> const& cached_records_with_expiration() const { return m_cached_records; }
+
+    AK::UnixDateTime last_accessed() const { return m_last_accessed; }
+    void did_access() const { m_last_accessed = AK::UnixDateTime::now(); }
+
     Vector<Messages::ResourceRecord> records() const
     {
         Vector<Messages::ResourceRecord> result;
@@ -190,11 +214,8 @@ private:
     bool m_dnssec_validated { false };
     bool m_being_dnssec_validated { false };
     Messages::DomainName m_name;
-
-    struct RecordWithExpiration {
-        Messages::ResourceRecord record;
-        Optional<AK::UnixDateTime> expiration;
-    };
+    Optional<AK::UnixDateTime> m_negative_expiration;
+    mutable AK::UnixDateTime m_last_accessed { AK::UnixDateTime::now() };
 
     Vector<RecordWithExpiration> m_cached_records;
     HashTable<Messages::ResourceType> m_desired_types;
@@ -299,6 +320,17 @@ public:
                 return {};
 
             auto& result = *it->value;
+            result.did_access();
+
+            if (result.is_negative()) {
+                // A negative entry only answers for the types the original lookup asked about.
+                for (auto const& type : desired_types) {
+                    if (!result.has_record_of_type(type, true))
+                        return {};
+                }
+                return result;
+            }
+
             for (auto const& type : desired_types) {
                 if (!result.has_record_of_type(type))
                     return {};
@@ -606,6 +638,76 @@ public:
         return promise;
     }
 
+    // Serializes all still-valid cached address records in a simple line-based format, so a client
+    // can reload them with load_cache() after a restart instead of re-resolving every host.
+    ErrorOr<void> save_cache(Stream& stream) const
+    {
+        return m_cache.with_read_locked([&](auto& cache) -> ErrorOr<void> {
+            for (auto& entry : cache) {
+                auto& result = *entry.value;
+                if (!result.is_done() || result.is_negative())
+                    continue;
+                for (auto& record : result.cached_records_with_expiration()) {
+                    if (!record.expiration.has_value())
+                        continue;
+                    auto line = record.record.record.visit(
+                        [&](Messages::Records::A const& a) -> Optional<String> {
+                            return MUST(String::formatted("{} A {} {}\n", entry.key, record.expiration->seconds_since_epoch(), a.address));
+                        },
+                        [&](Messages::Records::AAAA const& aaaa) -> Optional<String> {
+                            return MUST(String::formatted("{} AAAA {} {}\n", entry.key, record.expiration->seconds_since_epoch(), aaaa.address));
+                        },
+                        [](auto const&) -> Optional<String> { return {}; });
+                    if (line.has_value())
+                        TRY(stream.write_until_depleted(line->bytes()));
+                }
+            }
+            return {};
+        });
+    }
+
+    ErrorOr<void> load_cache(Stream& stream)
+    {
+        auto now = AK::UnixDateTime::now();
+        auto contents = TRY(stream.read_until_eof());
+        m_cache.with_write_locked([&](auto& cache) {
+            StringView { contents }.for_each_split_view('\n', SplitBehavior::Nothing, [&](StringView line) {
+                auto parts = line.split_view(' ');
+                if (parts.size() != 4)
+                    return;
+
+                auto expiration_seconds = parts[2].to_number<i64>();
+                if (!expiration_seconds.has_value())
+                    return;
+                auto expiration = AK::UnixDateTime::from_seconds_since_epoch(*expiration_seconds);
+                if (expiration <= now)
+                    return;
+                auto ttl = static_cast<u32>((expiration - now).to_seconds());
+
+                Optional<Messages::ResourceRecord> record;
+                if (parts[1] == "A"sv) {
+                    if (auto address = IPv4Address::from_string(parts[3]); address.has_value())
+                        record = Messages::ResourceRecord { .name = {}, .type = Messages::ResourceType::A, .class_ = Messages::Class::IN, .ttl = ttl, .record = Messages::Records::A { *address }, .raw = {} };
+                } else if (parts[1] == "AAAA"sv) {
+                    if (auto address = IPv6Address::from_string(parts[3]); address.has_value())
+                        record = Messages::ResourceRecord { .name = {}, .type = Messages::ResourceType::AAAA, .class_ = Messages::Class::IN, .ttl = ttl, .record = Messages::Records::AAAA { *address }, .raw = {} };
+                }
+                if (!record.has_value())
+                    return;
+
+                auto& result = cache.ensure(parts[0], [&] {
+                    auto ptr = make_ref_counted<LookupResult>(Messages::DomainName::from_string(parts[0]));
+                    ptr->will_add_record_of_type(Messages::ResourceType::A);
+                    ptr->will_add_record_of_type(Messages::ResourceType::AAAA);
+                    ptr->finished_request();
+                    return ptr;
+                });
+                result->add_record(record.release_value());
+            });
+        });
+        return {};
+    }
+
 private:
     ErrorOr<Messages::Message> parse_one_message()
     {
@@ -675,6 +777,17 @@ private:
                 for (auto& record : message.answers)
                     result->add_record(move(record));
 
+                if (message.answers.is_empty()) {
+                    // RFC 2308: Negatively cache empty responses for the SOA minimum TTL from the
+                    //           authority section, so missing names aren't re-queried every time.
+                    u32 negative_ttl = 60;
+                    for (auto& authority : message.authorities) {
+                        if (authority.type == Messages::ResourceType::SOA)
+                            negative_ttl = min(authority.record.get<Messages::Records::SOA>().minimum, authority.ttl);
+                    }
+                    result->set_negative(AK::UnixDateTime::now() + AK::Duration::from_seconds(min(negative_ttl, 3600u)));
+                }
+
                 result->finished_request();
                 lookup->promise->resolve(*result);
                 lookups->remove(message.header.id);
@@ -1198,9 +1311,41 @@ private:
             }
             for (auto const& key : to_remove)
                 cache.remove(key);
+
+            if (cache.size() <= max_cache_entries)
+                return;
+
+            // Keep the cache bounded by evicting the least recently used completed entries.
+            struct KeyAndLastAccess {
+                ByteString key;
+                AK::UnixDateTime last_accessed;
+            };
+            Vector<KeyAndLastAccess> candidates;
+            for (auto& entry : cache) {
+                if (!entry.value->is_done())
+                    continue;
+                // Statically configured entries (like localhost) never expire; keep them around.
+                auto has_static_record = false;
+                for (auto& record : entry.value->cached_records_with_expiration()) {
+                    if (!record.expiration.has_value()) {
+                        has_static_record = true;
+                        break;
+                    }
+                }
+                if (!has_static_record)
+                    candidates.append({ entry.key, entry.value->last_accessed() });
+            }
+            quick_sort(candidates, [](auto const& a, auto const& b) { return a.last_accessed < b.last_accessed; });
+            for (auto& candidate : candidates) {
+                if (cache.size() <= max_cache_entries)
+                    break;
+                cache.remove(candidate.key);
+            }
         });
     }
 
+    static constexpr size_t max_cache_entries = 1024;
+
     Threading::RWLockProtected<HashMap<ByteString, NonnullRefPtr<LookupResult>>> m_cache;
     Threading::RWLockProtected<NonnullOwnPtr<RedBlackTree<u16, PendingLookup>>> m_pending_lookups;
     Threading::RWLockProtected<Optional<MaybeOwned<Core::Socket>>> m_socket;
@@ -668,13 +668,27 @@ Optional<JsonObject const&> WalkerActor::remove_node(JsonObject const& node)
 
 void WalkerActor::new_dom_node_mutation(WebView::Mutation mutation)
 {
-    auto serialized_target = JsonValue::from_string(mutation.serialized_target);
-    if (serialized_target.is_error() || !serialized_target.value().is_object()) {
-        dbgln_if(DEVTOOLS_DEBUG, "Unable to parse serialized target as JSON object: {}", serialized_target.error());
-        return;
-    }
+    // NOTE: Attribute and character data mutations arrive without a serialized target, and are
+    //       applied to the cached DOM tree as deltas. Only child list mutations carry the target's
+    //       serialized subtree, as they are the only ones that introduce unknown nodes.
+    auto applied_mutation_to_tree = mutation.mutation.visit(
+        [&](WebView::AttributeMutation const& attribute_mutation) {
+            return apply_attribute_mutation(mutation.target, attribute_mutation);
+        },
+        [&](WebView::CharacterDataMutation const& character_data_mutation) {
+            return apply_character_data_mutation(mutation.target, character_data_mutation);
+        },
+        [&](WebView::ChildListMutation const&) {
+            auto serialized_target = JsonValue::from_string(mutation.serialized_target);
+            if (serialized_target.is_error() || !serialized_target.value().is_object()) {
+                dbgln_if(DEVTOOLS_DEBUG, "Unable to parse serialized target as JSON object: {}", serialized_target.error());
+                return false;
+            }
 
-    if (!replace_node_in_tree(move(serialized_target.release_value().as_object()))) {
+            return replace_node_in_tree(move(serialized_target.release_value().as_object()));
+        });
+
+    if (!applied_mutation_to_tree) {
         dbgln_if(DEVTOOLS_DEBUG, "Unable to apply mutation to DOM tree");
         return;
     }
@@ -742,6 +756,58 @@ JsonValue WalkerActor::serialize_mutations()
     return mutations;
 }
 
+JsonObject* WalkerActor::mutable_dom_node_for_id(Web::UniqueNodeID node_id)
+{
+    auto actor = m_dom_node_id_to_actor_map.get(node_id);
+    if (!actor.has_value())
+        return nullptr;
+
+    auto node = m_actor_to_dom_node_map.get(*actor);
+    if (!node.has_value() || !node.value())
+        return nullptr;
+
+    return const_cast<JsonObject*>(node.value());
+}
+
+bool WalkerActor::apply_attribute_mutation(Web::UniqueNodeID target, WebView::AttributeMutation const& mutation)
+{
+    auto* node = mutable_dom_node_for_id(target);
+    if (!node)
+        return false;
+
+    auto attributes = node->get_object("attributes"sv);
+    if (!attributes.has_value()) {
+        if (!mutation.new_value.has_value())
+            return true;
+
+        JsonObject added_attribute;
+        added_attribute.set(mutation.attribute_name, *mutation.new_value);
+        node->set("attributes"sv, move(added_attribute));
+        return true;
+    }
+
+    if (mutation.new_value.has_value())
+        attributes->set(mutation.attribute_name, *mutation.new_value);
+    else
+        attributes->remove(mutation.attribute_name);
+    return true;
+}
+
+bool WalkerActor::apply_character_data_mutation(Web::UniqueNodeID target, WebView::CharacterDataMutation const& mutation)
+{
+    auto* node = mutable_dom_node_for_id(target);
+    if (!node)
+        return false;
+
+    // NOTE: Text nodes serialize their contents as "text", comment nodes as "data". Other character
+    //       data (e.g. processing instructions) serialize neither, so there is nothing to update.
+    if (node->has("text"sv))
+        node->set("text"sv, mutation.new_value);
+    else if (node->has("data"sv))
+        node->set("data"sv, mutation.new_value);
+    return true;
+}
+
 bool WalkerActor::replace_node_in_tree(JsonObject replacement)
 {
     auto const& actor = actor_for_node(replacement);
@@ -47,6 +47,10 @@ private:
     void new_dom_node_mutation(WebView::Mutation);
     JsonValue serialize_mutations();
 
+    JsonObject* mutable_dom_node_for_id(Web::UniqueNodeID);
+    bool apply_attribute_mutation(Web::UniqueNodeID target, WebView::AttributeMutation const&);
+    bool apply_character_data_mutation(Web::UniqueNodeID target, WebView::CharacterDataMutation const&);
+
     bool replace_node_in_tree(JsonObject replacement);
 
     void populate_dom_tree_cache();
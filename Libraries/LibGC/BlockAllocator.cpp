@@ -34,24 +34,42 @@ BlockAllocator::~BlockAllocator()
 {
     for (auto* block : m_blocks) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+        release_block(block);
+    }
+    for (auto* block : m_deferred_blocks) {
+        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+        release_block(block);
+    }
+}
+
+void BlockAllocator::release_block(void* block) const
+{
 #if !defined(AK_OS_WINDOWS)
-        if (munmap(block, HeapBlock::block_size) < 0) {
-            perror("munmap");
-            VERIFY_NOT_REACHED();
-        }
+    if (munmap(block, HeapBlock::block_size) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
 #else
-        if (!VirtualFree(block, 0, MEM_RELEASE)) {
-            warnln("{}", Error::from_windows_error());
-            VERIFY_NOT_REACHED();
-        }
-#endif
+    if (!VirtualFree(block, 0, MEM_RELEASE)) {
+        warnln("{}", Error::from_windows_error());
+        VERIFY_NOT_REACHED();
     }
+#endif
 }
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
+    // Prefer blocks whose pages were never discarded; reusing one avoids refaulting its pages.
+    // To reduce predictability, take a random block from the chosen cache.
+    if (!m_deferred_blocks.is_empty()) {
+        size_t random_index = get_random_uniform(m_deferred_blocks.size());
+        auto* block = m_deferred_blocks.unstable_take(random_index);
+        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+        LSAN_REGISTER_ROOT_REGION(block, HeapBlock::block_size);
+        return block;
+    }
+
     if (!m_blocks.is_empty()) {
-        // To reduce predictability, take a random block from the cache.
         size_t random_index = get_random_uniform(m_blocks.size());
         auto* block = m_blocks.unstable_take(random_index);
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
@@ -74,6 +92,33 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
+    if (m_blocks.size() + m_deferred_blocks.size() >= max_cached_blocks) {
+        LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+        release_block(block);
+        return;
+    }
+
+    // NOTE: The block's pages are deliberately not discarded here; this runs during the sweep
+    //       phase of a collection, and the discard syscalls were a sizable chunk of the pause.
+    //       See release_deferred_blocks().
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    m_deferred_blocks.append(block);
+}
+
+void BlockAllocator::release_deferred_blocks()
+{
+    for (auto* block : m_deferred_blocks) {
+        ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::block_size);
+        discard_block_contents(block);
+        ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+        m_blocks.append(block);
+    }
+    m_deferred_blocks.clear();
+}
+
+void BlockAllocator::discard_block_contents([[maybe_unused]] void* block) const
+{
 #if defined(AK_OS_WINDOWS)
     DWORD ret = DiscardVirtualMemory(block, HeapBlock::block_size);
     if (ret != ERROR_SUCCESS) {
@@ -101,10 +146,6 @@ void BlockAllocator::deallocate_block(void* block)
         VERIFY_NOT_REACHED();
     }
 #endif
-
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    m_blocks.append(block);
 }
 
 }
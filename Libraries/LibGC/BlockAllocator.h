@@ -18,8 +18,23 @@ public:
 
     void* allocate_block(char const* name);
     void deallocate_block(void*);
+    void release_deferred_blocks();
 
 private:
+    // NOTE: Caching a bounded number of blocks keeps allocation cheap while the heap churns;
+    //       anything beyond that is returned to the OS so a long-lived process doesn't hold on
+    //       to address space for peak heap sizes it reached hours ago.
+    static constexpr size_t max_cached_blocks = 64;
+
+    void release_block(void*) const;
+    void discard_block_contents(void*) const;
+
+    // Cached blocks that still hold their physical pages. Discarding pages is a syscall per
+    // block and would otherwise happen inside the GC pause, so it's deferred: a deferred block
+    // that gets recycled before the next collection skips both the syscall and the page faults
+    // of touching freshly provided pages, and whatever is left over is discarded in bulk at
+    // the start of the next collection (see Heap::collect_garbage).
+    Vector<void*> m_deferred_blocks;
     Vector<void*> m_blocks;
 };
 
@@ -44,8 +44,12 @@ class GC_API Cell {
 public:
     virtual ~Cell() = default;
 
-    bool is_marked() const { return m_mark; }
-    void set_marked(bool b) { m_mark = b; }
+    // Mark state is versioned: a cell is marked if its mark version matches the heap's current
+    // mark version. This way, sweeping doesn't have to touch every surviving cell just to clear
+    // its mark bit; bumping the heap's version unmarks the whole heap at once.
+    bool is_marked(u8 mark_version) const { return m_mark_version == mark_version; }
+    void set_marked(u8 mark_version) { m_mark_version = mark_version; }
+    void clear_mark() { m_mark_version = 0; }
 
     enum class State : bool {
         Live,
@@ -188,7 +192,8 @@ protected:
     void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
 
 private:
-    bool m_mark { false };
+    // 0 is reserved for "never marked"; the heap's mark version never takes that value.
+    u8 m_mark_version { 0 };
     bool m_overrides_must_survive_garbage_collection { false };
     State m_state { State::Live };
 } SWIFT_UNSAFE_REFERENCE;
@@ -27,6 +27,7 @@ public:
     ~CellAllocator() = default;
 
     size_t cell_size() const { return m_cell_size; }
+    char const* class_name() const { return m_class_name; }
 
     Cell* allocate_cell(Heap&);
 
@@ -11,10 +11,13 @@
 #include <AK/HashTable.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
+#include <AK/NumericLimits.h>
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/StackInfo.h>
 #include <AK/TemporaryChange.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
 #include <LibGC/HeapBlock.h>
@@ -113,14 +116,11 @@ static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& a
 
 class GraphConstructorVisitor final : public Cell::Visitor {
 public:
-    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -225,22 +225,82 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    auto all_live_heap_blocks = gather_live_heap_blocks();
     HashMap<Cell*, HeapRoot> roots;
-    gather_roots(roots);
-    GraphConstructorVisitor visitor(*this, roots);
+    gather_roots(roots, all_live_heap_blocks);
+    GraphConstructorVisitor visitor(*this, roots, all_live_heap_blocks);
     visitor.visit_all_cells();
     return visitor.dump();
 }
 
+AK::JsonObject Heap::heap_statistics()
+{
+    struct AllocatorStatistics {
+        String name;
+        size_t cell_size { 0 };
+        size_t live_cell_count { 0 };
+        size_t block_count { 0 };
+    };
+    Vector<AllocatorStatistics> per_allocator;
+
+    for (auto& allocator : m_all_cell_allocators) {
+        AllocatorStatistics statistics;
+        if (auto const* class_name = allocator.class_name())
+            statistics.name = MUST(String::from_utf8(StringView { class_name, strlen(class_name) }));
+        else
+            statistics.name = MUST(String::formatted("(cells of {} bytes or less)", allocator.cell_size()));
+        statistics.cell_size = allocator.cell_size();
+        allocator.for_each_block([&](auto& block) {
+            statistics.live_cell_count += block.live_cell_count();
+            ++statistics.block_count;
+            return IterationDecision::Continue;
+        });
+        if (statistics.block_count > 0)
+            per_allocator.append(move(statistics));
+    }
+
+    quick_sort(per_allocator, [](auto const& a, auto const& b) {
+        return a.live_cell_count * a.cell_size > b.live_cell_count * b.cell_size;
+    });
+
+    size_t total_live_cell_count = 0;
+    size_t total_live_cell_bytes = 0;
+    size_t total_block_bytes = 0;
+
+    AK::JsonArray allocators;
+    for (auto const& statistics : per_allocator) {
+        AK::JsonObject entry;
+        entry.set("name"sv, statistics.name);
+        entry.set("cell_size"sv, statistics.cell_size);
+        entry.set("live_cell_count"sv, statistics.live_cell_count);
+        entry.set("live_cell_bytes"sv, statistics.live_cell_count * statistics.cell_size);
+        entry.set("block_bytes"sv, statistics.block_count * HeapBlock::block_size);
+        allocators.must_append(move(entry));
+
+        total_live_cell_count += statistics.live_cell_count;
+        total_live_cell_bytes += statistics.live_cell_count * statistics.cell_size;
+        total_block_bytes += statistics.block_count * HeapBlock::block_size;
+    }
+
+    AK::JsonObject stats;
+    stats.set("live_cell_count"sv, total_live_cell_count);
+    stats.set("live_cell_bytes"sv, total_live_cell_bytes);
+    stats.set("block_bytes"sv, total_block_bytes);
+    stats.set("allocators"sv, move(allocators));
+    return stats;
+}
+
 void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
+    TRACE_SCOPE("Heap::collect_garbage");
+
     VERIFY(!m_collecting_garbage);
 
     {
@@ -250,14 +310,28 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
         if (print_report)
             collection_measurement_timer.start();
 
+        if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+            m_should_gc_when_deferral_ends = true;
+            return;
+        }
+
+        // Return the physical pages of blocks that emptied during the previous collection and
+        // weren't recycled since. Doing this here rather than in the sweep phase keeps the
+        // discard syscalls for recycled blocks out of the pause entirely.
+        for (auto& allocator : m_all_cell_allocators)
+            allocator.block_allocator().release_deferred_blocks();
+
+        // Bumping the mark version unmarks every cell in the heap at once.
+        // (Version 0 is reserved for "never marked", so skip it on wraparound.)
+        m_mark_version = m_mark_version == NumericLimits<u8>::max() ? 1 : m_mark_version + 1;
+
         if (collection_type == CollectionType::CollectGarbage) {
-            if (m_gc_deferrals) {
-                m_should_gc_when_deferral_ends = true;
-                return;
-            }
+            // Gather the set of live heap blocks once up front, so root gathering and marking
+            // don't each have to walk every allocator's block lists all over again.
+            auto all_live_heap_blocks = gather_live_heap_blocks();
             HashMap<Cell*, HeapRoot> roots;
-            gather_roots(roots);
-            mark_live_cells(roots);
+            gather_roots(roots, all_live_heap_blocks);
+            mark_live_cells(roots, all_live_heap_blocks);
         }
         finalize_unmarked_cells();
         sweep_weak_blocks();
@@ -274,10 +348,20 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
     m_post_gc_tasks.append(move(task));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
+HashTable<HeapBlock*> Heap::gather_live_heap_blocks()
+{
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.set(&block);
+        return IterationDecision::Continue;
+    });
+    return all_live_heap_blocks;
+}
+
+void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     m_gather_embedder_roots(roots);
-    gather_conservative_roots(roots);
+    gather_conservative_roots(roots, all_live_heap_blocks);
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -317,7 +401,7 @@ void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, Fl
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     FlatPtr dummy;
 
@@ -350,12 +434,6 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
     for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
@@ -368,14 +446,12 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_mark_version(heap.mark_version())
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
 
         for (auto* root : roots.keys()) {
             visit(root);
@@ -384,11 +460,12 @@ public:
 
     virtual void visit_impl(Cell& cell) override
     {
-        if (cell.is_marked())
+        if (cell.is_marked(m_mark_version))
             return;
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
-        cell.set_marked(true);
+        cell.set_marked(m_mark_version);
+        HeapBlock::from_cell(&cell)->did_mark_cell();
         m_work_queue.append(cell);
     }
 
@@ -401,11 +478,12 @@ public:
             add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
 
         for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
+            if (cell->is_marked(m_mark_version))
                 return;
             if (cell->state() != Cell::State::Live)
                 return;
-            cell->set_marked(true);
+            cell->set_marked(m_mark_version);
+            HeapBlock::from_cell(cell)->did_mark_cell();
             m_work_queue.append(*cell);
         });
     }
@@ -419,26 +497,30 @@ public:
 
 private:
     Heap& m_heap;
+    u8 m_mark_version { 0 };
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots);
+    MarkingVisitor visitor(*this, roots, all_live_heap_blocks);
 
     visitor.mark_all_live_cells();
 
-    for (auto& inverse_root : m_uprooted_cells)
-        inverse_root->set_marked(false);
+    for (auto& inverse_root : m_uprooted_cells) {
+        if (inverse_root->is_marked(m_mark_version))
+            HeapBlock::from_cell(inverse_root.ptr())->did_unmark_cell();
+        inverse_root->clear_mark();
+    }
 
     for_each_block([&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
+            if (!cell->is_marked(m_mark_version) && cell_must_survive_garbage_collection(*cell))
                 cell->visit_edges(visitor);
         });
         return IterationDecision::Continue;
@@ -457,8 +539,12 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
 void Heap::finalize_unmarked_cells()
 {
     for_each_block([&](auto& block) {
-        block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
-            if (!cell->is_marked())
+        // Skip blocks that contain no garbage; this keeps the pause proportional
+        // to the amount of garbage rather than the size of the heap.
+        if (!block.has_unmarked_live_cells())
+            return IterationDecision::Continue;
+        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+            if (!cell->is_marked(m_mark_version))
                 cell->finalize();
         });
         return IterationDecision::Continue;
@@ -468,11 +554,11 @@ void Heap::finalize_unmarked_cells()
 void Heap::sweep_weak_blocks()
 {
     for (auto& weak_block : m_usable_weak_blocks) {
-        weak_block.sweep();
+        weak_block.sweep(m_mark_version);
     }
     Vector<WeakBlock&> now_usable_weak_blocks;
     for (auto& weak_block : m_full_weak_blocks) {
-        weak_block.sweep();
+        weak_block.sweep(m_mark_version);
         if (weak_block.can_allocate())
             now_usable_weak_blocks.append(weak_block);
     }
@@ -493,21 +579,32 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
+        // Skip blocks with no garbage in them. Note that mark bits don't need clearing,
+        // since bumping the heap's mark version at the start of the next collection
+        // unmarks everything at once.
+        if (!block.has_unmarked_live_cells()) {
+            live_cells += block.live_cell_count();
+            live_cell_bytes += block.live_cell_count() * block.cell_size();
+            block.reset_marked_cell_count();
+            if (block.live_cell_count() == 0)
+                empty_blocks.append(&block);
+            return IterationDecision::Continue;
+        }
         bool block_has_live_cells = false;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked()) {
+            if (!cell->is_marked(m_mark_version)) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
-                cell->set_marked(false);
                 block_has_live_cells = true;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
+        block.reset_marked_cell_count();
         if (!block_has_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
@@ -8,6 +8,7 @@
 
 #include <AK/Badge.h>
 #include <AK/Function.h>
+#include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
@@ -56,6 +57,11 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Live cell counts and byte usage per cell allocator, sorted by usage. Type-isolated
+    // allocators are reported under their class name; the shared size-based allocators are
+    // reported under their size class.
+    AK::JsonObject heap_statistics();
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -78,8 +84,23 @@ public:
 
     void uproot_cell(Cell* cell);
 
+    // Total size of all heap blocks, i.e. the memory this heap has reserved from the system.
+    size_t memory_usage()
+    {
+        size_t usage = 0;
+        for_each_block([&](auto&) {
+            usage += HeapBlock::block_size;
+            return IterationDecision::Continue;
+        });
+        return usage;
+    }
+
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
 
+    // The current mark version. Cells whose mark version matches are considered marked;
+    // see Cell::is_marked().
+    u8 mark_version() const { return m_mark_version; }
+
     void enqueue_post_gc_task(AK::Function<void()>);
 
     WeakImpl* create_weak_impl(void*);
@@ -110,10 +131,11 @@ private:
     void will_allocate(size_t);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
+    [[nodiscard]] HashTable<HeapBlock*> gather_live_heap_blocks();
+    void gather_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks);
+    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, HashTable<HeapBlock*> const& all_live_heap_blocks);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
     void sweep_weak_blocks();
@@ -159,6 +181,7 @@ private:
     bool m_should_gc_when_deferral_ends { false };
 
     bool m_collecting_garbage { false };
+    u8 m_mark_version { 0 };
     StackInfo m_stack_info;
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
 
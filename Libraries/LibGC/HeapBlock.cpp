@@ -42,8 +42,9 @@ void HeapBlock::deallocate(Cell* cell)
     VERIFY(is_valid_cell_pointer(cell));
     VERIFY(!m_freelist || is_valid_cell_pointer(m_freelist));
     VERIFY(cell->state() == Cell::State::Live);
-    VERIFY(!cell->is_marked());
+    VERIFY(!cell->is_marked(heap().mark_version()));
 
+    --m_live_cell_count;
     cell->~Cell();
     auto* freelist_entry = new (cell) FreelistEntry();
     freelist_entry->set_state(Cell::State::Dead);
@@ -43,11 +43,22 @@ public:
         }
 
         if (allocated_cell) {
+            ++m_live_cell_count;
             ASAN_UNPOISON_MEMORY_REGION(allocated_cell, m_cell_size);
         }
         return allocated_cell;
     }
 
+    // Live/marked counters let the collector skip blocks that contain no garbage
+    // without iterating their cells.
+    size_t live_cell_count() const { return m_live_cell_count; }
+    size_t marked_cell_count() const { return m_marked_cell_count; }
+    bool has_unmarked_live_cells() const { return m_marked_cell_count != m_live_cell_count; }
+
+    void did_mark_cell() { ++m_marked_cell_count; }
+    void did_unmark_cell() { --m_marked_cell_count; }
+    void reset_marked_cell_count() { m_marked_cell_count = 0; }
+
     void deallocate(Cell*);
 
     template<typename Callback>
@@ -111,6 +122,8 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count { 0 };
+    size_t m_marked_cell_count { 0 };
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
@@ -60,14 +60,14 @@ void WeakBlock::deallocate(WeakImpl* impl)
     m_freelist = impl;
 }
 
-void WeakBlock::sweep()
+void WeakBlock::sweep(u8 mark_version)
 {
     for (size_t i = 0; i < IMPL_COUNT; ++i) {
         auto& impl = m_impls[i];
         if (impl.state() == WeakImpl::State::Freelist)
             continue;
         auto* cell = static_cast<Cell*>(impl.ptr());
-        if (!cell || !cell->is_marked())
+        if (!cell || !cell->is_marked(mark_version))
             impl.set_ptr({}, nullptr);
         if (impl.ref_count() == 0)
             deallocate(&impl);
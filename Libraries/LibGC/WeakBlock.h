@@ -23,7 +23,7 @@ public:
 
     bool can_allocate() const { return m_freelist != nullptr; }
 
-    void sweep();
+    void sweep(u8 mark_version);
 
 private:
     WeakBlock();
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Checked.h>
+#include <AK/Memory.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/BitmapSequence.h>
@@ -30,6 +31,7 @@ ErrorOr<void> encode(Encoder& encoder, Gfx::BitmapMetadata const& metadata)
     TRY(encoder.encode(static_cast<u32>(metadata.alpha_type)));
     TRY(encoder.encode(metadata.size_in_bytes));
     TRY(encoder.encode(metadata.size));
+    TRY(encoder.encode(metadata.is_repeat_of_previous));
 
     return {};
 }
@@ -49,8 +51,9 @@ ErrorOr<Gfx::BitmapMetadata> decode(Decoder& decoder)
 
     auto size_in_bytes = TRY(decoder.decode<size_t>());
     auto size = TRY(decoder.decode<Gfx::IntSize>());
+    auto is_repeat_of_previous = TRY(decoder.decode<bool>());
 
-    return Gfx::BitmapMetadata { format, alpha_type, size, size_in_bytes };
+    return Gfx::BitmapMetadata { format, alpha_type, size, size_in_bytes, is_repeat_of_previous };
 }
 
 template<>
@@ -58,17 +61,35 @@ ErrorOr<void> encode(Encoder& encoder, Gfx::BitmapSequence const& bitmap_sequenc
 {
     auto const& bitmaps = bitmap_sequence.bitmaps;
 
+    // If the producer already collated the frames into a single buffer (as the ImageDecoder
+    // service does), we can ship that buffer as-is; repeat detection is skipped in that case
+    // since the buffer stores every frame.
+    bool const is_pre_collated = bitmap_sequence.collated_buffer.is_valid();
+
     Vector<Optional<Gfx::BitmapMetadata>> metadata;
     metadata.ensure_capacity(bitmaps.size());
 
     size_t total_buffer_size = 0;
+    Gfx::Bitmap const* previous_bitmap = nullptr;
 
     for (auto const& bitmap_option : bitmaps) {
         Optional<Gfx::BitmapMetadata> data = {};
 
         if (bitmap_option) {
             data = get_metadata(*bitmap_option);
-            total_buffer_size += data->size_in_bytes;
+
+            // OPTIMIZATION: Animations frequently pause on a frame or repeat one verbatim, so frames
+            //               identical to the previously shipped one are only transmitted once.
+            if (!is_pre_collated && previous_bitmap
+                && previous_bitmap->format() == bitmap_option->format()
+                && previous_bitmap->alpha_type() == bitmap_option->alpha_type()
+                && previous_bitmap->size() == bitmap_option->size()
+                && memcmp(previous_bitmap->scanline(0), bitmap_option->scanline(0), bitmap_option->size_in_bytes()) == 0) {
+                data->is_repeat_of_previous = true;
+            } else {
+                total_buffer_size += data->size_in_bytes;
+                previous_bitmap = bitmap_option.ptr();
+            }
         }
 
         metadata.unchecked_append(data);
@@ -79,13 +100,21 @@ ErrorOr<void> encode(Encoder& encoder, Gfx::BitmapSequence const& bitmap_sequenc
     TRY(encoder.encode(total_buffer_size));
 
     if (total_buffer_size > 0) {
+        // OPTIMIZATION: Ship a pre-collated buffer without copying each frame into a fresh one.
+        if (is_pre_collated) {
+            VERIFY(total_buffer_size <= bitmap_sequence.collated_buffer.size());
+            TRY(encoder.encode(bitmap_sequence.collated_buffer));
+            return {};
+        }
+
         // collate all of the bitmap data into one contiguous buffer
         auto collated_buffer = TRY(Core::AnonymousBuffer::create_with_size(total_buffer_size));
 
         Bytes buffer_bytes = { collated_buffer.data<u8>(), collated_buffer.size() };
         size_t write_offset = 0;
-        for (auto const& bitmap : bitmaps) {
-            if (bitmap) {
+        for (size_t i = 0; i < bitmaps.size(); ++i) {
+            auto const& bitmap = bitmaps[i];
+            if (bitmap && !metadata[i]->is_repeat_of_previous) {
                 buffer_bytes.overwrite(write_offset, bitmap->scanline(0), bitmap->size_in_bytes());
                 write_offset += bitmap->size_in_bytes();
             }
@@ -114,6 +143,7 @@ ErrorOr<Gfx::BitmapSequence> decode(Decoder& decoder)
 
     ReadonlyBytes bytes = ReadonlyBytes(collated_buffer.data<u8>(), collated_buffer.size());
     size_t bytes_read = 0;
+    RefPtr<Gfx::Bitmap> previous_bitmap;
 
     // sequentially read each valid bitmap's data from the collated buffer
     for (auto const& metadata_option : metadata_list) {
@@ -123,14 +153,31 @@ ErrorOr<Gfx::BitmapSequence> decode(Decoder& decoder)
             auto metadata = metadata_option.value();
             size_t size_in_bytes = metadata.size_in_bytes;
 
+            if (metadata.is_repeat_of_previous) {
+                if (!previous_bitmap)
+                    return Error::from_string_literal("IPC: Gfx::BitmapSequence repeated frame without a previous frame");
+                bitmaps.append(previous_bitmap);
+                continue;
+            }
+
             Checked<size_t> size_check = bytes_read;
             size_check += size_in_bytes;
             if (size_check.has_overflow() || size_check.value() > bytes.size())
                 return Error::from_string_literal("IPC: Invalid Gfx::BitmapSequence buffer data");
 
-            auto slice = bytes.slice(bytes_read, size_in_bytes);
+            auto pitch = Gfx::Bitmap::minimum_pitch(metadata.size.width(), metadata.format);
+            if (size_in_bytes == Gfx::Bitmap::size_in_bytes(pitch, metadata.size.height())) {
+                // OPTIMIZATION: Wrap the collated buffer instead of copying each frame out of it.
+                //               This keeps a many-frame animation backed by a single shared memory
+                //               region instead of duplicating every frame into private memory.
+                auto* frame_data = collated_buffer.data<u8>() + bytes_read;
+                bitmap = TRY(Gfx::Bitmap::create_wrapper(metadata.format, metadata.alpha_type, metadata.size, pitch, frame_data, [collated_buffer] { }));
+            } else {
+                auto slice = bytes.slice(bytes_read, size_in_bytes);
+                bitmap = TRY(Gfx::Bitmap::create_with_raw_data(metadata.format, metadata.alpha_type, slice, metadata.size));
+            }
             bytes_read += size_in_bytes;
-            bitmap = TRY(Gfx::Bitmap::create_with_raw_data(metadata.format, metadata.alpha_type, slice, metadata.size));
+            previous_bitmap = bitmap;
         }
 
         bitmaps.append(bitmap);
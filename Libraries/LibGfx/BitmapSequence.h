@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/RefPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Size.h>
 #include <LibIPC/Forward.h>
@@ -15,6 +16,11 @@ namespace Gfx {
 
 struct BitmapSequence {
     Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+
+    // When valid, holds the pixel data of every non-null bitmap, contiguously and in sequence
+    // order, with each bitmap wrapping its slice of the buffer. encode() then ships this buffer
+    // as-is instead of collating the frames into a fresh one.
+    Core::AnonymousBuffer collated_buffer;
 };
 
 // a struct to temporarily store bitmap fields before the buffer data is decoded
@@ -23,6 +29,9 @@ struct BitmapMetadata {
     Gfx::AlphaType alpha_type;
     Gfx::IntSize size;
     size_t size_in_bytes;
+    // Frames identical to the previously transmitted one are not shipped again; they
+    // reference the previous frame's pixel data instead.
+    bool is_repeat_of_previous { false };
 };
 
 }
@@ -87,7 +87,9 @@ public:
         // Before using the cache, make sure the features match! If they don't, clear the cache.
         ShapeFeatures features;
 
-        HashMap<Utf16String, hb_buffer_t*> map;
+        // NOTE: Entries are kept in least-recently-used order: a cache hit moves the entry to the
+        //       back of the map, and eviction pops from the front. (See get_or_create_shaping_buffer().)
+        OrderedHashMap<Utf16String, hb_buffer_t*> map;
         hb_buffer_t* single_ascii_character_map[128] { nullptr };
 
         ~ShapingCache();
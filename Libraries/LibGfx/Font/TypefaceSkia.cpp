@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/LsanSuppressions.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/TypefaceSkia.h>
@@ -106,10 +107,14 @@ TypefaceSkia::GlyphPage const& TypefaceSkia::glyph_page(size_t page_index) const
 void TypefaceSkia::populate_glyph_page(GlyphPage& glyph_page, size_t page_index) const
 {
     u32 first_code_point = page_index * GlyphPage::glyphs_per_page;
-    for (size_t i = 0; i < GlyphPage::glyphs_per_page; ++i) {
-        u32 code_point = first_code_point + i;
-        glyph_page.glyph_ids[i] = impl().skia_typeface->unicharToGlyph(code_point);
-    }
+    Array<SkUnichar, GlyphPage::glyphs_per_page> code_points;
+    for (size_t i = 0; i < GlyphPage::glyphs_per_page; ++i)
+        code_points[i] = static_cast<SkUnichar>(first_code_point + i);
+
+    // OPTIMIZATION: A single batched lookup, so the whole page costs one trip into Skia's character
+    //               map cache instead of one per code point.
+    static_assert(sizeof(glyph_page.glyph_ids[0]) == sizeof(SkGlyphID));
+    impl().skia_typeface->unicharsToGlyphs(code_points.data(), code_points.size(), glyph_page.glyph_ids);
 }
 
 FlyString const& TypefaceSkia::family() const
@@ -31,14 +31,14 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
 {
     struct jpeg_decompress_struct cinfo;
     ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
@@ -89,6 +89,20 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    // OPTIMIZATION: When the caller asks for a smaller size, have libjpeg scale during the IDCT
+    //               (it supports M/8 scaling factors) instead of decoding every pixel only for us
+    //               to hand an oversized bitmap to the compositor. We pick the smallest factor
+    //               that still covers the requested size, so quality never drops below it.
+    if (ideal_size.has_value() && ideal_size->width() > 0 && ideal_size->height() > 0) {
+        unsigned scale_num = 1;
+        while (scale_num < 8
+            && (static_cast<int>(cinfo.image_width * scale_num / 8) < ideal_size->width()
+                || static_cast<int>(cinfo.image_height * scale_num / 8) < ideal_size->height()))
+            ++scale_num;
+        cinfo.scale_num = scale_num;
+        cinfo.scale_denom = 8;
+    }
+
     jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
 
@@ -118,29 +132,27 @@ ErrorOr<void> JPEGLoadingContext::decode()
         // If image is in YCCK color space, we convert it to CMYK
         // and then CMYK code path will handle the rest
         if (cinfo.out_color_space == JCS_YCCK) {
+            // OPTIMIZATION: Fixed-point YCbCr -> RGB with the usual 16-bit scaled coefficients
+            //               (the same ones libjpeg uses); the per-pixel float math kept the
+            //               auto-vectorizer out of this loop.
             for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
+                auto* line = cmyk_bitmap->scanline(i);
                 for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = cmyk_bitmap->scanline(i)[j];
-
-                    auto y = cmyk.c;
-                    auto cb = cmyk.m;
-                    auto cr = cmyk.y;
-                    auto k = cmyk.k;
-
-                    int r = y + 1.402f * (cr - 128);
-                    int g = y - 0.3441f * (cb - 128) - 0.7141f * (cr - 128);
-                    int b = y + 1.772f * (cb - 128);
-
-                    y = clamp(r, 0, 255);
-                    cb = clamp(g, 0, 255);
-                    cr = clamp(b, 0, 255);
-                    k = 255 - k;
-
-                    cmyk_bitmap->scanline(i)[j] = {
-                        y,
-                        cb,
-                        cr,
-                        k,
+                    auto const& cmyk = line[j];
+
+                    int y = cmyk.c;
+                    int cb = cmyk.m - 128;
+                    int cr = cmyk.y - 128;
+
+                    int r = y + ((91881 * cr) >> 16);
+                    int g = y - ((22554 * cb + 46802 * cr) >> 16);
+                    int b = y + ((116130 * cb) >> 16);
+
+                    line[j] = {
+                        static_cast<u8>(clamp(r, 0, 255)),
+                        static_cast<u8>(clamp(g, 0, 255)),
+                        static_cast<u8>(clamp(b, 0, 255)),
+                        static_cast<u8>(255 - cmyk.k),
                     };
                 }
             }
@@ -152,18 +164,13 @@ ErrorOr<void> JPEGLoadingContext::decode()
             && (!cinfo.saw_Adobe_marker || cinfo.Adobe_transform == 0);
 
         if (should_invert_cmyk) {
+            // OPTIMIZATION: Inverting every component is a plain byte-wise XOR over the scanline,
+            //               which compiles down to vector XORs.
+            auto const line_length = cmyk_bitmap->size().width() * sizeof(CMYK);
             for (int i = 0; i < cmyk_bitmap->size().height(); ++i) {
-                auto* line = cmyk_bitmap->scanline(i);
-
-                for (int j = 0; j < cmyk_bitmap->size().width(); ++j) {
-                    auto const& cmyk = line[j];
-                    line[j] = {
-                        static_cast<u8>(255 - cmyk.c),
-                        static_cast<u8>(255 - cmyk.m),
-                        static_cast<u8>(255 - cmyk.y),
-                        static_cast<u8>(255 - cmyk.k),
-                    };
-                }
+                auto* line = reinterpret_cast<u8*>(cmyk_bitmap->scanline(i));
+                for (size_t j = 0; j < line_length; ++j)
+                    line[j] ^= 0xff;
             }
         }
     }
@@ -221,7 +228,7 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -229,8 +236,10 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
+    // NOTE: Whatever size the first decode happens at is what later calls get; we never decode
+    //       the same image twice.
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+        if (auto result = m_context->decode(ideal_size); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -231,11 +231,12 @@ ErrorOr<void> PNGLoadingContext::apply_exif_orientation()
         auto& img = img_frame_descriptor.image;
         auto oriented_bmp = TRY(ExifOrientedBitmap::create(orientation, img->size(), img->format()));
 
+        // NOTE: Copying raw ARGB32 values avoids a per-pixel round-trip through Color; source and
+        //       destination share the same format, so no conversion is needed.
         for (int y = 0; y < img->size().height(); ++y) {
-            for (int x = 0; x < img->size().width(); ++x) {
-                auto pixel = img->get_pixel(x, y);
-                oriented_bmp.set_pixel(x, y, pixel.value());
-            }
+            auto const* scanline = img->scanline(y);
+            for (int x = 0; x < img->size().width(); ++x)
+                oriented_bmp.set_pixel(x, y, scanline[x]);
         }
 
         img_frame_descriptor.image = oriented_bmp.bitmap();
@@ -6,11 +6,14 @@
 
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibGfx/SkiaBackendContext.h>
 #include <LibGfx/SkiaUtils.h>
 
 #include <core/SkBitmap.h>
 #include <core/SkColorSpace.h>
 #include <core/SkImage.h>
+#include <gpu/GrDirectContext.h>
+#include <gpu/ganesh/SkImageGanesh.h>
 
 namespace Gfx {
 
@@ -19,6 +22,11 @@ struct ImmutableBitmapImpl {
     SkBitmap sk_bitmap;
     Variant<NonnullRefPtr<Gfx::Bitmap>, NonnullRefPtr<Gfx::PaintingSurface>, Empty> source;
     ColorSpace color_space;
+
+    // OPTIMIZATION: The texture-backed image for the context this bitmap last painted under, so
+    //               repainting doesn't re-upload the pixels every frame.
+    sk_sp<SkImage> texture_image;
+    GrDirectContext* texture_image_context { nullptr };
 };
 
 int ImmutableBitmap::width() const
@@ -51,6 +59,27 @@ SkImage const* ImmutableBitmap::sk_image() const
     return m_impl->sk_image.get();
 }
 
+SkImage const* ImmutableBitmap::sk_image_for_context(SkiaBackendContext* context) const
+{
+    if (!context)
+        return m_impl->sk_image.get();
+
+    auto* direct_context = context->sk_context();
+    if (!direct_context)
+        return m_impl->sk_image.get();
+
+    if (m_impl->texture_image && m_impl->texture_image_context == direct_context)
+        return m_impl->texture_image.get();
+
+    auto texture_image = SkImages::TextureFromImage(direct_context, m_impl->sk_image);
+    if (!texture_image)
+        return m_impl->sk_image.get();
+
+    m_impl->texture_image = move(texture_image);
+    m_impl->texture_image_context = direct_context;
+    return m_impl->texture_image.get();
+}
+
 RefPtr<Gfx::Bitmap const> ImmutableBitmap::bitmap() const
 {
     // FIXME: Implement for PaintingSurface
@@ -37,6 +37,11 @@ public:
 
     SkImage const* sk_image() const;
 
+    // Returns a texture-backed image for the given context, uploading the pixels on first use and
+    // keeping them device-resident for the lifetime of this bitmap. Falls back to the raster image
+    // without a context (or if the upload fails). Must be called with the context made current.
+    SkImage const* sk_image_for_context(SkiaBackendContext*) const;
+
     Color get_pixel(int x, int y) const;
 
     RefPtr<Bitmap const> bitmap() const;
@@ -99,9 +99,10 @@ static hb_buffer_t* setup_text_shaping(Utf16View const& string, Font const& font
     return buffer;
 }
 
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static constexpr size_t maximum_shaping_cache_size = 1024;
+
+static hb_buffer_t* get_or_create_shaping_buffer(Utf16View const& string, Font const& font, ShapeFeatures const& features)
 {
-    auto const& metrics = font.pixel_metrics();
     auto& shaping_cache = font.shaping_cache();
 
     // NOTE: We only cache shaping results for a specific set of features. If the features change, we clear the cache.
@@ -110,29 +111,46 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
         shaping_cache.features = features;
     }
 
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
-    auto get_or_create_buffer = [&] -> hb_buffer_t* {
-        if (string.length_in_code_units() == 1) {
-            auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
-                auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
-                if (!cache_slot) {
-                    cache_slot = setup_text_shaping(string, font, features);
-                }
-                return cache_slot;
+    if (string.length_in_code_units() == 1) {
+        auto code_unit = string.code_unit_at(0);
+        if (code_unit < 128) {
+            auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
+            if (!cache_slot) {
+                cache_slot = setup_text_shaping(string, font, features);
             }
+            return cache_slot;
         }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
-        }
-        auto* buffer = setup_text_shaping(string, font, features);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
+    }
+
+    if (auto it = shaping_cache.map.find(
+            string.hash(), [&](auto& candidate) { return candidate.key == string; });
+        it != shaping_cache.map.end()) {
+        // NOTE: A hit moves the entry to the back of the map, keeping the map in least-recently-used order.
+        auto* buffer = it->value;
+        auto key = it->key;
+        shaping_cache.map.remove(it);
+        shaping_cache.map.set(move(key), buffer);
         return buffer;
-    };
+    }
+
+    // NOTE: The cache is bounded so that documents with lots of unique text don't keep every
+    //       string they ever shaped alive. When it fills up, we evict the least recently used entry.
+    if (shaping_cache.map.size() >= maximum_shaping_cache_size) {
+        auto least_recently_used = shaping_cache.map.begin();
+        hb_buffer_destroy(least_recently_used->value);
+        shaping_cache.map.remove(least_recently_used);
+    }
 
-    hb_buffer_t* buffer = get_or_create_buffer();
+    auto* buffer = setup_text_shaping(string, font, features);
+    shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
+    return buffer;
+}
+
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf16View const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    auto const& metrics = font.pixel_metrics();
+
+    hb_buffer_t* buffer = get_or_create_shaping_buffer(string, font, features);
     u32 glyph_count;
     auto const* glyph_info = hb_buffer_get_glyph_infos(buffer, &glyph_count);
     auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
@@ -182,7 +200,7 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
 float measure_text_width(Utf16View const& string, Font const& font, ShapeFeatures const& features)
 {
-    auto* buffer = setup_text_shaping(string, font, features);
+    auto* buffer = get_or_create_shaping_buffer(string, font, features);
 
     u32 glyph_count;
     auto const* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
@@ -191,7 +209,6 @@ float measure_text_width(Utf16View const& string, Font const& font, ShapeFeature
     for (size_t i = 0; i < glyph_count; ++i)
         point_x += positions[i].x_advance;
 
-    hb_buffer_destroy(buffer);
     return point_x / text_shaping_resolution;
 }
 
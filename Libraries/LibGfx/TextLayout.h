@@ -54,6 +54,11 @@ public:
     [[nodiscard]] float width() const { return m_width; }
     [[nodiscard]] FloatRect bounding_rect() const;
 
+    [[nodiscard]] NonnullRefPtr<GlyphRun> clone() const
+    {
+        return adopt_ref(*new GlyphRun(Vector<DrawGlyph>(m_glyphs), m_font, m_text_type, m_width, m_line_height));
+    }
+
 private:
     Vector<DrawGlyph> m_glyphs;
     NonnullRefPtr<Font const> m_font;
@@ -59,6 +59,13 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
     if (length == 0)
         return ByteBuffer {};
 
+    // Large buffers arrive as anonymous shared memory; see the matching encoder in Encoder.cpp.
+    if (TRY(decoder.decode<bool>())) {
+        auto anon_file = TRY(decoder.decode<IPC::File>());
+        auto anonymous_buffer = TRY(Core::AnonymousBuffer::create_from_anon_fd(anon_file.take_fd(), length));
+        return ByteBuffer::copy(anonymous_buffer.data<u8>(), length);
+    }
+
     auto buffer = TRY(ByteBuffer::create_uninitialized(length));
     auto bytes = buffer.bytes();
 
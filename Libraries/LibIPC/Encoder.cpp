@@ -85,10 +85,29 @@ ErrorOr<void> encode(Encoder& encoder, ByteString const& value)
     return encoder.encode(value.view());
 }
 
+// Buffers at least this large are transferred as anonymous shared memory instead of being copied
+// through the socket. Must match the decoding logic in Decoder.cpp.
+static constexpr size_t minimum_byte_buffer_size_for_shared_memory_transfer = 64 * KiB;
+
 template<>
 ErrorOr<void> encode(Encoder& encoder, ByteBuffer const& value)
 {
     TRY(encoder.encode_size(value.size()));
+    if (value.size() == 0)
+        return {};
+
+    // OPTIMIZATION: Spill large payloads into anonymous shared memory and send only the fd,
+    //               so multi-megabyte transfers don't get copied through the socket.
+    bool use_shared_memory = value.size() >= minimum_byte_buffer_size_for_shared_memory_transfer;
+    TRY(encoder.encode(use_shared_memory));
+
+    if (use_shared_memory) {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(value.size()));
+        memcpy(buffer.data<u8>(), value.data(), value.size());
+        TRY(encoder.encode(TRY(IPC::File::clone_fd(buffer.fd()))));
+        return {};
+    }
+
     TRY(encoder.append(value.data(), value.size()));
     return {};
 }
@@ -68,7 +68,9 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
+            // OPTIMIZATION: Drain as much of the queue as the socket buffer can take in one go, so a
+            //               burst of small messages is flushed with one syscall instead of one each.
+            auto [bytes, fds] = send_queue->peek(SOCKET_BUFFER_SIZE);
             ReadonlyBytes remaining_bytes_to_send = bytes;
 
             if (transfer_data(remaining_bytes_to_send, fds) == TransferState::SocketClosed)
@@ -243,7 +245,9 @@ TransportSocket::TransferState TransportSocket::transfer_data(ReadonlyBytes& byt
     if (!m_socket->is_open())
         return TransferState::SocketClosed;
 
-    {
+    // Wait for the socket to become writable again if some of the data didn't fit. If everything
+    // was sent there is nothing to wait for, and the next thing to block on is the send queue.
+    if (!bytes.is_empty()) {
         Vector<struct pollfd, 1> pollfds;
         pollfds.append({ .fd = m_socket->fd().value(), .events = POLLOUT, .revents = 0 });
 
@@ -262,9 +266,9 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
     bool should_shutdown = false;
     while (is_open()) {
-        u8 buffer[4096];
+        u8 buffer[64 * KiB];
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        auto maybe_bytes_read = m_socket->receive_message({ buffer, sizeof(buffer) }, MSG_DONTWAIT, received_fds);
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
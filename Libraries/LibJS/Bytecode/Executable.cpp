@@ -7,6 +7,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/RegexTable.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
@@ -39,7 +40,15 @@ Executable::Executable(
     global_variable_caches.resize(number_of_global_variable_caches);
 }
 
-Executable::~Executable() = default;
+Executable::~Executable()
+{
+    if (g_dump_execution_counts && times_executed > 0) {
+        if (name.is_empty())
+            warnln("[execution counts] {:>10} (anonymous)", times_executed);
+        else
+            warnln("[execution counts] {:>10} {}", times_executed, name);
+    }
+}
 
 void Executable::dump() const
 {
@@ -28,6 +28,7 @@ namespace JS::Bytecode {
 // Represents one polymorphic inline cache used for property lookups.
 struct PropertyLookupCache {
     static constexpr size_t max_number_of_shapes_to_remember = 4;
+    static constexpr u8 max_number_of_misses_before_megamorphic = 16;
     struct Entry {
         enum class Type {
             Empty,
@@ -46,6 +47,17 @@ struct PropertyLookupCache {
         Optional<u32> shape_dictionary_generation;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Once a site has missed this many times, it's considered megamorphic and we stop
+    // probing and updating the cache, so it doesn't keep getting thrashed for nothing.
+    [[nodiscard]] bool is_megamorphic() const { return miss_count >= max_number_of_misses_before_megamorphic; }
+    void note_miss()
+    {
+        if (!is_megamorphic())
+            ++miss_count;
+    }
+
+    u8 miss_count { 0 };
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -92,6 +104,10 @@ public:
     size_t number_of_registers { 0 };
     bool is_strict_mode { false };
 
+    // The number of times the interpreter has entered this executable. Reported at finalization
+    // when execution count dumping is enabled, and the tier-up trigger if we ever grow a JIT.
+    u64 times_executed { 0 };
+
     struct ExceptionHandlers {
         size_t start_offset;
         size_t end_offset;
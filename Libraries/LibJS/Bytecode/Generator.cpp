@@ -340,6 +340,46 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
+    // OPTIMIZATION: Thread jumps through basic blocks that do nothing but unconditionally jump somewhere else,
+    //               so that chains of empty blocks produced by codegen collapse into a single branch.
+    //               The intermediate blocks are still emitted (they may be entered through an exception
+    //               handler), but nothing branches to them anymore.
+    Vector<Optional<u32>> only_unconditional_jump_target;
+    only_unconditional_jump_target.resize(generator.m_root_basic_blocks.size());
+    for (size_t block_index = 0; block_index < generator.m_root_basic_blocks.size(); ++block_index) {
+        auto const& block = *generator.m_root_basic_blocks[block_index];
+        if (!block.is_terminated())
+            continue;
+        InstructionStreamIterator it { block.instruction_stream() };
+        if (it.at_end())
+            continue;
+        auto const& first_instruction = *it;
+        // NOTE: A Jump is a terminator, so if the first instruction is a Jump, it's also the only one.
+        if (first_instruction.type() != Instruction::Type::Jump)
+            continue;
+        only_unconditional_jump_target[block_index] = static_cast<Bytecode::Op::Jump const&>(first_instruction).target().basic_block_index();
+    }
+
+    auto resolve_jump_target = [&](u32 block_index) -> u32 {
+        // NOTE: Jump-only blocks may form a cycle (e.g `while (true);`), so cap the number of hops.
+        //       Stopping anywhere along the chain is fine, since every hop is a no-op.
+        auto hops_remaining = only_unconditional_jump_target.size();
+        while (hops_remaining-- > 0 && only_unconditional_jump_target[block_index].has_value() && *only_unconditional_jump_target[block_index] != block_index)
+            block_index = *only_unconditional_jump_target[block_index];
+        return block_index;
+    };
+
+    for (auto& block : generator.m_root_basic_blocks) {
+        Bytecode::InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                label = Label { resolve_jump_target(static_cast<u32>(label.basic_block_index())) };
+            });
+            ++it;
+        }
+    }
+
     for (auto& block : generator.m_root_basic_blocks) {
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
@@ -1349,6 +1389,19 @@ void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target,
         && m_current_basic_block->size() > 0) {
         if (fuse_compare_and_jump(condition, true_target, false_target))
             return;
+
+        // OPTIMIZATION: Jumping on a logical negation is the same as jumping on the original value
+        //               with the targets swapped, so the Not instruction can be elided entirely.
+        auto& last_instruction = *reinterpret_cast<Instruction const*>(m_current_basic_block->data() + m_current_basic_block->last_instruction_start_offset());
+        if (last_instruction.type() == Instruction::Type::Not) {
+            auto& not_instruction = static_cast<Op::Not const&>(last_instruction);
+            if (not_instruction.dst() == condition.operand()) {
+                auto value = not_instruction.src();
+                m_current_basic_block->rewind();
+                emit<Op::JumpIf>(value, false_target, true_target);
+                return;
+            }
+        }
     }
 
     emit<Op::JumpIf>(condition, true_target, false_target);
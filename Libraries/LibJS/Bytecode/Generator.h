@@ -138,7 +138,9 @@ public:
 
     void emit_mov(Operand const& dst, Operand const& src)
     {
-        emit<Op::Mov>(dst, src);
+        // Optimize away when the source is the destination
+        if (dst != src)
+            emit<Op::Mov>(dst, src);
     }
 
     void emit_jump_if(ScopedOperand const& condition, Label true_target, Label false_target);
@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/HashTable.h>
 #include <AK/TemporaryChange.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/RootHashMap.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/BasicBlock.h>
@@ -42,10 +43,12 @@
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
+#include <math.h>
 
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_dump_execution_counts = false;
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -126,6 +129,10 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_inequals(VM& vm, Value src1
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    // OPTIMIZATION: For two numbers, loose equality is the same IEEE 754 comparison as strict
+    //               equality, regardless of how the operands are boxed.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -135,6 +142,10 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> loosely_equals(VM& vm, Value src1,
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    // OPTIMIZATION: For two numbers, loose equality is the same IEEE 754 comparison as strict
+    //               equality, regardless of how the operands are boxed.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return TRY(is_loosely_equal(vm, src1, src2));
 }
 
@@ -144,6 +155,10 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_inequals(VM&, Value src1, Va
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() != src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers as doubles so mixed Int32/double operands stay on the fast
+    //               path. This also covers NaN and -0, which encoded() comparison would get wrong.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() != src2.as_double();
     return !is_strictly_equal(src1, src2);
 }
 
@@ -153,6 +168,10 @@ ALWAYS_INLINE static ThrowCompletionOr<bool> strict_equals(VM&, Value src1, Valu
         if (src1.is_int32() || src1.is_object() || src1.is_boolean() || src1.is_nullish())
             return src1.encoded() == src2.encoded();
     }
+    // OPTIMIZATION: Compare numbers as doubles so mixed Int32/double operands stay on the fast
+    //               path. This also covers NaN and -0, which encoded() comparison would get wrong.
+    if (src1.is_number() && src2.is_number())
+        return src1.as_double() == src2.as_double();
     return is_strictly_equal(src1, src2);
 }
 
@@ -183,9 +202,24 @@ ALWAYS_INLINE Value Interpreter::do_yield(Value value, Optional<Label> continuat
     return vm().heap().allocate<GeneratorResult>(value, continuation_value, false).ptr();
 }
 
+ALWAYS_INLINE GC::Ref<GeneratorResult> Interpreter::make_generator_result(Value result, Value continuation, bool is_await)
+{
+    // OPTIMIZATION: The driving generator only inspects its most recent suspension result, so we
+    //               can overwrite the cell from the previous suspension instead of allocating a
+    //               new one every time. Note that this must not be used for PrepareYield: its
+    //               result is stowed in a register and may survive across further suspensions.
+    if (m_reusable_generator_result) {
+        m_reusable_generator_result->reset(result, continuation, is_await);
+        return *m_reusable_generator_result;
+    }
+    return vm().heap().allocate<GeneratorResult>(result, continuation, is_await);
+}
+
 // 16.1.6 ScriptEvaluation ( scriptRecord ), https://tc39.es/ecma262/#sec-runtime-semantics-scriptevaluation
 ThrowCompletionOr<Value> Interpreter::run(Script& script_record, GC::Ptr<Environment> lexical_environment_override)
 {
+    TRACE_SCOPE("Interpreter::run");
+
     auto& vm = this->vm();
 
     // 1. Let globalEnv be scriptRecord.[[Realm]].[[GlobalEnv]].
@@ -709,11 +743,14 @@ Utf16FlyString const& Interpreter::get_identifier(IdentifierTableIndex index) co
     return m_identifier_table.data()[index.value];
 }
 
-Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& executable, Optional<size_t> entry_point, Value initial_accumulator_value)
+Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& executable, Optional<size_t> entry_point, Value initial_accumulator_value, GC::Ptr<GeneratorResult> reusable_generator_result)
 {
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter will run unit {:p}", &executable);
 
+    ++executable.times_executed;
+
     TemporaryChange restore_executable { m_current_executable, GC::Ptr { executable } };
+    TemporaryChange restore_reusable_generator_result { m_reusable_generator_result, reusable_generator_result };
     TemporaryChange restore_saved_jump { m_scheduled_jump, Optional<size_t> {} };
     TemporaryChange restore_realm { m_realm, GC::Ptr { vm().current_realm() } };
     TemporaryChange restore_global_object { m_global_object, GC::Ptr { m_realm->global_object() } };
@@ -1131,7 +1168,8 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
     case PutKind::Normal: {
         auto this_value_object = MUST(this_value.to_object(vm));
         auto& from_shape = this_value_object->shape();
-        if (caches) [[likely]] {
+        // NOTE: Megamorphic sites skip the cache entirely. See get_by_id().
+        if (caches && !caches->is_megamorphic()) [[likely]] {
             for (auto& cache : caches->entries) {
                 switch (cache.type) {
                 case PropertyLookupCache::Entry::Type::Empty:
@@ -1217,6 +1255,9 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
         CacheableSetPropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
+        if (caches) [[likely]]
+            caches->note_miss();
+
         auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
             for (size_t i = caches->entries.size() - 1; i >= 1; --i) {
                 caches->entries[i] = caches->entries[i - 1];
@@ -1225,7 +1266,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
             return caches->entries[0];
         };
 
-        if (succeeded && caches && cacheable_metadata.type == CacheableSetPropertyMetadata::Type::AddOwnProperty) {
+        if (succeeded && caches && !caches->is_megamorphic() && cacheable_metadata.type == CacheableSetPropertyMetadata::Type::AddOwnProperty) {
             auto& cache = get_cache_slot();
             cache.type = PropertyLookupCache::Entry::Type::AddOwnProperty;
             cache.from_shape = from_shape;
@@ -1242,7 +1283,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
         // If internal_set() caused object's shape change, we can no longer be sure
         // that collected metadata is valid, e.g. if setter in prototype chain added
         // property with the same name into the object itself.
-        if (succeeded && caches && &from_shape == &object->shape()) {
+        if (succeeded && caches && !caches->is_megamorphic() && &from_shape == &object->shape()) {
             auto& cache = get_cache_slot();
             switch (cacheable_metadata.type) {
             case CacheableSetPropertyMetadata::Type::AddOwnProperty:
@@ -1283,9 +1324,51 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
         }
         break;
     }
-    case PutKind::Own:
+    case PutKind::Own: {
+        // OPTIMIZATION: Object literals add their properties through a series of Own puts.
+        //               Caching the resulting shape transition lets repeated constructions of the
+        //               same literal skip the transition table lookups and store the value
+        //               directly at the cached offset. Unlike Normal puts, no prototype chain
+        //               validity checks are needed, since direct definition never consults the
+        //               prototype chain.
+        auto& from_shape = object->shape();
+        if (caches && !caches->is_megamorphic()) [[likely]] {
+            for (auto& cache : caches->entries) {
+                if (cache.type != PropertyLookupCache::Entry::Type::AddOwnProperty)
+                    continue;
+                if (cache.from_shape != &from_shape) [[unlikely]]
+                    continue;
+                auto cached_shape = cache.shape.ptr();
+                if (!cached_shape) [[unlikely]]
+                    continue;
+                object->unsafe_set_shape(*cached_shape);
+                object->put_direct(*cache.property_offset, value);
+                return {};
+            }
+        }
+
         object->define_direct_property(name, value, Attribute::Enumerable | Attribute::Writable | Attribute::Configurable);
+
+        if (caches) [[likely]]
+            caches->note_miss();
+
+        // NOTE: Only additions of named properties to non-dictionary shapes produce a new shape we
+        //       can cache. (Indexed properties don't change the shape at all, and dictionary
+        //       shapes are mutated in place.)
+        if (caches && !caches->is_megamorphic() && &object->shape() != &from_shape && !from_shape.is_dictionary() && !object->shape().is_dictionary()) {
+            for (size_t i = caches->entries.size() - 1; i >= 1; --i)
+                caches->entries[i] = caches->entries[i - 1];
+            auto& cache = caches->entries[0];
+            cache = {};
+            cache.type = PropertyLookupCache::Entry::Type::AddOwnProperty;
+            cache.from_shape = from_shape;
+            cache.shape = object->shape();
+            auto metadata = object->shape().lookup(name);
+            VERIFY(metadata.has_value());
+            cache.property_offset = metadata->offset;
+        }
         break;
+    }
     case PutKind::Prototype:
         if (value.is_object() || value.is_null()) [[likely]]
             MUST(object->internal_set_prototype_of(value.is_object() ? &value.as_object() : nullptr));
@@ -1937,6 +2020,28 @@ ThrowCompletionOr<void> Mul::execute_impl(Bytecode::Interpreter& interpreter) co
     return {};
 }
 
+ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    if (lhs.is_number() && rhs.is_number()) {
+        // OPTIMIZATION: Int32 remainder is exact when both operands are non-negative and the
+        //               divisor is nonzero; a negative dividend could produce -0, which has no
+        //               Int32 representation.
+        if (lhs.is_int32() && rhs.is_int32() && lhs.as_i32() >= 0 && rhs.as_i32() > 0) {
+            interpreter.set(m_dst, Value(lhs.as_i32() % rhs.as_i32()));
+            return {};
+        }
+        interpreter.set(m_dst, Value(fmod(lhs.as_double(), rhs.as_double())));
+        return {};
+    }
+
+    interpreter.set(m_dst, TRY(mod(vm, lhs, rhs)));
+    return {};
+}
+
 ThrowCompletionOr<void> Div::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -3126,6 +3231,15 @@ ThrowCompletionOr<void> Decrement::execute_impl(Bytecode::Interpreter& interpret
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(dst());
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(dst(), Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
 
     if (old_value.is_number())
@@ -3140,6 +3254,16 @@ ThrowCompletionOr<void> PostfixDecrement::execute_impl(Bytecode::Interpreter& in
     auto& vm = interpreter.vm();
     auto old_value = interpreter.get(m_src);
 
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (old_value.is_int32()) {
+        auto integer_value = old_value.as_i32();
+        if (integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(m_dst, old_value);
+            interpreter.set(m_src, Value { integer_value - 1 });
+            return {};
+        }
+    }
+
     old_value = TRY(old_value.to_numeric(vm));
     interpreter.set(m_dst, old_value);
 
@@ -3202,8 +3326,11 @@ void LeaveUnwindContext::execute_impl(Bytecode::Interpreter& interpreter) const
 void Yield::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto yielded_value = interpreter.get(m_value).is_special_empty_value() ? js_undefined() : interpreter.get(m_value);
+    // FIXME: If we get a pointer, which is not accurately representable as a double
+    //        will cause this to explode
+    auto continuation_value = m_continuation_label.has_value() ? Value(m_continuation_label->address()) : js_null();
     interpreter.do_return(
-        interpreter.do_yield(yielded_value, m_continuation_label));
+        interpreter.make_generator_result(yielded_value, continuation_value, false));
 }
 
 void PrepareYield::execute_impl(Bytecode::Interpreter& interpreter) const
@@ -3218,8 +3345,7 @@ void Await::execute_impl(Bytecode::Interpreter& interpreter) const
     // FIXME: If we get a pointer, which is not accurately representable as a double
     //        will cause this to explode
     auto continuation_value = Value(m_continuation_label.address());
-    auto result = interpreter.vm().heap().allocate<GeneratorResult>(yielded_value, continuation_value, true);
-    interpreter.do_return(result);
+    interpreter.do_return(interpreter.make_generator_result(yielded_value, continuation_value, true));
 }
 
 ThrowCompletionOr<void> GetByValue::execute_impl(Bytecode::Interpreter& interpreter) const
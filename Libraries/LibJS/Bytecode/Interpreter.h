@@ -44,7 +44,7 @@ public:
         ThrowCompletionOr<Value> value;
         Value return_register_value;
     };
-    ResultAndReturnRegister run_executable(Bytecode::Executable&, Optional<size_t> entry_point, Value initial_accumulator_value = js_special_empty_value());
+    ResultAndReturnRegister run_executable(Bytecode::Executable&, Optional<size_t> entry_point, Value initial_accumulator_value = js_special_empty_value(), GC::Ptr<GeneratorResult> reusable_generator_result = {});
 
     ALWAYS_INLINE Value& accumulator() { return reg(Register::accumulator()); }
     ALWAYS_INLINE Value& saved_return_value() { return reg(Register::saved_return_value()); }
@@ -61,6 +61,7 @@ public:
     void set(Operand, Value);
 
     Value do_yield(Value value, Optional<Label> continuation);
+    GC::Ref<GeneratorResult> make_generator_result(Value result, Value continuation, bool is_await);
     void do_return(Value value)
     {
         reg(Register::return_value()) = value;
@@ -106,9 +107,15 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     ExecutionContext* m_running_execution_context { nullptr };
     ReadonlySpan<Utf16FlyString> m_identifier_table;
+
+    // OPTIMIZATION: When a generator resumes us, it hands over the GeneratorResult cell from its
+    //               previous suspension so Yield and Await can overwrite it instead of allocating
+    //               a fresh cell for every suspension. Kept alive by the generator object.
+    GC::Ptr<GeneratorResult> m_reusable_generator_result;
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_dump_execution_counts;
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
@@ -119,6 +119,7 @@ private:
     O(LeftShift, left_shift)                             \
     O(LessThan, less_than)                               \
     O(LessThanEquals, less_than_equals)                  \
+    O(Mod, mod)                                          \
     O(Mul, mul)                                          \
     O(RightShift, right_shift)                           \
     O(Sub, sub)                                          \
@@ -126,7 +127,6 @@ private:
 
 #define JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(O) \
     O(Exp, exp)                                             \
-    O(Mod, mod)                                             \
     O(In, in)                                               \
     O(InstanceOf, instance_of)                              \
     O(LooselyInequals, loosely_inequals)                    \
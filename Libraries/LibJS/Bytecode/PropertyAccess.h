@@ -91,50 +91,54 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     if (shape.prototype())
         prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
 
-    for (auto& cache_entry : cache.entries) {
-        auto cached_prototype = cache_entry.prototype.ptr();
-        if (cached_prototype) {
-            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-            bool can_use_cache = [&]() -> bool {
-                if (&shape != cache_entry.shape) [[unlikely]]
-                    return false;
+    // OPTIMIZATION: Megamorphic sites don't get to use the cache at all, so they don't pay for
+    //               four guaranteed-to-fail probes (and don't keep thrashing the entries below).
+    if (!cache.is_megamorphic()) [[likely]] {
+        for (auto& cache_entry : cache.entries) {
+            auto cached_prototype = cache_entry.prototype.ptr();
+            if (cached_prototype) {
+                // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+                bool can_use_cache = [&]() -> bool {
+                    if (&shape != cache_entry.shape) [[unlikely]]
+                        return false;
+
+                    if (shape.is_dictionary()) {
+                        VERIFY(cache_entry.shape_dictionary_generation.has_value());
+                        if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]] {
+                            return false;
+                        }
+                    }
 
+                    auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
+                    if (!cached_prototype_chain_validity) [[unlikely]]
+                        return false;
+                    if (!cached_prototype_chain_validity->is_valid()) [[unlikely]]
+                        return false;
+                    return true;
+                }();
+                if (can_use_cache) [[likely]] {
+                    auto value = cached_prototype->get_direct(cache_entry.property_offset.value());
+                    if (value.is_accessor())
+                        return TRY(call(vm, value.as_accessor().getter(), this_value));
+                    return value;
+                }
+            } else if (&shape == cache_entry.shape) {
+                // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+                bool can_use_cache = true;
                 if (shape.is_dictionary()) {
                     VERIFY(cache_entry.shape_dictionary_generation.has_value());
                     if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]] {
-                        return false;
+                        can_use_cache = false;
                     }
                 }
 
-                auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
-                if (!cached_prototype_chain_validity) [[unlikely]]
-                    return false;
-                if (!cached_prototype_chain_validity->is_valid()) [[unlikely]]
-                    return false;
-                return true;
-            }();
-            if (can_use_cache) [[likely]] {
-                auto value = cached_prototype->get_direct(cache_entry.property_offset.value());
-                if (value.is_accessor())
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
-                return value;
-            }
-        } else if (&shape == cache_entry.shape) {
-            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-            bool can_use_cache = true;
-            if (shape.is_dictionary()) {
-                VERIFY(cache_entry.shape_dictionary_generation.has_value());
-                if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]] {
-                    can_use_cache = false;
-                }
-            }
-
-            if (can_use_cache) [[likely]] {
-                auto value = base_obj->get_direct(cache_entry.property_offset.value());
-                if (value.is_accessor()) {
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
+                if (can_use_cache) [[likely]] {
+                    auto value = base_obj->get_direct(cache_entry.property_offset.value());
+                    if (value.is_accessor()) {
+                        return TRY(call(vm, value.as_accessor().getter(), this_value));
+                    }
+                    return value;
                 }
-                return value;
             }
         }
     }
@@ -142,10 +146,12 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     CacheableGetPropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(get_property_name(), this_value, &cacheable_metadata));
 
+    cache.note_miss();
+
     // If internal_get() caused object's shape change, we can no longer be sure
     // that collected metadata is valid, e.g. if getter in prototype chain added
     // property with the same name into the object itself.
-    if (&shape == &base_obj->shape()) {
+    if (!cache.is_megamorphic() && &shape == &base_obj->shape()) {
         auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
             for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
                 cache.entries[i] = cache.entries[i - 1];
@@ -182,6 +182,7 @@ class FunctionEnvironment;
 class FunctionNode;
 struct FunctionParameter;
 class FunctionParameters;
+class GeneratorResult;
 class GlobalEnvironment;
 class GlobalObject;
 struct GraphLoadingState;
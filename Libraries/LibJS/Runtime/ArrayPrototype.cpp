@@ -31,6 +31,32 @@ GC_DEFINE_ALLOCATOR(ArrayPrototype);
 
 static HashTable<GC::Ref<Object>> s_array_join_seen_objects;
 
+// OPTIMIZATION: For an Array that is not a proxy target, has an intact prototype chain, and uses
+//               simple (packed) indexed storage, the HasProperty/Get pair of the iteration
+//               protocol collapses to a direct read from the element vector. The callback may
+//               mutate the array mid-iteration, so callers must re-check this for every element
+//               and fall back to the generic protocol when no value is returned (which also covers
+//               holes, correctly treated as absent thanks to the intact prototype chain).
+static ALWAYS_INLINE Optional<Value> fast_array_element(Object const& object, size_t index)
+{
+    auto const* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return {};
+
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return {};
+
+    auto const& elements = static_cast<SimpleIndexedPropertyStorage const&>(*storage).elements();
+    if (index >= elements.size())
+        return {};
+
+    auto value = elements[index];
+    if (value.is_special_empty_value())
+        return {};
+    return value;
+}
+
 ArrayPrototype::ArrayPrototype(Realm& realm)
     : Array(realm, realm.intrinsics().object_prototype())
 {
@@ -414,6 +440,16 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::filter)
 
     // 7. Repeat, while k < len,
     for (; k < length; ++k) {
+        // OPTIMIZATION: Steps a-c.i collapse to a direct read from the element storage for packed arrays.
+        if (auto fast_value = fast_array_element(*object, k); fast_value.has_value()) {
+            auto selected = TRY(call(vm, callback_function.as_function(), this_arg, *fast_value, Value(k), object)).to_boolean();
+            if (selected) {
+                TRY(array->create_data_property_or_throw(to, *fast_value));
+                ++to;
+            }
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -699,6 +735,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     // 4. Let k be 0.
     // 5. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
+        // OPTIMIZATION: Steps a-c.i collapse to a direct read from the element storage for packed arrays.
+        if (auto fast_value = fast_array_element(*object, k); fast_value.has_value()) {
+            TRY(call(vm, callback_function.as_function(), this_arg, *fast_value, Value(k), object));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -957,6 +999,13 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::map)
     // 5. Let k be 0.
     // 6. Repeat, while k < len,
     for (size_t k = 0; k < length; ++k) {
+        // OPTIMIZATION: Steps a-c.i collapse to a direct read from the element storage for packed arrays.
+        if (auto fast_value = fast_array_element(*object, k); fast_value.has_value()) {
+            auto mapped_value = TRY(call(vm, callback_function.as_function(), this_arg, *fast_value, Value(k), object));
+            TRY(array->create_data_property_or_throw(k, mapped_value));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -1074,6 +1123,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce)
 
     // 9. Repeat, while k < len,
     for (; k < length; ++k) {
+        // OPTIMIZATION: Steps a-c.i collapse to a direct read from the element storage for packed arrays.
+        if (auto fast_value = fast_array_element(*object, k); fast_value.has_value()) {
+            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, *fast_value, Value(k), object));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
@@ -1156,6 +1211,12 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::reduce_right)
 
     // 9. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
+        // OPTIMIZATION: Steps a-c.i collapse to a direct read from the element storage for packed arrays.
+        if (auto fast_value = fast_array_element(*object, k); fast_value.has_value()) {
+            accumulator = TRY(call(vm, callback_function.as_function(), js_undefined(), accumulator, *fast_value, Value((size_t)k), object));
+            continue;
+        }
+
         // a. Let Pk be ! ToString(𝔽(k)).
         auto property_key = PropertyKey { k };
 
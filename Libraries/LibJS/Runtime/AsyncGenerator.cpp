@@ -48,6 +48,7 @@ void AsyncGenerator::visit_edges(Cell::Visitor& visitor)
     }
     visitor.visit(m_generating_function);
     visitor.visit(m_previous_value);
+    visitor.visit(m_reusable_generator_result);
     visitor.visit(m_current_promise);
     m_async_generator_context->visit_edges(visitor);
 }
@@ -186,11 +187,16 @@ void AsyncGenerator::execute(VM& vm, Completion completion)
         // We should never enter `execute` again after the generator is complete.
         VERIFY(continuation_address.has_value());
 
-        auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), continuation_address, completion_cell);
+        auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), continuation_address, completion_cell, m_reusable_generator_result);
 
         auto result_value = move(next_result.value);
         if (!result_value.is_throw_completion()) {
             m_previous_value = result_value.release_value();
+
+            // If the generator suspended, keep the result cell around so the interpreter can reuse
+            // it on the next suspension. (A pending continuation implies it's a GeneratorResult.)
+            if (generated_continuation(m_previous_value).has_value())
+                m_reusable_generator_result = &static_cast<GeneratorResult&>(m_previous_value.as_cell());
             auto value = generated_value(m_previous_value);
             bool is_await = generated_is_await(m_previous_value);
 
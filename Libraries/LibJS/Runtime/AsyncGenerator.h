@@ -60,6 +60,11 @@ private:
 
     GC::Ptr<ECMAScriptFunctionObject> m_generating_function;
     Value m_previous_value;
+
+    // OPTIMIZATION: The GeneratorResult cell from the previous suspension, which the interpreter
+    //               may overwrite on the next suspension instead of allocating a new cell.
+    GC::Ptr<GeneratorResult> m_reusable_generator_result;
+
     GC::Ptr<Promise> m_current_promise;
 };
 
@@ -90,7 +90,13 @@ JS_DEFINE_NATIVE_FUNCTION(BigIntPrototype::to_locale_string)
     auto bigint = TRY(this_bigint_value(vm, vm.this_value()));
 
     // 2. Let numberFormat be ? Construct(%NumberFormat%, « locales, options »).
-    auto* number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
+    // OPTIMIZATION: The no-argument case always resolves to the same formatter, which is cached
+    //               on the constructor.
+    GC::Ptr<Intl::NumberFormat> number_format;
+    if (locales.is_undefined() && options.is_undefined())
+        number_format = TRY(realm.intrinsics().intl_number_format_constructor()->default_number_format());
+    else
+        number_format = static_cast<Intl::NumberFormat*>(TRY(construct(vm, realm.intrinsics().intl_number_format_constructor(), locales, options)).ptr());
 
     // 3. Return ? FormatNumeric(numberFormat, x).
     auto formatted = Intl::format_numeric(*number_format, Value(bigint));
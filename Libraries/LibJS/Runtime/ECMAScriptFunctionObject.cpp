@@ -53,7 +53,6 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create(Realm& realm,
     }
 
     auto shared_data = adopt_ref(*new SharedFunctionInstanceData(
-        realm.vm(),
         kind,
         move(name),
         function_length,
@@ -77,7 +76,6 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create(Realm& realm,
 GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create(Realm& realm, Utf16FlyString name, Object& prototype, ByteString source_text, Statement const& ecmascript_code, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, Vector<LocalVariable> local_variables_names, Environment* parent_environment, PrivateEnvironment* private_environment, FunctionKind kind, bool is_strict, FunctionParsingInsights parsing_insights, bool is_arrow_function, Variant<PropertyKey, PrivateName, Empty> class_field_initializer_name)
 {
     auto shared_data = adopt_ref(*new SharedFunctionInstanceData(
-        realm.vm(),
         kind,
         move(name),
         function_length,
@@ -122,7 +120,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
     RefPtr<SharedFunctionInstanceData> shared_data = function_node.shared_data();
 
     if (!shared_data) {
-        shared_data = adopt_ref(*new SharedFunctionInstanceData(realm->vm(),
+        shared_data = adopt_ref(*new SharedFunctionInstanceData(
             function_node.kind(),
             move(name),
             function_node.function_length(),
@@ -144,7 +142,6 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
 }
 
 SharedFunctionInstanceData::SharedFunctionInstanceData(
-    VM& vm,
     FunctionKind kind,
     Utf16FlyString name,
     i32 function_length,
@@ -167,6 +164,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     , m_contains_direct_call_to_eval(parsing_insights.contains_direct_call_to_eval)
     , m_is_arrow_function(is_arrow_function)
     , m_uses_this(parsing_insights.uses_this)
+    , m_uses_this_from_environment(parsing_insights.uses_this_from_environment)
 {
     if (m_is_arrow_function)
         m_this_mode = ThisMode::Lexical;
@@ -185,6 +183,13 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
             return false;
         return true;
     });
+}
+
+void SharedFunctionInstanceData::ensure_function_declaration_instantiation_data(VM& vm)
+{
+    if (m_function_declaration_instantiation_data_initialized)
+        return;
+    m_function_declaration_instantiation_data_initialized = true;
 
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
@@ -278,7 +283,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
 
     size_t parameter_environment_bindings_count = 0;
     // 19. If strict is true or hasParameterExpressions is false, then
-    if (strict || !m_has_parameter_expressions) {
+    if (m_strict || !m_has_parameter_expressions) {
         // a. NOTE: Only a single Environment Record is needed for the parameters, since calls to eval in strict mode code cannot create new bindings which are visible outside of the eval.
         // b. Let env be the LexicalEnvironment of calleeContext
         // NOTE: Here we are only interested in the size of the environment.
@@ -417,7 +422,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
 ECMAScriptFunctionObject::ECMAScriptFunctionObject(
@@ -488,6 +493,11 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
 
 ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& registers_and_constants_and_locals_count, size_t& argument_count)
 {
+    // NOTE: This runs before every call, so it is the single place that guarantees the deferred
+    //       FunctionDeclarationInstantiation data exists before the bytecode generator or
+    //       PrepareForOrdinaryCall read it.
+    m_shared_data->ensure_function_declaration_instantiation_data(vm());
+
     if (!m_bytecode_executable) {
         if (!ecmascript_code().bytecode_executable()) {
             if (is_module_wrapper()) {
@@ -37,7 +37,6 @@ enum class ConstructorKind : u8 {
 class SharedFunctionInstanceData : public RefCounted<SharedFunctionInstanceData> {
 public:
     SharedFunctionInstanceData(
-        VM& vm,
         FunctionKind,
         Utf16FlyString name,
         i32 function_length,
@@ -49,6 +48,11 @@ public:
         FunctionParsingInsights const&,
         Vector<LocalVariable> local_variables_names);
 
+    // Performs the parts of FunctionDeclarationInstantiation that only depend on the function's
+    // source, so they run once and are reused by every instantiation and call. This is deferred
+    // until the first invocation since most functions on real pages never run.
+    void ensure_function_declaration_instantiation_data(VM&);
+
     RefPtr<FunctionParameters const> m_formal_parameters; // [[FormalParameters]]
     RefPtr<Statement const> m_ecmascript_code;            // [[ECMAScriptCode]]
 
@@ -86,6 +90,8 @@ public:
     bool m_arguments_object_needed { false };
     bool m_function_environment_needed { false };
     bool m_uses_this { false };
+    bool m_uses_this_from_environment { false };
+    bool m_function_declaration_instantiation_data_initialized { false };
     Vector<VariableNameToInitialize> m_var_names_to_initialize_binding;
     Vector<Utf16FlyString> m_function_names_to_initialize_binding;
 
@@ -51,6 +51,7 @@ void GeneratorObject::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_generating_function);
     visitor.visit(m_previous_value);
+    visitor.visit(m_reusable_generator_result);
     m_execution_context->visit_edges(visitor);
 }
 
@@ -108,7 +109,7 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
     // We should never enter `execute` again after the generator is complete.
     VERIFY(next_block.has_value());
 
-    auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), next_block, compleion_cell);
+    auto next_result = bytecode_interpreter.run_executable(*m_generating_function->bytecode_executable(), next_block, compleion_cell, m_reusable_generator_result);
 
     vm.pop_execution_context();
 
@@ -121,6 +122,11 @@ ThrowCompletionOr<GeneratorObject::IterationResult> GeneratorObject::execute(VM&
     m_previous_value = result_value.release_value();
     bool done = !generated_continuation(m_previous_value).has_value();
 
+    // If the generator suspended, keep the result cell around so the interpreter can reuse it
+    // on the next suspension. (A pending continuation implies the result is a GeneratorResult.)
+    if (!done)
+        m_reusable_generator_result = &static_cast<GeneratorResult&>(m_previous_value.as_cell());
+
     m_generator_state = done ? GeneratorState::Completed : GeneratorState::SuspendedYield;
 
     return IterationResult(generated_value(m_previous_value), done);
@@ -55,6 +55,11 @@ private:
     NonnullOwnPtr<ExecutionContext> m_execution_context;
     GC::Ptr<ECMAScriptFunctionObject> m_generating_function;
     Value m_previous_value;
+
+    // OPTIMIZATION: The GeneratorResult cell from the previous suspension, which the interpreter
+    //               may overwrite on the next suspension instead of allocating a new cell.
+    GC::Ptr<GeneratorResult> m_reusable_generator_result;
+
     GeneratorState m_generator_state { GeneratorState::SuspendedStart };
     Optional<StringView> m_generator_brand;
 };
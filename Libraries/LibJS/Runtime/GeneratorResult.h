@@ -30,6 +30,13 @@ public:
     [[nodiscard]] Value continuation() const { return m_continuation; }
     [[nodiscard]] bool is_await() const { return m_is_await; }
 
+    void reset(Value result, Value continuation, bool is_await)
+    {
+        m_result = result;
+        m_continuation = continuation;
+        m_is_await = is_await;
+    }
+
 private:
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
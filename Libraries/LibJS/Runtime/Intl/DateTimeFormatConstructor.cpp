@@ -66,6 +66,47 @@ ThrowCompletionOr<GC::Ref<Object>> DateTimeFormatConstructor::construct(Function
     return date_time_format;
 }
 
+// Non-standard. Returns the formatter used by the toLocaleString family when both locales and
+// options are undefined. Constructing a DateTimeFormat re-resolves locale data through ICU every
+// time, which dominates no-argument toLocaleString calls in a loop, so the formatters for the
+// three no-argument variants are cached here. They depend on the system time zone, so the caches
+// are dropped when it changes.
+ThrowCompletionOr<GC::Ref<DateTimeFormat>> DateTimeFormatConstructor::default_date_time_format(OptionRequired required, OptionDefaults defaults)
+{
+    auto& vm = this->vm();
+
+    auto time_zone = system_time_zone_identifier();
+    if (time_zone != m_default_formats_time_zone) {
+        m_default_date_time_format = nullptr;
+        m_default_date_format = nullptr;
+        m_default_time_format = nullptr;
+        m_default_formats_time_zone = move(time_zone);
+    }
+
+    auto cached_format = [&]() -> GC::Ptr<DateTimeFormat>& {
+        switch (defaults) {
+        case OptionDefaults::Date:
+            return m_default_date_format;
+        case OptionDefaults::Time:
+            return m_default_time_format;
+        default:
+            return m_default_date_time_format;
+        }
+    }();
+
+    if (!cached_format)
+        cached_format = TRY(create_date_time_format(vm, *this, js_undefined(), js_undefined(), required, defaults));
+    return GC::Ref { *cached_format };
+}
+
+void DateTimeFormatConstructor::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_default_date_time_format);
+    visitor.visit(m_default_date_format);
+    visitor.visit(m_default_time_format);
+}
+
 // 11.2.2 Intl.DateTimeFormat.supportedLocalesOf ( locales [ , options ] ), https://tc39.es/ecma402/#sec-intl.datetimeformat.supportedlocalesof
 JS_DEFINE_NATIVE_FUNCTION(DateTimeFormatConstructor::supported_locales_of)
 {
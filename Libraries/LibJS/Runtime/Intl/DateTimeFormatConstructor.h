@@ -10,25 +10,6 @@
 
 namespace JS::Intl {
 
-class DateTimeFormatConstructor final : public NativeFunction {
-    JS_OBJECT(DateTimeFormatConstructor, NativeFunction);
-    GC_DECLARE_ALLOCATOR(DateTimeFormatConstructor);
-
-public:
-    virtual void initialize(Realm&) override;
-    virtual ~DateTimeFormatConstructor() override = default;
-
-    virtual ThrowCompletionOr<Value> call() override;
-    virtual ThrowCompletionOr<GC::Ref<Object>> construct(FunctionObject& new_target) override;
-
-private:
-    explicit DateTimeFormatConstructor(Realm&);
-
-    virtual bool has_constructor() const override { return true; }
-
-    JS_DECLARE_NATIVE_FUNCTION(supported_locales_of);
-};
-
 enum class OptionRequired {
     Any,
     Date,
@@ -51,6 +32,33 @@ enum class OptionInherit {
     Relevant,
 };
 
+class DateTimeFormatConstructor final : public NativeFunction {
+    JS_OBJECT(DateTimeFormatConstructor, NativeFunction);
+    GC_DECLARE_ALLOCATOR(DateTimeFormatConstructor);
+
+public:
+    virtual void initialize(Realm&) override;
+    virtual ~DateTimeFormatConstructor() override = default;
+
+    virtual ThrowCompletionOr<Value> call() override;
+    virtual ThrowCompletionOr<GC::Ref<Object>> construct(FunctionObject& new_target) override;
+
+    ThrowCompletionOr<GC::Ref<DateTimeFormat>> default_date_time_format(OptionRequired, OptionDefaults);
+
+private:
+    explicit DateTimeFormatConstructor(Realm&);
+
+    virtual bool has_constructor() const override { return true; }
+    virtual void visit_edges(Visitor&) override;
+
+    JS_DECLARE_NATIVE_FUNCTION(supported_locales_of);
+
+    GC::Ptr<DateTimeFormat> m_default_date_time_format;
+    GC::Ptr<DateTimeFormat> m_default_date_format;
+    GC::Ptr<DateTimeFormat> m_default_time_format;
+    String m_default_formats_time_zone;
+};
+
 ThrowCompletionOr<GC::Ref<DateTimeFormat>> create_date_time_format(VM&, FunctionObject& new_target, Value locales_value, Value options_value, OptionRequired, OptionDefaults, Optional<String> const& to_locale_string_time_zone = {});
 String format_offset_time_zone_identifier(double offset_minutes);
 
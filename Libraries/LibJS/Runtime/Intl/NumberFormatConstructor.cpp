@@ -167,6 +167,22 @@ ThrowCompletionOr<GC::Ref<Object>> NumberFormatConstructor::construct(FunctionOb
     return number_format;
 }
 
+// Non-standard. Returns the formatter used by the toLocaleString family when both locales and
+// options are undefined. Constructing a NumberFormat re-resolves locale data through ICU every
+// time, which dominates no-argument toLocaleString calls in a loop, so the result is cached here.
+ThrowCompletionOr<GC::Ref<NumberFormat>> NumberFormatConstructor::default_number_format()
+{
+    if (!m_default_number_format)
+        m_default_number_format = static_cast<NumberFormat*>(TRY(JS::construct(vm(), *this)).ptr());
+    return GC::Ref { *m_default_number_format };
+}
+
+void NumberFormatConstructor::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_default_number_format);
+}
+
 // 16.1.2 SetNumberFormatDigitOptions ( intlObj, options, mnfdDefault, mxfdDefault, notation ), https://tc39.es/ecma402/#sec-setnfdigitoptions
 ThrowCompletionOr<void> set_number_format_digit_options(VM& vm, NumberFormatBase& intl_object, Object const& options, int default_min_fraction_digits, int default_max_fraction_digits, Unicode::Notation notation)
 {
@@ -22,12 +22,17 @@ public:
     virtual ThrowCompletionOr<Value> call() override;
     virtual ThrowCompletionOr<GC::Ref<Object>> construct(FunctionObject& new_target) override;
 
+    ThrowCompletionOr<GC::Ref<NumberFormat>> default_number_format();
+
 private:
     explicit NumberFormatConstructor(Realm&);
 
     virtual bool has_constructor() const override { return true; }
+    virtual void visit_edges(Visitor&) override;
 
     JS_DECLARE_NATIVE_FUNCTION(supported_locales_of);
+
+    GC::Ptr<NumberFormat> m_default_number_format;
 };
 
 ThrowCompletionOr<void> set_number_format_digit_options(VM&, NumberFormatBase& intl_object, Object const& options, int default_min_fraction_digits, int default_max_fraction_digits, Unicode::Notation notation);
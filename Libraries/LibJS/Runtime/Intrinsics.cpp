@@ -242,19 +242,6 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_function_prototype->initialize(realm);
     m_object_prototype->initialize(realm);
 
-#define __JS_ENUMERATE(ClassName, snake_name) \
-    VERIFY(!m_##snake_name##_prototype);      \
-    m_##snake_name##_prototype = realm.create<ClassName##Prototype>(realm);
-    JS_ENUMERATE_ITERATOR_PROTOTYPES
-#undef __JS_ENUMERATE
-
-    // These must be initialized separately as they have no companion constructor
-    m_async_from_sync_iterator_prototype = realm.create<AsyncFromSyncIteratorPrototype>(realm);
-    m_async_generator_prototype = realm.create<AsyncGeneratorPrototype>(realm);
-    m_generator_prototype = realm.create<GeneratorPrototype>(realm);
-    m_intl_segments_prototype = realm.create<Intl::SegmentsPrototype>(realm);
-    m_wrap_for_valid_iterator_prototype = realm.create<WrapForValidIteratorPrototype>(realm);
-
     // These must be initialized before allocating...
     // - AggregateErrorPrototype, which uses ErrorPrototype as its prototype
     // - AggregateErrorConstructor, which uses ErrorConstructor as its prototype
@@ -263,9 +250,6 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_error_constructor = realm.create<ErrorConstructor>(realm);
     m_function_constructor = realm.create<FunctionConstructor>(realm);
 
-    // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct prototype
-    m_proxy_constructor = realm.create<ProxyConstructor>(realm);
-
     // Global object functions
     m_eval_function = NativeFunction::create(realm, GlobalObject::eval, 1, vm.names.eval, &realm);
     m_is_finite_function = NativeFunction::create(realm, GlobalObject::is_finite, 1, vm.names.isFinite, &realm);
@@ -299,29 +283,8 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     initialize_constructor(vm, vm.names.Error, *m_error_constructor, m_error_prototype);
     initialize_constructor(vm, vm.names.Function, *m_function_constructor, m_function_prototype);
     initialize_constructor(vm, vm.names.Object, *m_object_constructor, m_object_prototype);
-    initialize_constructor(vm, vm.names.Proxy, *m_proxy_constructor, nullptr);
-
-    initialize_constructor(vm, vm.names.GeneratorFunction, *generator_function_constructor(), generator_function_prototype(), Attribute::Configurable);
-    initialize_constructor(vm, vm.names.AsyncGeneratorFunction, *async_generator_function_constructor(), async_generator_function_prototype(), Attribute::Configurable);
-    initialize_constructor(vm, vm.names.AsyncFunction, *async_function_constructor(), async_function_prototype(), Attribute::Configurable);
 
-    // 27.5.1.1 Generator.prototype.constructor, https://tc39.es/ecma262/#sec-generator.prototype.constructor
-    m_generator_prototype->define_direct_property(vm.names.constructor, m_generator_function_prototype, Attribute::Configurable);
-
-    // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
-    m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
-
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
-    m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
-
-    array_prototype()->convert_to_prototype_if_needed();
-    m_default_array_prototype_shape = array_prototype()->shape();
     m_default_object_prototype_shape = object_prototype()->shape();
-
-    VERIFY(array_prototype()->indexed_properties().is_empty());
     VERIFY(object_prototype()->indexed_properties().is_empty());
 }
 
@@ -350,7 +313,13 @@ JS_ENUMERATE_TYPED_ARRAYS
         }                                                                                                                                                \
                                                                                                                                                          \
         /* FIXME: Add these special cases to JS_ENUMERATE_NATIVE_OBJECTS */                                                                              \
-        if constexpr (IsSame<Namespace::ConstructorName, BigIntConstructor>)                                                                             \
+        if constexpr (IsSame<Namespace::ConstructorName, AsyncFunctionConstructor>)                                                                      \
+            initialize_constructor(vm, vm.names.AsyncFunction, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype, Attribute::Configurable); \
+        else if constexpr (IsSame<Namespace::ConstructorName, AsyncGeneratorFunctionConstructor>)                                                        \
+            initialize_constructor(vm, vm.names.AsyncGeneratorFunction, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype, Attribute::Configurable); \
+        else if constexpr (IsSame<Namespace::ConstructorName, GeneratorFunctionConstructor>)                                                             \
+            initialize_constructor(vm, vm.names.GeneratorFunction, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype, Attribute::Configurable); \
+        else if constexpr (IsSame<Namespace::ConstructorName, BigIntConstructor>)                                                                        \
             initialize_constructor(vm, vm.names.BigInt, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else if constexpr (IsSame<Namespace::ConstructorName, BooleanConstructor>)                                                                       \
             initialize_constructor(vm, vm.names.Boolean, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);   \
@@ -368,6 +337,14 @@ JS_ENUMERATE_TYPED_ARRAYS
             initialize_constructor(vm, vm.names.Symbol, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
         else                                                                                                                                             \
             initialize_constructor(vm, vm.names.ClassName, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype); \
+                                                                                                                                                         \
+        /* OPTIMIZATION: Creating Array objects checks whether %Array.prototype% is still pristine */                                                    \
+        /*               by comparing shapes, so remember its initial shape here. */                                                                     \
+        if constexpr (IsSame<Namespace::ConstructorName, ArrayConstructor>) {                                                                            \
+            m_##snake_namespace##snake_name##_prototype->convert_to_prototype_if_needed();                                                               \
+            m_default_array_prototype_shape = m_##snake_namespace##snake_name##_prototype->shape();                                                      \
+            VERIFY(m_##snake_namespace##snake_name##_prototype->indexed_properties().is_empty());                                                        \
+        }                                                                                                                                                \
     }                                                                                                                                                    \
                                                                                                                                                          \
     GC::Ref<Namespace::ConstructorName> Intrinsics::snake_namespace##snake_name##_constructor()                                                          \
@@ -411,6 +388,98 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+#define __JS_ENUMERATE(ClassName, snake_name)                                            \
+    GC::Ref<Object> Intrinsics::snake_name##_prototype()                                 \
+    {                                                                                    \
+        if (!m_##snake_name##_prototype)                                                 \
+            m_##snake_name##_prototype = m_realm->create<ClassName##Prototype>(m_realm); \
+        return *m_##snake_name##_prototype;                                              \
+    }
+JS_ENUMERATE_ITERATOR_PROTOTYPES
+#undef __JS_ENUMERATE
+
+GC::Ref<ProxyConstructor> Intrinsics::proxy_constructor()
+{
+    if (!m_proxy_constructor) {
+        m_proxy_constructor = m_realm->create<ProxyConstructor>(m_realm);
+        initialize_constructor(vm(), vm().names.Proxy, *m_proxy_constructor, nullptr);
+    }
+    return *m_proxy_constructor;
+}
+
+GC::Ref<Object> Intrinsics::async_from_sync_iterator_prototype()
+{
+    if (!m_async_from_sync_iterator_prototype)
+        m_async_from_sync_iterator_prototype = m_realm->create<AsyncFromSyncIteratorPrototype>(m_realm);
+    return *m_async_from_sync_iterator_prototype;
+}
+
+// NOTE: The "constructor" properties of these two prototypes are defined by
+//       (Async)GeneratorFunctionPrototype::initialize(), since they must point at objects which in
+//       turn reference these prototypes.
+GC::Ref<Object> Intrinsics::async_generator_prototype()
+{
+    if (!m_async_generator_prototype)
+        m_async_generator_prototype = m_realm->create<AsyncGeneratorPrototype>(m_realm);
+    return *m_async_generator_prototype;
+}
+
+GC::Ref<Object> Intrinsics::generator_prototype()
+{
+    if (!m_generator_prototype)
+        m_generator_prototype = m_realm->create<GeneratorPrototype>(m_realm);
+    return *m_generator_prototype;
+}
+
+GC::Ref<Object> Intrinsics::wrap_for_valid_iterator_prototype()
+{
+    if (!m_wrap_for_valid_iterator_prototype)
+        m_wrap_for_valid_iterator_prototype = m_realm->create<WrapForValidIteratorPrototype>(m_realm);
+    return *m_wrap_for_valid_iterator_prototype;
+}
+
+GC::Ref<Object> Intrinsics::intl_segments_prototype()
+{
+    if (!m_intl_segments_prototype)
+        m_intl_segments_prototype = m_realm->create<Intl::SegmentsPrototype>(m_realm);
+    return *m_intl_segments_prototype;
+}
+
+GC::Ref<FunctionObject> Intrinsics::array_prototype_values_function()
+{
+    if (!m_array_prototype_values_function)
+        m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm().names.values).as_function();
+    return *m_array_prototype_values_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    if (!m_date_constructor_now_function)
+        m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm().names.now).as_function();
+    return *m_date_constructor_now_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_parse_function()
+{
+    if (!m_json_parse_function)
+        m_json_parse_function = &json_object()->get_without_side_effects(vm().names.parse).as_function();
+    return *m_json_parse_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_stringify_function()
+{
+    if (!m_json_stringify_function)
+        m_json_stringify_function = &json_object()->get_without_side_effects(vm().names.stringify).as_function();
+    return *m_json_stringify_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::object_prototype_to_string_function()
+{
+    if (!m_object_prototype_to_string_function)
+        m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm().names.toString).as_function();
+    return *m_object_prototype_to_string_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -51,27 +51,28 @@ public:
     [[nodiscard]] u32 mapped_arguments_object_well_known_symbol_iterator_offset() const { return m_mapped_arguments_object_well_known_symbol_iterator_offset; }
     [[nodiscard]] u32 mapped_arguments_object_callee_offset() const { return m_mapped_arguments_object_callee_offset; }
 
-    [[nodiscard]] GC::Ref<Shape> default_array_prototype_shape() const { return *m_default_array_prototype_shape; }
-    [[nodiscard]] GC::Ref<Shape> default_object_prototype_shape() const { return *m_default_object_prototype_shape; }
+    // This shape is only cached once the Array intrinsics have been initialized.
+    [[nodiscard]] GC::Ptr<Shape> default_array_prototype_shape() const { return m_default_array_prototype_shape; }
+    [[nodiscard]] GC::Ptr<Shape> default_object_prototype_shape() const { return m_default_object_prototype_shape; }
 
     [[nodiscard]] GC::Ref<Accessor> throw_type_error_accessor() { return *m_throw_type_error_accessor; }
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct prototype
-    GC::Ref<ProxyConstructor> proxy_constructor() { return *m_proxy_constructor; }
+    GC::Ref<ProxyConstructor> proxy_constructor();
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct constructor
-    GC::Ref<Object> async_from_sync_iterator_prototype() { return *m_async_from_sync_iterator_prototype; }
-    GC::Ref<Object> async_generator_prototype() { return *m_async_generator_prototype; }
-    GC::Ref<Object> generator_prototype() { return *m_generator_prototype; }
-    GC::Ref<Object> wrap_for_valid_iterator_prototype() { return *m_wrap_for_valid_iterator_prototype; }
+    GC::Ref<Object> async_from_sync_iterator_prototype();
+    GC::Ref<Object> async_generator_prototype();
+    GC::Ref<Object> generator_prototype();
+    GC::Ref<Object> wrap_for_valid_iterator_prototype();
 
     // Alias for the AsyncGenerator Prototype Object used by the spec (%AsyncGeneratorFunction.prototype.prototype%)
-    GC::Ref<Object> async_generator_function_prototype_prototype() { return *m_async_generator_prototype; }
+    GC::Ref<Object> async_generator_function_prototype_prototype() { return async_generator_prototype(); }
     // Alias for the Generator Prototype Object used by the spec (%GeneratorFunction.prototype.prototype%)
-    GC::Ref<Object> generator_function_prototype_prototype() { return *m_generator_prototype; }
+    GC::Ref<Object> generator_function_prototype_prototype() { return generator_prototype(); }
 
     // Not included in JS_ENUMERATE_INTL_OBJECTS due to missing distinct constructor
-    GC::Ref<Object> intl_segments_prototype() { return *m_intl_segments_prototype; }
+    GC::Ref<Object> intl_segments_prototype();
 
     // Global object functions
     GC::Ref<FunctionObject> eval_function() const { return *m_eval_function; }
@@ -87,11 +88,11 @@ public:
     GC::Ref<FunctionObject> unescape_function() const { return *m_unescape_function; }
 
     // Namespace/constructor object functions
-    GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
-    GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
+    GC::Ref<FunctionObject> array_prototype_values_function();
+    GC::Ref<FunctionObject> date_constructor_now_function();
+    GC::Ref<FunctionObject> json_parse_function();
+    GC::Ref<FunctionObject> json_stringify_function();
+    GC::Ref<FunctionObject> object_prototype_to_string_function();
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -118,10 +119,7 @@ public:
 #undef __JS_ENUMERATE
 
 #define __JS_ENUMERATE(ClassName, snake_name) \
-    GC::Ref<Object> snake_name##_prototype()  \
-    {                                         \
-        return *m_##snake_name##_prototype;   \
-    }
+    GC::Ref<Object> snake_name##_prototype();
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
@@ -110,6 +110,17 @@ ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value val
 
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(Utf16String {}, value));
+
+    // OPTIMIZATION: Without a replacer or indentation, every nested value's serialization is
+    //               concatenated into its parent unchanged, so we can stream the whole result
+    //               into a single builder instead of building a String per value.
+    if (!state.replacer_function && !state.property_list.has_value() && state.gap.is_empty()) {
+        StringBuilder builder;
+        if (!TRY(serialize_json_property_compact(vm, state, builder, Utf16String {}, wrapper)))
+            return Optional<String> {};
+        return builder.to_string_without_validation();
+    }
+
     return serialize_json_property(vm, state, Utf16String {}, wrapper);
 }
 
@@ -359,11 +370,139 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
     return builder.to_string_without_validation();
 }
 
+// A streaming variant of SerializeJSONProperty for the common no-replacer, no-indent case. It
+// follows the same steps as serialize_json_property() above, but appends into the shared builder
+// and signals the "return undefined" case through its return value.
+ThrowCompletionOr<bool> JSONObject::serialize_json_property_compact(VM& vm, StringifyState& state, StringBuilder& builder, PropertyKey const& key, Object* holder)
+{
+    auto value = TRY(holder->get(key));
+
+    if (value.is_object() || value.is_bigint()) {
+        auto to_json = TRY(value.get(vm, vm.names.toJSON));
+        if (to_json.is_function())
+            value = TRY(call(vm, to_json.as_function(), value, PrimitiveString::create(vm, key.to_string())));
+    }
+
+    if (value.is_object()) {
+        auto& value_object = value.as_object();
+
+        if (is<RawJSONObject>(value_object)) {
+            builder.append(MUST(value_object.get(vm.names.rawJSON)).as_string().utf8_string());
+            return true;
+        }
+        if (is<NumberObject>(value_object))
+            value = TRY(value.to_number(vm));
+        else if (is<StringObject>(value_object))
+            value = TRY(value.to_primitive_string(vm));
+        else if (is<BooleanObject>(value_object))
+            value = Value(static_cast<BooleanObject&>(value_object).boolean());
+        else if (is<BigIntObject>(value_object))
+            value = Value(&static_cast<BigIntObject&>(value_object).bigint());
+    }
+
+    if (value.is_null()) {
+        builder.append("null"sv);
+        return true;
+    }
+
+    if (value.is_boolean()) {
+        builder.append(value.as_bool() ? "true"sv : "false"sv);
+        return true;
+    }
+
+    if (value.is_string()) {
+        quote_json_string_into(builder, value.as_string().utf16_string_view());
+        return true;
+    }
+
+    if (value.is_number()) {
+        if (value.is_finite_number())
+            builder.append(MUST(value.to_string(vm)));
+        else
+            builder.append("null"sv);
+        return true;
+    }
+
+    if (value.is_bigint())
+        return vm.throw_completion<TypeError>(ErrorType::JsonBigInt);
+
+    if (value.is_object() && !value.is_function()) {
+        auto is_array = TRY(value.is_array(vm));
+        if (is_array)
+            TRY(serialize_json_array_compact(vm, state, builder, value.as_object()));
+        else
+            TRY(serialize_json_object_compact(vm, state, builder, value.as_object()));
+        return true;
+    }
+
+    return false;
+}
+
+ThrowCompletionOr<void> JSONObject::serialize_json_object_compact(VM& vm, StringifyState& state, StringBuilder& builder, Object& object)
+{
+    if (state.seen_objects.contains(&object))
+        return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
+    state.seen_objects.set(&object);
+
+    builder.append('{');
+    bool first = true;
+
+    auto property_list = TRY(object.enumerable_own_property_names(PropertyKind::Key));
+    for (auto& property : property_list) {
+        PropertyKey key = property.as_string().utf16_string();
+
+        // A property whose value serializes to undefined is omitted entirely, so remember where
+        // it started and roll the builder back if that happens.
+        auto builder_length_before_property = builder.length();
+        if (!first)
+            builder.append(',');
+        quote_json_string_into(builder, key.to_string());
+        builder.append(':');
+
+        if (TRY(serialize_json_property_compact(vm, state, builder, key, &object)))
+            first = false;
+        else
+            builder.trim(builder.length() - builder_length_before_property);
+    }
+
+    builder.append('}');
+    state.seen_objects.remove(&object);
+    return {};
+}
+
+ThrowCompletionOr<void> JSONObject::serialize_json_array_compact(VM& vm, StringifyState& state, StringBuilder& builder, Object& object)
+{
+    if (state.seen_objects.contains(&object))
+        return vm.throw_completion<TypeError>(ErrorType::JsonCircular);
+    state.seen_objects.set(&object);
+
+    builder.append('[');
+
+    auto length = TRY(length_of_array_like(vm, object));
+    for (size_t i = 0; i < length; ++i) {
+        if (i != 0)
+            builder.append(',');
+        // An element that serializes to undefined is emitted as "null".
+        if (!TRY(serialize_json_property_compact(vm, state, builder, i, &object)))
+            builder.append("null"sv);
+    }
+
+    builder.append(']');
+    state.seen_objects.remove(&object);
+    return {};
+}
+
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
 String JSONObject::quote_json_string(Utf16View const& string)
 {
-    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
     StringBuilder builder;
+    quote_json_string_into(builder, string);
+    return builder.to_string_without_validation();
+}
+
+void JSONObject::quote_json_string_into(StringBuilder& builder, Utf16View const& string)
+{
+    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
     builder.append('"');
 
     // 2. For each code point C of StringToCodePoints(value), do
@@ -409,9 +548,6 @@ String JSONObject::quote_json_string(Utf16View const& string)
 
     // 3. Set product to the string-concatenation of product and the code unit 0x0022 (QUOTATION MARK).
     builder.append('"');
-
-    // 4. Return product.
-    return builder.to_string_without_validation();
 }
 
 // 25.5.1 JSON.parse ( text [ , reviver ] ), https://tc39.es/ecma262/#sec-json.parse
@@ -471,11 +607,17 @@ ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 }
 
 Value JSONObject::parse_json_value(VM& vm, JsonValue const& value)
+{
+    PropertyKeyCache property_key_cache;
+    return parse_json_value(vm, value, property_key_cache);
+}
+
+Value JSONObject::parse_json_value(VM& vm, JsonValue const& value, PropertyKeyCache& property_key_cache)
 {
     if (value.is_object())
-        return Value(parse_json_object(vm, value.as_object()));
+        return Value(parse_json_object(vm, value.as_object(), property_key_cache));
     if (value.is_array())
-        return Value(parse_json_array(vm, value.as_array()));
+        return Value(parse_json_array(vm, value.as_array(), property_key_cache));
     if (value.is_null())
         return js_null();
     if (auto double_value = value.get_double_with_precision_loss(); double_value.has_value())
@@ -487,23 +629,24 @@ Value JSONObject::parse_json_value(VM& vm, JsonValue const& value)
     VERIFY_NOT_REACHED();
 }
 
-Object* JSONObject::parse_json_object(VM& vm, JsonObject const& json_object)
+Object* JSONObject::parse_json_object(VM& vm, JsonObject const& json_object, PropertyKeyCache& property_key_cache)
 {
     auto& realm = *vm.current_realm();
     auto object = Object::create(realm, realm.intrinsics().object_prototype());
     json_object.for_each_member([&](auto& key, auto& value) {
-        object->define_direct_property(Utf16String::from_utf8(key), parse_json_value(vm, value), default_attributes);
+        auto property_key = property_key_cache.ensure(key, [&] { return Utf16String::from_utf8(key); });
+        object->define_direct_property(move(property_key), parse_json_value(vm, value, property_key_cache), default_attributes);
     });
     return object;
 }
 
-Array* JSONObject::parse_json_array(VM& vm, JsonArray const& json_array)
+Array* JSONObject::parse_json_array(VM& vm, JsonArray const& json_array, PropertyKeyCache& property_key_cache)
 {
     auto& realm = *vm.current_realm();
     auto array = MUST(Array::create(realm, 0));
     size_t index = 0;
     json_array.for_each([&](auto& value) {
-        array->define_direct_property(index++, parse_json_value(vm, value), default_attributes);
+        array->define_direct_property(index++, parse_json_value(vm, value, property_key_cache), default_attributes);
     });
     return array;
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/Object.h>
 
@@ -42,10 +43,23 @@ private:
     static ThrowCompletionOr<String> serialize_json_object(VM&, StringifyState&, Object&);
     static ThrowCompletionOr<String> serialize_json_array(VM&, StringifyState&, Object&);
     static String quote_json_string(Utf16View const&);
+    static void quote_json_string_into(StringBuilder&, Utf16View const&);
+
+    // Compact stringify helpers, used when there is no replacer and no indentation. They serialize
+    // directly into a single builder instead of building a String per value; the property helper
+    // returns whether the value serialized to something (false corresponds to returning undefined
+    // from SerializeJSONProperty).
+    static ThrowCompletionOr<bool> serialize_json_property_compact(VM&, StringifyState&, StringBuilder&, PropertyKey const& key, Object* holder);
+    static ThrowCompletionOr<void> serialize_json_object_compact(VM&, StringifyState&, StringBuilder&, Object&);
+    static ThrowCompletionOr<void> serialize_json_array_compact(VM&, StringifyState&, StringBuilder&, Object&);
 
     // Parse helpers
-    static Object* parse_json_object(VM&, JsonObject const&);
-    static Array* parse_json_array(VM&, JsonArray const&);
+    // NOTE: The key cache deduplicates the UTF-8 to UTF-16 conversion of property keys, which are
+    //       repeated endlessly in JSON texts containing arrays of homogeneous records.
+    using PropertyKeyCache = HashMap<String, Utf16String>;
+    static Value parse_json_value(VM&, JsonValue const&, PropertyKeyCache&);
+    static Object* parse_json_object(VM&, JsonObject const&, PropertyKeyCache&);
+    static Array* parse_json_array(VM&, JsonArray const&, PropertyKeyCache&);
     static ThrowCompletionOr<Value> internalize_json_property(VM&, Object* holder, PropertyKey const& name, FunctionObject& reviver);
 
     JS_DECLARE_NATIVE_FUNCTION(stringify);
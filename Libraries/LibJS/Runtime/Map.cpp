@@ -23,71 +23,106 @@ Map::Map(Object& prototype)
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
+    // NOTE: m_next_insertion_id is deliberately not reset, so that live iterators do not revisit
+    //       entries added after the clear out of order.
     m_entries.clear();
+    m_entry_indices.clear();
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
+    auto it = m_entry_indices.find(key);
+    if (it == m_entry_indices.end())
+        return false;
 
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
+    auto& entry = m_entries[it->value];
+    entry.key = js_special_empty_value();
+    entry.value = js_special_empty_value();
+    m_entry_indices.remove(it);
 
-    if (!index.has_value())
-        return false;
+    if (m_entry_indices.size() < m_entries.size() / 2)
+        compact_entries();
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
     return true;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto it = m_entry_indices.find(key); it != m_entry_indices.end())
+        return m_entries[it->value].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return m_entry_indices.contains(key);
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
+    auto it = m_entry_indices.find(key);
+    if (it != m_entry_indices.end()) {
+        m_entries[it->value].value = value;
     } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+        m_entries.append({ m_next_insertion_id++, key, value });
+        m_entry_indices.set(key, m_entries.size() - 1);
     }
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_entry_indices.size();
+}
+
+Map::Entry const* Map::find_next_entry(size_t id_not_below) const
+{
+    // The entries are ordered by insertion id, so binary search for the first candidate, then
+    // skip over any tombstones.
+    size_t low = 0;
+    size_t high = m_entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_entries[middle].insertion_id < id_not_below)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    for (; low < m_entries.size(); ++low) {
+        if (!m_entries[low].is_tombstone())
+            return &m_entries[low];
+    }
+    return nullptr;
+}
+
+void Map::compact_entries()
+{
+    // Dropping tombstones preserves the relative order and the insertion ids of the remaining
+    // entries, so live iterators are unaffected; only the index table has to be rebuilt.
+    Vector<Entry> compacted_entries;
+    compacted_entries.ensure_capacity(m_entry_indices.size());
+    for (auto const& entry : m_entries) {
+        if (!entry.is_tombstone())
+            compacted_entries.unchecked_append(entry);
+    }
+    m_entries = move(compacted_entries);
+
+    for (size_t i = 0; i < m_entries.size(); ++i)
+        m_entry_indices.set(m_entries[i].key, i);
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
+    // NOTE: The keys in m_entry_indices are already visited by the walk over m_entries above.
 }
 
 }
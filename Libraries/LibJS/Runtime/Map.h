@@ -7,7 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -16,6 +16,16 @@
 
 namespace JS {
 
+// Map is stored as a dense entry vector ordered by insertion, plus a hash table mapping keys to
+// entry vector indices. Iteration is a linear walk over the entry vector; lookups are a single
+// hash table probe. Removed entries leave a tombstone (special empty key) so that the indices of
+// later entries remain stable; the vector is compacted once tombstones outnumber live entries.
+//
+// Iterators identify their position by insertion id rather than by index, so they survive
+// compaction: advancing binary-searches the id-ordered entry vector for the next id not yet
+// visited. This also gives the iteration semantics the spec asks for — entries added during
+// iteration are visited, removed entries are skipped, and clearing does not detach live
+// iterators.
 class JS_API Map : public Object {
     JS_OBJECT(Map, Object);
     GC_DECLARE_ALLOCATOR(Map);
@@ -34,6 +44,14 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    struct Entry {
+        size_t insertion_id { 0 };
+        Value key;
+        Value value;
+
+        bool is_tombstone() const { return key.is_special_empty_value(); }
+    };
+
     struct EndIterator {
     };
 
@@ -41,8 +59,7 @@ public:
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            return m_map->find_next_entry(m_index) == nullptr;
         }
 
         IteratorImpl& operator++()
@@ -51,16 +68,20 @@ public:
             return *this;
         }
 
-        decltype(auto) operator*()
+        Entry const& operator*()
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            auto const* entry = m_map->find_next_entry(m_index);
+            VERIFY(entry);
+            m_index = entry->insertion_id;
+            return *entry;
         }
 
-        decltype(auto) operator*() const
+        Entry const& operator*() const
         {
-            ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            auto const* entry = m_map->find_next_entry(m_index);
+            VERIFY(entry);
+            m_index = entry->insertion_id;
+            return *entry;
         }
 
         bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
@@ -72,30 +93,12 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
-        }
-
-        void ensure_next_element() const
-        {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
@@ -113,9 +116,12 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    Entry const* find_next_entry(size_t id_not_below) const;
+    void compact_entries();
+
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
+    Vector<Entry> m_entries;
+    HashMap<Value, size_t, ValueTraits> m_entry_indices;
 };
 
 template<>
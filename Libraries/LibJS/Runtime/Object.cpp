@@ -406,6 +406,17 @@ ThrowCompletionOr<GC::RootVector<Value>> Object::enumerable_own_property_names(P
     auto properties = GC::RootVector<Value> { heap() };
     properties.ensure_capacity(own_properties_count());
 
+    // OPTIMIZATION: When only keys are requested, no user code can run while we assemble the
+    //               result, so ordinary objects without indexed properties can be answered
+    //               straight from the shape's cached enumeration order.
+    if (kind == PropertyKind::Key && eligible_for_own_property_enumeration_fast_path() && m_indexed_properties.is_empty()) {
+        for (auto const& entry : shape().own_string_property_keys()) {
+            if (entry.enumerable)
+                properties.append(entry.key.to_value(vm));
+        }
+        return { move(properties) };
+    }
+
     auto& pre_iteration_shape = shape();
     TRY(for_each_own_property_with_enumerability([&](PropertyKey const& property_key, bool enumerable) -> ThrowCompletionOr<void> {
         // a. If Type(key) is String, then
@@ -1372,11 +1383,10 @@ ThrowCompletionOr<void> Object::for_each_own_property_with_enumerability(Functio
         for (auto& entry : m_indexed_properties)
             keys.unchecked_append({ PropertyKey(entry.index()), entry.enumerable() });
 
-        for (auto const& [property_key, metadata] : shape().property_table()) {
-            if (!property_key.is_string())
-                continue;
-            keys.unchecked_append({ property_key, metadata.attributes.is_enumerable() });
-        }
+        // NOTE: The cached keys are copied into a snapshot since the callback may mutate the
+        //       shape, which would invalidate the cache out from under us.
+        for (auto const& entry : shape().own_string_property_keys())
+            keys.unchecked_append({ entry.key, entry.enumerable });
 
         for (auto& key : keys)
             TRY(callback(key.property_key, key.enumerable));
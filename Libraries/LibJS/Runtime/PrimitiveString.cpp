@@ -185,6 +185,12 @@ Utf16View PrimitiveString::utf16_string_view() const
 
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    // OPTIMIZATION: Reading a rope's length doesn't require flattening it. This keeps the common
+    //               pattern of checking `.length` while building up a string with `+=` in a loop
+    //               from resolving the rope on every iteration.
+    if (m_is_rope) [[unlikely]]
+        return static_cast<RopeString const&>(*this).length_in_utf16_code_units_without_resolving();
+
     return utf16_string_view().length_in_code_units();
 }
 
@@ -230,6 +236,40 @@ void PrimitiveString::resolve_rope_if_needed(EncodingPreference preference) cons
     rope_string.resolve(preference);
 }
 
+size_t RopeString::length_in_utf16_code_units_without_resolving() const
+{
+    VERIFY(m_is_rope);
+
+    if (m_length_in_utf16_code_units.has_value())
+        return *m_length_in_utf16_code_units;
+
+    // NOTE: Like resolve(), we traverse the rope tree without using recursion, since a long
+    //       sequence of unresolved concatenations produces a very deep tree. Nested ropes with a
+    //       known length are not descended into, so repeatedly appending to a string and asking
+    //       for its length only has to look at the new pieces each time.
+    size_t length = 0;
+    Vector<PrimitiveString const*, 2> stack;
+    stack.append(m_rhs);
+    stack.append(m_lhs);
+    while (!stack.is_empty()) {
+        auto const* current = stack.take_last();
+        if (current->m_is_rope) {
+            auto& current_rope_string = static_cast<RopeString const&>(*current);
+            if (current_rope_string.m_length_in_utf16_code_units.has_value()) {
+                length += *current_rope_string.m_length_in_utf16_code_units;
+                continue;
+            }
+            stack.append(current_rope_string.m_rhs);
+            stack.append(current_rope_string.m_lhs);
+            continue;
+        }
+        length += current->length_in_utf16_code_units();
+    }
+
+    m_length_in_utf16_code_units = length;
+    return length;
+}
+
 void RopeString::resolve(EncodingPreference preference) const
 {
 
@@ -100,8 +100,11 @@ private:
 
     void resolve(EncodingPreference) const;
 
+    size_t length_in_utf16_code_units_without_resolving() const;
+
     mutable GC::Ptr<PrimitiveString> m_lhs;
     mutable GC::Ptr<PrimitiveString> m_rhs;
+    mutable Optional<size_t> m_length_in_utf16_code_units;
 };
 
 }
@@ -228,6 +228,25 @@ FLATTEN OrderedHashMap<PropertyKey, PropertyMetadata> const& Shape::property_tab
     return *m_property_table;
 }
 
+Vector<Shape::OwnStringKey> const& Shape::own_string_property_keys() const
+{
+    if (m_cached_own_string_keys && m_cached_own_string_keys_generation == m_dictionary_generation)
+        return *m_cached_own_string_keys;
+
+    auto keys = make<Vector<OwnStringKey>>();
+    keys->ensure_capacity(property_count());
+    for (auto const& [property_key, metadata] : property_table()) {
+        if (property_key.is_string())
+            keys->unchecked_append({ property_key, metadata.attributes.is_enumerable() });
+    }
+
+    // NOTE: The cached keys don't need to be visited by the garbage collector: symbol keys are
+    //       excluded, and string keys are plain reference-counted strings.
+    m_cached_own_string_keys = move(keys);
+    m_cached_own_string_keys_generation = m_dictionary_generation;
+    return *m_cached_own_string_keys;
+}
+
 void Shape::ensure_property_table() const
 {
     if (m_property_table)
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
+#include <AK/Vector.h>
 #include <AK/Weakable.h>
 #include <LibGC/Weak.h>
 #include <LibJS/Export.h>
@@ -100,6 +101,17 @@ public:
     OrderedHashMap<PropertyKey, PropertyMetadata> const& property_table() const;
     u32 property_count() const { return m_property_count; }
 
+    struct OwnStringKey {
+        PropertyKey key;
+        bool enumerable { false };
+    };
+
+    // The shape's string-keyed properties in enumeration order, cached so that hot shapes don't
+    // re-walk the property table for every Object.keys / for-in. The cache is keyed on the
+    // dictionary generation, so in-place mutations of dictionary shapes invalidate it; regular
+    // shapes never mutate their property table after creation.
+    [[nodiscard]] Vector<OwnStringKey> const& own_string_property_keys() const;
+
     struct Property {
         PropertyKey key;
         PropertyMetadata value;
@@ -129,6 +141,9 @@ private:
 
     mutable OwnPtr<OrderedHashMap<PropertyKey, PropertyMetadata>> m_property_table;
 
+    mutable OwnPtr<Vector<OwnStringKey>> m_cached_own_string_keys;
+    mutable u32 m_cached_own_string_keys_generation { 0 };
+
     OwnPtr<HashMap<TransitionKey, GC::Weak<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, GC::Weak<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<PropertyKey, GC::Weak<Shape>>> m_delete_transitions;
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -14,6 +15,7 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/TypedArrayPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <math.h>
 
 namespace JS {
 
@@ -503,6 +505,41 @@ inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 en
         *(slot++) = value;
 }
 
+// NOTE: This function assumes that the TypedArray is within the bounds of its ArrayBuffer, and that
+//       no user comparator is in play, so nothing can observe the elements mid-sort.
+template<typename T>
+inline void fast_typed_array_sort(TypedArrayBase& typed_array, u32 length)
+{
+    Checked<size_t> end_offset = length;
+    end_offset *= sizeof(T);
+    end_offset += typed_array.byte_offset();
+
+    if (end_offset.has_overflow() || end_offset.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
+        return;
+    }
+
+    auto& array_buffer = *typed_array.viewed_array_buffer();
+    auto* data = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(typed_array.byte_offset()));
+
+    if constexpr (IsFloatingPoint<T>) {
+        // This matches the ordering of CompareTypedArrayElements: NaN sorts after everything else,
+        // and -0 sorts before +0.
+        quick_sort(data, data + length, [](T x, T y) {
+            auto a = static_cast<double>(x);
+            auto b = static_cast<double>(y);
+            if (isnan(b))
+                return !isnan(a);
+            if (isnan(a))
+                return false;
+            if (a == b)
+                return signbit(a) && !signbit(b);
+            return a < b;
+        });
+    } else {
+        quick_sort(data, data + length, [](T a, T b) { return a < b; });
+    }
+}
+
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
 {
@@ -571,6 +608,24 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
+    // OPTIMIZATION: Any numeric value converts to a floating point element type without observable
+    //               side effects, so float arrays can always take the fast path.
+    if (value.is_number()) {
+        switch (typed_array->kind()) {
+        case TypedArrayBase::Kind::Float16Array:
+            fast_typed_array_fill<f16>(*typed_array, k, final, static_cast<f16>(value.as_double()));
+            return typed_array;
+        case TypedArrayBase::Kind::Float32Array:
+            fast_typed_array_fill<float>(*typed_array, k, final, static_cast<float>(value.as_double()));
+            return typed_array;
+        case TypedArrayBase::Kind::Float64Array:
+            fast_typed_array_fill<double>(*typed_array, k, final, value.as_double());
+            return typed_array;
+        default:
+            break;
+        }
+    }
+
     if (value.is_int32()) {
         switch (typed_array->kind()) {
         case TypedArrayBase::Kind::Uint8Array:
@@ -1736,6 +1791,19 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::slice)
                 return array;
             }
 
+            // OPTIMIZATION: When the species constructor produced a view into a different, non-shared
+            //               buffer, the bytes can be moved in one go. The byte-wise loop below is only
+            //               needed when both views alias the same buffer (where the forward copy order
+            //               is observable) or for shared buffers.
+            auto count_bytes = static_cast<size_t>(limit.value() - target_byte_index);
+            if (&source_buffer != &target_buffer
+                && !source_buffer.is_shared_array_buffer() && !target_buffer.is_shared_array_buffer()
+                && source_byte_index.value() + count_bytes <= source_buffer.byte_length()
+                && limit.value() <= target_buffer.byte_length()) {
+                memcpy(target_buffer.buffer().offset_pointer(target_byte_index), source_buffer.buffer().offset_pointer(source_byte_index.value()), count_bytes);
+                return array;
+            }
+
             // ix. Repeat, while targetByteIndex < limit,
             while (target_byte_index < limit) {
                 // 1. Let value be GetValueFromBuffer(srcBuffer, srcByteIndex, uint8, true, unordered).
@@ -1838,6 +1906,51 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparator no user code can run during the sort, so the elements can
+    //               be sorted in place without boxing each of them into a Value and copying them
+    //               through a list.
+    if (compare_function.is_undefined() && !typed_array->viewed_array_buffer()->is_shared_array_buffer()) {
+        switch (typed_array->kind()) {
+        case TypedArrayBase::Kind::Uint8Array:
+        case TypedArrayBase::Kind::Uint8ClampedArray:
+            fast_typed_array_sort<u8>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Uint16Array:
+            fast_typed_array_sort<u16>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Uint32Array:
+            fast_typed_array_sort<u32>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::BigUint64Array:
+            fast_typed_array_sort<u64>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Int8Array:
+            fast_typed_array_sort<i8>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Int16Array:
+            fast_typed_array_sort<i16>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Int32Array:
+            fast_typed_array_sort<i32>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::BigInt64Array:
+            fast_typed_array_sort<i64>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Float16Array:
+            fast_typed_array_sort<f16>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Float32Array:
+            fast_typed_array_sort<float>(*typed_array, length);
+            break;
+        case TypedArrayBase::Kind::Float64Array:
+            fast_typed_array_sort<double>(*typed_array, length);
+            break;
+        }
+
+        // Return obj (step 10).
+        return typed_array;
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGC/WeakInlines.h>
 #include <LibJS/Runtime/WeakRef.h>
 
 namespace JS {
@@ -22,39 +23,34 @@ GC::Ref<WeakRef> WeakRef::create(Realm& realm, Symbol& value)
 
 WeakRef::WeakRef(Object& value, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
-    , WeakContainer(heap())
-    , m_value(&value)
+    , m_value(GC::Weak<Object> { value })
     , m_last_execution_generation(vm().execution_generation())
 {
 }
 
 WeakRef::WeakRef(Symbol& value, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
-    , WeakContainer(heap())
-    , m_value(&value)
+    , m_value(GC::Weak<Symbol> { value })
     , m_last_execution_generation(vm().execution_generation())
 {
 }
 
-void WeakRef::remove_dead_cells(Badge<GC::Heap>)
+Value WeakRef::value() const
 {
-    if (m_value.visit([](Cell* cell) -> bool { return cell->state() == Cell::State::Live; }, [](Empty) -> bool { VERIFY_NOT_REACHED(); }))
-        return;
-
-    m_value = Empty {};
-    // This is an optimization, we deregister from the garbage collector early (even if we were not garbage collected ourself yet)
-    // to reduce the garbage collection overhead, which we can do because a cleared weak ref cannot be reused.
-    WeakContainer::deregister();
+    return m_value.visit([](auto const& value) -> Value {
+        if (!value)
+            return js_undefined();
+        return value.ptr();
+    });
 }
 
 void WeakRef::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
 
-    if (vm().execution_generation() == m_last_execution_generation) {
-        auto* cell = m_value.visit([](Cell* cell) -> Cell* { return cell; }, [](Empty) -> Cell* { return nullptr; });
-        visitor.visit(cell);
-    }
+    // AddToKeptObjects: keep the target strongly alive until the end of the current job.
+    if (vm().execution_generation() == m_last_execution_generation)
+        m_value.visit([&](auto const& value) { visitor.visit(value.ptr()); });
 }
 
 }
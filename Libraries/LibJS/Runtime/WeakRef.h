@@ -6,15 +6,13 @@
 
 #pragma once
 
-#include <LibGC/WeakContainer.h>
+#include <LibGC/Weak.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
 
-class WeakRef final
-    : public Object
-    , public GC::WeakContainer {
+class WeakRef final : public Object {
     JS_OBJECT(WeakRef, Object);
     GC_DECLARE_ALLOCATOR(WeakRef);
 
@@ -24,19 +22,21 @@ public:
 
     virtual ~WeakRef() override = default;
 
-    auto const& value() const { return m_value; }
+    // Returns the target, or undefined if it has been garbage collected.
+    Value value() const;
 
     void update_execution_generation() { m_last_execution_generation = vm().execution_generation(); }
 
-    virtual void remove_dead_cells(Badge<GC::Heap>) override;
-
 private:
     explicit WeakRef(Object&, Object& prototype);
     explicit WeakRef(Symbol&, Object& prototype);
 
     virtual void visit_edges(Visitor&) override;
 
-    Variant<GC::Ptr<Object>, GC::Ptr<Symbol>, Empty> m_value;
+    // NOTE: The target is held through the GC::Weak mechanism, which clears it centrally when
+    //       the weak blocks are swept. This way the heap doesn't have to visit every live
+    //       WeakRef as a weak container at the end of each collection.
+    Variant<GC::Weak<Object>, GC::Weak<Symbol>> m_value;
     u32 m_last_execution_generation { 0 };
 };
 
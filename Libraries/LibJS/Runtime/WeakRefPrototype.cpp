@@ -35,9 +35,7 @@ JS_DEFINE_NATIVE_FUNCTION(WeakRefPrototype::deref)
 
     // 3. Return WeakRefDeref(weakRef).
     weak_ref->update_execution_generation();
-    return weak_ref->value().visit(
-        [](Empty) -> Value { return js_undefined(); },
-        [](auto value) -> Value { return value; });
+    return weak_ref->value();
 }
 
 }
@@ -29,7 +29,12 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
 
-Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program> parse_node, HostDefined* host_defined)
+GC::Ref<Script> Script::create(NonnullRefPtr<Program const> parse_node, Realm& realm, StringView filename, HostDefined* host_defined)
+{
+    return realm.heap().allocate<Script>(realm, filename, move(parse_node), host_defined);
+}
+
+Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program const> parse_node, HostDefined* host_defined)
     : m_realm(realm)
     , m_parse_node(move(parse_node))
     , m_filename(filename)
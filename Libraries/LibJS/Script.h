@@ -38,6 +38,10 @@ public:
     virtual ~Script() override;
     static Result<GC::Ref<Script>, Vector<ParserError>> parse(StringView source_text, Realm&, StringView filename = {}, HostDefined* = nullptr, size_t line_number_offset = 1);
 
+    // Creates a Script Record from an already-parsed program. The AST is realm-independent, so
+    // embedders can cache it and skip the parser when the same source is loaded again.
+    static GC::Ref<Script> create(NonnullRefPtr<Program const> parse_node, Realm&, StringView filename = {}, HostDefined* = nullptr);
+
     Realm& realm() { return *m_realm; }
     Program const& parse_node() const { return *m_parse_node; }
     Vector<LoadedModuleRequest>& loaded_modules() { return m_loaded_modules; }
@@ -47,12 +51,12 @@ public:
     StringView filename() const LIFETIME_BOUND { return m_filename; }
 
 private:
-    Script(Realm&, StringView filename, NonnullRefPtr<Program>, HostDefined* = nullptr);
+    Script(Realm&, StringView filename, NonnullRefPtr<Program const>, HostDefined* = nullptr);
 
     virtual void visit_edges(Cell::Visitor&) override;
 
     GC::Ptr<Realm> m_realm;                       // [[Realm]]
-    NonnullRefPtr<Program> m_parse_node;          // [[ECMAScriptCode]]
+    NonnullRefPtr<Program const> m_parse_node;    // [[ECMAScriptCode]]
     Vector<LoadedModuleRequest> m_loaded_modules; // [[LoadedModules]]
 
     // Needed for potential lookups of modules.
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/HashMap.h>
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Parser.h>
@@ -117,6 +118,14 @@ SourceTextModule::SourceTextModule(Realm& realm, StringView filename, Script::Ho
     , m_star_export_entries(move(star_export_entries))
     , m_default_export(move(default_export))
 {
+    for (size_t i = 0; i < m_local_export_entries.size(); ++i) {
+        if (m_local_export_entries[i].export_name.has_value())
+            m_local_export_entries_by_export_name.set(*m_local_export_entries[i].export_name, i);
+    }
+    for (size_t i = 0; i < m_indirect_export_entries.size(); ++i) {
+        if (m_indirect_export_entries[i].export_name.has_value())
+            m_indirect_export_entries_by_export_name.set(*m_indirect_export_entries[i].export_name, i);
+    }
 }
 
 SourceTextModule::~SourceTextModule() = default;
@@ -148,8 +157,12 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
         import_entries.extend(import_statement->entries());
 
     // 5. Let importedBoundNames be ImportedLocalNames(importEntries).
-    // NOTE: Since we have to potentially extract the import entry we just use importEntries
-    //       In the future it might be an optimization to have a set/map of string to speed up the search.
+    // OPTIMIZATION: Since we have to potentially extract the import entry, we map each local name
+    //               to its index in importEntries instead of searching the list for every export.
+    HashMap<Utf16FlyString, size_t> imported_bound_names;
+    imported_bound_names.ensure_capacity(import_entries.size());
+    for (size_t i = 0; i < import_entries.size(); ++i)
+        imported_bound_names.set(import_entries[i].local_name, i);
 
     // 6. Let indirectExportEntries be a new empty List.
     Vector<ExportEntry> indirect_export_entries;
@@ -174,11 +187,7 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
             auto const& entry = export_statement->entries()[0];
             VERIFY(entry.kind == ExportEntry::Kind::NamedExport);
             VERIFY(!entry.is_module_request());
-            VERIFY(import_entries.find_if(
-                                     [&](ImportEntry const& import_entry) {
-                                         return import_entry.local_name == entry.local_or_import_name;
-                                     })
-                    .is_end());
+            VERIFY(!entry.local_or_import_name.has_value() || !imported_bound_names.contains(*entry.local_or_import_name));
             default_export = export_statement;
         }
 
@@ -193,20 +202,19 @@ Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(S
             // a. If ee.[[ModuleRequest]] is null, then
             if (!export_entry.is_module_request()) {
 
-                auto in_imported_bound_names = import_entries.find_if(
-                    [&](ImportEntry const& import_entry) {
-                        return import_entry.local_name == export_entry.local_or_import_name;
-                    });
+                auto in_imported_bound_names = export_entry.local_or_import_name.has_value()
+                    ? imported_bound_names.get(*export_entry.local_or_import_name)
+                    : Optional<size_t> {};
 
                 // i. If ee.[[LocalName]] is not an element of importedBoundNames, then
-                if (in_imported_bound_names.is_end()) {
+                if (!in_imported_bound_names.has_value()) {
                     // 1. Append ee to localExportEntries.
                     local_export_entries.empend(export_entry);
                 }
                 // ii. Else,
                 else {
                     // 1. Let ie be the element of importEntries whose [[LocalName]] is the same as ee.[[LocalName]].
-                    auto& import_entry = *in_imported_bound_names;
+                    auto& import_entry = import_entries[*in_imported_bound_names];
 
                     // 2. If ie.[[ImportName]] is NAMESPACE-OBJECT, then
                     if (import_entry.is_namespace()) {
@@ -567,10 +575,9 @@ ResolvedBinding SourceTextModule::resolve_export(VM& vm, Utf16FlyString const& e
     resolve_set.append({ ResolvedBinding::Type::BindingName, this, export_name });
 
     // 5. For each ExportEntry Record e of module.[[LocalExportEntries]], do
-    for (auto const& entry : m_local_export_entries) {
-        // a. If e.[[ExportName]] is exportName, then
-        if (export_name != entry.export_name)
-            continue;
+    // a. If e.[[ExportName]] is exportName, then
+    if (auto entry_index = m_local_export_entries_by_export_name.get(export_name); entry_index.has_value()) {
+        auto const& entry = m_local_export_entries[*entry_index];
 
         // i. Assert: module provides the direct binding for this export.
         // FIXME: What does this mean?
@@ -584,10 +591,9 @@ ResolvedBinding SourceTextModule::resolve_export(VM& vm, Utf16FlyString const& e
     }
 
     // 5. For each ExportEntry Record e of module.[[IndirectExportEntries]], do
-    for (auto const& entry : m_indirect_export_entries) {
-        // a. If e.[[ExportName]] is exportName, then
-        if (export_name != entry.export_name)
-            continue;
+    // a. If e.[[ExportName]] is exportName, then
+    if (auto entry_index = m_indirect_export_entries_by_export_name.get(export_name); entry_index.has_value()) {
+        auto const& entry = m_indirect_export_entries[*entry_index];
 
         // i. Assert: e.[[ModuleRequest]] is not null.
         // ii. Let importedModule be GetImportedModule(module, e.[[ModuleRequest]]).
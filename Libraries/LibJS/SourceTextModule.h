@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibJS/CyclicModule.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
@@ -52,6 +53,12 @@ private:
     Vector<ExportEntry> m_indirect_export_entries;       // [[IndirectExportEntries]]
     Vector<ExportEntry> m_star_export_entries;           // [[StarExportEntries]]
 
+    // OPTIMIZATION: ResolveExport is called once per imported binding while linking the module
+    //               graph, so we keep maps from export name to entry index instead of scanning
+    //               the export entry lists for every lookup.
+    HashMap<Utf16FlyString, size_t> m_local_export_entries_by_export_name;
+    HashMap<Utf16FlyString, size_t> m_indirect_export_entries_by_export_name;
+
     RefPtr<ExportStatement const> m_default_export; // Note: Not from the spec
 };
 
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/FixedArray.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Span.h>
+
+namespace Audio {
+
+// A single-producer, single-consumer ring buffer of interleaved audio samples. All storage is
+// allocated up front, and read() and write() neither lock nor allocate, so the consumer side is
+// safe to call from a real-time audio thread.
+class SampleRingBuffer {
+    AK_MAKE_NONCOPYABLE(SampleRingBuffer);
+    AK_MAKE_NONMOVABLE(SampleRingBuffer);
+
+public:
+    static ErrorOr<NonnullOwnPtr<SampleRingBuffer>> create(size_t minimum_sample_capacity)
+    {
+        // Round the capacity up to a power of two so that indices can be wrapped with a mask.
+        size_t sample_capacity = 1;
+        while (sample_capacity < minimum_sample_capacity)
+            sample_capacity *= 2;
+
+        auto storage = TRY(FixedArray<float>::create(sample_capacity));
+        return adopt_nonnull_own_or_enomem(new (nothrow) SampleRingBuffer(move(storage)));
+    }
+
+    size_t capacity() const { return m_storage.size(); }
+
+    size_t used() const
+    {
+        return m_write_index.load(AK::MemoryOrder::memory_order_acquire) - m_read_index.load(AK::MemoryOrder::memory_order_acquire);
+    }
+
+    size_t available() const { return capacity() - used(); }
+
+    // Producer side. Returns the number of samples actually written.
+    size_t write(ReadonlySpan<float> samples)
+    {
+        auto write_index = m_write_index.load(AK::MemoryOrder::memory_order_relaxed);
+        auto read_index = m_read_index.load(AK::MemoryOrder::memory_order_acquire);
+        auto samples_to_write = min(samples.size(), capacity() - (write_index - read_index));
+
+        auto mask = capacity() - 1;
+        for (size_t i = 0; i < samples_to_write; ++i)
+            m_storage[(write_index + i) & mask] = samples[i];
+
+        m_write_index.store(write_index + samples_to_write, AK::MemoryOrder::memory_order_release);
+        return samples_to_write;
+    }
+
+    // Consumer side. Returns the number of samples actually read.
+    size_t read(Span<float> samples)
+    {
+        auto read_index = m_read_index.load(AK::MemoryOrder::memory_order_relaxed);
+        auto write_index = m_write_index.load(AK::MemoryOrder::memory_order_acquire);
+        auto samples_to_read = min(samples.size(), write_index - read_index);
+
+        auto mask = capacity() - 1;
+        for (size_t i = 0; i < samples_to_read; ++i)
+            samples[i] = m_storage[(read_index + i) & mask];
+
+        m_read_index.store(read_index + samples_to_read, AK::MemoryOrder::memory_order_release);
+        return samples_to_read;
+    }
+
+    // NOTE: Only safe to call while the consumer is known not to be reading, e.g. after the playback
+    //       stream has been suspended around a seek.
+    void discard_all_samples()
+    {
+        m_read_index.store(m_write_index.load(AK::MemoryOrder::memory_order_acquire), AK::MemoryOrder::memory_order_release);
+    }
+
+private:
+    explicit SampleRingBuffer(FixedArray<float> storage)
+        : m_storage(move(storage))
+    {
+    }
+
+    FixedArray<float> m_storage;
+    Atomic<size_t> m_read_index { 0 };
+    Atomic<size_t> m_write_index { 0 };
+};
+
+}
@@ -872,7 +872,7 @@ DecoderErrorOr<void> Reader::seek_to_cue_for_timestamp(SampleIterator& iterator,
     return {};
 }
 
-static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp)
+DecoderErrorOr<void> Reader::search_clusters_for_keyframe_before_timestamp(SampleIterator& iterator, AK::Duration const& timestamp, Vector<KeyframeIndexEntry>& keyframe_index)
 {
 #if MATROSKA_DEBUG
     size_t inter_frames_count;
@@ -885,6 +885,10 @@ static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(Sample
 
         if (block.only_keyframes()) {
             last_keyframe.emplace(rewind_iterator);
+            // Record this keyframe so later seeks can resume here instead of rescanning from the
+            // start of the segment. Scans only move forward, so appending keeps the index sorted.
+            if (keyframe_index.is_empty() || keyframe_index.last().timestamp < block.timestamp())
+                keyframe_index.append({ block.timestamp(), rewind_iterator.m_position, rewind_iterator.m_current_cluster, rewind_iterator.m_last_timestamp });
 #if MATROSKA_DEBUG
             inter_frames_count = 0;
 #endif
@@ -922,14 +926,30 @@ DecoderErrorOr<SampleIterator> Reader::seek_to_random_access_point(SampleIterato
         return iterator;
     }
 
-    if (!iterator.last_timestamp().has_value() || timestamp < iterator.last_timestamp().value()) {
+    auto track_number = iterator.m_track->track_number();
+    auto& keyframe_index = m_keyframe_index.ensure(track_number);
+
+    // Find the latest keyframe we already know of that is at or before the timestamp.
+    KeyframeIndexEntry const* index_entry = nullptr;
+    for (auto const& entry : keyframe_index) {
+        if (entry.timestamp > timestamp)
+            break;
+        index_entry = &entry;
+    }
+
+    bool const is_backward_seek = !iterator.last_timestamp().has_value() || timestamp < iterator.last_timestamp().value();
+
+    if (index_entry != nullptr && (is_backward_seek || index_entry->timestamp > iterator.last_timestamp().value())) {
+        // Resume the scan from the known keyframe closest to the timestamp.
+        iterator.m_position = index_entry->position;
+        iterator.m_current_cluster = index_entry->cluster;
+        iterator.m_last_timestamp = index_entry->last_timestamp;
+    } else if (is_backward_seek) {
         // If the timestamp is before the iterator's current position, then we need to start from the beginning of the Segment.
-        iterator = TRY(create_sample_iterator(iterator.m_track->track_number()));
-        TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
-        return iterator;
+        iterator = TRY(create_sample_iterator(track_number));
     }
 
-    TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp));
+    TRY(search_clusters_for_keyframe_before_timestamp(iterator, timestamp, keyframe_index));
     return iterator;
 }
 
@@ -61,6 +61,18 @@ private:
     DecoderErrorOr<void> ensure_cues_are_parsed();
     DecoderErrorOr<void> seek_to_cue_for_timestamp(SampleIterator&, AK::Duration const&);
 
+    // OPTIMIZATION: Tracks without cues can only be seeked by linearly scanning clusters for keyframes.
+    //               Each scan records the keyframes it passes here, sorted by timestamp, so that later
+    //               seeks can resume from the nearest known keyframe instead of rescanning everything
+    //               before it.
+    struct KeyframeIndexEntry {
+        AK::Duration timestamp;
+        size_t position { 0 };
+        Optional<Cluster> cluster;
+        Optional<AK::Duration> last_timestamp;
+    };
+    static DecoderErrorOr<void> search_clusters_for_keyframe_before_timestamp(SampleIterator&, AK::Duration const&, Vector<KeyframeIndexEntry>&);
+
     RefPtr<Core::SharedMappedFile> m_mapped_file;
     ReadonlyBytes m_data;
 
@@ -79,6 +91,8 @@ private:
     // The vectors must be sorted by timestamp at all times.
     HashMap<u64, Vector<CuePoint>> m_cues;
     bool m_cues_have_been_parsed { false };
+
+    HashMap<u64, Vector<KeyframeIndexEntry>> m_keyframe_index;
 };
 
 class MEDIA_API SampleIterator {
@@ -37,6 +37,39 @@ static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat cons
     return AV_PIX_FMT_NONE;
 }
 
+// OPTIMIZATION: Holds a reference to the decoder's AVFrame rather than copying each plane into a
+//               tightly-packed buffer. FFmpeg's frame buffers are reference-counted, so cloning the
+//               frame only bumps a refcount, and the YUV to RGB conversion later reads straight out
+//               of the decoder's buffers using their row strides.
+class FFmpegVideoFrame final : public VideoFrame {
+public:
+    FFmpegVideoFrame(AVFrame* frame, AK::Duration timestamp, Gfx::Size<u32> size, u8 bit_depth, CodingIndependentCodePoints cicp, Subsampling subsampling)
+        : VideoFrame(timestamp, size, bit_depth, cicp)
+        , m_frame(frame)
+        , m_subsampling(subsampling)
+    {
+        VERIFY(m_frame != nullptr);
+    }
+
+    ~FFmpegVideoFrame()
+    {
+        av_frame_free(&m_frame);
+    }
+
+    DecoderErrorOr<void> output_to_bitmap(Gfx::Bitmap& bitmap) override
+    {
+        return convert_yuv_planes_to_bitmap(m_subsampling, cicp(), bit_depth(), width(), height(),
+            m_frame->data[0], static_cast<size_t>(m_frame->linesize[0]),
+            m_frame->data[1], static_cast<size_t>(m_frame->linesize[1]),
+            m_frame->data[2], static_cast<size_t>(m_frame->linesize[2]),
+            bitmap);
+    }
+
+private:
+    AVFrame* m_frame;
+    Subsampling m_subsampling;
+};
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
@@ -172,8 +205,6 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
                 VERIFY_NOT_REACHED();
             }
         }();
-        size_t component_size = (bit_depth + 7) / 8;
-
         auto subsampling = [&]() -> Subsampling {
             switch (m_frame->format) {
             case AV_PIX_FMT_YUV420P:
@@ -199,31 +230,27 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
 
         auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
-        auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
 
         for (u32 plane = 0; plane < 3; plane++) {
             VERIFY(m_frame->linesize[plane] != 0);
             if (m_frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
+            VERIFY(m_frame->data[plane] != nullptr);
+        }
 
-            bool const use_subsampling = plane > 0;
-            auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
-
-            auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
-
-            auto const* source = m_frame->data[plane];
-            VERIFY(source != nullptr);
-            auto* destination = frame->get_raw_plane_data(plane);
-            VERIFY(destination != nullptr);
+        // Clone the frame so we hold a reference to its buffers, leaving m_frame free to be reused
+        // for the next avcodec_receive_frame() call.
+        auto* cloned_frame = av_frame_clone(m_frame);
+        if (!cloned_frame)
+            return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to clone FFmpeg frame"sv);
 
-            for (size_t row = 0; row < plane_size.height(); row++) {
-                memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
-                destination += output_line_size;
+        ArmedScopeGuard clone_guard {
+            [&] {
+                av_frame_free(&cloned_frame);
             }
-        }
-
+        };
+        auto frame = DECODER_TRY_ALLOC(try_make<FFmpegVideoFrame>(cloned_frame, timestamp, size, bit_depth, cicp, subsampling));
+        clone_guard.disarm();
         return frame;
     }
     case AVERROR(EAGAIN):
@@ -76,26 +76,27 @@ SubsampledYUVFrame::~SubsampledYUVFrame()
 }
 
 template<u32 subsampling_horizontal, typename T>
-ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plane_u, T const* plane_v, T* __restrict__ u_row, T* __restrict__ v_row)
+ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plane_u, T const* plane_v, size_t const u_stride, size_t const v_stride, T* __restrict__ u_row, T* __restrict__ v_row)
 {
     // OPTIMIZATION: __restrict__ allows some load eliminations because the planes and the rows will not alias.
 
     constexpr auto horizontal_step = 1u << subsampling_horizontal;
-    auto const uv_width = (width + subsampling_horizontal) >> subsampling_horizontal;
+    auto const* u_source = &plane_u[row * u_stride];
+    auto const* v_source = &plane_v[row * v_stride];
     // Set the first column to the first chroma samples.
-    u_row[0] = plane_u[row * uv_width];
-    v_row[0] = plane_v[row * uv_width];
+    u_row[0] = u_source[0];
+    v_row[0] = v_source[0];
 
     auto const columns_end = width - subsampling_horizontal;
     // Interpolate the inner chroma columns.
     for (u32 column = 1; column < columns_end; column += horizontal_step) {
         auto uv_column = column >> subsampling_horizontal;
-        u_row[column] = plane_u[row * uv_width + uv_column];
-        v_row[column] = plane_v[row * uv_width + uv_column];
+        u_row[column] = u_source[uv_column];
+        v_row[column] = v_source[uv_column];
 
         if constexpr (subsampling_horizontal != 0) {
-            u_row[column + 1] = (plane_u[row * uv_width + uv_column] + plane_u[row * uv_width + uv_column + 1]) >> 1;
-            v_row[column + 1] = (plane_v[row * uv_width + uv_column] + plane_v[row * uv_width + uv_column + 1]) >> 1;
+            u_row[column + 1] = (u_source[uv_column] + u_source[uv_column + 1]) >> 1;
+            v_row[column + 1] = (v_source[uv_column] + v_source[uv_column + 1]) >> 1;
         }
     }
 
@@ -109,7 +110,7 @@ ALWAYS_INLINE void interpolate_row(u32 const row, u32 const width, T const* plan
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T, typename Convert>
-ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, Gfx::Bitmap& bitmap)
+ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert, u32 const width, u32 const height, T const* plane_y, T const* plane_u, T const* plane_v, size_t const y_stride, size_t const u_stride, size_t const v_stride, Gfx::Bitmap& bitmap)
 {
     VERIFY(bitmap.width() >= 0);
     VERIFY(bitmap.height() >= 0);
@@ -128,14 +129,14 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
 
     u32 const vertical_step = 1 << subsampling_vertical;
 
-    interpolate_row<subsampling_horizontal>(0, width, plane_u, plane_v, u_row_a, v_row_a);
+    interpolate_row<subsampling_horizontal>(0, width, plane_u, plane_v, u_stride, v_stride, u_row_a, v_row_a);
 
     // Do interpolation for all inner rows.
     u32 const rows_end = height - subsampling_vertical;
     for (u32 row = 0; row < rows_end; row += vertical_step) {
         // Horizontally scale the row if subsampled.
         auto uv_row = row >> subsampling_vertical;
-        interpolate_row<subsampling_horizontal>(uv_row, width, plane_u, plane_v, u_row_b, v_row_b);
+        interpolate_row<subsampling_horizontal>(uv_row, width, plane_u, plane_v, u_stride, v_stride, u_row_b, v_row_b);
 
         // If subsampled vertically, vertically interpolate the middle row between the above and below rows.
         if constexpr (subsampling_vertical != 0) {
@@ -148,14 +149,14 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
             }
         }
 
-        auto const* y_row_a = &plane_y[static_cast<size_t>(row) * width];
+        auto const* y_row_a = &plane_y[static_cast<size_t>(row) * y_stride];
         auto* scan_line_a = bitmap.scanline(static_cast<int>(row));
 
         for (size_t column = 0; column < width; column++) {
             scan_line_a[column] = convert(y_row_a[column], u_row_a[column], v_row_a[column]).value();
         }
         if constexpr (subsampling_vertical != 0) {
-            auto const* y_row_b = &plane_y[static_cast<size_t>(row + 1) * width];
+            auto const* y_row_b = &plane_y[static_cast<size_t>(row + 1) * y_stride];
             auto* scan_line_b = bitmap.scanline(static_cast<int>(row + 1));
             for (size_t column = 0; column < width; column++) {
                 scan_line_b[column] = convert(y_row_b[column], u_row_b[column], v_row_b[column]).value();
@@ -169,7 +170,7 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
     if constexpr (subsampling_vertical != 0) {
         // If there is a final row that hasn't been set above, convert it now.
         if ((height & 1) == 0) {
-            auto const* y_row = &plane_y[static_cast<size_t>(height - 1) * width];
+            auto const* y_row = &plane_y[static_cast<size_t>(height - 1) * y_stride];
             auto* scan_line = bitmap.scanline(static_cast<int>(height - 1));
             for (size_t column = 0; column < width; column++) {
                 scan_line[column] = convert(y_row[column], u_row_a[column], v_row_a[column]).value();
@@ -181,60 +182,69 @@ ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_subsampled(Convert convert,
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical, typename T>
-static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void* plane_y_data, void* plane_u_data, void* plane_v_data, Gfx::Bitmap& bitmap)
+static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_converter(CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void const* plane_y_data, void const* plane_u_data, void const* plane_v_data, size_t const y_stride, size_t const u_stride, size_t const v_stride, Gfx::Bitmap& bitmap)
 {
     auto const* plane_y = reinterpret_cast<T const*>(plane_y_data);
     auto const* plane_u = reinterpret_cast<T const*>(plane_u_data);
     auto const* plane_v = reinterpret_cast<T const*>(plane_v_data);
 
+    // The strides are given in bytes, but the planes are indexed in component-sized steps.
+    VERIFY(y_stride % sizeof(T) == 0 && u_stride % sizeof(T) == 0 && v_stride % sizeof(T) == 0);
+    auto const y_stride_elements = y_stride / sizeof(T);
+    auto const u_stride_elements = u_stride / sizeof(T);
+    auto const v_stride_elements = v_stride / sizeof(T);
+
     constexpr auto output_cicp = CodingIndependentCodePoints(ColorPrimaries::BT709, TransferCharacteristics::SRGB, MatrixCoefficients::BT709, VideoFullRangeFlag::Full);
 
     if (bit_depth == 8 && cicp.transfer_characteristics() == output_cicp.transfer_characteristics() && cicp.color_primaries() == output_cicp.color_primaries() && cicp.video_full_range_flag() == VideoFullRangeFlag::Studio) {
         switch (cicp.matrix_coefficients()) {
         case MatrixCoefficients::BT470BG:
         case MatrixCoefficients::BT601:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT601, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, y_stride_elements, u_stride_elements, v_stride_elements, bitmap);
         case MatrixCoefficients::BT709:
-            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+            return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([](T y, T u, T v) { return ColorConverter::convert_simple_yuv_to_rgb<MatrixCoefficients::BT709, VideoFullRangeFlag::Studio>(y, u, v); }, width, height, plane_y, plane_u, plane_v, y_stride_elements, u_stride_elements, v_stride_elements, bitmap);
         default:
             break;
         }
     }
 
     auto converter = TRY(ColorConverter::create(bit_depth, cicp, output_cicp));
-    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([&](T y, T u, T v) { return converter.convert_yuv(y, u, v); }, width, height, plane_y, plane_u, plane_v, bitmap);
+    return convert_to_bitmap_subsampled<subsampling_horizontal, subsampling_vertical>([&](T y, T u, T v) { return converter.convert_yuv(y, u, v); }, width, height, plane_y, plane_u, plane_v, y_stride_elements, u_stride_elements, v_stride_elements, bitmap);
 }
 
 template<u32 subsampling_horizontal, u32 subsampling_vertical>
-static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_bit_depth(CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void* plane_y_data, void* plane_u_data, void* plane_v_data, Gfx::Bitmap& bitmap)
+static ALWAYS_INLINE DecoderErrorOr<void> convert_to_bitmap_selecting_bit_depth(CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void const* plane_y_data, void const* plane_u_data, void const* plane_v_data, size_t const y_stride, size_t const u_stride, size_t const v_stride, Gfx::Bitmap& bitmap)
 {
     if (bit_depth <= 8) {
-        return convert_to_bitmap_selecting_converter<subsampling_horizontal, subsampling_vertical, u8>(cicp, bit_depth, width, height, plane_y_data, plane_u_data, plane_v_data, bitmap);
+        return convert_to_bitmap_selecting_converter<subsampling_horizontal, subsampling_vertical, u8>(cicp, bit_depth, width, height, plane_y_data, plane_u_data, plane_v_data, y_stride, u_stride, v_stride, bitmap);
     }
 
-    return convert_to_bitmap_selecting_converter<subsampling_horizontal, subsampling_vertical, u16>(cicp, bit_depth, width, height, plane_y_data, plane_u_data, plane_v_data, bitmap);
+    return convert_to_bitmap_selecting_converter<subsampling_horizontal, subsampling_vertical, u16>(cicp, bit_depth, width, height, plane_y_data, plane_u_data, plane_v_data, y_stride, u_stride, v_stride, bitmap);
 }
 
-static DecoderErrorOr<void> convert_to_bitmap_selecting_subsampling(Subsampling subsampling, CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void* plane_y, void* plane_u, void* plane_v, Gfx::Bitmap& bitmap)
+DecoderErrorOr<void> convert_yuv_planes_to_bitmap(Subsampling subsampling, CodingIndependentCodePoints cicp, u8 bit_depth, u32 const width, u32 const height, void const* plane_y, size_t y_stride, void const* plane_u, size_t u_stride, void const* plane_v, size_t v_stride, Gfx::Bitmap& bitmap)
 {
     if (subsampling.x() && subsampling.y()) {
-        return convert_to_bitmap_selecting_bit_depth<true, true>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, bitmap);
+        return convert_to_bitmap_selecting_bit_depth<true, true>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, y_stride, u_stride, v_stride, bitmap);
     }
 
     if (subsampling.x() && !subsampling.y()) {
-        return convert_to_bitmap_selecting_bit_depth<true, false>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, bitmap);
+        return convert_to_bitmap_selecting_bit_depth<true, false>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, y_stride, u_stride, v_stride, bitmap);
     }
 
     if (!subsampling.x() && subsampling.y()) {
-        return convert_to_bitmap_selecting_bit_depth<false, true>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, bitmap);
+        return convert_to_bitmap_selecting_bit_depth<false, true>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, y_stride, u_stride, v_stride, bitmap);
     }
 
-    return convert_to_bitmap_selecting_bit_depth<false, false>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, bitmap);
+    return convert_to_bitmap_selecting_bit_depth<false, false>(cicp, bit_depth, width, height, plane_y, plane_u, plane_v, y_stride, u_stride, v_stride, bitmap);
 }
 
 DecoderErrorOr<void> SubsampledYUVFrame::output_to_bitmap(Gfx::Bitmap& bitmap)
 {
-    return convert_to_bitmap_selecting_subsampling(m_subsampling, cicp(), bit_depth(), width(), height(), m_y_buffer, m_u_buffer, m_v_buffer, bitmap);
+    size_t component_size = bit_depth() > 8 ? sizeof(u16) : sizeof(u8);
+    auto y_stride = static_cast<size_t>(width()) * component_size;
+    auto uv_stride = static_cast<size_t>(m_subsampling.subsampled_size(size()).width()) * component_size;
+    return convert_yuv_planes_to_bitmap(m_subsampling, cicp(), bit_depth(), width(), height(), m_y_buffer, y_stride, m_u_buffer, uv_stride, m_v_buffer, uv_stride, bitmap);
 }
 
 }
@@ -119,4 +119,9 @@ protected:
     u8* m_v_buffer = nullptr;
 };
 
+// Converts planar YUV data into the given bitmap. The row strides are given in bytes, so decoders can
+// convert directly out of frame buffers whose rows are padded for alignment, without first copying each
+// plane into a tightly-packed buffer.
+DecoderErrorOr<void> convert_yuv_planes_to_bitmap(Subsampling, CodingIndependentCodePoints, u8 bit_depth, u32 width, u32 height, void const* plane_y, size_t y_stride, void const* plane_u, size_t u_stride, void const* plane_v, size_t v_stride, Gfx::Bitmap&);
+
 }
@@ -10,6 +10,7 @@
 #include "RegexOptions.h"
 
 #include <AK/ByteString.h>
+#include <AK/CharacterTypes.h>
 #include <AK/COWVector.h>
 #include <AK/Error.h>
 #include <AK/FlyString.h>
@@ -245,6 +246,59 @@ public:
             });
     }
 
+    // Returns the code unit index of the next occurrence of the given ASCII code point at or after
+    // the given code unit index, if any. With insensitive set, both cases of a letter match.
+    Optional<size_t> find_next_occurrence_of_ascii_code_point(u32 code_point, size_t index, bool insensitive) const
+    {
+        VERIFY(code_point < 0x80);
+        auto needle = static_cast<char>(code_point);
+        auto other_case_needle = insensitive && is_ascii_alpha(needle) ? static_cast<char>(needle ^ 0x20) : needle;
+        return m_view.visit(
+            [&](StringView view) -> Optional<size_t> {
+                auto first = view.find(needle, index);
+                if (needle == other_case_needle)
+                    return first;
+                auto second = view.find(other_case_needle, index);
+                if (!first.has_value() || (second.has_value() && *second < *first))
+                    return second;
+                return first;
+            },
+            [&](Utf16View const& view) -> Optional<size_t> {
+                for (size_t i = index; i < view.length_in_code_units(); ++i) {
+                    auto code_unit = view.code_unit_at(i);
+                    if (code_unit == static_cast<u16>(needle) || code_unit == static_cast<u16>(other_case_needle))
+                        return i;
+                }
+                return {};
+            });
+    }
+
+    // Returns the code unit index of the next occurrence of the given sequence of code units
+    // (one per byte of the needle) at or after the given code unit index, if any.
+    Optional<size_t> find_next_occurrence_of_code_unit_sequence(StringView needle, size_t index) const
+    {
+        return m_view.visit(
+            [&](StringView view) -> Optional<size_t> {
+                return view.find(needle, index);
+            },
+            [&](Utf16View const& view) -> Optional<size_t> {
+                if (view.has_ascii_storage())
+                    return StringView { view.ascii_span().data(), view.ascii_span().size() }.find(needle, index);
+
+                auto length_in_code_units = view.length_in_code_units();
+                if (needle.length() > length_in_code_units)
+                    return {};
+                for (size_t i = index; i + needle.length() <= length_in_code_units; ++i) {
+                    size_t matched_code_units = 0;
+                    while (matched_code_units < needle.length() && view.code_unit_at(i + matched_code_units) == static_cast<u8>(needle[matched_code_units]))
+                        ++matched_code_units;
+                    if (matched_code_units == needle.length())
+                        return i;
+                }
+                return {};
+            });
+    }
+
     bool operator==(char const* cstring) const
     {
         return m_view.visit(
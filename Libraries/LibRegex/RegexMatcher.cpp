@@ -211,6 +211,12 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
+    // Case-insensitive comparison and code-point-indexed (unicode) views are left to the bytecode.
+    auto const& pure_substring_search = m_pattern->parser_result.optimization_data.pure_substring_search;
+    auto use_substring_search = pure_substring_search.has_value()
+        && !pure_substring_search->is_empty()
+        && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
         auto lower_case_needle = needle;
@@ -295,15 +301,32 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             if (match_length_minimum && match_length_minimum > view_length - view_index)
                 break;
 
+            bool matched = false;
+
             auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
-                auto ch = input.view.unicode_aware_code_point_at(view_index);
-                if (insensitive)
-                    ch = to_ascii_lowercase(ch);
 
-                if (!binary_search(ranges, ch, nullptr, compare_range))
-                    goto done_matching;
+                // OPTIMIZATION: If the pattern can only start with one specific ASCII character, skip
+                //               ahead to its next occurrence at memory-scan speed instead of testing
+                //               every position. This is only valid when view_index is code-unit based,
+                //               so unicode (code-point indexed) matching is excluded.
+                if (ranges.size() == 1 && ranges[0].from == ranges[0].to && ranges[0].from < 0x80
+                    && view_index < view_length && !input.view.unicode()) {
+                    // We may only skip ahead when the engine would have kept searching in the first
+                    // place; otherwise a match is only acceptable at the current position.
+                    auto next_index = input.view.find_next_occurrence_of_ascii_code_point(ranges[0].from, view_index, insensitive);
+                    if (!next_index.has_value() || (*next_index != view_index && !continue_search))
+                        break;
+                    view_index = *next_index;
+                } else {
+                    auto ch = input.view.unicode_aware_code_point_at(view_index);
+                    if (insensitive)
+                        ch = to_ascii_lowercase(ch);
+
+                    if (!binary_search(ranges, ch, nullptr, compare_range))
+                        goto done_matching;
+                }
             }
 
             input.column = match_count;
@@ -321,7 +344,27 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (use_substring_search && !input.view.unicode()) {
+                // OPTIMIZATION: The optimizer reduced the whole pattern to a literal string, so we
+                //               can search for it directly instead of interpreting the bytecode.
+                //               This guarantees linear-time matching regardless of input. Positions
+                //               we skip over couldn't have matched anyway, but we may only skip
+                //               ahead when the engine would have kept searching in the first place.
+                auto next_occurrence = input.view.find_next_occurrence_of_code_unit_sequence(*pure_substring_search, view_index);
+                if (next_occurrence.has_value() && (*next_occurrence == view_index || continue_search)) {
+                    view_index = *next_occurrence;
+                    state.string_position = view_index + pure_substring_search->length();
+                    state.string_position_in_code_units = state.string_position;
+                    ++operations;
+                    matched = true;
+                } else if (!next_occurrence.has_value() && continue_search) {
+                    break;
+                }
+            } else {
+                matched = execute(input, state, operations);
+            }
+
+            if (matched) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -833,8 +833,10 @@ bool Regex<Parser>::attempt_rewrite_entire_match_as_substring_search(BasicBlockL
 
                 if (is_unicode || flat_compare.value <= 0x7f)
                     final_string.append_code_point(flat_compare.value);
-                else
+                else if (flat_compare.value <= 0xff)
                     final_string.append(bit_cast<char>(static_cast<u8>(flat_compare.value)));
+                else
+                    return false; // The resulting string stores one byte per code unit, so larger values cannot be represented.
             }
             break;
         }
@@ -40,10 +40,38 @@ void Request::set_request_fd(Badge<Requests::RequestClient>, int fd)
     auto notifier = Core::Notifier::construct(fd, Core::Notifier::Type::Read);
     auto stream = MUST(Core::File::adopt_fd(fd, Core::File::OpenMode::Read));
     notifier->on_activation = move(m_internal_stream_data->read_notifier->on_activation);
+    notifier->set_enabled(!m_internal_stream_data->paused);
     m_internal_stream_data->read_notifier = move(notifier);
     m_internal_stream_data->read_stream = move(stream);
 }
 
+void Request::pause()
+{
+    if (!m_internal_stream_data || m_internal_stream_data->paused)
+        return;
+
+    m_internal_stream_data->paused = true;
+    m_internal_stream_data->read_notifier->set_enabled(false);
+}
+
+void Request::resume()
+{
+    if (!m_internal_stream_data || !m_internal_stream_data->paused)
+        return;
+
+    m_internal_stream_data->paused = false;
+    m_internal_stream_data->read_notifier->set_enabled(true);
+
+    // The notifier only fires for new activity, so drain whatever arrived while we were paused.
+    if (m_internal_stream_data->read_notifier->on_activation)
+        m_internal_stream_data->read_notifier->on_activation();
+}
+
+void Request::set_priority(RequestPriority priority)
+{
+    m_client->set_request_priority({}, *this, priority);
+}
+
 void Request::set_buffered_request_finished_callback(BufferedRequestFinished on_buffered_request_finished)
 {
     VERIFY(m_mode == Mode::Unknown);
@@ -163,6 +191,10 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
                 break;
 
             on_data_available(read_bytes);
+
+            // The data callback may have paused the request; stop reading until it's resumed.
+            if (m_internal_stream_data->paused)
+                return;
         } while (true);
 
         if (m_internal_stream_data->read_stream->is_eof())
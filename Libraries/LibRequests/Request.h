@@ -15,6 +15,7 @@
 #include <LibCore/Notifier.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 
 namespace Requests {
@@ -51,6 +52,15 @@ public:
     // mutually exclusive with `set_buffered_request_finished_callback`.
     void set_unbuffered_request_callbacks(HeadersReceived, DataReceived, RequestFinished);
 
+    // Suspend and resume delivery of response data for an unbuffered request. While paused, the
+    // data stays queued in the transport pipe, which in turn pushes back on RequestServer.
+    void pause();
+    void resume();
+
+    // Change the scheduling priority of an in-flight request, e.g. to promote an image as it
+    // scrolls towards the viewport or demote one that scrolled away.
+    void set_priority(RequestPriority);
+
     Function<CertificateAndKey()> on_certificate_requested;
 
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
@@ -98,6 +108,7 @@ private:
         RequestTimingInfo timing_info;
         Function<void()> on_finish {};
         bool user_finish_called { false };
+        bool paused { false };
     };
 
     OwnPtr<InternalBufferedData> m_internal_buffered_data;
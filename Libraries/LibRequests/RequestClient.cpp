@@ -32,7 +32,7 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, RequestPriority priority, IsKeepalive is_keepalive)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -41,7 +41,7 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data, priority, is_keepalive == IsKeepalive::Yes);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -66,6 +66,11 @@ bool RequestClient::stop_request(Badge<Request>, Request& request)
     return IPCProxy::stop_request(request.id());
 }
 
+void RequestClient::set_request_priority(Badge<Request>, Request& request, RequestPriority priority)
+{
+    async_set_request_priority(request.id(), priority);
+}
+
 bool RequestClient::set_certificate(Badge<Request>, Request& request, ByteString certificate, ByteString key)
 {
     if (!m_requests.contains(request.id()))
@@ -115,11 +120,14 @@ void RequestClient::websocket_connected(i64 websocket_id)
         maybe_connection.value()->did_open({});
 }
 
-void RequestClient::websocket_received(i64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(i64 websocket_id, Vector<::WebSocket::Message> messages)
 {
     auto maybe_connection = m_websockets.get(websocket_id);
-    if (maybe_connection.has_value())
-        maybe_connection.value()->did_receive({}, move(data), is_text);
+    if (!maybe_connection.has_value())
+        return;
+
+    for (auto& message : messages)
+        maybe_connection.value()->did_receive({}, move(message.data()), message.is_text());
 }
 
 void RequestClient::websocket_errored(i64 websocket_id, i32 message)
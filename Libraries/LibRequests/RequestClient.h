@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibIPC/ConnectionToServer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
@@ -19,6 +20,13 @@ namespace Requests {
 
 class Request;
 
+// Keepalive requests are allowed to outlive the client that issued them; RequestServer will let
+// them run to completion even if the client disconnects before they finish.
+enum class IsKeepalive {
+    No,
+    Yes,
+};
+
 class RequestClient final
     : public IPC::ConnectionToServer<RequestClientEndpoint, RequestServerEndpoint>
     , public RequestClientEndpoint {
@@ -30,7 +38,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, RequestPriority = RequestPriority::Normal, IsKeepalive = IsKeepalive::No);
 
     RefPtr<WebSocket> websocket_connect(URL::URL const&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
@@ -38,6 +46,7 @@ public:
 
     bool stop_request(Badge<Request>, Request&);
     bool set_certificate(Badge<Request>, Request&, ByteString, ByteString);
+    void set_request_priority(Badge<Request>, Request&, RequestPriority);
 
     Function<void()> on_request_server_died;
 
@@ -50,7 +59,7 @@ private:
     virtual void headers_became_available(i32, HTTP::HeaderMap, Optional<u32>, Optional<String>) override;
 
     virtual void websocket_connected(i64 websocket_id) override;
-    virtual void websocket_received(i64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_received(i64 websocket_id, Vector<::WebSocket::Message>) override;
     virtual void websocket_errored(i64 websocket_id, i32) override;
     virtual void websocket_closed(i64 websocket_id, u16, ByteString, bool) override;
     virtual void websocket_ready_state_changed(i64 websocket_id, u32 ready_state) override;
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Requests {
+
+// Scheduling hint for RequestServer. High-priority requests (render-blocking resources) are given
+// a larger share of each connection's bandwidth, and low-priority (speculative) requests are held
+// back entirely while higher-priority requests are still fetching.
+enum class RequestPriority : u8 {
+    Low,
+    Normal,
+    High,
+};
+
+}
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/Promise.h>
 #include <LibCrypto/OpenSSL.h>
@@ -26,13 +27,13 @@ namespace TLS {
 ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect(ByteString const& host, u16 port, Options options)
 {
     auto tcp_socket = TRY(Core::TCPSocket::connect(host, port));
-    return connect_internal(move(tcp_socket), host, move(options));
+    return connect_internal(move(tcp_socket), host, port, move(options));
 }
 
 ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect(Core::SocketAddress const& address, ByteString const& host, Options options)
 {
     auto tcp_socket = TRY(Core::TCPSocket::connect(address));
-    return connect_internal(move(tcp_socket), host, move(options));
+    return connect_internal(move(tcp_socket), host, address.port(), move(options));
 }
 
 static void wait_for_activity(int sock, bool read)
@@ -207,9 +208,46 @@ TLSv12::~TLSv12()
     SSL_CTX_free(m_ssl_ctx);
 }
 
-ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPSocket> socket, ByteString const& host, Options options)
+static HashMap<ByteString, SSL_SESSION*>& session_cache()
 {
-    TRY(socket->set_blocking(false));
+    static HashMap<ByteString, SSL_SESSION*> s_cache;
+    return s_cache;
+}
+
+static int session_key_ex_data_index()
+{
+    static int s_index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr,
+        [](void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) {
+            delete static_cast<ByteString*>(ptr);
+        });
+    return s_index;
+}
+
+// Called by OpenSSL whenever the server hands us a new session; for TLS 1.3 that's a session
+// ticket arriving after the handshake has completed.
+static int on_new_session(SSL* ssl, SSL_SESSION* session)
+{
+    auto* session_key = static_cast<ByteString*>(SSL_get_ex_data(ssl, session_key_ex_data_index()));
+    if (!session_key)
+        return 0;
+
+    if (auto previous_session = session_cache().get(*session_key); previous_session.has_value())
+        SSL_SESSION_free(previous_session.value());
+    session_cache().set(*session_key, session);
+
+    // Returning 1 means we have taken over the reference to the session.
+    return 1;
+}
+
+static ErrorOr<SSL_CTX*> ssl_context_for(Optional<ByteString> const& root_certificates_path)
+{
+    // OPTIMIZATION: Creating a fresh SSL_CTX per connection made OpenSSL reload and re-parse the
+    //               entire root certificate store on every connect. Share one context per store.
+    static HashMap<ByteString, SSL_CTX*> s_ssl_contexts;
+
+    auto key = root_certificates_path.value_or(ByteString::empty());
+    if (auto existing = s_ssl_contexts.get(key); existing.has_value())
+        return existing.value();
 
     auto* ssl_ctx = OPENSSL_TRY_PTR(SSL_CTX_new(TLS_client_method()));
     ArmedScopeGuard free_ssl_ctx = [&] { SSL_CTX_free(ssl_ctx); };
@@ -217,9 +255,8 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPS
     // Configure the client to abort the handshake if certificate verification fails.
     SSL_CTX_set_verify(ssl_ctx, SSL_VERIFY_PEER, nullptr);
 
-    if (options.root_certificates_path.has_value()) {
-        auto path = options.root_certificates_path.value();
-        SSL_CTX_load_verify_file(ssl_ctx, path.characters());
+    if (root_certificates_path.has_value()) {
+        SSL_CTX_load_verify_file(ssl_ctx, root_certificates_path->characters());
     } else {
         // Use the default trusted certificate store
 #if defined(AK_OS_WINDOWS)
@@ -234,6 +271,26 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPS
     // Require a minimum TLS version of TLSv1.2.
     OPENSSL_TRY(SSL_CTX_set_min_proto_version(ssl_ctx, TLS1_2_VERSION));
 
+    // OPTIMIZATION: Remember the most recent session per host, so reconnecting resumes it instead
+    //               of running a full handshake and certificate chain verification.
+    SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ssl_ctx, on_new_session);
+
+    free_ssl_ctx.disarm();
+    s_ssl_contexts.set(key, ssl_ctx);
+    return ssl_ctx;
+}
+
+ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPSocket> socket, ByteString const& host, u16 port, Options options)
+{
+    TRY(socket->set_blocking(false));
+
+    auto* ssl_ctx = TRY(ssl_context_for(options.root_certificates_path));
+
+    // The context is shared between connections; take a reference for this one.
+    OPENSSL_TRY(SSL_CTX_up_ref(ssl_ctx));
+    ArmedScopeGuard free_ssl_ctx = [&] { SSL_CTX_free(ssl_ctx); };
+
     auto* ssl = OPENSSL_TRY_PTR(SSL_new(ssl_ctx));
     ArmedScopeGuard free_ssl = [&] { SSL_free(ssl); };
 
@@ -243,6 +300,13 @@ ErrorOr<NonnullOwnPtr<TLSv12>> TLSv12::connect_internal(NonnullOwnPtr<Core::TCPS
     // Ensure we check that the server has supplied a certificate for the hostname that we were expecting.
     OPENSSL_TRY(SSL_set1_host(ssl, host.characters()));
 
+    auto session_key = ByteString::formatted("{}:{}", host, port);
+    OPENSSL_TRY(SSL_set_ex_data(ssl, session_key_ex_data_index(), new ByteString(session_key)));
+
+    // Offer the previous session for this host back to the server, if we still have a usable one.
+    if (auto cached_session = session_cache().get(session_key); cached_session.has_value() && SSL_SESSION_is_resumable(cached_session.value()))
+        OPENSSL_TRY(SSL_set_session(ssl, cached_session.value()));
+
     auto* bio = OPENSSL_TRY_PTR(BIO_new_socket(socket->fd(), 0));
 
     // SSL takes ownership of the BIO and will handle freeing it
@@ -6,8 +6,11 @@
  */
 
 #include <AK/Function.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
 #include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
+#include <LibCore/File.h>
 #include <LibTest/Macros.h>
 #include <LibTest/TestResult.h>
 #include <LibTest/TestSuite.h>
@@ -125,6 +128,7 @@ int TestSuite::main(ByteString const& suite_name, Span<StringView> arguments)
     args_parser.add_option(do_benchmarks_only, "Only run benchmarks.", "bench");
     args_parser.add_option(m_benchmark_repetitions, "Number of times to repeat each benchmark (default 1)", "benchmark_repetitions", 0, "N");
     args_parser.add_option(m_randomized_runs, "Number of times to run each RANDOMIZED_TEST_CASE (default 100)", "randomized_runs", 0, "RUNS");
+    args_parser.add_option(m_json_output_path, "Write per-case results and timings as JSON to the given file, for consumption by performance CI", "json-output", 0, "PATH");
     args_parser.add_option(do_list_cases, "List available test cases.", "list");
     args_parser.add_positional_argument(search_string, "Only run matching cases.", "pattern", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
@@ -176,6 +180,7 @@ int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
     size_t benchmark_passed_count = 0;
     size_t benchmark_failed_count = 0;
     TestElapsedTimer global_timer;
+    JsonArray json_results;
 
     for (auto const& t : tests) {
         auto const test_type = t->is_benchmark() ? "benchmark" : "test";
@@ -223,6 +228,18 @@ int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
             dbgln("{} {} '{}' in {}ms", test_result_to_string(m_current_test_result), test_type, t->name(), total_time_ms);
         }
 
+        if (!m_json_output_path.is_empty()) {
+            JsonObject json_result;
+            json_result.set("name"sv, t->name());
+            json_result.set("type"sv, test_type);
+            json_result.set("result"sv, test_result_to_string(m_current_test_result));
+            json_result.set("repetitions"sv, repetitions);
+            json_result.set("total_ns"sv, total_time.to_nanoseconds());
+            json_result.set("min_ns"sv, min_time.to_nanoseconds());
+            json_result.set("max_ns"sv, max_time.to_nanoseconds());
+            json_results.must_append(move(json_result));
+        }
+
         if (t->is_benchmark()) {
             m_bench_time += total_time;
             benchmark_count++;
@@ -254,6 +271,20 @@ int TestSuite::run(Vector<NonnullRefPtr<TestCase>> const& tests)
         }
     }
 
+    if (!m_json_output_path.is_empty()) {
+        JsonObject json_output;
+        json_output.set("suite"sv, m_suite_name);
+        json_output.set("results"sv, move(json_results));
+
+        auto write_result = [&]() -> ErrorOr<void> {
+            auto file = TRY(Core::File::open(m_json_output_path, Core::File::OpenMode::Write));
+            TRY(file->write_until_depleted(json_output.serialized().bytes()));
+            return {};
+        }();
+        if (write_result.is_error())
+            warnln("Failed to write JSON results to {}: {}", m_json_output_path, write_result.error());
+    }
+
     auto const runtime = m_test_time + m_bench_time;
     auto const elapsed = global_timer.elapsed();
 
@@ -70,6 +70,7 @@ private:
     AK::Duration m_test_time;
     AK::Duration m_bench_time;
     ByteString m_suite_name;
+    ByteString m_json_output_path;
     u64 m_benchmark_repetitions = 1;
     u64 m_randomized_runs = 100;
     Function<void()> m_setup;
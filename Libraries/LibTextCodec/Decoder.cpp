@@ -408,6 +408,13 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    // OPTIMIZATION: Latin1 is the same as the first 256 Unicode code points, so simdutf can
+    //               transcode the whole buffer at once.
+    return String::from_latin1(input.bytes());
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -479,6 +486,28 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<String> XUserDefinedDecoder::to_utf8(StringView input)
+{
+    // OPTIMIZATION: ASCII bytes map straight through, so append them in bulk and only convert
+    //               bytes with the high bit set one at a time.
+    StringBuilder builder(input.length());
+
+    size_t index = 0;
+    while (index < input.length()) {
+        auto run_start = index;
+        while (index < input.length() && static_cast<u8>(input[index]) < 0x80)
+            ++index;
+        builder.append(input.substring_view(run_start, index - run_start));
+
+        while (index < input.length() && static_cast<u8>(input[index]) >= 0x80) {
+            builder.append_code_point(0xF780 + static_cast<u8>(input[index]) - 0x80);
+            ++index;
+        }
+    }
+
+    return builder.to_string_without_validation();
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +531,29 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<String> SingleByteDecoder<ArrayType>::to_utf8(StringView input)
+{
+    // OPTIMIZATION: ASCII bytes map straight through in every single-byte encoding, so append them
+    //               in bulk and only translate bytes with the high bit set through the table.
+    StringBuilder builder(input.length());
+
+    size_t index = 0;
+    while (index < input.length()) {
+        auto run_start = index;
+        while (index < input.length() && static_cast<u8>(input[index]) < 0x80)
+            ++index;
+        builder.append(input.substring_view(run_start, index - run_start));
+
+        while (index < input.length() && static_cast<u8>(input[index]) >= 0x80) {
+            builder.append_code_point(m_translation_table[static_cast<u8>(input[index]) - 0x80]);
+            ++index;
+        }
+    }
+
+    return builder.to_string_without_validation();
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
@@ -6,6 +6,8 @@
  */
 
 #include <AK/Queue.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
 #include <LibThreading/BackgroundAction.h>
 #include <LibThreading/Mutex.h>
 #include <LibThreading/Thread.h>
@@ -13,28 +15,28 @@
 static pthread_mutex_t s_mutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t s_condition = PTHREAD_COND_INITIALIZER;
 static Queue<Function<void()>>* s_all_actions;
-static Threading::Thread* s_background_thread;
-static Atomic<bool> s_background_thread_should_run = true;
+static Vector<Threading::Thread*>* s_background_threads;
+static Atomic<bool> s_background_threads_should_run = true;
 
 static intptr_t background_thread_func()
 {
-    Vector<Function<void()>> actions;
-    while (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
+    while (s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire)) {
+        Function<void()> action;
+
         pthread_mutex_lock(&s_mutex);
 
-        while (s_all_actions->is_empty() && s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
+        while (s_all_actions->is_empty() && s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire))
             pthread_cond_wait(&s_condition, &s_mutex);
 
-        while (!s_all_actions->is_empty())
-            actions.append(s_all_actions->dequeue());
+        // NOTE: Only take a single action here, so the remaining ones can be picked up by the
+        //       other background threads and run in parallel with ours.
+        if (!s_all_actions->is_empty())
+            action = s_all_actions->dequeue();
 
         pthread_mutex_unlock(&s_mutex);
 
-        for (auto& action : actions) {
-            if (s_background_thread_should_run.load(AK::MemoryOrder::memory_order_acquire))
-                action();
-        }
-        actions.clear();
+        if (action && s_background_threads_should_run.load(AK::MemoryOrder::memory_order_acquire))
+            action();
     }
     return 0;
 }
@@ -42,36 +44,41 @@ static intptr_t background_thread_func()
 static void init()
 {
     s_all_actions = new Queue<Function<void()>>;
-    s_background_thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
-    s_background_thread->start();
+    s_background_threads = new Vector<Threading::Thread*>;
+
+    // One background thread per CPU (within reason), so independent actions don't have to wait
+    // for each other.
+    auto thread_count = max(min(Core::System::hardware_concurrency(), 8u), 1u);
+    s_background_threads->ensure_capacity(thread_count);
+    for (unsigned i = 0; i < thread_count; ++i) {
+        auto* thread = &Threading::Thread::construct(background_thread_func, "Background Thread"sv).leak_ref();
+        thread->start();
+        s_background_threads->unchecked_append(thread);
+    }
 }
 
 void Threading::quit_background_thread()
 {
-    if (!s_background_thread)
+    if (!s_background_threads)
         return;
 
-    s_background_thread_should_run.store(false, AK::MemoryOrder::memory_order_release);
+    s_background_threads_should_run.store(false, AK::MemoryOrder::memory_order_release);
 
     pthread_mutex_lock(&s_mutex);
     pthread_cond_broadcast(&s_condition);
     pthread_mutex_unlock(&s_mutex);
 
-    MUST(s_background_thread->join());
+    for (auto* thread : *s_background_threads) {
+        MUST(thread->join());
+        thread->unref();
+    }
 
     delete s_all_actions;
-    s_background_thread->unref();
+    delete s_background_threads;
     s_all_actions = nullptr;
-    s_background_thread = nullptr;
+    s_background_threads = nullptr;
 
-    s_background_thread_should_run.store(true, AK::MemoryOrder::memory_order_release);
-}
-
-Threading::Thread& Threading::BackgroundActionBase::background_thread()
-{
-    if (s_background_thread == nullptr)
-        init();
-    return *s_background_thread;
+    s_background_threads_should_run.store(true, AK::MemoryOrder::memory_order_release);
 }
 
 void Threading::BackgroundActionBase::enqueue_work(Function<void()> work)
@@ -31,7 +31,6 @@ private:
     BackgroundActionBase() = default;
 
     static void enqueue_work(ESCAPING Function<void()>);
-    static Thread& background_thread();
 };
 
 template<typename Result>
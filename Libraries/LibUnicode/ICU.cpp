@@ -9,6 +9,7 @@
 #include <AK/Utf16View.h>
 #include <LibUnicode/ICU.h>
 
+#include <unicode/brkiter.h>
 #include <unicode/dtptngen.h>
 #include <unicode/locdspnm.h>
 #include <unicode/numsys.h>
@@ -90,6 +91,42 @@ icu::NumberingSystem& LocaleData::numbering_system()
     return *m_numbering_system;
 }
 
+icu::BreakIterator& LocaleData::character_break_iterator()
+{
+    if (!m_character_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_character_break_iterator = adopt_own(*icu::BreakIterator::createCharacterInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_character_break_iterator;
+}
+
+icu::BreakIterator& LocaleData::sentence_break_iterator()
+{
+    if (!m_sentence_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_sentence_break_iterator = adopt_own(*icu::BreakIterator::createSentenceInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_sentence_break_iterator;
+}
+
+icu::BreakIterator& LocaleData::word_break_iterator()
+{
+    if (!m_word_break_iterator) {
+        UErrorCode status = U_ZERO_ERROR;
+
+        m_word_break_iterator = adopt_own(*icu::BreakIterator::createWordInstance(locale(), status));
+        VERIFY(icu_success(status));
+    }
+
+    return *m_word_break_iterator;
+}
+
 icu::DateTimePatternGenerator& LocaleData::date_time_pattern_generator()
 {
     if (!m_date_time_pattern_generator) {
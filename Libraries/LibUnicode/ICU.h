@@ -24,6 +24,7 @@
 #include <unicode/uversion.h>
 
 U_NAMESPACE_BEGIN
+class BreakIterator;
 class DateTimePatternGenerator;
 class LocaleDisplayNames;
 class NumberingSystem;
@@ -46,6 +47,12 @@ public:
 
     icu::NumberingSystem& numbering_system();
 
+    // NOTE: These are prototypes to be clone()d before use. Creating a break iterator parses its
+    //       ICU rule data, whereas cloning one is cheap.
+    icu::BreakIterator& character_break_iterator();
+    icu::BreakIterator& sentence_break_iterator();
+    icu::BreakIterator& word_break_iterator();
+
     icu::DateTimePatternGenerator& date_time_pattern_generator();
 
     icu::TimeZoneNames& time_zone_names();
@@ -62,6 +69,9 @@ private:
     OwnPtr<icu::LocaleDisplayNames> m_standard_display_names;
     OwnPtr<icu::LocaleDisplayNames> m_dialect_display_names;
     OwnPtr<icu::NumberingSystem> m_numbering_system;
+    OwnPtr<icu::BreakIterator> m_character_break_iterator;
+    OwnPtr<icu::BreakIterator> m_sentence_break_iterator;
+    OwnPtr<icu::BreakIterator> m_word_break_iterator;
     OwnPtr<icu::DateTimePatternGenerator> m_date_time_pattern_generator;
     OwnPtr<icu::TimeZoneNames> m_time_zone_names;
     Optional<DigitalFormat> m_digital_format;
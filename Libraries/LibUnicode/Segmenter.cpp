@@ -225,26 +225,25 @@ NonnullOwnPtr<Segmenter> Segmenter::create(SegmenterGranularity segmenter_granul
 
 NonnullOwnPtr<Segmenter> Segmenter::create(StringView locale, SegmenterGranularity segmenter_granularity)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto segmenter = adopt_own_if_nonnull([&]() {
+    // OPTIMIZATION: Creating a break iterator parses its ICU rule data, and text layout creates
+    //               segmenters constantly. The rule parsing is paid once per locale by cloning
+    //               the prototype iterator cached on the locale data.
+    auto& prototype = [&]() -> icu::BreakIterator& {
         switch (segmenter_granularity) {
         case SegmenterGranularity::Grapheme:
-            return icu::BreakIterator::createCharacterInstance(locale_data->locale(), status);
+            return locale_data->character_break_iterator();
         case SegmenterGranularity::Sentence:
-            return icu::BreakIterator::createSentenceInstance(locale_data->locale(), status);
+            return locale_data->sentence_break_iterator();
         case SegmenterGranularity::Word:
-            return icu::BreakIterator::createWordInstance(locale_data->locale(), status);
+            return locale_data->word_break_iterator();
         }
         VERIFY_NOT_REACHED();
-    }());
-
-    VERIFY(icu_success(status));
+    }();
 
-    return make<SegmenterImpl>(segmenter.release_nonnull(), segmenter_granularity);
+    return make<SegmenterImpl>(adopt_own(*prototype.clone()), segmenter_granularity);
 }
 
 bool Segmenter::should_continue_beyond_word(Utf16View const& word)
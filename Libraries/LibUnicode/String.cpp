@@ -37,6 +37,13 @@ static ResolvedLocale resolve_locale(Optional<StringView> const& locale)
 
 ErrorOr<String> String::to_lowercase(Optional<StringView> const& locale) const
 {
+    // OPTIMIZATION: Root-locale case mapping agrees with ASCII case mapping, so pure-ASCII
+    //               strings (the overwhelmingly common case) don't need ICU. Callers that
+    //               provide a locale still go through ICU, since e.g. Turkish maps ASCII 'I'
+    //               to a non-ASCII dotless i.
+    if (!locale.has_value() && bytes_as_string_view().is_ascii())
+        return to_ascii_lowercase();
+
     UErrorCode status = U_ZERO_ERROR;
 
     StringBuilder builder { bytes_as_string_view().length() };
@@ -53,6 +60,11 @@ ErrorOr<String> String::to_lowercase(Optional<StringView> const& locale) const
 
 ErrorOr<String> String::to_uppercase(Optional<StringView> const& locale) const
 {
+    // OPTIMIZATION: As in to_lowercase() above, pure-ASCII strings don't need ICU unless a
+    //               locale was provided.
+    if (!locale.has_value() && bytes_as_string_view().is_ascii())
+        return to_ascii_uppercase();
+
     UErrorCode status = U_ZERO_ERROR;
 
     StringBuilder builder { bytes_as_string_view().length() };
@@ -117,6 +129,10 @@ static ErrorOr<void> build_casefold_string(StringView string, StringBuilder& bui
 
 ErrorOr<String> String::to_casefold() const
 {
+    // OPTIMIZATION: Unicode case folding of ASCII is just ASCII lowercasing.
+    if (bytes_as_string_view().is_ascii())
+        return to_ascii_lowercase();
+
     StringBuilder builder { bytes_as_string_view().length() };
     TRY(build_casefold_string(*this, builder));
 
@@ -3875,19 +3875,19 @@ template<typename ReadType, typename PushType>
 bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
 {
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    // bounds checked by verifier.
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
     auto& entry = configuration.source_value(0, addresses.sources); // bounds checked by verifier.
     auto base = entry.to<i32>();
     u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
-    if (instance_address + sizeof(ReadType) > memory->size()) {
+    if (instance_address + sizeof(ReadType) > memory->size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(ReadType), memory->size());
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
-    entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
+    entry = Value(static_cast<PushType>(read_value<ReadType>({ memory->data().offset_pointer(instance_address), sizeof(ReadType) })));
     return false;
 }
 
@@ -3901,26 +3901,27 @@ template<size_t M, size_t N, template<typename> typename SetSign>
 bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
 {
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    // bounds checked by verifier.
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
     auto& entry = configuration.source_value(0, addresses.sources); // bounds checked by verifier.
     auto base = entry.to<i32>();
     u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
-    if (instance_address + M * N / 8 > memory->size()) {
+    if (instance_address + M * N / 8 > memory->size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + M * N / 8, memory->size());
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M * N / 8);
+    auto const* source = memory->data().offset_pointer(instance_address);
     using V64 = NativeVectorType<M, N, SetSign>;
     using V128 = NativeVectorType<M * 2, N, SetSign>;
 
     V64 bytes { 0 };
-    if (bit_cast<FlatPtr>(slice.data()) % sizeof(V64) == 0)
-        bytes = *bit_cast<V64*>(slice.data());
+    if (bit_cast<FlatPtr>(source) % sizeof(V64) == 0)
+        bytes = *bit_cast<V64 const*>(source);
     else
-        ByteReader::load(slice.data(), bytes);
+        ByteReader::load(source, bytes);
 
     entry = Value(bit_cast<u128>(convert_vector<V128>(bytes)));
     return false;
@@ -3930,19 +3931,19 @@ template<size_t N>
 bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
 {
     auto memarg_and_lane = instruction.arguments().get<Instruction::MemoryAndLaneArgument>();
-    auto& address = configuration.frame().module().memories()[memarg_and_lane.memory.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    // bounds checked by verifier.
+    auto& address = configuration.frame().module().memories().data()[memarg_and_lane.memory.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
     // bounds checked by verifier.
     auto vector = configuration.take_source(0, addresses.sources).to<u128>();
     auto base = configuration.take_source(1, addresses.sources).to<u32>();
     u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + memarg_and_lane.memory.offset;
-    if (instance_address + N / 8 > memory->size()) {
+    if (instance_address + N / 8 > memory->size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
     auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
-    memcpy(dst, slice.data(), N / 8);
+    memcpy(dst, memory->data().offset_pointer(instance_address), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
     return false;
 }
@@ -3951,18 +3952,18 @@ template<size_t N>
 bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
 {
     auto memarg_and_lane = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories()[memarg_and_lane.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    // bounds checked by verifier.
+    auto& address = configuration.frame().module().memories().data()[memarg_and_lane.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
     // bounds checked by verifier.
     auto base = configuration.take_source(0, addresses.sources).to<u32>();
     u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + memarg_and_lane.offset;
-    if (instance_address + N / 8 > memory->size()) {
+    if (instance_address + N / 8 > memory->size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
     u128 vector = 0;
-    memcpy(&vector, slice.data(), N / 8);
+    memcpy(&vector, memory->data().offset_pointer(instance_address), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
     return false;
 }
@@ -3971,19 +3972,19 @@ template<size_t M>
 bool BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
 {
     auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
-    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    // bounds checked by verifier.
+    auto& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
+    auto memory = configuration.store().unsafe_get(address);
     auto& entry = configuration.source_value(0, addresses.sources); // bounds checked by verifier.
     auto base = entry.to<i32>();
     u64 instance_address = static_cast<u64>(bit_cast<u32>(base)) + arg.offset;
-    if (instance_address + M / 8 > memory->size()) {
+    if (instance_address + M / 8 > memory->size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + M / 8, memory->size());
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-splat({} : {}) -> stack", instance_address, M / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
-    auto value = read_value<NativeIntegralType<M>>(slice);
+    auto value = read_value<NativeIntegralType<M>>({ memory->data().offset_pointer(instance_address), M / 8 });
     set_top_m_splat<M, NativeIntegralType>(configuration, value, addresses);
     return false;
 }
@@ -4164,8 +4165,9 @@ bool BytecodeInterpreter::pop_and_store_lane_n(Configuration& configuration, Ins
 
 bool BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruction::MemoryArgument const& arg, ReadonlyBytes data, u32 base)
 {
+    // bounds checked by verifier.
     auto const& address = configuration.frame().module().memories().data()[arg.memory_index.value()];
-    auto memory = configuration.store().get(address);
+    auto memory = configuration.store().unsafe_get(address);
     u64 instance_address = static_cast<u64>(base) + arg.offset;
     return store_to_memory(*memory, instance_address, data);
 }
@@ -4173,15 +4175,15 @@ bool BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
 template<typename T>
 bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T value)
 {
-    Checked addition { address };
     size_t data_size;
     if constexpr (IsSame<ReadonlyBytes, T>)
         data_size = value.size();
     else
         data_size = sizeof(T);
 
-    addition += data_size;
-    if (addition.has_overflow() || addition.value() > memory.size()) [[unlikely]] {
+    // NOTE: The addition cannot overflow, as the address is at most 2^32 + 2^32 and the data size
+    //       is at most 16 bytes (a v128 store).
+    if (address + data_size > memory.size()) [[unlikely]] {
         m_trap = Trap::from_string("Memory access out of bounds");
         dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected 0 <= {} and {} <= {})", address, address + data_size, memory.size());
         return true;
@@ -4189,9 +4191,9 @@ bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T
 
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data_size, address);
     if constexpr (IsSame<ReadonlyBytes, T>)
-        (void)value.copy_to(memory.data().bytes().slice(address, data_size));
+        memcpy(memory.data().offset_pointer(address), value.data(), data_size);
     else
-        memcpy(memory.data().bytes().offset_pointer(address), &value, data_size);
+        memcpy(memory.data().offset_pointer(address), &value, data_size);
     return false;
 }
 
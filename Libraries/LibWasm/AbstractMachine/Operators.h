@@ -339,16 +339,13 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
-        auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
+        using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        auto first = bit_cast<VectorType>(c1);
+        auto second = bit_cast<VectorType>(c2);
         Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            SetSign<ElementType> lhs = result[i];
-            SetSign<ElementType> rhs = other[i];
-            result[i] = op(lhs, rhs) ? static_cast<MakeUnsigned<ElementType>>(-1) : 0;
-        }
-        return bit_cast<u128>(result);
+        // NOTE: Comparing whole vectors yields all-ones or all-zeroes lanes, which is exactly
+        //       what the spec asks for.
+        return bit_cast<u128>(op(first, second));
     }
 
     static StringView name()
@@ -374,12 +371,10 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        Native128ByteVectorOf<ElementType, MakeUnsigned> result;
         Op op;
-        for (size_t i = 0; i < VectorSize; ++i)
-            result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
-        return bit_cast<u128>(result);
+        // NOTE: Comparing whole vectors yields all-ones or all-zeroes lanes (false for NaN
+        //       operands except with !=), which is exactly what the spec asks for.
+        return bit_cast<u128>(op(first, other));
     }
 
     static StringView name()
@@ -576,16 +571,29 @@ struct VectorIntegerExtOpPairwise {
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
         Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
-        }
+        if constexpr (IsSame<Op, Add>) {
+            // OPTIMIZATION: Each result lane covers one adjacent pair of source lanes, so the pair
+            //               members can be extracted with shifts on the wide lanes (sign- or
+            //               zero-extending per SetSign) and summed as whole vectors. The sum of two
+            //               source lanes always fits the wide lane.
+            constexpr auto source_lane_bits = 128 / (VectorSize * 2);
+            auto vector = bit_cast<VectorResult>(c);
+            auto low = (vector << source_lane_bits) >> source_lane_bits;
+            auto high = vector >> source_lane_bits;
+            return bit_cast<u128>(low + high);
+        } else {
+            auto vector = bit_cast<VectorInput>(c);
+            VectorResult result;
 
-        return bit_cast<u128>(result);
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
+            }
+
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -613,21 +621,11 @@ struct VectorIntegerExt {
     auto operator()(u128 c) const
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        using VectorHalfInput = NativeVectorType<128 / (VectorSize * 2), VectorSize, SetSign>;
+        // OPTIMIZATION: The source lanes all live in one half of the input vector, so they can be
+        //               widened with a single vector conversion of that half.
+        auto half = bit_cast<VectorHalfInput>(Mode == VectorExt::High ? c.high() : c.low());
+        return bit_cast<u128>(__builtin_convertvector(half, VectorResult));
     }
 
     static StringView name()
@@ -650,28 +648,26 @@ struct VectorIntegerExtOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto first = bit_cast<VectorInput>(lhs);
-        auto second = bit_cast<VectorInput>(rhs);
-        VectorResult result;
+        using VectorHalfInput = NativeVectorType<128 / (VectorSize * 2), VectorSize, SetSign>;
+        // OPTIMIZATION: The source lanes all live in one half of each input vector, so they can be
+        //               widened with a single vector conversion per operand.
+        auto first = __builtin_convertvector(bit_cast<VectorHalfInput>(Mode == VectorExt::High ? lhs.high() : lhs.low()), VectorResult);
+        auto second = __builtin_convertvector(bit_cast<VectorHalfInput>(Mode == VectorExt::High ? rhs.high() : rhs.low()), VectorResult);
         Op op;
 
-        using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High) {
-                ResultType a = first[VectorSize + i];
-                ResultType b = second[VectorSize + i];
-                result[i] = op(a, b);
-            } else if constexpr (Mode == VectorExt::Low) {
-                ResultType a = first[i];
-                ResultType b = second[i];
-                result[i] = op(a, b);
-            } else
-                VERIFY_NOT_REACHED();
-        }
+        if constexpr (IsSame<Op, Multiply>) {
+            // NOTE: The product of two widened lanes always fits the wide lane, so this cannot
+            //       overflow.
+            return bit_cast<u128>(Op {}(first, second));
+        } else {
+            VectorResult result;
 
-        return bit_cast<u128>(result);
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(first[i], second[i]);
+
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -694,17 +690,27 @@ struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        auto first = bit_cast<VectorType>(lhs);
-        auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
+        // OPTIMIZATION: Wrapping arithmetic applies to whole vectors at once, letting the compiler
+        //               emit actual vector instructions. Unsigned lanes sidestep signed-overflow
+        //               UB; the resulting bit patterns are the same either way.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            auto first = bit_cast<UnsignedVectorType>(lhs);
+            auto second = bit_cast<UnsignedVectorType>(rhs);
+            return bit_cast<u128>(Op {}(first, second));
+        } else {
+            auto first = bit_cast<VectorType>(lhs);
+            auto second = bit_cast<VectorType>(rhs);
+            VectorType result;
+            Op op;
+
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+            return bit_cast<u128>(result);
         }
-
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -829,16 +835,24 @@ struct VectorIntegerUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
+        // OPTIMIZATION: Negating unsigned lanes is negation modulo 2^N, which is the exact spec
+        //               behavior (including for the minimum signed value), and applies to whole
+        //               vectors at once.
+        if constexpr (IsSame<Op, Negate>) {
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(-bit_cast<UnsignedVectorType>(lhs));
+        } else {
+            auto value = bit_cast<VectorType>(lhs);
+            VectorType result;
+            Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
-        }
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(value[i]);
+            }
 
-        return bit_cast<u128>(result);
+            return bit_cast<u128>(result);
+        }
     }
 
     static StringView name()
@@ -865,12 +879,21 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+        // OPTIMIZATION: IEEE 754 vector arithmetic has exactly the lane-wise semantics the spec
+        //               requires, so these operators can apply to whole vectors at once. Divide is
+        //               spelled out since its functor only divides directly for scalar floats.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            return bit_cast<u128>(Op {}(first, second));
+        } else if constexpr (IsSame<Op, Divide>) {
+            return bit_cast<u128>(first / second);
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(first[i], second[i]);
+            }
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -892,12 +915,18 @@ struct VectorFloatUnaryOp {
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
+        // OPTIMIZATION: Vector negation just flips the sign bits (NaNs included), same as the
+        //               scalar functor does lane by lane.
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(-value);
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i) {
+                result[i] = op(value[i]);
+            }
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -68,6 +68,11 @@ public:
 
     void remove_animations_from_timeline();
 
+    // NOTE: This returns true if any animation or transition has ever been associated with this
+    //       element, even if it has since finished. A return value of false is a guarantee that
+    //       the element's style is unaffected by animations and transitions.
+    [[nodiscard]] bool may_have_animations_or_transitions() const { return m_impl != nullptr; }
+
 protected:
     void visit_edges(JS::Cell::Visitor&);
 
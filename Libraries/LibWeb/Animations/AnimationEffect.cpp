@@ -636,9 +636,18 @@ void AnimationEffect::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_associated_animation);
 }
 
-static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties)
-{
+struct RequiredInvalidationForAnimatedProperties {
     CSS::RequiredInvalidationAfterStyleChange invalidation;
+    bool changed_an_inherited_property { false };
+    // Whether every property that requested a stacking context tree rebuild did so only because it may
+    // have started or stopped establishing a stacking context (as opacity and the transform properties
+    // do), rather than changing how existing contexts are ordered.
+    bool stacking_context_rebuild_is_establishment_only { true };
+};
+
+static RequiredInvalidationForAnimatedProperties compute_required_invalidation_for_animated_properties(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::StyleValue const>> const& new_properties)
+{
+    RequiredInvalidationForAnimatedProperties result;
     auto old_and_new_properties = MUST(Bitmap::create(CSS::number_of_longhand_properties, 0));
     for (auto const& [property_id, _] : old_properties)
         old_and_new_properties.set(to_underlying(property_id) - to_underlying(CSS::first_longhand_property_id), 1);
@@ -652,9 +661,16 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation_f
         auto const* new_value = new_properties.get(property_id).value_or({});
         if (!old_value && !new_value)
             continue;
-        invalidation |= compute_property_invalidation(property_id, old_value, new_value);
+        auto property_invalidation = compute_property_invalidation(property_id, old_value, new_value);
+        // NOTE: compute_property_invalidation() returns no invalidation when the value is unchanged.
+        if (!property_invalidation.is_none() && CSS::is_inherited_property(property_id))
+            result.changed_an_inherited_property = true;
+        if (property_invalidation.rebuild_stacking_context_tree
+            && !AK::first_is_one_of(property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform, CSS::PropertyID::Translate, CSS::PropertyID::Rotate, CSS::PropertyID::Scale))
+            result.stacking_context_rebuild_is_establishment_only = false;
+        result.invalidation |= property_invalidation;
     }
-    return invalidation;
+    return result;
 }
 
 AnimationUpdateContext::~AnimationUpdateContext()
@@ -665,19 +681,24 @@ AnimationUpdateContext::~AnimationUpdateContext()
             continue;
         auto& element = it.key;
         GC::Ref<DOM::Element> target = element.element();
-        auto invalidation = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values());
+        auto [invalidation, changed_an_inherited_property, stacking_context_rebuild_is_establishment_only] = compute_required_invalidation_for_animated_properties(it.value->animated_properties_before_update, style->animated_property_values());
 
         if (invalidation.is_none())
             continue;
 
         // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
-        target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
-            auto element_invalidation = element.recompute_inherited_style();
-            if (element_invalidation.is_none())
-                return TraversalDecision::SkipChildrenAndContinue;
-            invalidation |= element_invalidation;
-            return TraversalDecision::Continue;
-        });
+        // OPTIMIZATION: If no inherited property changed, descendant style can't have been affected, so skip the
+        //               walk entirely. This keeps ticking a transform or opacity animation (the common case)
+        //               independent of the size of the target's subtree.
+        if (changed_an_inherited_property) {
+            target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
+                auto element_invalidation = element.recompute_inherited_style();
+                if (element_invalidation.is_none())
+                    return TraversalDecision::SkipChildrenAndContinue;
+                invalidation |= element_invalidation;
+                return TraversalDecision::Continue;
+            });
+        }
 
         if (!element.pseudo_element().has_value()) {
             if (target->layout_node())
@@ -703,8 +724,19 @@ AnimationUpdateContext::~AnimationUpdateContext()
                 target->paintable()->set_needs_paint_only_properties_update(true);
             element.document().set_needs_display();
         }
-        if (invalidation.rebuild_stacking_context_tree)
-            element.document().invalidate_stacking_context_tree();
+        if (invalidation.rebuild_stacking_context_tree) {
+            // OPTIMIZATION: Opacity and transform changes only request a rebuild because they may have
+            //               started or stopped establishing a stacking context. If the target establishes
+            //               one either way — typically because will-change: transform or opacity pins it —
+            //               the shape of the stacking context tree is unchanged and the retained tree,
+            //               including its sorted child lists, can be kept.
+            auto const* paintable_box = element.pseudo_element().has_value() ? nullptr : target->paintable_box();
+            bool establishment_is_unchanged = stacking_context_rebuild_is_establishment_only
+                && paintable_box
+                && (paintable_box->stacking_context() != nullptr) == paintable_box->layout_node().establishes_stacking_context();
+            if (!establishment_is_unchanged)
+                element.document().invalidate_stacking_context_tree();
+        }
     }
 }
 
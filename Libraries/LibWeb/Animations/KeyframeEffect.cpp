@@ -788,6 +788,7 @@ void KeyframeEffect::set_target(DOM::Element* target)
             target->associate_with_animation(*animation);
     }
     m_target_element = target;
+    m_cached_computed_keyframe_values.clear();
 }
 
 Optional<String> KeyframeEffect::pseudo_element() const
@@ -889,6 +890,7 @@ WebIDL::ExceptionOr<void> KeyframeEffect::set_keyframes(Optional<GC::Root<JS::Ob
 
     generate_initial_and_final_frames(keyframe_set, m_target_properties);
     m_key_frame_set = keyframe_set;
+    m_cached_computed_keyframe_values.clear();
 
     return {};
 }
@@ -909,6 +911,8 @@ void KeyframeEffect::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_target_element);
     visitor.visit(m_keyframe_objects);
+    if (m_cached_computed_keyframe_values.has_value())
+        visitor.visit(m_cached_computed_keyframe_values->target_style);
 }
 
 void KeyframeEffect::update_computed_properties(AnimationUpdateContext& context)
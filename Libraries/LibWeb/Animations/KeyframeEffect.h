@@ -103,7 +103,30 @@ public:
     WebIDL::ExceptionOr<void> set_keyframes(Optional<GC::Root<JS::Object>> const&);
 
     KeyFrameSet const* key_frame_set() { return m_key_frame_set; }
-    void set_key_frame_set(RefPtr<KeyFrameSet const> key_frame_set) { m_key_frame_set = key_frame_set; }
+    void set_key_frame_set(RefPtr<KeyFrameSet const> key_frame_set)
+    {
+        m_key_frame_set = key_frame_set;
+        m_cached_computed_keyframe_values.clear();
+    }
+
+    // OPTIMIZATION: The computed values of the pair of keyframes currently being interpolated between.
+    //               Computing them means expanding shorthands, mapping logical properties and running the
+    //               computed-value logic for every keyframe property, but the result only changes when the
+    //               animation moves on to a different keyframe pair or the target's underlying style changes,
+    //               not on every tick. StyleComputer::collect_animation_into() keeps the values for the active
+    //               pair here so that a ticking animation only has to interpolate.
+    struct CachedComputedKeyframeValues {
+        i64 start_key { 0 };
+        i64 end_key { 0 };
+        GC::Ptr<CSS::ComputedProperties> target_style;
+        CSSPixels font_size { 0 };
+        CSSPixels line_height { 0 };
+        // Cleared when a keyframe value depends on per-tick state (e.g. inherit from an animated ancestor).
+        bool is_reusable { false };
+        HashMap<CSS::PropertyID, RefPtr<CSS::StyleValue const>> start_values;
+        HashMap<CSS::PropertyID, RefPtr<CSS::StyleValue const>> end_values;
+    };
+    Optional<CachedComputedKeyframeValues>& cached_computed_keyframe_values() { return m_cached_computed_keyframe_values; }
 
     virtual bool is_keyframe_effect() const override { return true; }
 
@@ -136,6 +159,8 @@ private:
 
     RefPtr<KeyFrameSet const> m_key_frame_set {};
 
+    Optional<CachedComputedKeyframeValues> m_cached_computed_keyframe_values;
+
     Optional<CSS::AnimationPlayState> m_last_css_animation_play_state;
 };
 
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/Object.h>
@@ -15,12 +16,21 @@ namespace Web::Bindings {
 
 GC_DEFINE_ALLOCATOR(Intrinsics);
 
+size_t Detail::next_intrinsic_cache_index()
+{
+    static Atomic<size_t> s_next_index { 0 };
+    return s_next_index.fetch_add(1);
+}
+
 void Intrinsics::visit_edges(JS::Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_namespaces);
     visitor.visit(m_prototypes);
     visitor.visit(m_constructors);
+    visitor.visit(m_cached_prototypes);
+    for (auto& entry : m_cached_constructors)
+        visitor.visit(entry.constructor);
     visitor.visit(m_realm);
 }
 
@@ -9,6 +9,7 @@
 #include <AK/FlyString.h>
 #include <AK/Forward.h>
 #include <AK/HashMap.h>
+#include <AK/Vector.h>
 #include <LibGC/Heap.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Heap/Cell.h>
@@ -27,6 +28,22 @@
 
 namespace Web::Bindings {
 
+namespace Detail {
+
+WEB_API size_t next_intrinsic_cache_index();
+
+// OPTIMIZATION: Gives each prototype/constructor type a process-wide sequential index, so that
+//               Intrinsics can cache the ensure_web_*() results in a flat vector and skip the hash
+//               lookup that would otherwise run for every platform object constructed in the realm.
+template<typename T>
+size_t intrinsic_cache_index()
+{
+    static size_t index = next_intrinsic_cache_index();
+    return index;
+}
+
+}
+
 class Intrinsics final : public JS::Cell {
     GC_CELL(Intrinsics, JS::Cell);
     GC_DECLARE_ALLOCATOR(Intrinsics);
@@ -50,21 +67,46 @@ public:
     template<typename PrototypeType>
     JS::Object& ensure_web_prototype(FlyString const& class_name)
     {
-        if (auto it = m_prototypes.find(class_name); it != m_prototypes.end())
-            return *it->value;
-
-        create_web_prototype_and_constructor<PrototypeType>(*m_realm);
-        return *m_prototypes.find(class_name)->value;
+        // OPTIMIZATION: This runs when constructing any platform object of this type in the realm, so
+        //               after the first call the result is served from a per-type slot.
+        auto cache_index = Detail::intrinsic_cache_index<PrototypeType>();
+        if (cache_index < m_cached_prototypes.size()) {
+            if (auto cached = m_cached_prototypes[cache_index])
+                return *cached;
+        }
+
+        if (!m_prototypes.contains(class_name))
+            create_web_prototype_and_constructor<PrototypeType>(*m_realm);
+        auto& prototype = *m_prototypes.find(class_name)->value;
+
+        if (cache_index >= m_cached_prototypes.size())
+            m_cached_prototypes.resize(cache_index + 1);
+        m_cached_prototypes[cache_index] = prototype;
+        return prototype;
     }
 
     template<typename PrototypeType>
     JS::NativeFunction& ensure_web_constructor(FlyString const& class_name)
     {
-        if (auto it = m_constructors.find(class_name); it != m_constructors.end())
-            return *it->value;
-
-        create_web_prototype_and_constructor<PrototypeType>(*m_realm);
-        return *m_constructors.find(class_name)->value;
+        // NOTE: Unlike prototypes, constructors are not 1:1 with the prototype type: a
+        //       LegacyFactoryFunction shares its interface's prototype type but registers a second
+        //       constructor under another name (e.g. "Image" next to "HTMLImageElement"). The slot
+        //       therefore remembers which name it holds, and other names take the map path.
+        auto cache_index = Detail::intrinsic_cache_index<PrototypeType>();
+        if (cache_index < m_cached_constructors.size()) {
+            if (auto const& cached = m_cached_constructors[cache_index]; cached.constructor && cached.class_name == class_name)
+                return *cached.constructor;
+        }
+
+        if (!m_constructors.contains(class_name))
+            create_web_prototype_and_constructor<PrototypeType>(*m_realm);
+        auto& constructor = *m_constructors.find(class_name)->value;
+
+        if (cache_index >= m_cached_constructors.size())
+            m_cached_constructors.resize(cache_index + 1);
+        if (!m_cached_constructors[cache_index].constructor)
+            m_cached_constructors[cache_index] = { class_name, constructor };
+        return constructor;
     }
 
     template<typename PrototypeType>
@@ -82,6 +124,17 @@ private:
     HashMap<FlyString, GC::Ref<JS::Object>> m_namespaces;
     HashMap<FlyString, GC::Ref<JS::Object>> m_prototypes;
     HashMap<FlyString, GC::Ptr<JS::NativeFunction>> m_constructors;
+
+    struct CachedConstructor {
+        FlyString class_name;
+        GC::Ptr<JS::NativeFunction> constructor;
+    };
+
+    // Per-type caches, indexed by Detail::intrinsic_cache_index(). These only ever hold objects that
+    // are also in the maps above.
+    Vector<GC::Ptr<JS::Object>> m_cached_prototypes;
+    Vector<CachedConstructor> m_cached_constructors;
+
     GC::Ref<JS::Realm> m_realm;
 };
 
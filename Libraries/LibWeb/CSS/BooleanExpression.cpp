@@ -52,6 +52,11 @@ void BooleanNotExpression::dump(StringBuilder& builder, int indent_levels) const
     m_child->dump(builder, indent_levels + 1);
 }
 
+bool BooleanNotExpression::depends_on_viewport_dimensions() const
+{
+    return m_child->depends_on_viewport_dimensions();
+}
+
 MatchResult BooleanExpressionInParens::evaluate(DOM::Document const* document) const
 {
     return m_child->evaluate(document);
@@ -71,6 +76,11 @@ void BooleanExpressionInParens::dump(StringBuilder& builder, int indent_levels)
     builder.append(")\n"sv);
 }
 
+bool BooleanExpressionInParens::depends_on_viewport_dimensions() const
+{
+    return m_child->depends_on_viewport_dimensions();
+}
+
 MatchResult BooleanAndExpression::evaluate(DOM::Document const* document) const
 {
     // https://drafts.csswg.org/css-values-5/#boolean-logic
@@ -102,6 +112,15 @@ void BooleanAndExpression::dump(StringBuilder& builder, int indent_levels) const
         child->dump(builder, indent_levels + 1);
 }
 
+bool BooleanAndExpression::depends_on_viewport_dimensions() const
+{
+    for (auto const& child : m_children) {
+        if (child->depends_on_viewport_dimensions())
+            return true;
+    }
+    return false;
+}
+
 MatchResult BooleanOrExpression::evaluate(DOM::Document const* document) const
 {
     // https://drafts.csswg.org/css-values-5/#boolean-logic
@@ -133,4 +152,13 @@ void BooleanOrExpression::dump(StringBuilder& builder, int indent_levels) const
         child->dump(builder, indent_levels + 1);
 }
 
+bool BooleanOrExpression::depends_on_viewport_dimensions() const
+{
+    for (auto const& child : m_children) {
+        if (child->depends_on_viewport_dimensions())
+            return true;
+    }
+    return false;
+}
+
 }
@@ -87,6 +87,10 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const = 0;
     virtual String to_string() const = 0;
     virtual void dump(StringBuilder&, int indent_levels = 0) const = 0;
+
+    // Whether evaluating this expression reads the viewport dimensions. Used to skip re-evaluating
+    // media queries whose result can't possibly change when the viewport is resized.
+    virtual bool depends_on_viewport_dimensions() const { return false; }
 };
 
 // https://www.w3.org/TR/mediaqueries-4/#typedef-general-enclosed
@@ -124,6 +128,7 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
+    virtual bool depends_on_viewport_dimensions() const override;
 
 private:
     BooleanNotExpression(NonnullOwnPtr<BooleanExpression>&& child)
@@ -145,6 +150,7 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
+    virtual bool depends_on_viewport_dimensions() const override;
 
 private:
     BooleanExpressionInParens(NonnullOwnPtr<BooleanExpression>&& child)
@@ -166,6 +172,7 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
+    virtual bool depends_on_viewport_dimensions() const override;
 
 private:
     BooleanAndExpression(Vector<NonnullOwnPtr<BooleanExpression>>&& children)
@@ -187,6 +194,7 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
+    virtual bool depends_on_viewport_dimensions() const override;
 
 private:
     BooleanOrExpression(Vector<NonnullOwnPtr<BooleanExpression>>&& children)
@@ -30,7 +30,7 @@ public:
 
     MediaList* media() const { return m_media; }
 
-    bool evaluate(DOM::Document const& document) { return m_media->evaluate(document); }
+    bool evaluate(DOM::Document const& document, MediaQueryEvaluationScope scope = MediaQueryEvaluationScope::All) { return m_media->evaluate(document, scope); }
 
 private:
     CSSMediaRule(JS::Realm&, MediaList&, CSSRuleList&);
@@ -11,6 +11,7 @@
 #include <AK/Function.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/CSS/CSSRule.h>
+#include <LibWeb/CSS/MediaQuery.h>
 #include <LibWeb/CSS/Parser/RuleContext.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -62,7 +63,7 @@ public:
 
     void for_each_effective_rule(TraversalOrder, Function<void(CSSRule const&)> const& callback) const;
     // Returns whether the match state of any media queries changed after evaluation.
-    bool evaluate_media_queries(DOM::Document const&);
+    bool evaluate_media_queries(DOM::Document const&, MediaQueryEvaluationScope = MediaQueryEvaluationScope::All);
 
     void set_owner_rule(GC::Ref<CSSRule> owner_rule) { m_owner_rule = owner_rule; }
     void set_rules(Badge<CSSStyleSheet>, Vector<GC::Ref<CSSRule>> rules) { m_rules = move(rules); }
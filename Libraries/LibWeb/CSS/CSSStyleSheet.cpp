@@ -368,14 +368,14 @@ GC::Ptr<DOM::Document> CSSStyleSheet::owning_document() const
     return nullptr;
 }
 
-bool CSSStyleSheet::evaluate_media_queries(DOM::Document const& document)
+bool CSSStyleSheet::evaluate_media_queries(DOM::Document const& document, MediaQueryEvaluationScope scope)
 {
     bool any_media_queries_changed_match_state = false;
 
-    bool now_matches = m_media->evaluate(document);
+    bool now_matches = m_media->evaluate(document, scope);
     if (!m_did_match.has_value() || m_did_match.value() != now_matches)
         any_media_queries_changed_match_state = true;
-    if (now_matches && m_rules->evaluate_media_queries(document))
+    if (now_matches && m_rules->evaluate_media_queries(document, scope))
         any_media_queries_changed_match_state = true;
 
     m_did_match = now_matches;
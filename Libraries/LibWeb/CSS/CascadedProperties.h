@@ -34,6 +34,16 @@ public:
 
     void resolve_unresolved_properties(DOM::AbstractElement);
 
+    // Calls `callback` with every value in the cascade, including values overridden by later entries.
+    template<typename Callback>
+    void for_each_value(Callback callback) const
+    {
+        for (auto const& [property_id, entries] : m_properties) {
+            for (auto const& entry : entries)
+                callback(*entry.property.value);
+        }
+    }
+
 private:
     CascadedProperties();
 
@@ -843,6 +843,24 @@ bool ComputedProperties::operator==(ComputedProperties const& other) const
     return true;
 }
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_values = m_property_values;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_display_before_box_type_transformation = m_display_before_box_type_transformation;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 TextAnchor ComputedProperties::text_anchor() const
 {
     auto const& value = property(PropertyID::TextAnchor);
@@ -253,6 +253,8 @@ public:
 
     bool operator==(ComputedProperties const&) const;
 
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
     Positioning position() const;
     Optional<int> z_index() const;
 
@@ -36,7 +36,7 @@ static NonnullRefPtr<Core::Promise<NonnullRefPtr<Gfx::Typeface const>>> load_vec
     // FIXME: 'Asynchronously' shouldn't mean 'later on the main thread'.
     //        Can we defer this to a background thread?
     Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&data, promise] {
-        // FIXME: This should be de-duplicated with StyleComputer::FontLoader::try_load_font
+        // FIXME: This should be de-duplicated with StyleComputer's try_decode_font()
         // We don't have the luxury of knowing the MIME type, so we have to try all formats.
         auto ttf = Gfx::Typeface::try_load_from_externally_owned_memory(data);
         if (!ttf.is_error()) {
@@ -109,10 +109,10 @@ void MediaList::delete_medium(StringView medium)
     // FIXME: If nothing was removed, then throw a NotFoundError exception.
 }
 
-bool MediaList::evaluate(DOM::Document const& document)
+bool MediaList::evaluate(DOM::Document const& document, MediaQueryEvaluationScope scope)
 {
     for (auto& media : m_media)
-        media->evaluate(document);
+        media->evaluate(document, scope);
 
     return matches();
 }
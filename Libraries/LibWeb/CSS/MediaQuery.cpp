@@ -96,6 +96,49 @@ String MediaFeature::to_string() const
     VERIFY_NOT_REACHED();
 }
 
+bool MediaFeature::depends_on_viewport_dimensions() const
+{
+    switch (m_id) {
+    case MediaFeatureID::AspectRatio:
+    case MediaFeatureID::Height:
+    case MediaFeatureID::Orientation:
+    case MediaFeatureID::Width:
+        return true;
+    default:
+        break;
+    }
+
+    // Lengths compared against other features may also use viewport-relative units, which resolve
+    // against the viewport size. Calculated lengths could contain such units anywhere, so treat
+    // them as viewport-dependent.
+    auto value_depends_on_viewport_dimensions = [](MediaFeatureValue const& value) {
+        if (!value.is_length())
+            return false;
+        auto const& length = value.length();
+        if (length.is_calculated())
+            return true;
+        return length.value().is_viewport_relative();
+    };
+
+    switch (m_type) {
+    case Type::IsTrue:
+        return false;
+    case Type::ExactValue:
+    case Type::MinValue:
+    case Type::MaxValue:
+        return value_depends_on_viewport_dimensions(value());
+    case Type::Range: {
+        auto const& range = this->range();
+        if (range.left_value.has_value() && value_depends_on_viewport_dimensions(*range.left_value))
+            return true;
+        if (range.right_value.has_value() && value_depends_on_viewport_dimensions(*range.right_value))
+            return true;
+        return false;
+    }
+    }
+    VERIFY_NOT_REACHED();
+}
+
 MatchResult MediaFeature::evaluate(DOM::Document const* document) const
 {
     VERIFY(document);
@@ -288,8 +331,20 @@ String MediaQuery::to_string() const
     return MUST(builder.to_string());
 }
 
-bool MediaQuery::evaluate(DOM::Document const& document)
+bool MediaQuery::depends_on_viewport_dimensions() const
 {
+    if (!m_depends_on_viewport_dimensions.has_value())
+        m_depends_on_viewport_dimensions = m_media_condition && m_media_condition->depends_on_viewport_dimensions();
+    return *m_depends_on_viewport_dimensions;
+}
+
+bool MediaQuery::evaluate(DOM::Document const& document, MediaQueryEvaluationScope scope)
+{
+    // OPTIMIZATION: If this evaluation was triggered by a viewport size change and nothing in this
+    //               query reads the viewport dimensions, the cached result is still valid.
+    if (scope == MediaQueryEvaluationScope::ViewportDependent && !depends_on_viewport_dimensions())
+        return m_matches;
+
     auto matches_media = [](MediaType const& media) -> MatchResult {
         if (!media.known_type.has_value())
             return MatchResult::False;
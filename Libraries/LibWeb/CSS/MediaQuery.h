@@ -164,6 +164,7 @@ public:
     virtual MatchResult evaluate(DOM::Document const*) const override;
     virtual String to_string() const override;
     virtual void dump(StringBuilder&, int indent_levels = 0) const override;
+    virtual bool depends_on_viewport_dimensions() const override;
 
 private:
     enum class Type : u8 {
@@ -197,6 +198,12 @@ private:
     Variant<Empty, MediaFeatureValue, Range> m_value {};
 };
 
+// How much of a media query needs re-evaluating, based on what triggered the evaluation.
+enum class MediaQueryEvaluationScope : u8 {
+    All,
+    ViewportDependent,
+};
+
 class MediaQuery : public RefCounted<MediaQuery> {
     friend class Parser::Parser;
 
@@ -218,9 +225,11 @@ public:
     static NonnullRefPtr<MediaQuery> create() { return adopt_ref(*new MediaQuery); }
 
     bool matches() const { return m_matches; }
-    bool evaluate(DOM::Document const&);
+    bool evaluate(DOM::Document const&, MediaQueryEvaluationScope = MediaQueryEvaluationScope::All);
     String to_string() const;
 
+    bool depends_on_viewport_dimensions() const;
+
 private:
     MediaQuery() = default;
 
@@ -231,6 +240,9 @@ private:
 
     // Cached value, updated by evaluate()
     bool m_matches { false };
+
+    // Lazily computed from the media condition; never changes after parsing.
+    mutable Optional<bool> m_depends_on_viewport_dimensions;
 };
 
 String serialize_a_media_query_list(Vector<NonnullRefPtr<MediaQuery>> const&);
@@ -83,14 +83,14 @@ bool MediaQueryList::matches() const
     return now_matches;
 }
 
-bool MediaQueryList::evaluate()
+bool MediaQueryList::evaluate(MediaQueryEvaluationScope scope)
 {
     if (m_media.is_empty())
         return true;
 
     bool now_matches = false;
     for (auto& media : m_media) {
-        now_matches = now_matches || media->evaluate(m_document);
+        now_matches = now_matches || media->evaluate(m_document, scope);
     }
 
     return now_matches;
@@ -24,7 +24,7 @@ public:
 
     String media() const;
     bool matches() const;
-    bool evaluate();
+    bool evaluate(MediaQueryEvaluationScope = MediaQueryEvaluationScope::All);
 
     void add_listener(GC::Ptr<DOM::IDLEventListener>);
     void remove_listener(GC::Ptr<DOM::IDLEventListener>);
@@ -16,6 +16,7 @@
 #include <LibWeb/CSS/CSSRuleList.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/Parser/Parser.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/Window.h>
 
 namespace Web {
@@ -55,7 +56,12 @@ GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet(CSS::Parser::ParsingParams cons
     }
     auto style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location, move(media_query_list));
     // FIXME: Avoid this copy
-    style_sheet->set_source_text(MUST(String::from_utf8(css)));
+    auto source_text = MUST(String::from_utf8(css));
+    // OPTIMIZATION: Sheets created from identical text (e.g. the same <style> element stamped out
+    //               for every instance of a web component) share one copy of the source text.
+    if (context.document)
+        source_text = context.document->deduplicated_style_sheet_source_text(move(source_text));
+    style_sheet->set_source_text(move(source_text));
     return style_sheet;
 }
 
@@ -155,6 +155,22 @@ static inline bool is_E(u32 code_point)
     return code_point == 0x45;
 }
 
+// OPTIMIZATION: Returns the length of the run of bytes starting at `offset` for which `predicate` holds.
+//               The hot tokenizer paths use this to consume whole ASCII runs in one step instead of
+//               decoding one code point at a time; the byte loop is simple enough for the compiler to
+//               vectorize. Multi-byte UTF-8 sequences only use bytes >= 0x80, so matching ASCII bytes
+//               can never land inside one.
+template<typename Predicate>
+static size_t length_of_byte_run(Utf8View const& view, size_t offset, Predicate&& predicate)
+{
+    auto const* bytes = view.bytes();
+    auto byte_length = view.byte_length();
+    auto end = offset;
+    while (end < byte_length && predicate(bytes[end]))
+        ++end;
+    return end - offset;
+}
+
 Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
 {
     // https://www.w3.org/TR/css-syntax-3/#css-filter-code-points
@@ -164,10 +180,13 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
 
         auto decoded_input = MUST(decoder->to_utf8(input));
 
-        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
+        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering.
+        //               Every filterable code point is a single ASCII byte, except surrogates, whose
+        //               UTF-8 encoding starts with 0xED, so a byte scan is enough to decide. This loop
+        //               is simple enough for the compiler to vectorize.
         bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
+            for (auto byte : decoded_input.bytes()) {
+                if (byte == '\r' || byte == '\f' || byte == 0x00 || byte == 0xED)
                     return true;
             }
             return false;
@@ -228,15 +247,21 @@ Tokenizer::Tokenizer(String decoded_input)
 Vector<Token> Tokenizer::tokenize()
 {
     Vector<Token> tokens;
+
+    // OPTIMIZATION: Reserve a slot per handful of input bytes so big stylesheets don't repeatedly
+    //               reallocate (and copy) the token vector while it grows.
+    tokens.ensure_capacity(m_decoded_input.bytes().size() / 4 + 1);
+
     for (;;) {
         auto token_start = m_position;
         auto token = consume_a_token();
         token.set_position_range({}, token_start, m_position);
-        tokens.append(token);
 
-        if (token.is(Token::Type::EndOfFile)) {
+        bool is_end_of_file = token.is(Token::Type::EndOfFile);
+        tokens.append(move(token));
+
+        if (is_end_of_file)
             return tokens;
-        }
     }
 }
 
@@ -451,13 +476,7 @@ Number Tokenizer::consume_a_number()
     }
 
     // 3. While the next input code point is a digit, consume it and append it to repr.
-    for (;;) {
-        auto digits = peek_code_point();
-        if (!is_digit(digits))
-            break;
-
-        repr.append_code_point(next_code_point());
-    }
+    consume_as_many_digits_as_possible(repr);
 
     // 4. If the next 2 input code points are U+002E FULL STOP (.) followed by a digit, then:
     auto maybe_number = peek_twin();
@@ -471,13 +490,7 @@ Number Tokenizer::consume_a_number()
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digit = peek_code_point();
-            if (!is_digit(digit))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        consume_as_many_digits_as_possible(repr);
     }
 
     // 5. If the next 2 or 3 input code points are U+0045 LATIN CAPITAL LETTER E (E) or
@@ -504,13 +517,7 @@ Number Tokenizer::consume_a_number()
         type = Number::Type::Number;
 
         // 4. While the next input code point is a digit, consume it and append it to repr.
-        for (;;) {
-            auto digits = peek_code_point();
-            if (!is_digit(digits))
-                break;
-
-            repr.append_code_point(next_code_point());
-        }
+        consume_as_many_digits_as_possible(repr);
     }
 
     // 6. Convert repr to a number, and set the value to the returned value.
@@ -547,6 +554,15 @@ FlyString Tokenizer::consume_an_ident_sequence()
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Identifiers are overwhelmingly plain ASCII, so consume the longest run of
+        //               ASCII ident bytes in one step, and only decode code points one at a time for
+        //               escapes and non-ASCII input.
+        auto run_start = current_byte_offset();
+        if (auto run_length = length_of_byte_run(m_utf8_view, run_start, [](u8 byte) { return is_ascii_alphanumeric(byte) || byte == '_' || byte == '-'; }); run_length > 0) {
+            result.append(m_utf8_view.as_string().substring_view(run_start, run_length));
+            skip_input_bytes_within_line(run_length);
+        }
+
         auto input = next_code_point();
 
         if (is_eof(input))
@@ -596,6 +612,19 @@ Token Tokenizer::consume_a_url_token()
 
     // 3. Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Consume the longest run of bytes that can only be part of the URL itself in
+        //               one step; every code point the loop below inspects is ASCII.
+        auto run_start = current_byte_offset();
+        if (auto run_length = length_of_byte_run(m_utf8_view, run_start, [](u8 byte) {
+                return is_ascii(byte) && !is_non_printable_code_point(byte)
+                    && byte != ')' && byte != '"' && byte != '\'' && byte != '(' && byte != '\\'
+                    && byte != '\n' && byte != '\t' && byte != ' ';
+            });
+            run_length > 0) {
+            builder.append(m_utf8_view.as_string().substring_view(run_start, run_length));
+            skip_input_bytes_within_line(run_length);
+        }
+
         auto input = next_code_point();
 
         // U+0029 RIGHT PARENTHESIS ())
@@ -703,8 +732,39 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
+    // OPTIMIZATION: After preprocessing, whitespace is always a single ASCII byte (newline, tab, or
+    //               space), so we can walk the underlying bytes directly instead of decoding code
+    //               points. Newlines still need counting for the token position information.
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+    auto offset = current_byte_offset();
+    auto start = offset;
+    while (offset < byte_length) {
+        auto byte = bytes[offset];
+        if (byte != '\n' && byte != '\t' && byte != ' ')
+            break;
+        m_prev_position = m_position;
+        if (byte == '\n') {
+            m_position.line++;
+            m_position.column = 0;
+        } else {
+            m_position.column++;
+        }
+        ++offset;
+    }
+    if (offset != start) {
+        m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset - 1);
+        m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset);
+    }
+}
+
+void Tokenizer::consume_as_many_digits_as_possible(StringBuilder& repr)
+{
+    // OPTIMIZATION: Digits are single ASCII bytes, so append the whole run in one step.
+    auto offset = current_byte_offset();
+    if (auto run_length = length_of_byte_run(m_utf8_view, offset, [](u8 byte) { return is_ascii_digit(byte); }); run_length > 0) {
+        repr.append(m_utf8_view.as_string().substring_view(offset, run_length));
+        skip_input_bytes_within_line(run_length);
     }
 }
 
@@ -714,6 +774,18 @@ void Tokenizer::reconsume_current_input_code_point()
     m_position = m_prev_position;
 }
 
+// Skips over `length` input bytes, which must all be ASCII and must not include a newline.
+void Tokenizer::skip_input_bytes_within_line(size_t length)
+{
+    VERIFY(length > 0);
+    auto offset = current_byte_offset();
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + length - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(offset + length);
+    m_prev_position = m_position;
+    m_prev_position.column += length - 1;
+    m_position.column += length;
+}
+
 // https://www.w3.org/TR/css-syntax-3/#consume-numeric-token
 Token Tokenizer::consume_a_numeric_token()
 {
@@ -877,6 +949,15 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Find the next byte that can end or alter the string (the ending code point,
+        //               a newline, a backslash, or non-ASCII) and append everything before it in one
+        //               step, so the loop below only ever looks at the interesting code points.
+        auto run_start = current_byte_offset();
+        if (auto run_length = length_of_byte_run(m_utf8_view, run_start, [&](u8 byte) { return byte != ending_code_point && byte != '\n' && byte != '\\' && is_ascii(byte); }); run_length > 0) {
+            builder.append(m_utf8_view.as_string().substring_view(run_start, run_length));
+            skip_input_bytes_within_line(run_length);
+        }
+
         auto input = next_code_point();
 
         // ending code point
@@ -945,21 +1026,37 @@ start:
     (void)next_code_point();
     (void)next_code_point();
 
-    for (;;) {
-        auto twin_inner = peek_twin();
-        if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
-            log_parse_error();
-            return;
+    // OPTIMIZATION: Find the closing "*/" with a byte scan instead of peeking two code points at
+    //               every position. We still advance through the comment one code point at a time so
+    //               the line/column bookkeeping stays in one place.
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+    Optional<size_t> close_offset;
+    for (auto offset = current_byte_offset(); offset + 1 < byte_length; ++offset) {
+        if (bytes[offset] == '*' && bytes[offset + 1] == '/') {
+            close_offset = offset;
+            break;
         }
+    }
+
+    if (!close_offset.has_value()) {
+        // There is no closing "*/", so consume code points until fewer than two remain.
+        for (;;) {
+            auto twin_inner = peek_twin();
+            if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
+                log_parse_error();
+                return;
+            }
 
-        if (is_asterisk(twin_inner.first) && is_solidus(twin_inner.second)) {
-            (void)next_code_point();
             (void)next_code_point();
-            goto start;
         }
+    }
 
+    while (current_byte_offset() < *close_offset)
         (void)next_code_point();
-    }
+    (void)next_code_point();
+    (void)next_code_point();
+    goto start;
 }
 
 // https://www.w3.org/TR/css-syntax-3/#consume-token
@@ -92,7 +92,9 @@ private:
     void consume_the_remnants_of_a_bad_url();
     void consume_comments();
     void consume_as_much_whitespace_as_possible();
+    void consume_as_many_digits_as_possible(StringBuilder&);
     void reconsume_current_input_code_point();
+    void skip_input_bytes_within_line(size_t length);
     [[nodiscard]] static bool is_valid_escape_sequence(U32Twin);
     [[nodiscard]] static bool would_start_an_ident_sequence(U32Triplet);
     [[nodiscard]] static bool would_start_a_number(U32Triplet);
@@ -6,6 +6,7 @@
  */
 
 #include "Selector.h"
+#include <AK/Function.h>
 #include <AK/GenericShorthands.h>
 #include <LibWeb/CSS/Parser/ErrorReporter.h>
 #include <LibWeb/CSS/Serialize.h>
@@ -156,31 +157,67 @@ void Selector::collect_ancestor_hashes()
         return false;
     };
 
-    auto last_combinator = m_compound_selectors.last().combinator;
-    for (ssize_t compound_selector_index = static_cast<ssize_t>(m_compound_selectors.size()) - 2; compound_selector_index >= 0; --compound_selector_index) {
-        auto const& compound_selector = m_compound_selectors[compound_selector_index];
-        if (last_combinator == Combinator::Descendant || last_combinator == Combinator::ImmediateChild) {
-            m_can_use_ancestor_filter = true;
-            for (auto const& simple_selector : compound_selector.simple_selectors) {
-                switch (simple_selector.type) {
-                case SimpleSelector::Type::Id:
-                case SimpleSelector::Type::Class:
-                    if (append_unique_hash(simple_selector.name().hash()))
-                        return;
-                    break;
-                case SimpleSelector::Type::TagName:
-                    if (append_unique_hash(simple_selector.qualified_name().name.lowercase_name.hash()))
-                        return;
+    // Harvests hashes from the simple selectors of one ancestor compound selector.
+    // Returns true if the hash array is full and collection should stop.
+    Function<bool(Vector<SimpleSelector> const&)> collect_hashes_from_ancestor_compound = [&](Vector<SimpleSelector> const& simple_selectors) -> bool {
+        for (auto const& simple_selector : simple_selectors) {
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::Id:
+            case SimpleSelector::Type::Class:
+                if (append_unique_hash(simple_selector.name().hash()))
+                    return true;
+                break;
+            case SimpleSelector::Type::TagName:
+                if (append_unique_hash(simple_selector.qualified_name().name.lowercase_name.hash()))
+                    return true;
+                break;
+            case SimpleSelector::Type::Attribute:
+                if (append_unique_hash(simple_selector.attribute().qualified_name.name.lowercase_name.hash()))
+                    return true;
+                break;
+            case SimpleSelector::Type::PseudoClass: {
+                // :is()/:where() with a single argument require that argument to match the same ancestor.
+                // This matters a lot in practice, since nesting absolutization wraps parent selectors in :is().
+                // If the argument itself is a descendant/child chain, every compound in it matches an ancestor
+                // of the subject too, so all of their hashes are required.
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                if (pseudo_class.type != PseudoClass::Is && pseudo_class.type != PseudoClass::Where)
                     break;
-                case SimpleSelector::Type::Attribute:
-                    if (append_unique_hash(simple_selector.attribute().qualified_name.name.lowercase_name.hash()))
-                        return;
+                if (pseudo_class.argument_selector_list.size() != 1)
                     break;
-                default:
+                auto const& argument_selector = *pseudo_class.argument_selector_list.first();
+                bool all_combinators_are_ancestral = true;
+                for (auto const& argument_compound : argument_selector.compound_selectors()) {
+                    if (argument_compound.combinator != Combinator::None
+                        && argument_compound.combinator != Combinator::Descendant
+                        && argument_compound.combinator != Combinator::ImmediateChild) {
+                        all_combinators_are_ancestral = false;
+                        break;
+                    }
+                }
+                if (!all_combinators_are_ancestral)
                     break;
+                for (auto const& argument_compound : argument_selector.compound_selectors()) {
+                    if (collect_hashes_from_ancestor_compound(argument_compound.simple_selectors))
+                        return true;
                 }
+                break;
+            }
+            default:
+                break;
             }
         }
+        return false;
+    };
+
+    auto last_combinator = m_compound_selectors.last().combinator;
+    for (ssize_t compound_selector_index = static_cast<ssize_t>(m_compound_selectors.size()) - 2; compound_selector_index >= 0; --compound_selector_index) {
+        auto const& compound_selector = m_compound_selectors[compound_selector_index];
+        if (last_combinator == Combinator::Descendant || last_combinator == Combinator::ImmediateChild) {
+            m_can_use_ancestor_filter = true;
+            if (collect_hashes_from_ancestor_compound(compound_selector.simple_selectors))
+                return;
+        }
         last_combinator = compound_selector.combinator;
     }
 
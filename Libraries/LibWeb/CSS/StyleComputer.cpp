@@ -17,12 +17,14 @@
 #include <AK/Math.h>
 #include <AK/NonnullRawPtr.h>
 #include <AK/QuickSort.h>
+#include <LibCore/Tracing.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/FontStyleMapping.h>
 #include <LibGfx/Font/Typeface.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 #include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Animations/AnimationEffect.h>
 #include <LibWeb/Animations/DocumentTimeline.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
@@ -80,6 +82,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
@@ -131,6 +134,11 @@ struct Traits<Web::CSS::OwnFontFaceKey> : public DefaultTraits<Web::CSS::OwnFont
     static unsigned hash(Web::CSS::OwnFontFaceKey const& key) { return pair_int_hash(key.family_name.hash(), pair_int_hash(key.weight, key.slope)); }
 };
 
+template<>
+struct Traits<Web::CSS::FontCascadeListCacheKey> : public DefaultTraits<Web::CSS::FontCascadeListCacheKey> {
+    static unsigned hash(Web::CSS::FontCascadeListCacheKey const& key) { return key.hash(); }
+};
+
 }
 
 namespace Web::CSS {
@@ -202,6 +210,14 @@ void StyleComputer::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
     visitor.visit(m_loaded_fonts);
     visitor.visit(m_user_style_sheet);
+    if (m_style_sharing_candidate.has_value()) {
+        m_style_sharing_candidate->abstract_element.visit(visitor);
+        if (m_style_sharing_candidate->element_to_inherit_style_from.has_value())
+            m_style_sharing_candidate->element_to_inherit_style_from->visit(visitor);
+        visitor.visit(m_style_sharing_candidate->inherited_style);
+        visitor.visit(m_style_sharing_candidate->cascaded_properties);
+        visitor.visit(m_style_sharing_candidate->computed_properties);
+    }
 }
 
 FontLoader::FontLoader(StyleComputer& style_computer, GC::Ptr<CSSStyleSheet> parent_style_sheet, FlyString family_name, Vector<Gfx::UnicodeRange> unicode_ranges, Vector<URL> urls, Function<void(RefPtr<Gfx::Typeface const>)> on_load)
@@ -239,6 +255,33 @@ RefPtr<Gfx::Font const> FontLoader::font_with_point_size(float point_size)
     return m_vector_font->font(point_size);
 }
 
+static ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_decode_font(Optional<MimeSniff::MimeType> mime_type, ByteBuffer const& bytes)
+{
+    // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
+    if (!mime_type.has_value() || !mime_type->is_font()) {
+        mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
+    }
+    if (mime_type.has_value()) {
+        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
+            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
+                return result;
+            }
+        }
+        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
+            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
+                return result;
+            }
+        }
+        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
+            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
+                return result;
+            }
+        }
+    }
+
+    return Error::from_string_literal("Automatic format detection failed");
+}
+
 void FontLoader::start_loading_next_url()
 {
     // FIXME: Load local() fonts somehow.
@@ -258,23 +301,26 @@ void FontLoader::start_loading_next_url()
             // 2. Load a font from stream according to its type.
 
             // NB: We need to fetch the next source if this one fails to fetch OR decode. So, first try to decode it.
-            RefPtr<Gfx::Typeface const> typeface;
-            if (auto* bytes = stream.template get_pointer<ByteBuffer>()) {
-                if (auto maybe_typeface = loader->try_load_font(response, *bytes); !maybe_typeface.is_error())
-                    typeface = maybe_typeface.release_value();
+            auto* bytes = stream.template get_pointer<ByteBuffer>();
+            if (!bytes) {
+                loader->font_decode_finished(nullptr);
+                return;
             }
 
-            if (!typeface) {
-                // NB: If we have other sources available, try the next one.
-                if (loader->m_urls.is_empty()) {
-                    loader->font_did_load_or_fail(nullptr);
-                } else {
-                    loader->m_fetch_controller = nullptr;
-                    loader->start_loading_next_url();
-                }
-            } else {
-                loader->font_did_load_or_fail(move(typeface));
-            }
+            // OPTIMIZATION: Decoding a webfont (especially decompressing WOFF/WOFF2) is pure byte
+            //               crunching that can take tens of milliseconds for large fonts, so do it
+            //               on a background thread and hop back to the event loop with the result.
+            auto mime_type = response->header_list()->extract_mime_type();
+            (void)Threading::BackgroundAction<RefPtr<Gfx::Typeface const>>::construct(
+                [mime_type = move(mime_type), bytes = move(*bytes)](auto&) -> ErrorOr<RefPtr<Gfx::Typeface const>> {
+                    if (auto maybe_typeface = try_decode_font(mime_type, bytes); !maybe_typeface.is_error())
+                        return RefPtr<Gfx::Typeface const> { maybe_typeface.release_value() };
+                    return RefPtr<Gfx::Typeface const> {};
+                },
+                [loader = GC::make_root(*loader)](RefPtr<Gfx::Typeface const> typeface) -> ErrorOr<void> {
+                    loader->font_decode_finished(move(typeface));
+                    return {};
+                });
         });
 
     if (maybe_fetch_controller.is_error()) {
@@ -284,6 +330,21 @@ void FontLoader::start_loading_next_url()
     }
 }
 
+void FontLoader::font_decode_finished(RefPtr<Gfx::Typeface const> typeface)
+{
+    if (!typeface) {
+        // NB: If we have other sources available, try the next one.
+        if (m_urls.is_empty()) {
+            font_did_load_or_fail(nullptr);
+        } else {
+            m_fetch_controller = nullptr;
+            start_loading_next_url();
+        }
+    } else {
+        font_did_load_or_fail(move(typeface));
+    }
+}
+
 void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
 {
     if (typeface) {
@@ -298,34 +359,6 @@ void FontLoader::font_did_load_or_fail(RefPtr<Gfx::Typeface const> typeface)
     m_fetch_controller = nullptr;
 }
 
-ErrorOr<NonnullRefPtr<Gfx::Typeface const>> FontLoader::try_load_font(Fetch::Infrastructure::Response const& response, ByteBuffer const& bytes)
-{
-    // FIXME: This could maybe use the format() provided in @font-face as well, since often the mime type is just application/octet-stream and we have to try every format
-    auto mime_type = response.header_list()->extract_mime_type();
-    if (!mime_type.has_value() || !mime_type->is_font()) {
-        mime_type = MimeSniff::Resource::sniff(bytes, MimeSniff::SniffingConfiguration { .sniffing_context = MimeSniff::SniffingContext::Font });
-    }
-    if (mime_type.has_value()) {
-        if (mime_type->essence() == "font/ttf"sv || mime_type->essence() == "application/x-font-ttf"sv || mime_type->essence() == "font/otf"sv) {
-            if (auto result = Gfx::Typeface::try_load_from_temporary_memory(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff"sv || mime_type->essence() == "application/font-woff"sv) {
-            if (auto result = WOFF::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-        if (mime_type->essence() == "font/woff2"sv || mime_type->essence() == "application/font-woff2"sv) {
-            if (auto result = WOFF2::try_load_from_bytes(bytes); !result.is_error()) {
-                return result;
-            }
-        }
-    }
-
-    return Error::from_string_literal("Automatic format detection failed");
-}
-
 struct StyleComputer::MatchingFontCandidate {
     FontFaceKey key;
     Variant<FontLoaderList*, Gfx::Typeface const*> loader_or_typeface;
@@ -441,7 +474,7 @@ RuleCache const* StyleComputer::rule_cache_for_cascade_origin(CascadeOrigin casc
     }();
     auto const* rule_caches_by_layer = [&]() -> RuleCaches const* {
         if (shadow_root)
-            return rule_caches_for_document_and_shadow_roots->for_shadow_roots.get(*shadow_root).value_or(nullptr);
+            return rule_caches_for_document_and_shadow_roots->for_shadow_roots.get(*rule_cache_scope_representative(shadow_root)).value_or(nullptr);
         return &rule_caches_for_document_and_shadow_roots->for_document;
     }();
     if (!rule_caches_by_layer)
@@ -465,6 +498,15 @@ RuleCache const& StyleComputer::get_pseudo_class_rule_cache(PseudoClass pseudo_c
     return *m_pseudo_class_rule_cache[to_underlying(pseudo_class)];
 }
 
+GC::Ptr<DOM::ShadowRoot const> StyleComputer::rule_cache_scope_representative(GC::Ptr<DOM::ShadowRoot const> shadow_root) const
+{
+    if (!shadow_root)
+        return shadow_root;
+    if (auto representative = m_rule_cache_scope_representatives.get(*shadow_root); representative.has_value())
+        return *representative;
+    return shadow_root;
+}
+
 InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<InvalidationSet::Property> const& properties) const
 {
     if (!m_style_invalidation_data)
@@ -478,35 +520,23 @@ InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<Invalidati
     return result;
 }
 
-bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::Property const& property) const
+InvalidationSet StyleComputer::has_subject_invalidation_set_for_properties(Vector<InvalidationSet::Property> const& properties) const
 {
-    if (!m_style_invalidation_data)
-        return true;
-    switch (property.type) {
-    case InvalidationSet::Property::Type::Id:
-        if (m_style_invalidation_data->ids_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::Class:
-        if (m_style_invalidation_data->class_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::Attribute:
-        if (m_style_invalidation_data->attribute_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::TagName:
-        if (m_style_invalidation_data->tag_names_used_in_has_selectors.contains(property.name()))
-            return true;
-        break;
-    case InvalidationSet::Property::Type::PseudoClass:
-        if (m_style_invalidation_data->pseudo_classes_used_in_has_selectors.contains(property.value.get<PseudoClass>()))
-            return true;
-        break;
-    default:
-        break;
+    // Returns the subject features an ancestor has to carry for its :has() match result to possibly
+    // change when the given properties do. An empty set means no :has() selector uses any of the
+    // properties; a set that needs whole subtree invalidation means some :has() compound has no
+    // usable subject feature, so every ancestor has to be considered.
+    InvalidationSet result;
+    if (!m_style_invalidation_data) {
+        result.set_needs_invalidate_whole_subtree();
+        return result;
     }
-    return false;
+    auto const& has_subject_invalidation_sets = m_style_invalidation_data->has_subject_invalidation_sets;
+    for (auto const& property : properties) {
+        if (auto it = has_subject_invalidation_sets.find(property); it != has_subject_invalidation_sets.end())
+            result.include_all_from(it->value);
+    }
+    return result;
 }
 
 Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractElement abstract_element, CascadeOrigin cascade_origin, PseudoClassBitmap& attempted_pseudo_class_matches, Optional<FlyString const> qualified_layer_name) const
@@ -522,6 +552,11 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
     else if (shadow_root)
         shadow_host = shadow_root->host();
 
+    // NOTE: Rules from a scope that shares its rule caches with another scope carry the
+    //       representative scope's shadow root, so that's what we compare rule roots against.
+    auto scope_representative = rule_cache_scope_representative(shadow_root);
+    auto element_scope_representative = rule_cache_scope_representative(element_shadow_root);
+
     Vector<MatchingRule const&, 512> rules_to_run;
 
     auto add_rule_to_run = [&](MatchingRule const& rule_to_run) {
@@ -537,8 +572,8 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
         // FIXME: We should reorganize the data so that the document-level StyleComputer doesn't cache *all* rules,
         //        but instead we'd have some kind of "style scope" at the document level, and also one for each shadow root.
         //        Then we could only evaluate rules from the current style scope.
-        bool rule_is_relevant_for_current_scope = rule_root == shadow_root
-            || (element_shadow_root && rule_root == element_shadow_root)
+        bool rule_is_relevant_for_current_scope = rule_root == scope_representative
+            || (element_shadow_root && rule_root == element_scope_representative)
             || from_user_agent_or_user_stylesheet
             || rule_to_run.slotted;
 
@@ -604,7 +639,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
         //       be confined to the element itself (since it refuses to cross the shadow boundary).
         auto rule_root = rule_to_run.shadow_root;
         auto shadow_host_to_use = shadow_host;
-        if (abstract_element.element().is_shadow_host() && rule_root != abstract_element.element().shadow_root())
+        if (abstract_element.element().is_shadow_host() && rule_root != element_scope_representative)
             shadow_host_to_use = nullptr;
 
         auto const& selector = rule_to_run.selector;
@@ -640,10 +675,10 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
 static void sort_matching_rules(Vector<MatchingRule const*>& matching_rules)
 {
     quick_sort(matching_rules, [&](MatchingRule const* a, MatchingRule const* b) {
-        auto const& a_selector = a->selector;
-        auto const& b_selector = b->selector;
-        auto a_specificity = a_selector.specificity();
-        auto b_specificity = b_selector.specificity();
+        // NOTE: We use the specificity cached on the MatchingRule at rule cache build time,
+        //       so sorting doesn't have to chase the selector pointer for every comparison.
+        auto a_specificity = a->specificity;
+        auto b_specificity = b->specificity;
         if (a_specificity == b_specificity) {
             if (a->style_sheet_index == b->style_sheet_index)
                 return a->rule_index < b->rule_index;
@@ -919,7 +954,7 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
     }
 
     // FIXME: Follow https://drafts.csswg.org/web-animations-1/#ref-for-computed-keyframes in whatever the right place is.
-    auto compute_keyframe_values = [&computed_properties, &abstract_element, this](auto const& keyframe_values) {
+    auto compute_keyframe_values = [&computed_properties, &abstract_element, this](auto const& keyframe_values, bool& values_are_reusable) {
         HashMap<PropertyID, RefPtr<StyleValue const>> result;
         HashMap<PropertyID, PropertyID> longhands_set_by_property_id;
         auto property_is_set_by_use_initial = MUST(Bitmap::create(number_of_longhand_properties, false));
@@ -993,8 +1028,12 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             if (style_value->is_pending_substitution())
                 continue;
 
-            if (style_value->is_unresolved())
+            if (style_value->is_unresolved()) {
+                // NOTE: The substituted value may reference a custom property that changes without the target's
+                //       style being recomputed, e.g. an animated registered property on an ancestor.
+                values_are_reusable = false;
                 style_value = Parser::Parser::resolve_unresolved_style_value(Parser::ParsingParams { abstract_element.document() }, abstract_element, PropertyNameAndID::from_id(property_id), style_value->as_unresolved());
+            }
 
             for_each_property_expanding_shorthands(property_id, *style_value, [&](PropertyID longhand_id, StyleValue const& longhand_value) {
                 auto physical_longhand_id = map_logical_alias_to_physical_property(longhand_id, LogicalAliasMappingContext { computed_properties.writing_mode(), computed_properties.direction() });
@@ -1010,6 +1049,9 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
 
                 auto const& specified_value_with_css_wide_keywords_applied = [&]() -> StyleValue const& {
                     if (longhand_value.is_inherit() || (longhand_value.is_unset() && is_inherited_property(longhand_id))) {
+                        // NOTE: The inherited value may come from an animated ancestor, so it can change
+                        //       from one tick to the next.
+                        values_are_reusable = false;
                         if (auto inherited_animated_value = get_animated_inherit_value(longhand_id, abstract_element); inherited_animated_value.has_value())
                             return inherited_animated_value.value();
 
@@ -1019,8 +1061,11 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
                     if (longhand_value.is_initial() || longhand_value.is_unset())
                         return property_initial_value(longhand_id);
 
-                    if (longhand_value.is_revert() || longhand_value.is_revert_layer())
+                    if (longhand_value.is_revert() || longhand_value.is_revert_layer()) {
+                        // NOTE: The reverted-to value includes previously applied animated values.
+                        values_are_reusable = false;
                         return computed_properties.property(longhand_id);
+                    }
 
                     return longhand_value;
                 }();
@@ -1100,6 +1145,8 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
             if (auto keyframe_value = specified_values.get(property_id); keyframe_value.has_value() && keyframe_value.value())
                 return *keyframe_value.value();
 
+            // NOTE: This reads a value that other animations may be updating every tick.
+            values_are_reusable = false;
             return computed_properties.property(property_id);
         };
 
@@ -1115,8 +1162,37 @@ void StyleComputer::collect_animation_into(DOM::AbstractElement abstract_element
 
         return result;
     };
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_start_values = compute_keyframe_values(keyframe_values);
-    HashMap<PropertyID, RefPtr<StyleValue const>> computed_end_values = compute_keyframe_values(keyframe_end_values);
+    // OPTIMIZATION: Computing the keyframe endpoint values is the expensive part of ticking an animation, and
+    //               the result only changes when the animation moves on to a different pair of keyframes or the
+    //               target's underlying style changes, not on every tick. Reuse the values computed on the
+    //               previous tick whenever neither has happened, leaving only the interpolation below to do.
+    auto font_size = computed_properties.font_size();
+    auto line_height = computed_properties.line_height();
+    auto& cached_keyframe_values = effect->cached_computed_keyframe_values();
+    bool can_reuse_cached_keyframe_values = cached_keyframe_values.has_value()
+        && cached_keyframe_values->is_reusable
+        && cached_keyframe_values->start_key == keyframe_start
+        && cached_keyframe_values->end_key == keyframe_end
+        && cached_keyframe_values->target_style == &computed_properties
+        && cached_keyframe_values->font_size == font_size
+        && cached_keyframe_values->line_height == line_height;
+    if (!can_reuse_cached_keyframe_values) {
+        bool values_are_reusable = true;
+        auto start_values = compute_keyframe_values(keyframe_values, values_are_reusable);
+        auto end_values = compute_keyframe_values(keyframe_end_values, values_are_reusable);
+        cached_keyframe_values = Animations::KeyframeEffect::CachedComputedKeyframeValues {
+            .start_key = keyframe_start,
+            .end_key = keyframe_end,
+            .target_style = computed_properties,
+            .font_size = font_size,
+            .line_height = line_height,
+            .is_reusable = values_are_reusable,
+            .start_values = move(start_values),
+            .end_values = move(end_values),
+        };
+    }
+    auto const& computed_start_values = cached_keyframe_values->start_values;
+    auto const& computed_end_values = cached_keyframe_values->end_values;
     auto to_composite_operation = [&](Bindings::CompositeOperationOrAuto composite_operation_or_auto) {
         switch (composite_operation_or_auto) {
         case Bindings::CompositeOperationOrAuto::Accumulate:
@@ -1835,6 +1911,19 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
 
     // FIXME: Implement the full font-matching algorithm: https://www.w3.org/TR/css-fonts-4/#font-matching-algorithm
 
+    // OPTIMIZATION: Resolving a font-family list against the font database is expensive, and most
+    //               elements in a document share a handful of (family list, size, weight) tuples.
+    //               The cache is cleared whenever the set of available fonts changes.
+    FontCascadeListCacheKey cache_key {
+        .family_list_serialization = font_family.to_string(SerializationMode::Normal),
+        .font_size = font_size,
+        .weight = weight,
+        .slope = slope,
+        .width = width,
+    };
+    if (auto it = m_font_cascade_list_cache.find(cache_key); it != m_font_cascade_list_cache.end())
+        return it->value;
+
     float const font_size_in_pt = font_size * 0.75f;
 
     auto find_font = [&](FlyString const& family) -> RefPtr<Gfx::FontCascadeList const> {
@@ -1940,6 +2029,8 @@ RefPtr<Gfx::FontCascadeList const> StyleComputer::compute_font_for_style_values(
     // the requested code point, there is still a font available to provide a fallback glyph.
     font_list->set_last_resort_font(*default_font);
 
+    m_font_cascade_list_cache.set(move(cache_key), *font_list);
+
     return font_list;
 }
 
@@ -2318,6 +2409,7 @@ GC::Ref<ComputedProperties> StyleComputer::create_document_style() const
 
 GC::Ref<ComputedProperties> StyleComputer::compute_style(DOM::AbstractElement abstract_element, Optional<bool&> did_change_custom_properties) const
 {
+    TRACE_SCOPE("StyleComputer::compute_style");
     return *compute_style_impl(abstract_element, ComputeStyleMode::Normal, did_change_custom_properties);
 }
 
@@ -2360,7 +2452,11 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     PseudoClassBitmap attempted_pseudo_class_matches;
     auto matching_rule_set = build_matching_rule_set(abstract_element, attempted_pseudo_class_matches, did_match_any_pseudo_element_rules, mode);
 
-    auto old_custom_properties = abstract_element.custom_properties();
+    // OPTIMIZATION: Only take a copy of the old custom property table if the caller actually wants
+    //               to know whether it changed.
+    Optional<OrderedHashMap<FlyString, StyleProperty>> old_custom_properties;
+    if (did_change_custom_properties.has_value())
+        old_custom_properties = abstract_element.custom_properties();
 
     // Resolve all the CSS custom properties ("variables") for this element:
     if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
@@ -2371,6 +2467,17 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
         abstract_element.set_custom_properties(move(custom_properties));
     }
 
+    // OPTIMIZATION: If a recently-styled element matched exactly the same rules in the same
+    //               inherited context, reuse its style instead of redoing the whole cascade.
+    if (mode == ComputeStyleMode::Normal) {
+        if (auto shared_style = try_to_share_style(abstract_element, matching_rule_set)) {
+            shared_style->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
+            if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != *old_custom_properties)
+                *did_change_custom_properties = true;
+            return shared_style;
+        }
+    }
+
     auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
     auto cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
     abstract_element.set_cascaded_properties(cascaded_properties);
@@ -2407,13 +2514,148 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
     auto computed_properties = compute_properties(abstract_element, cascaded_properties);
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
-    if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties) {
+    if (mode == ComputeStyleMode::Normal && is_style_sharing_candidate(abstract_element))
+        update_style_sharing_candidate(abstract_element, matching_rule_set, cascaded_properties, computed_properties);
+
+    if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != *old_custom_properties) {
         *did_change_custom_properties = true;
     }
 
     return computed_properties;
 }
 
+bool StyleComputer::is_style_sharing_candidate(DOM::AbstractElement abstract_element) const
+{
+    // We only share style between actual elements, not pseudo-elements.
+    if (abstract_element.pseudo_element().has_value())
+        return false;
+
+    // The document element inherits from the document itself; don't bother sharing its style.
+    if (!abstract_element.parent_element())
+        return false;
+
+    auto const& element = abstract_element.element();
+
+    // Inline style contributes to the cascade without going through the rule caches.
+    if (element.inline_style())
+        return false;
+
+    // Custom properties declared on the element can be referenced by var() anywhere in its style.
+    if (!abstract_element.custom_properties().is_empty())
+        return false;
+
+    // Animations and transitions produce element-specific computed values.
+    if (element.may_have_animations_or_transitions())
+        return false;
+
+    return true;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::try_to_share_style(DOM::AbstractElement abstract_element, MatchingRuleSet const& matching_rule_set) const
+{
+    if (!m_style_sharing_candidate.has_value())
+        return {};
+
+    if (!is_style_sharing_candidate(abstract_element))
+        return {};
+
+    auto const& candidate = *m_style_sharing_candidate;
+    auto const& element = abstract_element.element();
+    auto const& candidate_element = candidate.abstract_element.element();
+
+    // The candidate may have gained animations or transitions since we recorded it.
+    if (candidate_element.may_have_animations_or_transitions())
+        return {};
+
+    // Same element type, so that element-specific computed-style adjustments agree.
+    if (element.local_name() != candidate_element.local_name() || element.namespace_uri() != candidate_element.namespace_uri())
+        return {};
+
+    // Same element to inherit style from, and its style must not have changed since we recorded
+    // the candidate, so that every inherited and parent-dependent value agrees.
+    auto element_to_inherit_style_from = abstract_element.element_to_inherit_style_from();
+    if (element_to_inherit_style_from != candidate.element_to_inherit_style_from)
+        return {};
+    if (element_to_inherit_style_from.has_value()) {
+        if (element_to_inherit_style_from->computed_properties() != candidate.inherited_style)
+            return {};
+        if (element_to_inherit_style_from->element().may_have_animations_or_transitions())
+            return {};
+    }
+
+    // Same attributes, so that presentational hints agree. `id` is excluded, since it can only
+    // affect style through selectors, and those are covered by the matched-rule comparison below.
+    auto attributes = element.attributes();
+    size_t candidate_attribute_index = 0;
+    bool attributes_match = true;
+    for (size_t i = 0; attributes && i < attributes->length(); ++i) {
+        auto const& attribute = *attributes->item(i);
+        if (!attribute.namespace_uri().has_value() && attribute.local_name() == HTML::AttributeNames::id)
+            continue;
+        if (candidate_attribute_index >= candidate.attributes.size()
+            || candidate.attributes[candidate_attribute_index].name != attribute.name()
+            || candidate.attributes[candidate_attribute_index].value != attribute.value()) {
+            attributes_match = false;
+            break;
+        }
+        ++candidate_attribute_index;
+    }
+    if (!attributes_match || candidate_attribute_index != candidate.attributes.size())
+        return {};
+
+    // And finally, the exact same rules must have matched.
+    if (matching_rule_set != candidate.matching_rule_set)
+        return {};
+
+    // Descendants look at our cascaded values when they recascade, so share those structurally as well.
+    abstract_element.set_cascaded_properties(candidate.cascaded_properties);
+    return candidate.computed_properties->clone();
+}
+
+void StyleComputer::update_style_sharing_candidate(DOM::AbstractElement abstract_element, MatchingRuleSet const& matching_rule_set, CascadedProperties& cascaded_properties, ComputedProperties& computed_properties) const
+{
+    // NOTE: This can be true even though is_style_sharing_candidate() said otherwise before the
+    //       cascade, since computing style is what attaches CSS animations and transitions.
+    if (abstract_element.element().may_have_animations_or_transitions())
+        return;
+
+    // sibling-index() and sibling-count() resolve differently for every element, even when the
+    // matched rules are identical. calc() can contain them, so conservatively reject it too.
+    bool has_element_dependent_value = false;
+    cascaded_properties.for_each_value([&](StyleValue const& value) {
+        if (value.is_tree_counting_function() || value.is_calculated())
+            has_element_dependent_value = true;
+    });
+    if (has_element_dependent_value)
+        return;
+
+    Vector<StyleSharingCandidate::Attribute> attributes;
+    if (auto attribute_map = abstract_element.element().attributes()) {
+        attributes.ensure_capacity(attribute_map->length());
+        for (size_t i = 0; i < attribute_map->length(); ++i) {
+            auto const& attribute = *attribute_map->item(i);
+            if (!attribute.namespace_uri().has_value() && attribute.local_name() == HTML::AttributeNames::id)
+                continue;
+            attributes.append({ attribute.name(), attribute.value() });
+        }
+    }
+
+    auto element_to_inherit_style_from = abstract_element.element_to_inherit_style_from();
+    GC::Ptr<ComputedProperties const> inherited_style;
+    if (element_to_inherit_style_from.has_value())
+        inherited_style = element_to_inherit_style_from->computed_properties();
+
+    m_style_sharing_candidate = StyleSharingCandidate {
+        .abstract_element = abstract_element,
+        .element_to_inherit_style_from = element_to_inherit_style_from,
+        .inherited_style = inherited_style,
+        .attributes = move(attributes),
+        .cascaded_properties = cascaded_properties,
+        .computed_properties = computed_properties,
+        .matching_rule_set = matching_rule_set,
+    };
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (value.to_keyword() == Keyword::Monospace)
@@ -2679,6 +2921,14 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
     Vector<MatchingRule> matching_rules;
     size_t style_sheet_index = 0;
     for_each_stylesheet(cascade_origin, [&](auto& sheet, GC::Ptr<DOM::ShadowRoot> shadow_root) {
+        // OPTIMIZATION: Scopes that share rule caches with an earlier scope don't build their own;
+        //               see build_rule_cache(). We still advance the style sheet index so cascade
+        //               order tie-breaking between the remaining sheets is unaffected.
+        if (shadow_root && rule_cache_scope_representative(shadow_root) != shadow_root) {
+            ++style_sheet_index;
+            return;
+        }
+
         auto& rule_caches = [&] -> RuleCaches& {
             RuleCachesForDocumentAndShadowRoots* rule_caches_for_document_or_shadow_root = nullptr;
             switch (cascade_origin) {
@@ -2891,6 +3141,40 @@ void StyleComputer::build_rule_cache()
 
     build_qualified_layer_names_cache();
 
+    // OPTIMIZATION: Shadow roots whose style sheet lists consist of the same CSSStyleSheet objects
+    //               (e.g. hundreds of instances of the same web component sharing adopted style
+    //               sheets) would all build identical rule caches. Instead, we let the first such
+    //               shadow root act as the representative for the whole group: only it builds rule
+    //               caches, and the other members map to it both when looking up caches and when
+    //               checking which scope a rule belongs to.
+    m_rule_cache_scope_representatives.clear();
+    {
+        struct ScopeSheetList {
+            GC::Ref<DOM::ShadowRoot const> shadow_root;
+            Vector<CSSStyleSheet const*> sheets;
+            u32 hash { 0 };
+        };
+        Vector<ScopeSheetList> scopes;
+        for_each_stylesheet(CascadeOrigin::Author, [&](auto& sheet, GC::Ptr<DOM::ShadowRoot> shadow_root) {
+            if (!shadow_root)
+                return;
+            if (scopes.is_empty() || scopes.last().shadow_root != shadow_root)
+                scopes.append({ *shadow_root, {}, 0 });
+            scopes.last().sheets.append(&sheet);
+            scopes.last().hash = pair_int_hash(scopes.last().hash, ptr_hash(&sheet));
+        });
+        for (size_t i = 0; i < scopes.size(); ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                // NOTE: The first matching scope is never itself mapped to an earlier one, since we
+                //       would have matched that earlier scope first.
+                if (scopes[j].hash == scopes[i].hash && scopes[j].sheets == scopes[i].sheets) {
+                    m_rule_cache_scope_representatives.set(scopes[i].shadow_root, scopes[j].shadow_root);
+                    break;
+                }
+            }
+        }
+    }
+
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Hover)] = make<RuleCache>();
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Active)] = make<RuleCache>();
     m_pseudo_class_rule_cache[to_underlying(PseudoClass::Focus)] = make<RuleCache>();
@@ -2919,10 +3203,15 @@ void StyleComputer::invalidate_rule_cache()
 
     m_pseudo_class_rule_cache = {};
     m_style_invalidation_data = nullptr;
+    m_rule_cache_scope_representatives.clear();
+
+    // NOTE: The style sharing candidate holds pointers into the rule caches, so it cannot outlive them.
+    m_style_sharing_candidate.clear();
 }
 
 void StyleComputer::did_load_font(FlyString const&)
 {
+    m_font_cascade_list_cache.clear();
     document().invalidate_style(DOM::StyleInvalidationReason::CSSFontLoaded);
 }
 
@@ -2964,6 +3253,7 @@ GC::Ptr<FontLoader> StyleComputer::load_font_face(ParsedFontFace const& font_fac
         loaders.append(loader);
         m_loaded_fonts.set(OwnFontFaceKey(key), move(loaders));
     }
+    m_font_cascade_list_cache.clear();
     // Actual object owned by font loader list inside m_loaded_fonts, this isn't use-after-move/free
     return loader_ref;
 }
@@ -2989,6 +3279,7 @@ void StyleComputer::unload_fonts_from_sheet(CSSStyleSheet& sheet)
             return sheet.has_associated_font_loader(*font_loader);
         });
     }
+    m_font_cascade_list_cache.clear();
 }
 
 NonnullRefPtr<StyleValue const> StyleComputer::compute_value_of_custom_property(DOM::AbstractElement abstract_element, FlyString const& name, Optional<Parser::GuardedSubstitutionContexts&> guarded_contexts)
@@ -3033,8 +3324,28 @@ void StyleComputer::compute_custom_properties(ComputedProperties&, DOM::Abstract
     // https://drafts.csswg.org/css-variables/#propdef-
     // The computed value of a custom property is its specified value with any arbitrary-substitution functions replaced.
     // FIXME: These should probably be part of ComputedProperties.
-    auto custom_properties = abstract_element.custom_properties();
-    decltype(custom_properties) resolved_custom_properties;
+    auto const& custom_properties = abstract_element.custom_properties();
+
+    // OPTIMIZATION: A custom property only computes to something other than its specified value if
+    //               it's a CSS-wide keyword or contains an arbitrary substitution function. If no
+    //               property on this element needs that treatment, the existing table is already
+    //               the computed one and we can skip rebuilding it.
+    auto needs_computation = [](StyleValue const& value) {
+        return value.is_css_wide_keyword()
+            || (value.is_unresolved() && value.as_unresolved().contains_arbitrary_substitution_function());
+    };
+    bool any_property_needs_computation = false;
+    for (auto const& [name, style_property] : custom_properties) {
+        if (needs_computation(*style_property.value)) {
+            any_property_needs_computation = true;
+            break;
+        }
+    }
+    if (!any_property_needs_computation)
+        return;
+
+    OrderedHashMap<FlyString, StyleProperty> resolved_custom_properties;
+    resolved_custom_properties.ensure_capacity(custom_properties.size());
 
     for (auto const& [name, style_property] : custom_properties) {
         resolved_custom_properties.set(name,
@@ -3811,48 +4122,5 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
     }
 }
 
-void RuleCache::for_each_matching_rules(DOM::AbstractElement abstract_element, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const
-{
-    for (auto const& class_name : abstract_element.element().class_names()) {
-        if (auto it = rules_by_class.find(class_name); it != rules_by_class.end()) {
-            if (callback(it->value) == IterationDecision::Break)
-                return;
-        }
-    }
-    if (auto id = abstract_element.element().id(); id.has_value()) {
-        if (auto it = rules_by_id.find(id.value()); it != rules_by_id.end()) {
-            if (callback(it->value) == IterationDecision::Break)
-                return;
-        }
-    }
-    if (auto it = rules_by_tag_name.find(abstract_element.element().lowercased_local_name()); it != rules_by_tag_name.end()) {
-        if (callback(it->value) == IterationDecision::Break)
-            return;
-    }
-    if (abstract_element.pseudo_element().has_value()) {
-        if (Selector::PseudoElementSelector::is_known_pseudo_element_type(abstract_element.pseudo_element().value())) {
-            if (callback(rules_by_pseudo_element.at(to_underlying(abstract_element.pseudo_element().value()))) == IterationDecision::Break)
-                return;
-        } else {
-            // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
-        }
-    }
-
-    if (abstract_element.element().is_document_element()) {
-        if (callback(root_rules) == IterationDecision::Break)
-            return;
-    }
-
-    IterationDecision decision = IterationDecision::Continue;
-    abstract_element.element().for_each_attribute([&](auto& name, auto&) {
-        if (auto it = rules_by_attribute_name.find(name); it != rules_by_attribute_name.end()) {
-            decision = callback(it->value);
-        }
-    });
-    if (decision == IterationDecision::Break)
-        return;
-
-    (void)callback(other_rules);
-}
 
 }
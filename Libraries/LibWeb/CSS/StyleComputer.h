@@ -20,6 +20,8 @@
 #include <LibWeb/CSS/CascadedProperties.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
+#include <LibWeb/DOM/AbstractElement.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Loader/ResourceLoader.h>
@@ -111,6 +113,19 @@ struct OwnFontFaceKey {
     int slope { 0 };
 };
 
+// Key for the computed font cascade list cache. Two elements whose font-family lists serialize
+// identically and that share size/weight/slope/width resolve to the same cascade list.
+struct FontCascadeListCacheKey {
+    String family_list_serialization;
+    CSSPixels font_size;
+    int weight { 0 };
+    int slope { 0 };
+    int width { 0 };
+
+    [[nodiscard]] u32 hash() const { return pair_int_hash(family_list_serialization.hash(), pair_int_hash(pair_int_hash(font_size.raw_value(), weight), pair_int_hash(slope, width))); }
+    [[nodiscard]] bool operator==(FontCascadeListCacheKey const& other) const = default;
+};
+
 struct RuleCache {
     HashMap<FlyString, Vector<MatchingRule>> rules_by_id;
     HashMap<FlyString, Vector<MatchingRule>> rules_by_class;
@@ -124,7 +139,12 @@ struct RuleCache {
     HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
     void add_rule(MatchingRule const&, Optional<PseudoElement>, bool contains_root_pseudo_class);
-    void for_each_matching_rules(DOM::AbstractElement, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const;
+
+    // NOTE: This is a template so the callback can be invoked directly, without going through
+    //       a Function on this extremely hot path. (We visit every bucket for every element
+    //       during a full-document restyle.)
+    template<typename Callback>
+    void for_each_matching_rules(DOM::AbstractElement, Callback callback) const;
 };
 
 class FontLoader;
@@ -157,10 +177,15 @@ public:
 
     [[nodiscard]] RuleCache const& get_pseudo_class_rule_cache(PseudoClass) const;
 
+    // Maps a shadow root to the shadow root whose rule caches it shares, if any (see build_rule_cache()).
+    // Rules built for a shared cache carry the representative's shadow root, so scope comparisons
+    // against MatchingRule::shadow_root have to go through this.
+    [[nodiscard]] GC::Ptr<DOM::ShadowRoot const> rule_cache_scope_representative(GC::Ptr<DOM::ShadowRoot const>) const;
+
     [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::AbstractElement, CascadeOrigin, PseudoClassBitmap& attempted_pseudo_class_matches, Optional<FlyString const> qualified_layer_name = {}) const;
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
-    bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&) const;
+    InvalidationSet has_subject_invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
 
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
     void invalidate_rule_cache();
@@ -225,14 +250,39 @@ private:
     struct LayerMatchingRules {
         FlyString qualified_layer_name;
         Vector<MatchingRule const*> rules;
+
+        bool operator==(LayerMatchingRules const&) const = default;
     };
 
     struct MatchingRuleSet {
         Vector<MatchingRule const*> user_agent_rules;
         Vector<MatchingRule const*> user_rules;
         Vector<LayerMatchingRules> author_rules;
+
+        bool operator==(MatchingRuleSet const&) const = default;
     };
 
+    // The most recently styled element whose style is simple enough to be reused by another
+    // element that matches exactly the same rules in the same inherited context.
+    struct StyleSharingCandidate {
+        struct Attribute {
+            FlyString name;
+            String value;
+        };
+
+        DOM::AbstractElement abstract_element;
+        Optional<DOM::AbstractElement> element_to_inherit_style_from;
+        GC::Ptr<ComputedProperties const> inherited_style;
+        Vector<Attribute> attributes;
+        GC::Ref<CascadedProperties> cascaded_properties;
+        GC::Ref<ComputedProperties> computed_properties;
+        MatchingRuleSet matching_rule_set;
+    };
+
+    [[nodiscard]] bool is_style_sharing_candidate(DOM::AbstractElement) const;
+    [[nodiscard]] GC::Ptr<ComputedProperties> try_to_share_style(DOM::AbstractElement, MatchingRuleSet const&) const;
+    void update_style_sharing_candidate(DOM::AbstractElement, MatchingRuleSet const&, CascadedProperties&, ComputedProperties&) const;
+
     [[nodiscard]] MatchingRuleSet build_matching_rule_set(DOM::AbstractElement, PseudoClassBitmap& attempted_pseudo_class_matches, bool& did_match_any_pseudo_element_rules, ComputeStyleMode) const;
 
     LogicalAliasMappingContext compute_logical_alias_mapping_context(DOM::AbstractElement, ComputeStyleMode, MatchingRuleSet const&) const;
@@ -298,17 +348,24 @@ private:
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_author_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_agent_rule_cache;
+    HashMap<GC::Ref<DOM::ShadowRoot const>, GC::Ref<DOM::ShadowRoot const>> m_rule_cache_scope_representatives;
     GC::Ptr<CSSStyleSheet> m_user_style_sheet;
 
     using FontLoaderList = Vector<GC::Ref<FontLoader>>;
     HashMap<OwnFontFaceKey, FontLoaderList> m_loaded_fonts;
 
+    // Cleared whenever the set of available fonts changes (a webfont finishes loading, or
+    // @font-face rules are added/removed).
+    mutable HashMap<FontCascadeListCacheKey, NonnullRefPtr<Gfx::FontCascadeList const>> m_font_cascade_list_cache;
+
     Length::FontMetrics m_default_font_metrics;
     Length::FontMetrics m_root_element_font_metrics;
 
     CSSPixelRect m_viewport_rect;
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
+
+    mutable Optional<StyleSharingCandidate> m_style_sharing_candidate;
 };
 
 class FontLoader final : public GC::Cell {
@@ -331,7 +388,7 @@ public:
 private:
     virtual void visit_edges(Visitor&) override;
 
-    ErrorOr<NonnullRefPtr<Gfx::Typeface const>> try_load_font(Fetch::Infrastructure::Response const&, ByteBuffer const&);
+    void font_decode_finished(RefPtr<Gfx::Typeface const>);
 
     void font_did_load_or_fail(RefPtr<Gfx::Typeface const>);
 
@@ -345,6 +402,51 @@ private:
     Function<void(RefPtr<Gfx::Typeface const>)> m_on_load;
 };
 
+template<typename Callback>
+void RuleCache::for_each_matching_rules(DOM::AbstractElement abstract_element, Callback callback) const
+{
+    for (auto const& class_name : abstract_element.element().class_names()) {
+        if (auto it = rules_by_class.find(class_name); it != rules_by_class.end()) {
+            if (callback(it->value) == IterationDecision::Break)
+                return;
+        }
+    }
+    if (auto id = abstract_element.element().id(); id.has_value()) {
+        if (auto it = rules_by_id.find(id.value()); it != rules_by_id.end()) {
+            if (callback(it->value) == IterationDecision::Break)
+                return;
+        }
+    }
+    if (auto it = rules_by_tag_name.find(abstract_element.element().lowercased_local_name()); it != rules_by_tag_name.end()) {
+        if (callback(it->value) == IterationDecision::Break)
+            return;
+    }
+    if (abstract_element.pseudo_element().has_value()) {
+        if (Selector::PseudoElementSelector::is_known_pseudo_element_type(abstract_element.pseudo_element().value())) {
+            if (callback(rules_by_pseudo_element.at(to_underlying(abstract_element.pseudo_element().value()))) == IterationDecision::Break)
+                return;
+        } else {
+            // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
+        }
+    }
+
+    if (abstract_element.element().is_document_element()) {
+        if (callback(root_rules) == IterationDecision::Break)
+            return;
+    }
+
+    IterationDecision decision = IterationDecision::Continue;
+    abstract_element.element().for_each_attribute([&](auto& name, auto&) {
+        if (auto it = rules_by_attribute_name.find(name); it != rules_by_attribute_name.end()) {
+            decision = callback(it->value);
+        }
+    });
+    if (decision == IterationDecision::Break)
+        return;
+
+    (void)callback(other_rules);
+}
+
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
 {
     for (u32 hash : selector.ancestor_hashes()) {
@@ -67,6 +67,15 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
         if (old_value_opacity != new_value_opacity && (old_value_opacity == 1 || new_value_opacity == 1)) {
             invalidation.rebuild_stacking_context_tree = true;
         }
+    } else if (AK::first_is_one_of(property_id, CSS::PropertyID::Transform, CSS::PropertyID::Translate, CSS::PropertyID::Rotate, CSS::PropertyID::Scale)) {
+        // OPTIMIZATION: These properties create a stacking context when their value is anything other
+        //               than `none`. A change between two non-none values (which is what every frame of
+        //               a transform animation produces) leaves the stacking context tree unchanged, so
+        //               only a repaint is needed.
+        bool old_value_is_none = !old_value || old_value->to_keyword() == CSS::Keyword::None;
+        bool new_value_is_none = !new_value || new_value->to_keyword() == CSS::Keyword::None;
+        if (old_value_is_none != new_value_is_none)
+            invalidation.rebuild_stacking_context_tree = true;
     } else if (CSS::property_affects_stacking_context(property_id)) {
         invalidation.rebuild_stacking_context_tree = true;
     }
@@ -41,27 +41,36 @@ static void for_each_consecutive_simple_selector_group(Selector const& selector,
     }
 }
 
-static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has)
+static void index_property_used_in_has(StyleInvalidationData& style_invalidation_data, InvalidationSet::Property property, InvalidationSet const& subject_features)
+{
+    auto& subject_invalidation_set = style_invalidation_data.has_subject_invalidation_sets.ensure(move(property), [] { return InvalidationSet {}; });
+    if (subject_features.has_properties())
+        subject_invalidation_set.include_all_from(subject_features);
+    else
+        subject_invalidation_set.set_needs_invalidate_whole_subtree();
+}
+
+static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has, InvalidationSet const& subject_features)
 {
     switch (selector.type) {
     case Selector::SimpleSelector::Type::Id: {
         if (in_has)
-            style_invalidation_data.ids_used_in_has_selectors.set(selector.name());
+            index_property_used_in_has(style_invalidation_data, { InvalidationSet::Property::Type::Id, selector.name() }, subject_features);
         break;
     }
     case Selector::SimpleSelector::Type::Class: {
         if (in_has)
-            style_invalidation_data.class_names_used_in_has_selectors.set(selector.name());
+            index_property_used_in_has(style_invalidation_data, { InvalidationSet::Property::Type::Class, selector.name() }, subject_features);
         break;
     }
     case Selector::SimpleSelector::Type::Attribute: {
         if (in_has)
-            style_invalidation_data.attribute_names_used_in_has_selectors.set(selector.attribute().qualified_name.name.lowercase_name);
+            index_property_used_in_has(style_invalidation_data, { InvalidationSet::Property::Type::Attribute, selector.attribute().qualified_name.name.lowercase_name }, subject_features);
         break;
     }
     case Selector::SimpleSelector::Type::TagName: {
         if (in_has)
-            style_invalidation_data.tag_names_used_in_has_selectors.set(selector.qualified_name().name.lowercase_name);
+            index_property_used_in_has(style_invalidation_data, { InvalidationSet::Property::Type::TagName, selector.qualified_name().name.lowercase_name }, subject_features);
         break;
     }
     case Selector::SimpleSelector::Type::PseudoClass: {
@@ -77,7 +86,7 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
         case PseudoClass::LocalLink:
         case PseudoClass::Default:
             if (in_has)
-                style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
+                index_property_used_in_has(style_invalidation_data, { InvalidationSet::Property::Type::PseudoClass, pseudo_class.type }, subject_features);
             break;
         default:
             break;
@@ -85,7 +94,7 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
         for (auto const& child_selector : pseudo_class.argument_selector_list) {
             for (auto const& compound_selector : child_selector->compound_selectors()) {
                 for (auto const& simple_selector : compound_selector.simple_selectors) {
-                    collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has || pseudo_class.type == PseudoClass::Has);
+                    collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has || pseudo_class.type == PseudoClass::Has, subject_features);
                 }
             }
         }
@@ -220,6 +229,29 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
     for_each_consecutive_simple_selector_group(selector, [&](Vector<Selector::SimpleSelector const&> const& simple_selectors, Selector::Combinator combinator, bool is_rightmost) {
         // Collect properties used in :has() so we can decide if only specific properties
         // trigger descendant invalidation or if the entire document must be invalidated.
+        // Each collected property is indexed together with the subject features of this compound:
+        // an element has to carry one of them to match the compound at all, so when the property
+        // changes, ancestors without any of them can be skipped entirely
+        // (see Document::invalidate_style_of_elements_affected_by_has()).
+        InvalidationSet subject_features;
+        for (auto const& simple_selector : simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Id:
+                subject_features.set_needs_invalidate_id(simple_selector.name());
+                break;
+            case Selector::SimpleSelector::Type::Class:
+                subject_features.set_needs_invalidate_class(simple_selector.name());
+                break;
+            case Selector::SimpleSelector::Type::TagName:
+                subject_features.set_needs_invalidate_tag_name(simple_selector.qualified_name().name.lowercase_name);
+                break;
+            case Selector::SimpleSelector::Type::Attribute:
+                subject_features.set_needs_invalidate_attribute(simple_selector.attribute().qualified_name.name.lowercase_name);
+                break;
+            default:
+                break;
+            }
+        }
         for (auto const& simple_selector : simple_selectors) {
             bool in_has = false;
             if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
@@ -227,7 +259,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
                 if (pseudo_class.type == PseudoClass::Has)
                     in_has = true;
             }
-            collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has);
+            collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has, subject_features);
         }
 
         if (is_rightmost) {
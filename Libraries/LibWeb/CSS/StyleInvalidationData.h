@@ -14,11 +14,14 @@ namespace Web::CSS {
 
 struct StyleInvalidationData {
     HashMap<InvalidationSet::Property, InvalidationSet> descendant_invalidation_sets;
-    HashTable<FlyString> ids_used_in_has_selectors;
-    HashTable<FlyString> class_names_used_in_has_selectors;
-    HashTable<FlyString> attribute_names_used_in_has_selectors;
-    HashTable<FlyString> tag_names_used_in_has_selectors;
-    HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
+
+    // Reverse index for :has() invalidation: maps each property that appears inside a :has() argument
+    // to the subject features (id, class names, tag name, attribute names) of the compound selectors
+    // whose :has() uses it. When such a property changes, only ancestors carrying one of the recorded
+    // subject features can change their match result, so everything else on the ancestor chain can be
+    // skipped. An entry marked "invalidate whole subtree" means some compound has no usable subject
+    // feature (e.g. ":has(.a)" on its own) and every ancestor has to be considered.
+    HashMap<InvalidationSet::Property, InvalidationSet> has_subject_invalidation_sets;
 
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
@@ -4,14 +4,31 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/AnonymousBuffer.h>
 #include <LibIPC/Decoder.h>
 #include <LibIPC/Encoder.h>
 #include <LibWeb/Clipboard/SystemClipboard.h>
 
+// Clipboard payloads above this size are transferred through shared memory rather than being
+// written into the IPC stream. Copying a large table produces multi-megabyte HTML and plain text
+// representations, which would otherwise be copied several more times on their way through the
+// transport socket.
+static constexpr size_t minimum_size_for_shared_memory_transfer = 64 * KiB;
+
 template<>
 ErrorOr<void> IPC::encode(Encoder& encoder, Web::Clipboard::SystemClipboardRepresentation const& output)
 {
-    TRY(encoder.encode(output.data));
+    bool use_shared_memory = output.data.length() >= minimum_size_for_shared_memory_transfer;
+    TRY(encoder.encode(use_shared_memory));
+
+    if (use_shared_memory) {
+        auto buffer = TRY(Core::AnonymousBuffer::create_with_size(output.data.length()));
+        memcpy(buffer.data<void>(), output.data.characters(), output.data.length());
+        TRY(encoder.encode(buffer));
+    } else {
+        TRY(encoder.encode(output.data));
+    }
+
     TRY(encoder.encode(output.mime_type));
     return {};
 }
@@ -19,7 +36,16 @@ ErrorOr<void> IPC::encode(Encoder& encoder, Web::Clipboard::SystemClipboardRepre
 template<>
 ErrorOr<Web::Clipboard::SystemClipboardRepresentation> IPC::decode(Decoder& decoder)
 {
-    auto data = TRY(decoder.decode<ByteString>());
+    auto used_shared_memory = TRY(decoder.decode<bool>());
+
+    ByteString data;
+    if (used_shared_memory) {
+        auto buffer = TRY(decoder.decode<Core::AnonymousBuffer>());
+        data = ByteString { StringView { buffer.data<u8 const>(), buffer.size() } };
+    } else {
+        data = TRY(decoder.decode<ByteString>());
+    }
+
     auto mime_type = TRY(decoder.decode<String>());
 
     return Web::Clipboard::SystemClipboardRepresentation { move(data), move(mime_type) };
@@ -256,12 +256,20 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     // 1. Let algorithm be the algorithm parameter passed to the digest() method.
 
     // 2. Let data be the result of getting a copy of the bytes held by the data parameter passed to the digest() method.
-    auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*data->raw_object());
-    if (data_buffer_or_error.is_error()) {
-        VERIFY(data_buffer_or_error.error().code() == ENOMEM);
-        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)));
+    // OPTIMIZATION: The copy only exists to snapshot the bytes before control returns to script, so
+    //               when nothing can run script before the digest operation below reads them, we
+    //               digest the bytes in place instead of duplicating potentially very large inputs.
+    //               Normalizing an object-valued algorithm can run script (getters on the object),
+    //               so only the common string-valued case skips the copy.
+    Optional<ByteBuffer> data_copy;
+    if (!algorithm.has<String>()) {
+        auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*data->raw_object());
+        if (data_buffer_or_error.is_error()) {
+            VERIFY(data_buffer_or_error.error().code() == ENOMEM);
+            return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)));
+        }
+        data_copy = data_buffer_or_error.release_value();
     }
-    auto data_buffer = data_buffer_or_error.release_value();
 
     // 3. Let normalizedAlgorithm be the result of normalizing an algorithm, with alg set to algorithm and op set to "digest".
     auto normalized_algorithm = normalize_an_algorithm(realm, algorithm, "digest"_string);
@@ -274,15 +282,20 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     // 5. Let promise be a new Promise.
     auto promise = WebIDL::create_promise(realm);
 
+    // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+    // NOTE: The digest is computed before returning so that it can read the input without copying
+    //       it; only the promise settlement happens in the deferred steps. Since the digest ran on
+    //       this thread either way, this is not observably different from performing it "in
+    //       parallel".
+    auto algorithm_object = normalized_algorithm.release_value();
+    auto data_bytes = data_copy.has_value() ? data_copy->bytes() : WebIDL::get_buffer_source_view(*data->raw_object());
+    auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_bytes);
+
     // 6. Return promise and perform the remaining steps in parallel.
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, promise, result = move(result)]() mutable -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
-
-        // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
-        auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
-
         if (result.is_exception()) {
             WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
             return;
@@ -19,6 +19,7 @@
 #include <AK/Time.h>
 #include <AK/Utf8View.h>
 #include <LibCore/Timer.h>
+#include <LibCore/Tracing.h>
 #include <LibGC/RootVector.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/FunctionObject.h>
@@ -137,6 +138,7 @@
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Scripting/WindowEnvironmentSettingsObject.h>
+#include <LibWeb/HTML/SessionHistoryEntry.h>
 #include <LibWeb/HTML/SharedResourceRequest.h>
 #include <LibWeb/HTML/Storage.h>
 #include <LibWeb/HTML/StorageEvent.h>
@@ -460,6 +462,16 @@ GC::Ref<Document> Document::create_for_fragment_parsing(JS::Realm& realm)
     return realm.create<Document>(realm, URL::about_blank(), TemporaryDocumentForFragmentParsing::Yes);
 }
 
+GC::Ptr<Document> Document::take_cached_document_for_fragment_parsing(Badge<HTML::HTMLParser>)
+{
+    return exchange(m_cached_document_for_fragment_parsing, nullptr);
+}
+
+void Document::set_cached_document_for_fragment_parsing(Badge<HTML::HTMLParser>, Document& document)
+{
+    m_cached_document_for_fragment_parsing = document;
+}
+
 Document::Document(JS::Realm& realm, URL::URL const& url, TemporaryDocumentForFragmentParsing temporary_document_for_fragment_parsing)
     : ParentNode(realm, *this, NodeType::DOCUMENT_NODE)
     , m_page(Bindings::principal_host_defined_page(realm))
@@ -552,14 +564,17 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_inspected_node);
     visitor.visit(m_highlighted_node);
     visitor.visit(m_active_favicon);
+    visitor.visit(m_last_inserted_node);
     visitor.visit(m_browsing_context);
     visitor.visit(m_focused_area);
+    visitor.visit(m_accessibility_tree_cache_focused_area);
     visitor.visit(m_active_element);
     visitor.visit(m_target_element);
     visitor.visit(m_implementation);
     visitor.visit(m_current_script);
     visitor.visit(m_associated_inert_template_document);
     visitor.visit(m_appropriate_template_contents_owner_document);
+    visitor.visit(m_cached_document_for_fragment_parsing);
     visitor.visit(m_pending_parsing_blocking_script);
     visitor.visit(m_history);
     visitor.visit(m_style_computer);
@@ -1112,6 +1127,7 @@ void Document::tear_down_layout_tree()
 {
     m_layout_root = nullptr;
     m_paintable = nullptr;
+    m_previous_layout_state = nullptr;
     m_needs_full_layout_tree_update = true;
 }
 
@@ -1259,7 +1275,35 @@ Optional<URL::URL> Document::encoding_parse_url(StringView url) const
     auto base_url = this->base_url();
 
     // 5. Return the result of applying the URL parser to url, with baseURL and encoding.
-    return DOMURL::parse(url, base_url, encoding);
+    // OPTIMIZATION: Pages tend to resolve the same URL strings against the same base URL over and
+    //               over, so parse results are cached until the base URL or encoding changes.
+    //               Note that comparing against the previous base URL is cheap: both usually share
+    //               the same underlying data, since base_url() returns stored URLs.
+    if (m_encoding_parse_url_cache_base_url != base_url || m_encoding_parse_url_cache_encoding != encoding) {
+        m_encoding_parse_url_cache.clear();
+        m_encoding_parse_url_cache_base_url = base_url;
+        m_encoding_parse_url_cache_encoding = encoding;
+    }
+
+    auto cache_key = String::from_utf8(url);
+    if (cache_key.is_error())
+        return DOMURL::parse(url, base_url, encoding);
+
+    if (auto it = m_encoding_parse_url_cache.find(cache_key.value()); it != m_encoding_parse_url_cache.end())
+        return it->value;
+
+    auto result = DOMURL::parse(url, base_url, encoding);
+
+    // NOTE: Blob URL parse results are never cached, since they capture the blob URL registry
+    //       entry (and its data) at parse time.
+    if (result.has_value() && result->scheme() == "blob"sv)
+        return result;
+
+    static constexpr size_t max_cached_urls_per_document = 1024;
+    if (m_encoding_parse_url_cache.size() >= max_cached_urls_per_document)
+        m_encoding_parse_url_cache.clear();
+    m_encoding_parse_url_cache.set(cache_key.release_value(), result);
+    return result;
 }
 
 // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#encoding-parsing-and-serializing-a-url
@@ -1276,6 +1320,22 @@ Optional<String> Document::encoding_parse_and_serialize_url(StringView url) cons
     return parsed_url->serialize();
 }
 
+// Style sheets created from identical text are parsed separately, but they can at least share one
+// copy of the source text, which every sheet retains for serialization and the style inspector.
+// This matters for pages that stamp out the same web component many times, where each instance's
+// copy of a <style> sheet carries the same text.
+String Document::deduplicated_style_sheet_source_text(String source_text) const
+{
+    if (auto it = m_style_sheet_source_text_cache.find(source_text); it != m_style_sheet_source_text_cache.end())
+        return *it;
+
+    static constexpr size_t max_cached_style_sheet_source_texts = 64;
+    if (m_style_sheet_source_text_cache.size() >= max_cached_style_sheet_source_texts)
+        m_style_sheet_source_text_cache.clear();
+    m_style_sheet_source_text_cache.set(source_text);
+    return source_text;
+}
+
 void Document::invalidate_layout_tree(InvalidateLayoutTreeReason reason)
 {
     if (m_layout_root)
@@ -1338,6 +1398,8 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
 
 void Document::update_layout(UpdateLayoutReason reason)
 {
+    TRACE_SCOPE("Document::update_layout");
+
     auto navigable = this->navigable();
     if (!navigable || navigable->active_document() != this)
         return;
@@ -1356,6 +1418,16 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (m_created_for_appropriate_template_contents)
         return;
 
+    // Getting past the checks above means a layout is actually going to run. If it was forced by script
+    // (typically a geometry read like getBoundingClientRect() between DOM writes), log the JS stack that
+    // forced it, so layout thrash can be tracked down in the page rather than in the engine.
+    if constexpr (FORCED_LAYOUT_DEBUG) {
+        if (reason != UpdateLayoutReason::HTMLEventLoopRenderingUpdate && !vm().execution_context_stack().is_empty()) {
+            dbgln("Forced synchronous layout ({}) triggered by script:", to_string(reason));
+            vm().dump_backtrace();
+        }
+    }
+
     // Clear text blocks cache so we rebuild them on the next find action.
     if (m_layout_root)
         m_layout_root->invalidate_text_blocks_cache();
@@ -1369,6 +1441,9 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
         Layout::TreeBuilder tree_builder;
+        // NOTE: Previous layout results refer to the layout nodes we're about to replace,
+        //       so they cannot be reused (or kept alive) past this point.
+        m_previous_layout_state = nullptr;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
 
         if (document_element && document_element->layout_node()) {
@@ -1416,6 +1491,10 @@ void Document::update_layout(UpdateLayoutReason reason)
         return TraversalDecision::Continue;
     });
 
+    // Previous layout results were produced for the old viewport size, so they cannot be reused.
+    if (m_previous_layout_state && m_previous_layout_state_viewport_rect != viewport_rect)
+        m_previous_layout_state = nullptr;
+
     Layout::LayoutState layout_state;
 
     {
@@ -1439,11 +1518,17 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     layout_state.commit(*m_layout_root);
 
+    // Keep the layout results around, so that the next layout pass can reuse them for independent
+    // formatting context subtrees that don't get invalidated in the meantime.
+    m_previous_layout_state = make<Layout::LayoutState>(move(layout_state));
+    m_previous_layout_state_viewport_rect = viewport_rect;
+
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
 
     m_document->set_needs_display();
     set_needs_to_resolve_paint_only_properties();
+    page().invalidate_intersection_observations();
 
     paintable()->assign_scroll_frames();
 
@@ -1804,14 +1889,24 @@ void Document::invalidate_style_of_elements_affected_by_has()
     }
 
     auto nodes = move(m_pending_nodes_for_style_invalidation_due_to_presence_of_has);
-    for (auto const& node : nodes) {
+    for (auto const& [node, has_subject_filter] : nodes) {
         if (!node)
             continue;
+
+        // OPTIMIZATION: The filter holds the subject features of the :has() selectors that use the
+        //               changed properties; an element without any of them cannot change its match
+        //               result, so it doesn't need invalidation. A filter that needs whole subtree
+        //               invalidation matches every element.
+        auto may_be_affected = [&](Element const& element) {
+            return element.includes_properties_from_invalidation_set(has_subject_filter);
+        };
+
         for (auto ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
             if (!ancestor->is_element())
                 continue;
             auto& element = static_cast<Element&>(*ancestor);
-            element.invalidate_style_if_affected_by_has();
+            if (may_be_affected(element))
+                element.invalidate_style_if_affected_by_has();
 
             auto* parent = ancestor->parent_or_shadow_host();
             if (!parent)
@@ -1820,7 +1915,7 @@ void Document::invalidate_style_of_elements_affected_by_has()
             // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
             // its style might be affected by the change in descendant node.
             parent->for_each_child_of_type<Element>([&](auto& ancestor_sibling_element) {
-                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+                if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator() && may_be_affected(ancestor_sibling_element))
                     ancestor_sibling_element.invalidate_style_if_affected_by_has();
                 return IterationDecision::Continue;
             });
@@ -1836,11 +1931,12 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
     auto shadow_root = is<ShadowRoot>(root) ? static_cast<ShadowRoot const*>(&root) : nullptr;
 
     auto& style_computer = this->style_computer();
+    auto scope_representative = style_computer.rule_cache_scope_representative(shadow_root);
     auto does_rule_match_on_element = [&](Element const& element, CSS::MatchingRule const& rule) {
         auto rule_root = rule.shadow_root;
         auto from_user_agent_or_user_stylesheet = rule.cascade_origin == CSS::CascadeOrigin::UserAgent || rule.cascade_origin == CSS::CascadeOrigin::User;
-        bool rule_is_relevant_for_current_scope = rule_root == shadow_root
-            || (element.is_shadow_host() && rule_root == element.shadow_root())
+        bool rule_is_relevant_for_current_scope = rule_root == scope_representative
+            || (element.is_shadow_host() && rule_root == style_computer.rule_cache_scope_representative(element.shadow_root()))
             || from_user_agent_or_user_stylesheet;
         if (!rule_is_relevant_for_current_scope)
             return false;
@@ -3436,16 +3532,16 @@ void Document::run_the_scroll_steps()
 
 void Document::add_media_query_list(GC::Ref<CSS::MediaQueryList> media_query_list)
 {
-    m_needs_media_query_evaluation = true;
+    set_needs_media_query_evaluation();
     m_media_query_lists.append(media_query_list);
 }
 
 // https://drafts.csswg.org/cssom-view/#evaluate-media-queries-and-report-changes
 void Document::evaluate_media_queries_and_report_changes()
 {
-    if (!m_needs_media_query_evaluation)
+    if (!m_needs_media_query_evaluation.has_value())
         return;
-    m_needs_media_query_evaluation = false;
+    auto scope = m_needs_media_query_evaluation.release_value();
 
     // NOTE: Not in the spec, but we take this opportunity to prune null WeakPtrs.
     m_media_query_lists.remove_all_matching([](auto& it) {
@@ -3464,7 +3560,7 @@ void Document::evaluate_media_queries_and_report_changes()
             continue;
         GC::Ptr<CSS::MediaQueryList> media_query_list = media_query_list_ptr.ptr();
         bool did_match = media_query_list->matches();
-        bool now_matches = media_query_list->evaluate();
+        bool now_matches = media_query_list->evaluate(scope);
 
         auto did_change_internally = media_query_list->has_changed_state();
         media_query_list->set_has_changed_state(false);
@@ -3480,14 +3576,14 @@ void Document::evaluate_media_queries_and_report_changes()
     }
 
     // Also not in the spec, but this is as good a place as any to evaluate @media rules!
-    evaluate_media_rules();
+    evaluate_media_rules(scope);
 }
 
-void Document::evaluate_media_rules()
+void Document::evaluate_media_rules(CSS::MediaQueryEvaluationScope scope)
 {
     bool any_media_queries_changed_match_state = false;
     for_each_active_css_style_sheet([&](CSS::CSSStyleSheet& style_sheet, auto) {
-        if (style_sheet.evaluate_media_queries(*this))
+        if (style_sheet.evaluate_media_queries(*this, scope))
             any_media_queries_changed_match_state = true;
     });
 
@@ -4327,8 +4423,63 @@ void Document::set_browsing_context(GC::Ptr<HTML::BrowsingContext> browsing_cont
     m_browsing_context = browsing_context;
 }
 
+// Decides whether a document that is about to be unloaded should be stored in its traversable's
+// back/forward cache instead of being destroyed, so that history traversal can reactivate it
+// without a reload.
+bool Document::is_eligible_for_back_forward_cache(GC::Ptr<Document> new_document) const
+{
+    // Only documents replaced by another document can be traversed back to; if the navigable itself
+    // is going away there is nothing to restore the document into.
+    if (!new_document)
+        return false;
+
+    // FIXME: Also cache subframe documents that navigate independently of their traversable.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_traversable())
+        return false;
+
+    // A document whose session history entry has already been replaced (for example the initial
+    // about:blank) can never be traversed back to, so caching it would only waste memory.
+    auto referenced_by_a_session_history_entry = false;
+    for (auto& entry : as<HTML::TraversableNavigable>(*navigable).session_history_entries()) {
+        if (entry->document().ptr() == this) {
+            referenced_by_a_session_history_entry = true;
+            break;
+        }
+    }
+    if (!referenced_by_a_session_history_entry)
+        return false;
+
+    auto is_cacheable = [](Document const& document) {
+        if (!document.m_salvageable)
+            return false;
+
+        // Pages with unload or beforeunload listeners expect the legacy teardown order; caching them
+        // would mean never firing those events. This matches the policy of other engines.
+        auto& window = as<HTML::Window>(HTML::relevant_global_object(document));
+        if (window.has_event_listener(HTML::EventNames::unload) || window.has_event_listener(HTML::EventNames::beforeunload))
+            return false;
+        if (document.has_event_listener(HTML::EventNames::unload) || document.has_event_listener(HTML::EventNames::beforeunload))
+            return false;
+
+        // An open WebSocket would keep receiving messages for a page that cannot react to them.
+        if (window.has_registered_web_sockets())
+            return false;
+
+        return true;
+    };
+
+    if (!is_cacheable(*this))
+        return false;
+    for (auto& descendant_navigable : descendant_navigables()) {
+        if (!is_cacheable(*descendant_navigable->active_document()))
+            return false;
+    }
+    return true;
+}
+
 // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
-void Document::unload(GC::Ptr<Document>)
+void Document::unload(GC::Ptr<Document>, bool intend_to_store_in_back_forward_cache)
 {
     // FIXME: 1. Assert: this is running as part of a task queued on oldDocument's event loop.
 
@@ -4340,7 +4491,8 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    // NOTE: Our caller decides this for the whole document tree; see unload_a_document_and_its_descendants().
+    auto intend_to_store_in_bfcache = intend_to_store_in_back_forward_cache;
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4445,14 +4597,18 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
 
     IGNORE_USE_IN_ESCAPING_LAMBDA auto unloaded_documents_count = descendant_navigables.size() + 1;
 
-    HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, HTML::relevant_global_object(*this), GC::create_function(heap(), [&number_unloaded, this, new_document] {
-        unload(new_document);
+    // Not in the spec: decide up front whether this document tree will be stored in the back/forward
+    // cache; the unload steps below keep the documents salvageable and skip the unload event when it is.
+    bool intend_to_store_in_bfcache = is_eligible_for_back_forward_cache(new_document);
+
+    HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, HTML::relevant_global_object(*this), GC::create_function(heap(), [&number_unloaded, this, new_document, intend_to_store_in_bfcache] {
+        unload(new_document, intend_to_store_in_bfcache);
         ++number_unloaded;
     }));
 
     for (auto& descendant_navigable : descendant_navigables) {
-        HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, *descendant_navigable->active_window(), GC::create_function(heap(), [&number_unloaded, descendant_navigable = descendant_navigable.ptr()] {
-            descendant_navigable->active_document()->unload();
+        HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, *descendant_navigable->active_window(), GC::create_function(heap(), [&number_unloaded, descendant_navigable = descendant_navigable.ptr(), intend_to_store_in_bfcache] {
+            descendant_navigable->active_document()->unload({}, intend_to_store_in_bfcache);
             ++number_unloaded;
         }));
     }
@@ -4461,6 +4617,16 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // Not in the spec: store the document tree in the back/forward cache instead of destroying it.
+    // pagehide handlers may have made a document ineligible in the meantime (for example by opening
+    // a WebSocket), so eligibility is checked again after the unload steps have run.
+    if (intend_to_store_in_bfcache && is_eligible_for_back_forward_cache(new_document)) {
+        navigable->traversable_navigable()->store_in_back_forward_cache(*this);
+        if (after_all_unloads)
+            after_all_unloads->function()();
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
@@ -4543,6 +4709,17 @@ GC::Ref<DOM::Document> Document::appropriate_template_contents_owner_document()
 
 String Document::dump_accessibility_tree_as_json()
 {
+    // OPTIMIZATION: Building and serializing the accessibility tree is O(page), so reuse the last
+    //               serialization until something that feeds into the tree changes: a DOM tree or
+    //               attribute mutation, a character data change, or the focused area (a focused
+    //               element is always included in the tree).
+    if (m_cached_accessibility_tree_json.has_value()
+        && m_accessibility_tree_cache_dom_tree_version == dom_tree_version()
+        && m_accessibility_tree_cache_character_data_version == character_data_version()
+        && m_accessibility_tree_cache_focused_area == focused_area()) {
+        return *m_cached_accessibility_tree_json;
+    }
+
     StringBuilder builder;
     auto accessibility_tree = AccessibilityTreeNode::create(this, nullptr);
     build_accessibility_tree(*&accessibility_tree);
@@ -4557,7 +4734,12 @@ String Document::dump_accessibility_tree_as_json()
     }
 
     MUST(json.finish());
-    return MUST(builder.to_string());
+
+    m_cached_accessibility_tree_json = MUST(builder.to_string());
+    m_accessibility_tree_cache_dom_tree_version = dom_tree_version();
+    m_accessibility_tree_cache_character_data_version = character_data_version();
+    m_accessibility_tree_cache_focused_area = focused_area();
+    return *m_cached_accessibility_tree_json;
 }
 
 // https://dom.spec.whatwg.org/#dom-document-createattribute
@@ -4779,6 +4961,13 @@ static CSSPixelRect compute_intersection(GC::Ref<Element> target, IntersectionOb
 // https://www.w3.org/TR/intersection-observer/#run-the-update-intersection-observations-steps
 void Document::run_the_update_intersection_observations_steps(HighResolutionTime::DOMHighResTimeStamp time)
 {
+    // OPTIMIZATION: If nothing that could affect an intersection has happened since we last ran these
+    //               steps (no layout, no scroll, no newly observed target), every observation would come
+    //               out unchanged, so skip the work instead of recomputing all the rectangles each frame.
+    if (m_last_intersection_observation_epoch == page().intersection_observation_epoch())
+        return;
+    m_last_intersection_observation_epoch = page().intersection_observation_epoch();
+
     auto& realm = this->realm();
 
     // 1. Let observer list be a list of all IntersectionObservers whose root is in the DOM tree of document.
@@ -5268,10 +5457,35 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
         // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate();
     }
 }
 
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate()
+{
+    // FIXME: 1-3. Restore persisted state (form control values, scroll positions) from document's latest entry.
+    // FIXME: Update the navigation API entries for this reactivation.
+
+    // 4. Set document's page showing flag to true.
+    set_page_showing(true);
+
+    // 5. Update the visibility state of document to its node navigable's traversable navigable's system visibility state.
+    update_the_visibility_state(navigable()->traversable_navigable()->system_visibility_state());
+
+    // 6. Fire a page transition event named pageshow at document's relevant global object with true.
+    as<HTML::Window>(HTML::relevant_global_object(*this)).fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+
+    // Not in the spec: subframe documents are restored together with their top-level document, so
+    // reactivate them as well, and let the traversable know the document no longer needs to be
+    // retained by the back/forward cache.
+    for (auto& child_navigable : document_tree_child_navigables())
+        child_navigable->active_document()->reactivate();
+    if (auto navigable = this->navigable(); navigable && navigable->is_traversable())
+        navigable->traversable_navigable()->remove_from_back_forward_cache(*this);
+}
+
 HashMap<URL::URL, GC::Ptr<HTML::SharedResourceRequest>>& Document::shared_resource_requests()
 {
     return m_shared_resource_requests;
@@ -6241,6 +6455,8 @@ void Document::set_needs_to_refresh_scroll_state(bool b)
 {
     if (auto* paintable = this->paintable())
         paintable->set_needs_to_refresh_scroll_state(b);
+    if (b)
+        page().invalidate_intersection_observations();
 }
 
 Vector<GC::Root<Range>> Document::find_matching_text(String const& query, CaseSensitivity case_sensitivity)
@@ -6256,41 +6472,90 @@ Vector<GC::Root<Range>> Document::find_matching_text(String const& query, CaseSe
         return {};
 
     auto utf16_query = Utf16String::from_utf8(query);
+    auto query_length = utf16_query.length_in_code_units();
+
+    // OPTIMIZATION: When the new query merely extends the previous one (the user typed another
+    //               character into the find bar), every occurrence of it must start at one of the
+    //               previous query's occurrences, so we re-verify those offsets instead of
+    //               re-scanning all of the document's text.
+    bool can_refine_previous_occurrences = m_find_matching_text_cache.has_value()
+        && m_find_matching_text_cache->text_blocks_generation == layout_node()->text_blocks_generation()
+        && m_find_matching_text_cache->case_sensitivity == case_sensitivity
+        && m_find_matching_text_cache->match_offsets_per_block.size() == text_blocks.size()
+        && query.bytes_as_string_view().starts_with(m_find_matching_text_cache->query);
+
+    Vector<Vector<size_t>> occurrence_offsets_per_block;
+    occurrence_offsets_per_block.ensure_capacity(text_blocks.size());
 
     Vector<GC::Root<Range>> matches;
-    for (auto const& text_block : text_blocks) {
-        size_t offset = 0;
-        size_t i = 0;
+    for (size_t block_index = 0; block_index < text_blocks.size(); ++block_index) {
+        auto const& text_block = text_blocks[block_index];
         Utf16View text_view { text_block.text };
+
+        // Collect every occurrence of the query, including overlapping ones, so the offsets stay
+        // refinable by the next (longer) query.
+        Vector<size_t> occurrence_offsets;
+        if (can_refine_previous_occurrences) {
+            for (auto candidate_offset : m_find_matching_text_cache->match_offsets_per_block[block_index]) {
+                if (candidate_offset + query_length > text_view.length_in_code_units())
+                    continue;
+                auto candidate = text_view.substring_view(candidate_offset, query_length);
+                auto candidate_matches = case_sensitivity == CaseSensitivity::CaseInsensitive
+                    ? candidate.equals_ignoring_case(utf16_query)
+                    : candidate == utf16_query;
+                if (candidate_matches)
+                    occurrence_offsets.append(candidate_offset);
+            }
+        } else {
+            size_t offset = 0;
+            while (offset < text_view.length_in_code_units()) {
+                auto match_index = case_sensitivity == CaseSensitivity::CaseInsensitive
+                    ? text_view.find_code_unit_offset_ignoring_case(utf16_query, offset)
+                    : text_view.find_code_unit_offset(utf16_query, offset);
+                if (!match_index.has_value())
+                    break;
+                occurrence_offsets.append(match_index.value());
+                offset = match_index.value() + 1;
+            }
+        }
+
+        size_t i = 0;
         auto* match_start_position = text_block.positions.data();
-        while (true) {
-            auto match_index = case_sensitivity == CaseSensitivity::CaseInsensitive
-                ? text_view.find_code_unit_offset_ignoring_case(utf16_query, offset)
-                : text_view.find_code_unit_offset(utf16_query, offset);
-            if (!match_index.has_value())
-                break;
+        Optional<size_t> last_reported_offset;
+        for (auto match_index : occurrence_offsets) {
+            // Only report non-overlapping matches, like the scanning loop used to by resuming
+            // the search one code unit past the end of each match.
+            if (last_reported_offset.has_value() && match_index <= *last_reported_offset + query_length)
+                continue;
+            last_reported_offset = match_index;
 
-            for (; i < text_block.positions.size() - 1 && match_index.value() > text_block.positions[i + 1].start_offset; ++i)
+            for (; i < text_block.positions.size() - 1 && match_index > text_block.positions[i + 1].start_offset; ++i)
                 match_start_position = &text_block.positions[i + 1];
 
-            auto start_position = match_index.value() - match_start_position->start_offset;
+            auto start_position = match_index - match_start_position->start_offset;
             auto& start_dom_node = match_start_position->dom_node;
 
             auto* match_end_position = match_start_position;
-            for (; i < text_block.positions.size() - 1 && (match_index.value() + utf16_query.length_in_code_units() > text_block.positions[i + 1].start_offset); ++i)
+            for (; i < text_block.positions.size() - 1 && (match_index + query_length > text_block.positions[i + 1].start_offset); ++i)
                 match_end_position = &text_block.positions[i + 1];
 
             auto& end_dom_node = match_end_position->dom_node;
-            auto end_position = match_index.value() + utf16_query.length_in_code_units() - match_end_position->start_offset;
+            auto end_position = match_index + query_length - match_end_position->start_offset;
 
             matches.append(Range::create(start_dom_node, start_position, end_dom_node, end_position));
             match_start_position = match_end_position;
-            offset = match_index.value() + utf16_query.length_in_code_units() + 1;
-            if (offset >= text_view.length_in_code_units())
-                break;
         }
+
+        occurrence_offsets_per_block.unchecked_append(move(occurrence_offsets));
     }
 
+    m_find_matching_text_cache = FindMatchingTextCache {
+        .query = query,
+        .case_sensitivity = case_sensitivity,
+        .text_blocks_generation = layout_node()->text_blocks_generation(),
+        .match_offsets_per_block = move(occurrence_offsets_per_block),
+    };
+
     return matches;
 }
 
@@ -6466,11 +6731,16 @@ void Document::set_needs_display(InvalidateDisplayList should_invalidate_display
     set_needs_display(viewport_rect(), should_invalidate_display_list);
 }
 
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
+void Document::set_needs_display(CSSPixelRect const& rect, InvalidateDisplayList should_invalidate_display_list)
 {
     // FIXME: Ignore updates outside the visible viewport rect.
     //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
 
+    // OPTIMIZATION: An empty rect can't change any pixels, so don't throw away the cached
+    //               display list or schedule a repaint for it.
+    if (rect.is_empty())
+        return;
+
     // OPTIMIZATION: Ignore set_needs_display() inside navigable containers (i.e frames) with visibility: hidden.
     if (auto navigable = this->navigable()) {
         if (navigable->has_inclusive_ancestor_with_visibility_hidden())
@@ -6879,6 +7149,24 @@ NonnullRefPtr<CSS::StyleValue const> Document::custom_property_initial_value(Fly
     return CSS::GuaranteedInvalidStyleValue::create();
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_with_cache(StringView selector_text)
+{
+    // OPTIMIZATION: Scripts tend to call querySelector(All) with the same handful of selector strings
+    //               over and over, so we keep the parsed selector lists around keyed by source text
+    //               instead of re-running the CSS parser on every call.
+    if (auto cached_selector_list = m_parsed_selector_cache.get(selector_text); cached_selector_list.has_value())
+        return cached_selector_list.release_value();
+
+    auto selector_list = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    if (selector_list.has_value()) {
+        // NOTE: Pages that generate selector strings could otherwise grow the cache without bound.
+        if (m_parsed_selector_cache.size() >= 256)
+            m_parsed_selector_cache.clear();
+        m_parsed_selector_cache.set(MUST(String::from_utf8(selector_text)), selector_list.value());
+    }
+    return selector_list;
+}
+
 GC::Ptr<Element> ElementByIdMap::get(FlyString const& element_id) const
 {
     if (auto elements = m_map.get(element_id); elements.has_value() && !elements->is_empty()) {
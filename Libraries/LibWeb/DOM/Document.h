@@ -24,6 +24,7 @@
 #include <LibWeb/CSS/CSSPropertyRule.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
 #include <LibWeb/CSS/EnvironmentVariable.h>
+#include <LibWeb/CSS/InvalidationSet.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -116,6 +117,7 @@ enum class InvalidateLayoutTreeReason {
     X(InternalsHitTest)                    \
     X(MediaQueryListMatches)               \
     X(NodeNameOrDescription)               \
+    X(PageExtractTextRuns)                 \
     X(RangeGetClientRects)                 \
     X(ResolvedCSSStyleDeclarationProperty) \
     X(SVGDecodedImageDataRender)           \
@@ -197,6 +199,32 @@ public:
     u64 dom_tree_version() const { return m_dom_tree_version; }
     void bump_dom_tree_version() { ++m_dom_tree_version; }
 
+    // AD-HOC: Finer-grained companions to dom_tree_version(), for caches that only depend on part of the DOM:
+    //         the tree structure version only increments when a node is added or removed, and attribute versions
+    //         only increment when an attribute with that local name changes somewhere in the document.
+    //         Bumping any of them also bumps dom_tree_version().
+    u64 tree_structure_version() const { return m_tree_structure_version; }
+    void bump_tree_structure_version(Node* inserted_node = nullptr)
+    {
+        ++m_tree_structure_version;
+        ++m_dom_tree_version;
+        m_last_inserted_node = inserted_node;
+    }
+
+    u64 any_attribute_version() const { return m_any_attribute_version; }
+    u64 attribute_version(FlyString const& local_name) const { return m_attribute_versions.get(local_name).value_or(0); }
+    void bump_attribute_version(FlyString const& local_name)
+    {
+        ++m_attribute_versions.ensure(local_name);
+        ++m_any_attribute_version;
+        ++m_dom_tree_version;
+    }
+
+    // The node inserted by the most recent tree structure mutation, if that mutation was a single-node
+    // insertion. Lets live collections extend their caches instead of rebuilding them from scratch
+    // during append-heavy DOM construction.
+    GC::Ptr<Node> last_inserted_node() const { return m_last_inserted_node; }
+
     // AD-HOC: This number increments whenever CharacterData is modified in the document. It is used together with
     //         dom_tree_version() to understand whether either the DOM tree structure or contents were changed.
     u64 character_data_version() const { return m_character_data_version; }
@@ -251,6 +279,8 @@ public:
     Optional<URL::URL> encoding_parse_url(StringView) const;
     Optional<String> encoding_parse_and_serialize_url(StringView) const;
 
+    [[nodiscard]] String deduplicated_style_sheet_source_text(String) const;
+
     CSS::StyleComputer& style_computer() { return *m_style_computer; }
     CSS::StyleComputer const& style_computer() const { return *m_style_computer; }
 
@@ -352,6 +382,10 @@ public:
     void invalidate_layout_tree(InvalidateLayoutTreeReason);
     void invalidate_stacking_context_tree();
 
+    // Layout results from the previous layout pass, kept around so that independent formatting
+    // context subtrees that haven't been invalidated can reuse them instead of laying out again.
+    [[nodiscard]] Layout::LayoutState const* previous_layout_state() const { return m_previous_layout_state.ptr(); }
+
     virtual bool is_child_allowed(Node const&) const override;
 
     Layout::Viewport const* layout_node() const;
@@ -549,7 +583,13 @@ public:
     void run_the_scroll_steps();
 
     void evaluate_media_queries_and_report_changes();
-    void set_needs_media_query_evaluation() { m_needs_media_query_evaluation = true; }
+    void set_needs_media_query_evaluation(CSS::MediaQueryEvaluationScope scope = CSS::MediaQueryEvaluationScope::All)
+    {
+        // NOTE: A pending full evaluation must not be narrowed by a later viewport-only request.
+        if (m_needs_media_query_evaluation == CSS::MediaQueryEvaluationScope::All)
+            return;
+        m_needs_media_query_evaluation = scope;
+    }
     void add_media_query_list(GC::Ref<CSS::MediaQueryList>);
 
     GC::Ref<CSS::VisualViewport> visual_viewport();
@@ -574,6 +614,9 @@ public:
 
     [[nodiscard]] bool is_temporary_document_for_fragment_parsing() const { return m_temporary_document_for_fragment_parsing == TemporaryDocumentForFragmentParsing::Yes; }
 
+    [[nodiscard]] GC::Ptr<Document> take_cached_document_for_fragment_parsing(Badge<HTML::HTMLParser>);
+    void set_cached_document_for_fragment_parsing(Badge<HTML::HTMLParser>, Document&);
+
     static bool is_valid_name(String const&);
 
     GC::Ref<NodeIterator> create_node_iterator(Node& root, unsigned what_to_show, GC::Ptr<NodeFilter>);
@@ -658,10 +701,14 @@ public:
     void abort_a_document_and_its_descendants();
 
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
-    void unload(GC::Ptr<Document> new_document = nullptr);
+    void unload(GC::Ptr<Document> new_document = nullptr, bool intend_to_store_in_back_forward_cache = false);
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(GC::Ptr<Document> new_document, GC::Ptr<GC::Function<void()>> after_all_unloads = {});
 
+    bool is_eligible_for_back_forward_cache(GC::Ptr<Document> new_document) const;
+    // https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+    void reactivate();
+
     // https://html.spec.whatwg.org/multipage/dom.html#active-parser
     GC::Ptr<HTML::HTMLParser> active_parser();
 
@@ -927,11 +974,22 @@ public:
 
     void schedule_ancestors_style_invalidation_due_to_presence_of_has(Node& node)
     {
-        m_pending_nodes_for_style_invalidation_due_to_presence_of_has.set(node);
+        CSS::InvalidationSet invalidate_all_ancestors;
+        invalidate_all_ancestors.set_needs_invalidate_whole_subtree();
+        schedule_ancestors_style_invalidation_due_to_presence_of_has(node, move(invalidate_all_ancestors));
+    }
+
+    // The filter carries the subject features of the :has() selectors that can be affected by the
+    // change; ancestors without any of them are skipped during invalidation.
+    void schedule_ancestors_style_invalidation_due_to_presence_of_has(Node& node, CSS::InvalidationSet has_subject_filter)
+    {
+        m_pending_nodes_for_style_invalidation_due_to_presence_of_has.ensure(node).include_all_from(has_subject_filter);
     }
 
     ElementByIdMap& element_by_id() const;
 
+    Optional<CSS::SelectorList> parse_selector_with_cache(StringView selector_text);
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -966,7 +1024,7 @@ private:
 
     void run_unloading_cleanup_steps();
 
-    void evaluate_media_rules();
+    void evaluate_media_rules(CSS::MediaQueryEvaluationScope = CSS::MediaQueryEvaluationScope::All);
 
     enum class AddLineFeed {
         Yes,
@@ -1007,9 +1065,24 @@ private:
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
 
+    // Parsed selector lists keyed by source text, used by parse_selector_with_cache().
+    HashMap<String, CSS::SelectorList> m_parsed_selector_cache;
+
+    // Parse results keyed by input string, used by encoding_parse_url(). The cache is only
+    // valid for the base URL and encoding it was populated with; see encoding_parse_url().
+    mutable HashMap<String, Optional<URL::URL>> m_encoding_parse_url_cache;
+    mutable Optional<URL::URL> m_encoding_parse_url_cache_base_url;
+    mutable Optional<String> m_encoding_parse_url_cache_encoding;
+
+    // Source texts of style sheets parsed for this document, used to share one buffer between
+    // sheets created from identical text; see deduplicated_style_sheet_source_text().
+    mutable HashTable<String> m_style_sheet_source_text_cache;
+
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
+    OwnPtr<Layout::LayoutState> m_previous_layout_state;
+    CSSPixelRect m_previous_layout_state_viewport_rect;
 
     GC::Ptr<Node> m_hovered_node;
     GC::Ptr<Node> m_inspected_node;
@@ -1119,7 +1192,7 @@ private:
     Vector<GC::Ref<EventTarget>> m_pending_scrollend_event_targets;
 
     // Used by evaluate_media_queries_and_report_changes().
-    bool m_needs_media_query_evaluation { false };
+    Optional<CSS::MediaQueryEvaluationScope> m_needs_media_query_evaluation;
     Vector<GC::Weak<CSS::MediaQueryList>> m_media_query_lists;
 
     bool m_needs_full_style_update { false };
@@ -1201,6 +1274,10 @@ private:
     // Each document has an IntersectionObserverTaskQueued flag which is initialized to false.
     bool m_intersection_observer_task_queued { false };
 
+    // The page's intersection observation epoch the last time we ran the update intersection
+    // observations steps. Lets us skip those steps entirely when nothing has moved since.
+    u64 m_last_intersection_observation_epoch { 0 };
+
     // https://html.spec.whatwg.org/multipage/urls-and-fetching.html#lazy-load-intersection-observer
     // Each Document has a lazy load intersection observer, initially set to null but can be set to an IntersectionObserver instance.
     GC::Ptr<IntersectionObserver::IntersectionObserver> m_lazy_load_intersection_observer;
@@ -1215,6 +1292,10 @@ private:
 
     TemporaryDocumentForFragmentParsing m_temporary_document_for_fragment_parsing { TemporaryDocumentForFragmentParsing::No };
 
+    // The temporary document most recently used to parse an HTML fragment for this document, kept
+    // around so that the next fragment parse doesn't have to create a new one.
+    GC::Ptr<Document> m_cached_document_for_fragment_parsing;
+
     // https://html.spec.whatwg.org/multipage/browsing-the-web.html#latest-entry
     GC::Ptr<HTML::SessionHistoryEntry> m_latest_entry;
 
@@ -1256,6 +1337,10 @@ private:
 
     u64 m_dom_tree_version { 0 };
     u64 m_character_data_version { 0 };
+    u64 m_tree_structure_version { 0 };
+    u64 m_any_attribute_version { 0 };
+    HashMap<FlyString, u64> m_attribute_versions;
+    GC::Ptr<Node> m_last_inserted_node;
 
     // https://drafts.csswg.org/css-position-4/#document-top-layer
     // Documents have a top layer, an ordered set containing elements from the document.
@@ -1336,12 +1421,30 @@ private:
     // https://drafts.csswg.org/css-view-transitions-1/#document-update-callback-queue
     Vector<GC::Ptr<ViewTransition::ViewTransition>> m_update_callback_queue = {};
 
-    HashTable<GC::Weak<Node>> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
+    HashMap<GC::Weak<Node>, CSS::InvalidationSet> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
 
     GC::Ref<StyleInvalidator> m_style_invalidator;
 
     // https://www.w3.org/TR/css-properties-values-api-1/#dom-window-registeredpropertyset-slot
     HashMap<FlyString, GC::Ref<Web::CSS::CSSPropertyRule>> m_registered_custom_properties;
+
+    // OPTIMIZATION: The serialized accessibility tree from the last time it was requested, valid
+    //               as long as nothing that feeds into the tree has changed since.
+    Optional<String> m_cached_accessibility_tree_json;
+    u64 m_accessibility_tree_cache_dom_tree_version { 0 };
+    u64 m_accessibility_tree_cache_character_data_version { 0 };
+    GC::Ptr<Node> m_accessibility_tree_cache_focused_area;
+
+    // OPTIMIZATION: Match offsets from the last find-in-page query, used to refine the results
+    //               when the next query merely extends the current one (the user typed another
+    //               character) instead of re-scanning all of the document's text.
+    struct FindMatchingTextCache {
+        String query;
+        CaseSensitivity case_sensitivity { CaseSensitivity::CaseInsensitive };
+        u64 text_blocks_generation { 0 };
+        Vector<Vector<size_t>> match_offsets_per_block;
+    };
+    Optional<FindMatchingTextCache> m_find_matching_text_cache;
 };
 
 template<>
@@ -98,6 +98,8 @@
 
 namespace Web::DOM {
 
+GC_DEFINE_ALLOCATOR(Element);
+
 Element::Element(Document& document, DOM::QualifiedName qualified_name)
     : ParentNode(document, NodeType::ELEMENT_NODE)
     , m_qualified_name(move(qualified_name))
@@ -689,7 +691,7 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
 
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
-        document().bump_dom_tree_version();
+        document().bump_attribute_version(local_name);
     }
 }
 
@@ -3290,11 +3292,9 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
     }
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
-        for (auto* element = this; element; element = element->parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
+    if (options->content_visibility_auto) {
+        for (auto* element = parent_element(); element; element = element->parent_element()) {
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
                 return false;
         }
     }
@@ -3306,6 +3306,8 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
 void Element::determine_proximity_to_the_viewport()
 {
+    auto const was_close_to_the_viewport = m_proximity_to_the_viewport == ProximityToTheViewport::CloseToTheViewport;
+
     // An element that has content-visibility: auto is in one of three states when it comes to its proximity to the viewport:
 
     // - The element is close to the viewport: In this state, the element is considered "on-screen": its paint
@@ -3316,21 +3318,28 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box() && paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
-
-    // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
-    //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
-    //        within the viewport (or within the user-agent defined margin around the viewport), even if the element itself is
-    //        still off-screen.
-
-    // - The element is far away from the viewport: In this state, the element’s proximity to the viewport has been
-    //   computed and is not close to the viewport.
-    m_proximity_to_the_viewport = ProximityToTheViewport::FarAwayFromTheViewport;
+    } else {
+        // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
+        //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
+        //        within the viewport (or within the user-agent defined margin around the viewport), even if the element itself is
+        //        still off-screen.
+
+        // - The element is far away from the viewport: In this state, the element’s proximity to the viewport has been
+        //   computed and is not close to the viewport.
+        m_proximity_to_the_viewport = ProximityToTheViewport::FarAwayFromTheViewport;
+    }
 
     // - The element’s proximity to the viewport is not determined: In this state, the computation to determine the
     //   element’s proximity to the viewport has not been done since the last time the element was connected.
     // NOTE: This function is what does the computation to determine the element’s proximity to the viewport, so this is not the case.
+
+    // NOTE: Whether an element with content-visibility: auto skips its contents depends on whether it's close to
+    //       the viewport, so crossing that boundary means its subtree has to be built or torn down again.
+    auto const is_close_to_the_viewport = m_proximity_to_the_viewport == ProximityToTheViewport::CloseToTheViewport;
+    if (was_close_to_the_viewport != is_close_to_the_viewport)
+        set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::ContentVisibilityAutoProximityChange);
 }
 
 // https://drafts.csswg.org/css-contain/#relevant-to-the-user
@@ -17,6 +17,15 @@ public:
     void remove(FlyString const& element_id, Element&);
     GC::Ptr<Element> get(FlyString const& element_id) const;
 
+    // NOTE: Entries are kept in tree order, but may contain stale weak pointers.
+    Vector<GC::Weak<Element>> const* elements_with_id(FlyString const& element_id) const
+    {
+        auto it = m_map.find(element_id);
+        if (it == m_map.end())
+            return nullptr;
+        return &it->value;
+    }
+
 private:
     HashMap<FlyString, Vector<GC::Weak<Element>>> m_map;
 };
@@ -113,7 +113,8 @@ public:
     void append_to_path(EventTarget&, GC::Ptr<EventTarget>, GC::Ptr<EventTarget>, TouchTargetList&, bool);
     Path& path() { return m_path; }
     Path const& path() const { return m_path; }
-    void clear_path() { m_path.clear(); }
+    // NOTE: Keeps the path's capacity so that re-dispatching the same event doesn't reallocate it.
+    void clear_path() { m_path.clear_with_capacity(); }
 
     void set_touch_target_list(TouchTargetList& touch_target_list) { m_touch_target_list = touch_target_list; }
     TouchTargetList& touch_target_list() { return m_touch_target_list; }
@@ -183,6 +183,45 @@ void EventDispatcher::invoke(Event::PathEntry& struct_, Event& event, Event::Pha
     }
 }
 
+// OPTIMIZATION: Returns true if dispatching this event cannot run any listener, so the caller may skip
+//               building the event path entirely. This is the common case for high-frequency trusted
+//               events such as pointermove. We only claim this when the event cannot trigger activation
+//               behavior and no shadow trees or touch targets are involved, since those affect the
+//               event's state after dispatch.
+static bool no_listeners_on_propagation_path(GC::Ref<EventTarget> target, Event& event)
+{
+    // Activation behavior (and its legacy variants) must run even when there are no listeners.
+    if (is<UIEvents::MouseEvent>(event) && event.type() == HTML::EventNames::click)
+        return false;
+
+    // Trusted animation and transition events may fall back to their legacy webkit-prefixed names in
+    // invoke(), so a single per-target type check is not enough for them.
+    if (event.is_trusted()
+        && event.type().is_one_of(HTML::EventNames::animationend, HTML::EventNames::animationiteration, HTML::EventNames::animationstart, HTML::EventNames::transitionend))
+        return false;
+
+    // Touch targets participate in retargeting and the clear-targets determination.
+    if (!event.touch_target_list().is_empty())
+        return false;
+
+    if (auto related_target = event.related_target(); related_target && is<Node>(*related_target) && as<Node>(*related_target).root().is_shadow_root())
+        return false;
+
+    // NOTE: get_parent() walks the same chain as the path-building loop in dispatch(), so this visits
+    //       exactly the invocation targets that a full dispatch would.
+    for (auto* current = target.ptr(); current; current = current->get_parent(event)) {
+        if (current->has_event_listener(event.type()))
+            return false;
+
+        // If the path crosses a shadow tree, retargeting decides the event's final target; leave that
+        // to the full dispatch machinery.
+        if (is<Node>(*current) && as<Node>(*current).root().is_shadow_root())
+            return false;
+    }
+
+    return true;
+}
+
 // https://dom.spec.whatwg.org/#concept-event-dispatch
 bool EventDispatcher::dispatch(GC::Ref<EventTarget> target, Event& event, bool legacy_target_override)
 {
@@ -214,6 +253,20 @@ bool EventDispatcher::dispatch(GC::Ref<EventTarget> target, Event& event, bool l
     // 5. Let clearTargets be false.
     bool clear_targets = false;
 
+    // OPTIMIZATION: If no target on the propagation path has a listener for this event type, the whole
+    //               dispatch is unobservable, so skip building the event path (and its per-entry
+    //               retargeting and touch target lists) and return early.
+    if ((related_target != target || event.related_target() == target) && no_listeners_on_propagation_path(target, event)) {
+        // NOTE: Without shadow trees on the path, every invocation would have seen targetOverride as
+        //       the shadow-adjusted target, so this matches what a full dispatch leaves behind.
+        event.set_target(target_override.ptr());
+
+        event.set_dispatched(false);
+        event.set_stop_propagation(false);
+        event.set_stop_immediate_propagation(false);
+        return !event.cancelled();
+    }
+
     // 6. If target is not relatedTarget or target is event’s relatedTarget, then:
     if (related_target != target || event.related_target() == target) {
         // 1. Let touchTargets be a new list.
@@ -271,7 +324,7 @@ bool EventDispatcher::dispatch(GC::Ref<EventTarget> target, Event& event, bool l
             related_target = retarget(event.related_target(), parent);
 
             // 4. Let touchTargets be a new list.
-            touch_targets.clear();
+            touch_targets.clear_with_capacity();
 
             // 5. For each touchTarget of event’s touch target list, append the result of retargeting touchTarget against parent to touchTargets.
             for (auto& touch_target : event.touch_target_list()) {
@@ -11,6 +11,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/ParentNode.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/Namespace.h>
 
 namespace Web::DOM {
@@ -19,13 +20,19 @@ GC_DEFINE_ALLOCATOR(HTMLCollection);
 
 GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
 {
-    return root.realm().create<HTMLCollection>(root, scope, move(filter));
+    return create(root, scope, RelevantMutations {}, move(filter));
 }
 
-HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, Function<bool(Element const&)> filter)
+GC::Ref<HTMLCollection> HTMLCollection::create(ParentNode& root, Scope scope, RelevantMutations relevant_mutations, Function<bool(Element const&)> filter)
+{
+    return root.realm().create<HTMLCollection>(root, scope, move(relevant_mutations), move(filter));
+}
+
+HTMLCollection::HTMLCollection(ParentNode& root, Scope scope, RelevantMutations relevant_mutations, Function<bool(Element const&)> filter)
     : PlatformObject(root.realm())
     , m_root(root)
     , m_filter(move(filter))
+    , m_relevant_mutations(move(relevant_mutations))
     , m_scope(scope)
 {
     m_legacy_platform_object_flags = LegacyPlatformObjectFlags {
@@ -74,11 +81,78 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
     }
 }
 
+u64 HTMLCollection::relevant_attribute_version() const
+{
+    auto& document = root()->document();
+    if (m_relevant_mutations.any_attribute)
+        return document.any_attribute_version();
+
+    // NOTE: Version counters only ever increase, so this sum changes whenever any of them does.
+    //       The id and name attributes are always included because named_item() depends on them.
+    u64 version = document.attribute_version(HTML::AttributeNames::id) + document.attribute_version(HTML::AttributeNames::name);
+    for (auto const& attribute : m_relevant_mutations.attributes)
+        version += document.attribute_version(attribute);
+    return version;
+}
+
+bool HTMLCollection::update_cache_incrementally_if_possible(u64 tree_structure_version) const
+{
+    // OPTIMIZATION: If exactly one node was inserted since the cache was built, we don't have to
+    //               rebuild it: if the inserted subtree is outside our scope the cache is still valid,
+    //               and if it comes after everything collected so far, its matches can simply be
+    //               appended. This keeps append-and-measure loops (e.g. adding table rows while
+    //               reading rows.length) linear instead of quadratic.
+    if (m_cached_tree_structure_version + 1 != tree_structure_version)
+        return false;
+    auto inserted_node = root()->document().last_inserted_node();
+    if (!inserted_node)
+        return false;
+
+    if (m_scope == Scope::Children) {
+        // An insertion elsewhere in the tree can't affect a children-only collection.
+        if (inserted_node->parent() != m_root.ptr())
+            return true;
+        if (!m_cached_elements.is_empty() && !m_cached_elements.last()->is_before(*inserted_node))
+            return false;
+        if (auto* element = as_if<Element>(*inserted_node); element && m_filter(*element)) {
+            m_cached_elements.append(*element);
+            m_cached_name_to_element_mappings = nullptr;
+        }
+        return true;
+    }
+
+    // An insertion outside our subtree can't affect the collection.
+    if (!inserted_node->is_descendant_of(m_root))
+        return true;
+    if (!m_cached_elements.is_empty() && !m_cached_elements.last()->is_before(*inserted_node))
+        return false;
+    bool appended_any = false;
+    inserted_node->for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
+        if (m_filter(element)) {
+            m_cached_elements.append(element);
+            appended_any = true;
+        }
+        return TraversalDecision::Continue;
+    });
+    if (appended_any)
+        m_cached_name_to_element_mappings = nullptr;
+    return true;
+}
+
 void HTMLCollection::update_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    auto& document = root()->document();
+    auto tree_structure_version = document.tree_structure_version();
+    auto attribute_version = relevant_attribute_version();
+
+    // Nothing to do, no relevant part of the DOM has updated since we last built the cache.
+    if (m_cache_is_valid && m_cached_tree_structure_version == tree_structure_version && m_cached_attribute_version == attribute_version)
+        return;
+
+    if (m_cache_is_valid && m_cached_attribute_version == attribute_version && update_cache_incrementally_if_possible(tree_structure_version)) {
+        m_cached_tree_structure_version = tree_structure_version;
         return;
+    }
 
     m_cached_elements.clear();
     m_cached_name_to_element_mappings = nullptr;
@@ -95,7 +169,9 @@ void HTMLCollection::update_cache_if_needed() const
             return IterationDecision::Continue;
         });
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_tree_structure_version = tree_structure_version;
+    m_cached_attribute_version = attribute_version;
+    m_cache_is_valid = true;
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
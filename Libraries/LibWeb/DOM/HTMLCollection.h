@@ -7,7 +7,9 @@
 
 #pragma once
 
+#include <AK/FlyString.h>
 #include <AK/Function.h>
+#include <AK/Vector.h>
 #include <LibGC/Ptr.h>
 #include <LibWeb/Bindings/PlatformObject.h>
 #include <LibWeb/Forward.h>
@@ -30,7 +32,17 @@ public:
         Children,
         Descendants,
     };
+
+    // Describes which DOM mutations can change the contents of the collection. Collections that only
+    // depend on the tree structure (and optionally on specific attributes) survive unrelated attribute
+    // churn without rebuilding their cache.
+    struct RelevantMutations {
+        bool any_attribute { true };
+        Vector<FlyString> attributes {};
+    };
+
     [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    [[nodiscard]] static GC::Ref<HTMLCollection> create(ParentNode& root, Scope, RelevantMutations, ESCAPING Function<bool(Element const&)> filter);
 
     virtual ~HTMLCollection() override;
 
@@ -46,7 +58,7 @@ public:
     virtual bool is_supported_property_name(FlyString const&) const override;
 
 protected:
-    HTMLCollection(ParentNode& root, Scope, ESCAPING Function<bool(Element const&)> filter);
+    HTMLCollection(ParentNode& root, Scope, RelevantMutations, ESCAPING Function<bool(Element const&)> filter);
 
     virtual void initialize(JS::Realm&) override;
 
@@ -58,13 +70,18 @@ private:
 
     void update_cache_if_needed() const;
     void update_name_to_element_mappings_if_needed() const;
+    u64 relevant_attribute_version() const;
+    bool update_cache_incrementally_if_possible(u64 tree_structure_version) const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable bool m_cache_is_valid { false };
+    mutable u64 m_cached_tree_structure_version { 0 };
+    mutable u64 m_cached_attribute_version { 0 };
     mutable Vector<GC::Ref<Element>> m_cached_elements;
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
     GC::Ref<ParentNode> m_root;
     Function<bool(Element const&)> m_filter;
+    RelevantMutations m_relevant_mutations;
 
     Scope m_scope { Scope::Descendants };
 };
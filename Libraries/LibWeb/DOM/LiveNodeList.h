@@ -12,7 +12,8 @@
 
 namespace Web::DOM {
 
-// FIXME: Just like HTMLCollection, LiveNodeList currently does no caching.
+// This class implements a live, filtered view of DOM nodes. Like HTMLCollection, it caches the
+// collected nodes and only rebuilds the cache when the DOM has mutated since it was built.
 
 class LiveNodeList : public NodeList {
     WEB_PLATFORM_OBJECT(LiveNodeList, NodeList);
@@ -38,7 +39,11 @@ protected:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
-    GC::RootVector<Node*> collection() const;
+    void update_cache_if_needed() const;
+
+    mutable bool m_cache_is_valid { false };
+    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable Vector<GC::Ref<Node>> m_cached_nodes;
 
     GC::Ref<Node const> m_root;
     Function<bool(Node const&)> m_filter;
@@ -161,6 +161,8 @@ Vector<GC::Root<MutationRecord>> MutationObserver::take_records()
     return records;
 }
 
+size_t RegisteredObserver::s_living_count { 0 };
+
 GC::Ref<RegisteredObserver> RegisteredObserver::create(MutationObserver& observer, MutationObserverInit const& options)
 {
     return observer.heap().allocate<RegisteredObserver>(observer, options);
@@ -170,9 +172,13 @@ RegisteredObserver::RegisteredObserver(MutationObserver& observer, MutationObser
     : m_observer(observer)
     , m_options(options)
 {
+    ++s_living_count;
 }
 
-RegisteredObserver::~RegisteredObserver() = default;
+RegisteredObserver::~RegisteredObserver()
+{
+    --s_living_count;
+}
 
 void RegisteredObserver::visit_edges(Cell::Visitor& visitor)
 {
@@ -80,6 +80,12 @@ public:
     static GC::Ref<RegisteredObserver> create(MutationObserver&, MutationObserverInit const&);
     virtual ~RegisteredObserver() override;
 
+    // OPTIMIZATION: Tracks whether any registered observers exist at all, so the common case of
+    //               mutating a DOM that nobody is observing can bail out with a single check.
+    //               The count is decremented on finalization, so it may overshoot between a
+    //               disconnect() and the next garbage collection; that only costs us the fast path.
+    static bool any_observers_are_registered() { return s_living_count > 0; }
+
     GC::Ref<MutationObserver> observer() const { return m_observer; }
 
     MutationObserverInit const& options() const { return m_options; }
@@ -91,6 +97,8 @@ protected:
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
+    static size_t s_living_count;
+
     GC::Ref<MutationObserver> m_observer;
     MutationObserverInit m_options;
 };
@@ -231,7 +231,7 @@ WebIDL::ExceptionOr<void> Node::set_text_content(Optional<Utf16String> const& ma
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeSetTextContent);
     }
 
-    document().bump_dom_tree_version();
+    document().bump_tree_structure_version();
     return {};
 }
 
@@ -499,12 +499,9 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
     if (is_character_data())
         return;
 
-    bool properties_used_in_has_selectors = false;
-    for (auto const& property : properties) {
-        properties_used_in_has_selectors |= document().style_computer().invalidation_property_used_in_has_selector(property);
-    }
-    if (properties_used_in_has_selectors) {
-        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
+    auto has_subject_filter = document().style_computer().has_subject_invalidation_set_for_properties(properties);
+    if (!has_subject_filter.is_empty()) {
+        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this, move(has_subject_filter));
     }
 
     auto invalidation_set = document().style_computer().invalidation_set_for_properties(properties);
@@ -804,7 +801,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
     //       an ordinal value (default from constructor).
     // FIXME: This will not work if the child or the parent is not an element. Is insert_before even possible in this situation?
 
-    document().bump_dom_tree_version();
+    document().bump_tree_structure_version(nodes.size() == 1 ? nodes.first().ptr() : nullptr);
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -1026,7 +1023,7 @@ void Node::remove(bool suppress_observers)
     // 17. Run the children changed steps for parent.
     parent->children_changed(nullptr);
 
-    document().bump_dom_tree_version();
+    document().bump_tree_structure_version();
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -1357,7 +1354,7 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
     new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
-    document().bump_dom_tree_version();
+    document().bump_tree_structure_version();
 
     return {};
 }
@@ -2503,6 +2500,12 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     auto& document = this->document();
     auto& page = document.page();
 
+    // OPTIMIZATION: If there are no registered observers anywhere, the interested observers map below is
+    //               guaranteed to come out empty. Bail before deferring GC and walking the ancestor chain,
+    //               so that mutating an unobserved DOM costs a single counter check per mutation.
+    if (!RegisteredObserver::any_observers_are_registered() && !page.listen_for_dom_mutations())
+        return;
+
     // NOTE: We defer garbage collection until the end of the scope, since we can't safely use MutationObserver* as a hashmap key otherwise.
     // FIXME: This is a total hack.
     GC::DeferGC defer_gc(heap());
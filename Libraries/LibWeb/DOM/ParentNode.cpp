@@ -6,15 +6,16 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/DOM/StaticNodeList.h>
 #include <LibWeb/Dump.h>
+#include <LibWeb/HTML/AttributeNames.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Namespace.h>
@@ -52,7 +53,7 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_with_cache(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -67,6 +68,49 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
+
+    // OPTIMIZATION: If we're matching a single selector whose rightmost compound contains an ID,
+    //               only elements carrying that ID can possibly match. Instead of walking the entire
+    //               subtree, run the selector against the candidates from the tree's id-to-element
+    //               map, which are kept in tree order.
+    if (selectors.size() == 1 && node.is_connected()) {
+        Optional<FlyString> rightmost_id;
+        for (auto const& simple_selector : selectors.first()->compound_selectors().last().simple_selectors) {
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
+                rightmost_id = simple_selector.name();
+                break;
+            }
+        }
+
+        ElementByIdMap* element_by_id_map = nullptr;
+        if (rightmost_id.has_value()) {
+            auto& root = node.root();
+            if (root.is_document())
+                element_by_id_map = &static_cast<Document&>(root).element_by_id();
+            else if (root.is_shadow_root())
+                element_by_id_map = &static_cast<ShadowRoot&>(root).element_by_id();
+        }
+
+        if (element_by_id_map) {
+            if (auto const* candidates = element_by_id_map->elements_with_id(*rightmost_id)) {
+                for (auto const& weak_element : *candidates) {
+                    auto* element = weak_element.ptr();
+                    if (!element || !element->is_descendant_of(node))
+                        continue;
+                    SelectorEngine::MatchContext context;
+                    if (SelectorEngine::matches(selectors.first(), *element, nullptr, context, {}, node)) {
+                        if (return_matches == ReturnMatches::First)
+                            return { GC::Ptr<Element> { element } };
+                        results.append(*element);
+                    }
+                }
+            }
+            if (return_matches == ReturnMatches::First)
+                return { single_result };
+            return { StaticNodeList::create(node.realm(), move(results)) };
+        }
+    }
+
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
     node.for_each_in_subtree_of_type<Element>([&](auto& element) {
         for (auto& selector : selectors) {
@@ -136,7 +180,7 @@ GC::Ref<HTMLCollection> ParentNode::children()
 {
     // The children getter steps are to return an HTMLCollection collection rooted at this matching only element children.
     if (!m_children) {
-        m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, [](Element const&) {
+        m_children = HTMLCollection::create(*this, HTMLCollection::Scope::Children, HTMLCollection::RelevantMutations { .any_attribute = false }, [](Element const&) {
             return true;
         });
     }
@@ -149,7 +193,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
 {
     // 1. If qualifiedName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches only descendant elements.
     if (qualified_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [](Element const&) {
             return true;
         });
     }
@@ -157,7 +201,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     // 2. Otherwise, if root’s node document is an HTML document, return a HTMLCollection rooted at root, whose filter matches the following descendant elements:
     if (root().document().document_type() == Document::Type::HTML) {
         FlyString qualified_name_in_ascii_lowercase = qualified_name.to_ascii_lowercase();
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name, qualified_name_in_ascii_lowercase](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [qualified_name, qualified_name_in_ascii_lowercase](Element const& element) {
             // - Whose namespace is the HTML namespace and whose qualified name is qualifiedName, in ASCII lowercase.
             if (element.namespace_uri() == Namespace::HTML)
                 return element.qualified_name() == qualified_name_in_ascii_lowercase;
@@ -168,7 +212,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name(FlyString const& qu
     }
 
     // 3. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose qualified name is qualifiedName.
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [qualified_name](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [qualified_name](Element const& element) {
         return element.qualified_name() == qualified_name;
     });
 }
@@ -183,27 +227,27 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_tag_name_ns(Optional<FlyStri
 
     // 2. If both namespace and localName are "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements.
     if (namespace_ == "*" && local_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [](Element const&) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [](Element const&) {
             return true;
         });
     }
 
     // 3. Otherwise, if namespace is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose local name is localName.
     if (namespace_ == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [local_name](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [local_name](Element const& element) {
             return element.local_name() == local_name;
         });
     }
 
     // 4. Otherwise, if localName is "*" (U+002A), return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace.
     if (local_name == "*") {
-        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_](Element const& element) {
+        return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [namespace_](Element const& element) {
             return element.namespace_uri() == namespace_;
         });
     }
 
     // 5. Otherwise, return a HTMLCollection rooted at root, whose filter matches descendant elements whose namespace is namespace and local name is localName.
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [namespace_, local_name](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false }, [namespace_, local_name](Element const& element) {
         return element.namespace_uri() == namespace_ && element.local_name() == local_name;
     });
 }
@@ -267,7 +311,7 @@ GC::Ref<HTMLCollection> ParentNode::get_elements_by_class_name(StringView class_
     for (auto& name : class_names.split_view_if(Infra::is_ascii_whitespace)) {
         list_of_class_names.append(FlyString::from_utf8(name).release_value_but_fixme_should_propagate_errors());
     }
-    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, [list_of_class_names = move(list_of_class_names), quirks_mode = document().in_quirks_mode()](Element const& element) {
+    return HTMLCollection::create(*this, HTMLCollection::Scope::Descendants, HTMLCollection::RelevantMutations { .any_attribute = false, .attributes = { HTML::AttributeNames::class_ } }, [list_of_class_names = move(list_of_class_names), quirks_mode = document().in_quirks_mode()](Element const& element) {
         for (auto& name : list_of_class_names) {
             if (!element.has_class(name, quirks_mode ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive))
                 return false;
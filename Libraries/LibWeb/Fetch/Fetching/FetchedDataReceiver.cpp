@@ -5,6 +5,7 @@
  */
 
 #include <LibGC/Function.h>
+#include <LibRequests/Request.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Fetch/Fetching/FetchedDataReceiver.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
@@ -18,6 +19,11 @@ namespace Web::Fetch::Fetching {
 
 GC_DEFINE_ALLOCATOR(FetchedDataReceiver);
 
+// When more than this many received bytes haven't been pulled into the stream yet, the fetch is
+// suspended until the stream's consumer catches up.
+static constexpr u64 buffered_bytes_high_water_mark = 4 * MiB;
+static constexpr u64 buffered_bytes_low_water_mark = 1 * MiB;
+
 FetchedDataReceiver::FetchedDataReceiver(GC::Ref<Infrastructure::FetchParams const> fetch_params, GC::Ref<Streams::ReadableStream> stream)
     : m_fetch_params(fetch_params)
     , m_stream(stream)
@@ -39,19 +45,24 @@ void FetchedDataReceiver::set_pending_promise(GC::Ref<WebIDL::Promise> promise)
     auto had_pending_promise = m_pending_promise != nullptr;
     m_pending_promise = promise;
 
-    if (!had_pending_promise && !m_buffer.is_empty()) {
-        on_data_received(m_buffer);
-        m_buffer.clear();
-    }
+    if (!had_pending_promise && !m_buffer.is_empty())
+        deliver_bytes_to_stream(exchange(m_buffer, {}));
+}
+
+void FetchedDataReceiver::set_request(RefPtr<Requests::Request> request)
+{
+    m_request = move(request);
 }
 
 // This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
 // https://fetch.spec.whatwg.org/#ref-for-in-parallel④
 void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
 {
-    // FIXME: 1. If the size of buffer is smaller than a lower limit chosen by the user agent and the ongoing fetch
-    //           is suspended, resume the fetch.
-    // FIXME: 2. Wait until buffer is not empty.
+    // If the size of buffer is larger than an upper limit chosen by the user agent, ask the user
+    // agent to suspend the ongoing fetch.
+    m_unacknowledged_bytes += bytes.size();
+    if (m_request && m_unacknowledged_bytes >= buffered_bytes_high_water_mark)
+        m_request->pause();
 
     // If the remote end sends data immediately after we receive headers, we will often get that data here before the
     // stream tasks have all been queued internally. Just hold onto that data.
@@ -60,11 +71,22 @@ void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
         return;
     }
 
+    deliver_bytes_to_stream(MUST(ByteBuffer::copy(bytes)));
+}
+
+void FetchedDataReceiver::deliver_bytes_to_stream(ByteBuffer bytes)
+{
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination(),
-        GC::create_function(heap(), [this, bytes = MUST(ByteBuffer::copy(bytes))]() mutable {
+        GC::create_function(heap(), [this, bytes = move(bytes)]() mutable {
+            // If the size of buffer is smaller than a lower limit chosen by the user agent and the
+            // ongoing fetch is suspended, resume the fetch.
+            m_unacknowledged_bytes -= bytes.size();
+            if (m_request && m_unacknowledged_bytes <= buffered_bytes_low_water_mark)
+                m_request->resume();
+
             HTML::TemporaryExecutionContext execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
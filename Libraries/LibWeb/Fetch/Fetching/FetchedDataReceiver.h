@@ -7,8 +7,10 @@
 #pragma once
 
 #include <AK/ByteBuffer.h>
+#include <AK/RefPtr.h>
 #include <LibGC/CellAllocator.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibRequests/Forward.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::Fetch::Fetching {
@@ -21,6 +23,7 @@ public:
     virtual ~FetchedDataReceiver() override;
 
     void set_pending_promise(GC::Ref<WebIDL::Promise>);
+    void set_request(RefPtr<Requests::Request>);
     void on_data_received(ReadonlyBytes);
 
 private:
@@ -28,10 +31,17 @@ private:
 
     virtual void visit_edges(Visitor& visitor) override;
 
+    void deliver_bytes_to_stream(ByteBuffer);
+
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ref<Streams::ReadableStream> m_stream;
     GC::Ptr<WebIDL::Promise> m_pending_promise;
+    RefPtr<Requests::Request> m_request;
     ByteBuffer m_buffer;
+
+    // Bytes received from the network but not yet pulled into the stream. Used to pause the
+    // request when the stream's consumer falls behind.
+    u64 m_unacknowledged_bytes { 0 };
 };
 
 }
@@ -14,6 +14,7 @@
 #include <AK/ScopeGuard.h>
 #include <LibJS/Runtime/Completion.h>
 #include <LibRequests/RequestTimingInfo.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
@@ -605,17 +606,30 @@ WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> main_fetch(JS::Realm& realm, Infra
 
                 // 3. Let processBody given bytes be these steps:
                 auto process_body = GC::create_function(vm.heap(), [&realm, request, response, &fetch_params, process_body_error](ByteBuffer bytes) {
-                    // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
-                    if (!TRY_OR_IGNORE(SRI::do_bytes_match_metadata_list(bytes, request->integrity_metadata()))) {
-                        process_body_error->function()({});
-                        return;
-                    }
-
-                    // 2. Set response’s body to bytes as a body.
-                    response->set_body(Infrastructure::byte_sequence_as_body(realm, bytes));
-
-                    // 3. Run fetch response handover given fetchParams and response.
-                    fetch_response_handover(realm, fetch_params, *response);
+                    // OPTIMIZATION: Hashing a multi-megabyte script or style sheet takes long enough that we don't
+                    //               want to stall the event loop for it, right before the resource gets used. The
+                    //               hash only needs the raw bytes, so we compute it on a background thread and hop
+                    //               back to the event loop with the verdict.
+                    (void)Threading::BackgroundAction<Optional<ByteBuffer>>::construct(
+                        [bytes = move(bytes), integrity_metadata = request->integrity_metadata()](auto&) mutable -> ErrorOr<Optional<ByteBuffer>> {
+                            // 1. If bytes do not match request’s integrity metadata, then run processBodyError and abort these steps.
+                            if (!TRY(SRI::do_bytes_match_metadata_list(bytes, integrity_metadata)))
+                                return Optional<ByteBuffer> {};
+                            return move(bytes);
+                        },
+                        [realm = GC::make_root(realm), response = GC::make_root(response), fetch_params = GC::make_root(fetch_params), process_body_error = GC::make_root(process_body_error)](Optional<ByteBuffer> bytes) -> ErrorOr<void> {
+                            if (!bytes.has_value()) {
+                                process_body_error->function()({});
+                                return {};
+                            }
+
+                            // 2. Set response’s body to bytes as a body.
+                            response->set_body(Infrastructure::byte_sequence_as_body(*realm, *bytes));
+
+                            // 3. Run fetch response handover given fetchParams and response.
+                            fetch_response_handover(*realm, *fetch_params, *response);
+                            return {};
+                        });
                 });
 
                 // 4. Fully read response’s body given processBody and processBodyError.
@@ -1085,6 +1099,9 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_fetch(JS::Realm& realm, Infra
 
         // FIXME: 4. Set response to the result of invoking handle fetch for requestForServiceWorker, with fetchParams’s
         //           controller and fetchParams’s cross-origin isolated capability.
+        // NOTE: When implementing this, make sure requests for clients whose active worker has no "fetch" in its
+        //       set of event types to handle skip the worker entirely (Handle Fetch step 7), rather than paying
+        //       a worker round-trip per request only to fall back to the network.
 
         // 5. If response is non-null, then:
         if (response) {
@@ -2291,6 +2308,38 @@ static void log_response(auto const& status_code, auto const& headers, auto cons
 }
 #endif
 
+// AD-HOC: Maps the request's priority and destination onto the scheduling priority used by
+//         RequestServer, so that render-blocking resources are fetched ahead of other subresources
+//         and speculative fetches yield to everything else.
+static Requests::RequestPriority network_scheduling_priority_for_request(Infrastructure::Request const& request)
+{
+    if (request.initiator() == Infrastructure::Request::Initiator::Prefetch || request.initiator() == Infrastructure::Request::Initiator::Prerender)
+        return Requests::RequestPriority::Low;
+
+    // A developer-supplied priority hint (e.g. fetchpriority) overrides the destination-based default.
+    if (request.priority() == Infrastructure::Request::Priority::High)
+        return Requests::RequestPriority::High;
+    if (request.priority() == Infrastructure::Request::Priority::Low)
+        return Requests::RequestPriority::Low;
+
+    if (request.destination().has_value()) {
+        switch (*request.destination()) {
+        case Infrastructure::Request::Destination::Document:
+        case Infrastructure::Request::Destination::Frame:
+        case Infrastructure::Request::Destination::IFrame:
+        case Infrastructure::Request::Destination::Style:
+        case Infrastructure::Request::Destination::Font:
+            return Requests::RequestPriority::High;
+        default:
+            break;
+        }
+    }
+
+    // FIXME: Demote below-the-fold images to Low and promote them via Requests::Request::set_priority()
+    //        as they scroll towards the viewport.
+    return Requests::RequestPriority::Normal;
+}
+
 // https://fetch.spec.whatwg.org/#concept-http-network-fetch
 // Drop-in replacement for 'HTTP-network fetch', but obviously non-standard :^)
 // It also handles file:// URLs since those can also go through ResourceLoader.
@@ -2317,6 +2366,8 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
     load_request.set_store_set_cookie_headers(include_credentials == IncludeCredentials::Yes);
+    load_request.set_priority(network_scheduling_priority_for_request(request));
+    load_request.set_keepalive(request->keepalive());
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
@@ -2454,7 +2505,10 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             }
         });
 
-        ResourceLoader::the().load_unbuffered(load_request, on_headers_received, on_data_received, on_complete);
+        // Hand the underlying request to the receiver, so it can pause the fetch when the stream's
+        // consumer falls behind and resume it once the backlog has drained.
+        auto protocol_request = ResourceLoader::the().load_unbuffered(load_request, on_headers_received, on_data_received, on_complete);
+        fetched_data_receiver->set_request(move(protocol_request));
     } else {
         auto on_load_success = GC::create_function(vm.heap(), [&realm, &vm, request, pending_response, fetch_timing_info, cross_origin_isolated_capability](ReadonlyBytes data, Requests::RequestTimingInfo const& timing_info, HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase) {
             (void)request;
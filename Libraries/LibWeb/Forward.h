@@ -100,6 +100,7 @@ enum class RequestPriority : u8;
 enum class RequestRedirect : u8;
 enum class ResizeObserverBoxOptions : u8;
 enum class ResponseType : u8;
+enum class TaskPriority : u8;
 enum class TextTrackKind : u8;
 enum class TransferFunction : u8;
 enum class XMLHttpRequestResponseType : u8;
@@ -1017,6 +1018,14 @@ class PerformanceResourceTiming;
 
 }
 
+namespace Web::Scheduler {
+
+class Scheduler;
+
+struct SchedulerPostTaskOptions;
+
+}
+
 namespace Web::Selection {
 
 class Selection;
@@ -1039,6 +1048,9 @@ struct SerialPortInfo;
 
 namespace Web::ServiceWorker {
 
+class Cache;
+class CacheStorage;
+class NavigationPreloadManager;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BinarySearch.h>
 #include <AK/ScopeGuard.h>
 #include <LibWeb/HTML/AnimationFrameCallbackDriver.h>
 
@@ -16,34 +17,55 @@ GC_DEFINE_ALLOCATOR(AnimationFrameCallbackDriver);
 void AnimationFrameCallbackDriver::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    visitor.visit(m_callbacks);
-    visitor.visit(m_executing_callbacks);
+    for (auto& entry : m_callbacks)
+        visitor.visit(entry.callback);
+    for (auto& entry : m_executing_callbacks)
+        visitor.visit(entry.callback);
 }
 
 WebIDL::UnsignedLong AnimationFrameCallbackDriver::add(Callback handler)
 {
     auto id = ++m_animation_frame_callback_identifier;
-    m_callbacks.set(id, handler);
+    m_callbacks.append({ id, handler });
     return id;
 }
 
 bool AnimationFrameCallbackDriver::remove(WebIDL::UnsignedLong id)
 {
-    return m_callbacks.remove(id);
+    auto* entry = binary_search(m_callbacks.span(), id, nullptr, [](auto id, auto const& entry) {
+        if (id < entry.id)
+            return -1;
+        if (id > entry.id)
+            return 1;
+        return 0;
+    });
+
+    if (!entry || !entry->callback)
+        return false;
+
+    entry->callback = nullptr;
+    ++m_cancelled_callback_count;
+    return true;
 }
 
 bool AnimationFrameCallbackDriver::has_callbacks() const
 {
-    return !m_callbacks.is_empty();
+    return m_callbacks.size() > m_cancelled_callback_count;
 }
 
 void AnimationFrameCallbackDriver::run(double now)
 {
-    AK::ScopeGuard guard { [&]() { m_executing_callbacks.clear(); } };
-    m_executing_callbacks = move(m_callbacks);
+    AK::ScopeGuard guard { [&]() { m_executing_callbacks.clear_with_capacity(); } };
+
+    // NOTE: Swapping instead of moving lets callbacks registered during this run reuse the buffer the
+    //       previous batch ran from, so steady-state rAF loops never reallocate.
+    swap(m_callbacks, m_executing_callbacks);
+    m_cancelled_callback_count = 0;
 
-    for (auto& [id, callback] : m_executing_callbacks)
-        callback->function()(now);
+    for (auto& entry : m_executing_callbacks) {
+        if (entry.callback)
+            entry.callback->function()(now);
+    }
 }
 
 }
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
+#include <AK/Vector.h>
 #include <LibGC/Function.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Heap/Cell.h>
@@ -32,11 +32,21 @@ public:
 private:
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // OPTIMIZATION: Identifiers only ever increase, so registrations form a flat vector that is always
+    //               sorted by id. That keeps per-frame dispatch cache-linear and allocation-free, and
+    //               lets cancellation use a binary search. Cancelled callbacks stay behind as null
+    //               entries (preserving the sort order) until the next run drops the whole batch.
+    struct RegisteredCallback {
+        WebIDL::UnsignedLong id { 0 };
+        GC::Ptr<GC::Function<void(double)>> callback;
+    };
+
     // https://html.spec.whatwg.org/multipage/imagebitmap-and-animations.html#animation-frame-callback-identifier
     WebIDL::UnsignedLong m_animation_frame_callback_identifier { 0 };
 
-    OrderedHashMap<WebIDL::UnsignedLong, Callback> m_callbacks;
-    OrderedHashMap<WebIDL::UnsignedLong, Callback> m_executing_callbacks;
+    Vector<RegisteredCallback> m_callbacks;
+    Vector<RegisteredCallback> m_executing_callbacks;
+    size_t m_cancelled_callback_count { 0 };
 };
 
 }
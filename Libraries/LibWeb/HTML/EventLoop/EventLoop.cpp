@@ -695,14 +695,18 @@ double EventLoop::compute_deadline() const
         //    set hasPendingRenders to true.
         if (window->has_animation_frame_callbacks())
             has_pending_renders = true;
-        // FIXME: 2. Let timerCallbackEstimates be the result of getting the values of windowInSameLoop's map of active timers.
-        // FIXME: 3. For each timeoutDeadline of timerCallbackEstimates, if timeoutDeadline is less than deadline, set deadline to timeoutDeadline.
+        // 2. Let timerCallbackEstimates be the result of getting the values of windowInSameLoop's map of active timers.
+        auto timer_callback_estimates = window->timer_callback_estimates();
+        // 3. For each timeoutDeadline of timerCallbackEstimates, if timeoutDeadline is less than deadline, set deadline to timeoutDeadline.
+        for (auto timeout_deadline : timer_callback_estimates) {
+            if (timeout_deadline < deadline)
+                deadline = timeout_deadline;
+        }
     }
     // 4. If hasPendingRenders is true, then:
     if (has_pending_renders) {
         // 1. Let nextRenderDeadline be this event loop's last render opportunity time plus (1000 divided by the current refresh rate).
-        // FIXME: Hardcoded to 60Hz
-        auto next_render_deadline = m_last_render_opportunity_time + (1000.0 / 60.0);
+        auto next_render_deadline = m_last_render_opportunity_time + (1000.0 / m_refresh_rate);
         // 2. If nextRenderDeadline is less than deadline, then return nextRenderDeadline.
         if (next_render_deadline < deadline)
             return next_render_deadline;
@@ -87,6 +87,8 @@ public:
 
     double compute_deadline() const;
 
+    void set_refresh_rate(double refresh_rate) { m_refresh_rate = refresh_rate; }
+
     [[nodiscard]] PauseHandle pause();
     void unpause(Badge<PauseHandle>, JS::Object const& global, HighResolutionTime::DOMHighResTimeStamp);
     bool execution_paused() const { return m_execution_paused; }
@@ -114,6 +116,9 @@ private:
     // https://html.spec.whatwg.org/multipage/webappapis.html#last-idle-period-start-time
     double m_last_idle_period_start_time { 0 };
 
+    // The rate at which the embedder drives rendering updates, in frames per second.
+    double m_refresh_rate { 60.0 };
+
     GC::Ptr<Platform::Timer> m_system_event_loop_timer;
 
     // https://html.spec.whatwg.org/multipage/webappapis.html#performing-a-microtask-checkpoint
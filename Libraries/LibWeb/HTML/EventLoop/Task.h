@@ -84,6 +84,9 @@ public:
         // https://w3c.github.io/gamepad/#dfn-gamepad-task-source
         Gamepad,
 
+        // https://wicg.github.io/scheduling-apis/#sec-scheduler
+        Scheduler,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
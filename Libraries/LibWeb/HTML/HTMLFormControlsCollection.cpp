@@ -22,7 +22,7 @@ GC::Ref<HTMLFormControlsCollection> HTMLFormControlsCollection::create(DOM::Pare
 }
 
 HTMLFormControlsCollection::HTMLFormControlsCollection(DOM::ParentNode& root, Scope scope, Function<bool(DOM::Element const&)> filter)
-    : DOM::HTMLCollection(root, scope, move(filter))
+    : DOM::HTMLCollection(root, scope, DOM::HTMLCollection::RelevantMutations {}, move(filter))
 {
 }
 
@@ -36,6 +36,15 @@ void HTMLOptGroupElement::inserted()
         static_cast<HTMLSelectElement&>(*parent()).update_selectedness();
 }
 
+void HTMLOptGroupElement::children_changed(ChildrenChangedMetadata const* metadata)
+{
+    Base::children_changed(metadata);
+
+    // NOTE: Our option children are part of the parent select's list of options, which is cached.
+    if (auto* select = as_if<HTMLSelectElement>(parent()))
+        select->invalidate_cached_list_of_options();
+}
+
 void HTMLOptGroupElement::removed_from(Node* old_parent, Node& old_root)
 {
     Base::removed_from(old_parent, old_root);
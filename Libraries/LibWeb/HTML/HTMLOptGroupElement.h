@@ -28,6 +28,7 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void removed_from(Node* old_parent, Node& old_root) override;
     virtual void inserted() override;
+    virtual void children_changed(ChildrenChangedMetadata const*) override;
 };
 
 }
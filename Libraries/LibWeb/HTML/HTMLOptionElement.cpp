@@ -80,9 +80,14 @@ void HTMLOptionElement::set_selected(bool selected)
 
 void HTMLOptionElement::set_selected_internal(bool selected)
 {
-    if (m_selected != selected)
+    if (m_selected != selected) {
         invalidate_style(DOM::StyleInvalidationReason::HTMLOptionElementSelectedChange);
 
+        // NOTE: The containing select element caches how many of its options are selected.
+        if (auto select = first_ancestor_of_type<HTMLSelectElement>())
+            select->invalidate_cached_list_of_options();
+    }
+
     m_selected = selected;
     if (selected)
         m_selectedness_update_index = m_next_selectedness_update_index++;
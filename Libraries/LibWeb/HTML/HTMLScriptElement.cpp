@@ -6,6 +6,10 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/HashTable.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
 #include <AK/StringBuilder.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/HTMLScriptElementPrototype.h>
@@ -23,6 +27,8 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
+#include <LibWeb/Loader/LoadRequest.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/MimeSniff/MimeType.h>
 #include <LibWeb/TrustedTypes/RequireTrustedTypesForDirective.h>
 #include <LibWeb/TrustedTypes/TrustedTypePolicy.h>
@@ -167,6 +173,71 @@ void HTMLScriptElement::execute_script()
         dispatch_event(DOM::Event::create(realm(), HTML::EventNames::load));
 }
 
+// https://wicg.github.io/nav-speculation/speculation-rules.html#parse-speculation-rules
+// AD-HOC: This handles a useful subset of the Speculation Rules API: list rules ("urls") from the
+//         "prefetch" and "prerender" rule sets, both treated as a cache-warming prefetch of the
+//         target document through RequestServer's HTTP cache. Document rules ("where") and actual
+//         prerendering into a separate navigable are not supported.
+static void process_speculation_rules(DOM::Document& document, String const& source_text)
+{
+    auto json_or_error = JsonValue::from_string(source_text);
+    if (json_or_error.is_error() || !json_or_error.value().is_object()) {
+        dbgln("HTMLScriptElement: Ignoring speculation rules that aren't a JSON object.");
+        return;
+    }
+    auto const& top_level = json_or_error.value().as_object();
+
+    // Candidate URLs can appear in several rules; only prefetch each of them once.
+    HashTable<ByteString> seen_urls;
+
+    for (auto rule_set_name : { "prefetch"sv, "prerender"sv }) {
+        auto rules = top_level.get_array(rule_set_name);
+        if (!rules.has_value())
+            continue;
+
+        rules->for_each([&](JsonValue const& rule) {
+            if (!rule.is_object())
+                return;
+
+            auto urls = rule.as_object().get_array("urls"sv);
+            if (!urls.has_value())
+                return;
+
+            urls->for_each([&](JsonValue const& url_value) {
+                if (!url_value.is_string())
+                    return;
+
+                auto url = document.encoding_parse_url(url_value.as_string());
+                if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+                    return;
+
+                // NOTE: The spec allows same-site and even cross-site prefetching with extra
+                //       restrictions; we only act on same-origin candidates, where serving the
+                //       response from the HTTP cache later is unambiguously correct.
+                if (!document.origin().is_same_origin(url->origin()))
+                    return;
+
+                if (url->equals(document.url(), URL::ExcludeFragment::Yes))
+                    return;
+
+                if (seen_urls.set(url->to_byte_string()) != HashSetResult::InsertedNewEntry)
+                    return;
+
+                auto load_request = LoadRequest::create_for_url_on_page(*url, &document.page());
+
+                // Speculative work shouldn't compete with resources the current page actually needs.
+                load_request.set_priority(Requests::RequestPriority::Low);
+
+                ResourceLoader::the().load(
+                    load_request,
+                    GC::create_function(document.heap(), [](ReadonlyBytes, Requests::RequestTimingInfo const&, HTTP::HeaderMap const&, Optional<u32>, Optional<String> const&) {
+                        // The response is only fetched to populate the HTTP cache; nobody consumes it here.
+                    }));
+            });
+        });
+    }
+}
+
 // https://html.spec.whatwg.org/multipage/scripting.html#prepare-a-script
 // https://whatpr.org/html/9893/scripting.html#prepare-a-script
 void HTMLScriptElement::prepare_script()
@@ -242,7 +313,11 @@ void HTMLScriptElement::prepare_script()
         // then set el's type to "importmap".
         m_script_type = ScriptType::ImportMap;
     }
-    // FIXME: 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules", then set el's type to "speculationrules".
+    // 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules",
+    else if (script_block_type.equals_ignoring_ascii_case("speculationrules"sv)) {
+        // then set el's type to "speculationrules".
+        m_script_type = ScriptType::SpeculationRules;
+    }
     // 13. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
@@ -377,8 +452,7 @@ void HTMLScriptElement::prepare_script()
     // 33. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
         // 1. If el's type is "importmap" or "speculationrules", then:
-        // FIXME: Add "speculationrules" support.
-        if (m_script_type == ScriptType::ImportMap) {
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -492,7 +566,14 @@ void HTMLScriptElement::prepare_script()
             // 2. Mark as ready el given result.
             mark_as_ready(Result(move(result)));
         }
-        // FIXME: -> "speculationrules"
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // AD-HOC: We don't have prerendering or a parsed speculation rule set that outlives this
+            //         element. Parse the rules now and warm the HTTP cache for their candidate URLs,
+            //         then bail out; the execution steps below have nothing to do for this type.
+            process_speculation_rules(document(), source_text_utf8);
+            return;
+        }
     }
 
     // 35. If el's type is "classic" and el has a src attribute, or el's type is "module":
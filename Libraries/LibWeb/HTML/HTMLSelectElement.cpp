@@ -203,6 +203,14 @@ GC::Ref<DOM::HTMLCollection> HTMLSelectElement::selected_options()
 // https://html.spec.whatwg.org/multipage/form-elements.html#concept-select-option-list
 void HTMLSelectElement::update_cached_list_of_options() const
 {
+    // OPTIMIZATION: The list is rebuilt lazily after a mutation that could have changed it, so
+    //               repeated accessors (e.g. reading selectedIndex in a loop over a huge select)
+    //               don't walk all options every time. Invalidation happens in children_changed()
+    //               here and on HTMLOptGroupElement, and when an option's selectedness changes.
+    if (m_cached_list_of_options_valid)
+        return;
+    m_cached_list_of_options_valid = true;
+
     // The list of options for a select element consists of all the option element children of the select element,
     // and all the option element children of all the optgroup element children of the select element, in tree order.
     m_cached_list_of_options.clear();
@@ -333,6 +341,8 @@ void HTMLSelectElement::children_changed(ChildrenChangedMetadata const* metadata
 {
     Base::children_changed(metadata);
 
+    invalidate_cached_list_of_options();
+
     if (metadata && can_skip_children_changed_selectedness_update(*metadata))
         return;
 
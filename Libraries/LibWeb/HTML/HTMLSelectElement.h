@@ -100,6 +100,7 @@ public:
     void did_select_item(Optional<u32> const& id);
 
     void update_selectedness();
+    void invalidate_cached_list_of_options() const { m_cached_list_of_options_valid = false; }
 
     void update_inner_text_element(Badge<HTMLOptionElement>);
 
@@ -141,6 +142,7 @@ private:
 
     mutable Vector<GC::Ref<HTMLOptionElement>> m_cached_list_of_options;
     mutable size_t m_cached_number_of_selected_options { 0 };
+    mutable bool m_cached_list_of_options_valid { false };
 
     GC::Ptr<HTMLOptionsCollection> m_options;
     GC::Ptr<DOM::HTMLCollection> m_selected_options;
@@ -46,6 +46,7 @@
 #include <LibWeb/Layout/Node.h>
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
+#include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
 #include <LibWeb/Painting/NavigableContainerViewportPaintable.h>
@@ -1561,6 +1562,12 @@ void Navigable::begin_navigation(NavigateParams params)
     auto& active_document = *this->active_document();
     auto& vm = this->vm();
 
+    // OPTIMIZATION: Start warming up connections for the target origin and its predicted
+    //               subresource origins right away, so DNS lookups and TLS handshakes overlap with
+    //               everything between here and the first response bytes.
+    if (!document_resource.has<POSTResource>())
+        ResourceLoader::the().predict_connections_for_navigation(url);
+
     // 1. Let cspNavigationType be "form-submission" if formDataEntryList is non-null; otherwise "other".
     auto csp_navigation_type = form_data_entry_list.has_value() ? ContentSecurityPolicy::Directives::Directive::NavigationType::FormSubmission : ContentSecurityPolicy::Directives::Directive::NavigationType::Other;
 
@@ -2309,7 +2316,8 @@ void perform_url_and_history_update_steps(DOM::Document& document, URL::URL new_
     // FIXME: persisted user state: activeEntry's persisted user state
     GC::Ref<SessionHistoryEntry> new_entry = document.heap().allocate<SessionHistoryEntry>();
     new_entry->set_url(new_url);
-    new_entry->set_classic_history_api_state(serialized_data.value_or(active_entry->classic_history_api_state()));
+    bool const has_serialized_data = serialized_data.has_value();
+    new_entry->set_classic_history_api_state(has_serialized_data ? serialized_data.release_value() : active_entry->classic_history_api_state());
     new_entry->set_document_state(active_entry->document_state());
     new_entry->set_scroll_restoration_mode(active_entry->scroll_restoration_mode());
 
@@ -2331,7 +2339,7 @@ void perform_url_and_history_update_steps(DOM::Document& document, URL::URL new_
     }
 
     // If serializedData is not null, then restore the history object state given document and newEntry.
-    if (serialized_data.has_value())
+    if (has_serialized_data)
         document.restore_the_history_object_state(new_entry);
 
     // 8. Set the URL given document to newURL.
@@ -2418,7 +2426,7 @@ void Navigable::set_viewport_size(CSSPixelSize size)
     if (auto document = active_document()) {
         // NOTE: Resizing the viewport changes the reference value for viewport-relative CSS lengths.
         document->invalidate_style(DOM::StyleInvalidationReason::NavigableSetViewportSize);
-        document->set_needs_media_query_evaluation();
+        document->set_needs_media_query_evaluation(CSS::MediaQueryEvaluationScope::ViewportDependent);
         if (auto layout_node = document->layout_node())
             layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::NavigableSetViewportSize);
     }
@@ -2463,7 +2471,12 @@ bool Navigable::has_a_rendering_opportunity() const
     // or whether its active document's visibility state is "visible".
     // Rendering opportunities typically occur at regular intervals.
 
-    // FIXME: Return `false` here if we're an inactive browser tab.
+    // OPTIMIZATION: Inactive browser tabs have no rendering opportunities, so background tabs neither run
+    //               requestAnimationFrame() callbacks nor schedule paints until they become visible again.
+    auto traversable = traversable_navigable();
+    if (traversable && traversable->system_visibility_state() != VisibilityState::Visible)
+        return false;
+
     return is_ready_to_paint();
 }
 
@@ -255,6 +255,11 @@ WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> OffscreenCanvas::transfer_to_image_bit
         m_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::RGBA8888, size));
     }
 
+    // NOTE: The 2D context's painting surface wraps the old bitmap, which now belongs to the
+    //       ImageBitmap; drop it so the next draw targets the fresh bitmap.
+    if (auto* context = m_context.get_pointer<GC::Ref<OffscreenCanvasRenderingContext2D>>())
+        (*context)->reset_painting_surface();
+
     // 5. Return image.
     return image;
 }
@@ -6,12 +6,16 @@
 
 #include <AK/OwnPtr.h>
 #include <LibGfx/CompositingAndBlendingOperator.h>
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PainterSkia.h>
+#include <LibGfx/PaintingSurface.h>
 #include <LibGfx/Rect.h>
+#include <LibGfx/TextLayout.h>
 #include <LibUnicode/Segmenter.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/OffscreenCanvasRenderingContext2DPrototype.h>
 #include <LibWeb/CSS/PropertyID.h>
+#include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/HTMLImageElement.h>
 #include <LibWeb/HTML/ImageBitmap.h>
@@ -63,9 +67,16 @@ void OffscreenCanvasRenderingContext2D::visit_edges(Cell::Visitor& visitor)
 
 void OffscreenCanvasRenderingContext2D::set_size(Gfx::IntSize const& size)
 {
-    if (m_size == size)
-        return;
     m_size = size;
+    // NOTE: The canvas reallocates its bitmap even when the size doesn't change, so the surface
+    //       always has to be re-wrapped.
+    reset_painting_surface();
+}
+
+void OffscreenCanvasRenderingContext2D::reset_painting_surface()
+{
+    m_surface = nullptr;
+    m_painter = nullptr;
 }
 
 GC::Ref<OffscreenCanvas> OffscreenCanvasRenderingContext2D::canvas()
@@ -84,93 +95,547 @@ OffscreenCanvas const& OffscreenCanvasRenderingContext2D::canvas_element() const
     return *m_canvas;
 }
 
-void OffscreenCanvasRenderingContext2D::fill_rect(float, float, float, float)
+void OffscreenCanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
+{
+    // NOTE: There's nothing to invalidate here; the pixels only become visible to the outside once
+    //       they are handed over via transferToImageBitmap() or read back.
+}
+
+Gfx::Painter* OffscreenCanvasRenderingContext2D::painter()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill_rect()");
+    if (!m_surface) {
+        auto bitmap = canvas_element().bitmap();
+        if (!bitmap)
+            return nullptr;
+
+        // NOTE: Since script on a worker runs on the worker's own thread, wrapping the canvas
+        //       bitmap here means all rasterization happens on that thread, and the pixels are
+        //       handed over to ImageBitmap without a copy.
+        m_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
+        m_painter = make<Gfx::PainterSkia>(*m_surface);
+    }
+    return m_painter.ptr();
 }
 
-void OffscreenCanvasRenderingContext2D::clear_rect(float, float, float, float)
+// https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
+Gfx::Color OffscreenCanvasRenderingContext2D::clear_color() const
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::clear_rect()");
+    return m_context_attributes.alpha ? Gfx::Color::Transparent : Gfx::Color::Black;
 }
 
-void OffscreenCanvasRenderingContext2D::stroke_rect(float, float, float, float)
+Gfx::Path OffscreenCanvasRenderingContext2D::rect_path(float x, float y, float width, float height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke_rect()");
+    auto top_left = Gfx::FloatPoint(x, y);
+    auto top_right = Gfx::FloatPoint(x + width, y);
+    auto bottom_left = Gfx::FloatPoint(x, y + height);
+    auto bottom_right = Gfx::FloatPoint(x + width, y + height);
+
+    Gfx::Path path;
+    path.move_to(top_left);
+    path.line_to(top_right);
+    path.line_to(bottom_right);
+    path.line_to(bottom_left);
+    path.line_to(top_left);
+    return path;
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::draw_image_internal(CanvasImageSource const&, float, float, float, float, float, float, float, float)
+void OffscreenCanvasRenderingContext2D::fill_rect(float x, float y, float width, float height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::draw_image_internal()");
+    fill_internal(rect_path(x, y, width, height), Gfx::WindingRule::EvenOdd);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-clearrect
+void OffscreenCanvasRenderingContext2D::clear_rect(float x, float y, float width, float height)
+{
+    // 1. If any of the arguments are infinite or NaN, then return.
+    if (!isfinite(x) || !isfinite(y) || !isfinite(width) || !isfinite(height))
+        return;
+
+    if (auto* painter = this->painter()) {
+        auto rect = Gfx::FloatRect(x, y, width, height);
+        painter->clear_rect(rect, clear_color());
+        did_draw(rect);
+    }
+}
+
+void OffscreenCanvasRenderingContext2D::stroke_rect(float x, float y, float width, float height)
+{
+    stroke_internal(rect_path(x, y, width, height));
+}
+
+// 4.12.5.1.14 Drawing images, https://html.spec.whatwg.org/multipage/canvas.html#drawing-images
+WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::draw_image_internal(CanvasImageSource const& image, float source_x, float source_y, float source_width, float source_height, float destination_x, float destination_y, float destination_width, float destination_height)
+{
+    // 1. If any of the arguments are infinite or NaN, then return.
+    if (!isfinite(source_x) || !isfinite(source_y) || !isfinite(source_width) || !isfinite(source_height) || !isfinite(destination_x) || !isfinite(destination_y) || !isfinite(destination_width) || !isfinite(destination_height))
+        return {};
+
+    // 2. Let usability be the result of checking the usability of image.
+    auto usability = TRY(check_usability_of_image(image));
+
+    // 3. If usability is bad, then return (without drawing anything).
+    if (usability == CanvasImageSourceUsability::Bad)
+        return {};
+
+    auto bitmap = canvas_image_source_bitmap(image);
+    if (!bitmap)
+        return {};
+
+    // 4. Establish the source and destination rectangles as follows:
+    // NOTE: Implemented in drawImage() overloads
+    if (source_width < 0) {
+        source_x += source_width;
+        source_width = abs(source_width);
+    }
+    if (source_height < 0) {
+        source_y += source_height;
+        source_height = abs(source_height);
+    }
+    if (destination_width < 0) {
+        destination_x += destination_width;
+        destination_width = abs(destination_width);
+    }
+    if (destination_height < 0) {
+        destination_y += destination_height;
+        destination_height = abs(destination_height);
+    }
+
+    //    The source rectangle is the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
+    auto source_rect = Gfx::FloatRect { source_x, source_y, source_width, source_height };
+    //    The destination rectangle is the rectangle whose corners are the four points (dx, dy), (dx+dw, dy), (dx+dw, dy+dh), (dx, dy+dh).
+    auto destination_rect = Gfx::FloatRect { destination_x, destination_y, destination_width, destination_height };
+    //    When the source rectangle is outside the source image, the source rectangle must be clipped
+    //    to the source image and the destination rectangle must be clipped in the same proportion.
+    auto clipped_source = source_rect.intersected(bitmap->rect().to_type<float>());
+    auto clipped_destination = destination_rect;
+    if (clipped_source != source_rect) {
+        clipped_destination.set_width(clipped_destination.width() * (clipped_source.width() / source_rect.width()));
+        clipped_destination.set_height(clipped_destination.height() * (clipped_source.height() / source_rect.height()));
+    }
+
+    // 5. If one of the sw or sh arguments is zero, then return. Nothing is painted.
+    if (source_width == 0 || source_height == 0)
+        return {};
+
+    // 6. Paint the region of the image argument specified by the source rectangle on the region of the rendering context's output bitmap specified by the destination rectangle, after applying the current transformation matrix to the destination rectangle.
+    auto scaling_mode = Gfx::ScalingMode::NearestNeighbor;
+    if (drawing_state().image_smoothing_enabled) {
+        // FIXME: Honor drawing_state().image_smoothing_quality
+        scaling_mode = Gfx::ScalingMode::BilinearBlend;
+    }
+
+    if (auto* painter = this->painter()) {
+        painter->draw_bitmap(destination_rect, *bitmap, source_rect.to_rounded<int>(), scaling_mode, drawing_state().filter, drawing_state().global_alpha, drawing_state().current_compositing_and_blending_operator);
+        did_draw(destination_rect);
+    }
+
+    // 7. If image is not origin-clean, then set the OffscreenCanvasRenderingContext2D's origin-clean flag to false.
+    if (image_is_not_origin_clean(image))
+        m_origin_clean = false;
+
     return {};
 }
 
 void OffscreenCanvasRenderingContext2D::begin_path()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::begin_path()");
+    path().clear();
+}
+
+static Gfx::Path::CapStyle to_gfx_cap(Bindings::CanvasLineCap const& cap_style)
+{
+    switch (cap_style) {
+    case Bindings::CanvasLineCap::Butt:
+        return Gfx::Path::CapStyle::Butt;
+    case Bindings::CanvasLineCap::Round:
+        return Gfx::Path::CapStyle::Round;
+    case Bindings::CanvasLineCap::Square:
+        return Gfx::Path::CapStyle::Square;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+static Gfx::Path::JoinStyle to_gfx_join(Bindings::CanvasLineJoin const& join_style)
+{
+    switch (join_style) {
+    case Bindings::CanvasLineJoin::Round:
+        return Gfx::Path::JoinStyle::Round;
+    case Bindings::CanvasLineJoin::Bevel:
+        return Gfx::Path::JoinStyle::Bevel;
+    case Bindings::CanvasLineJoin::Miter:
+        return Gfx::Path::JoinStyle::Miter;
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+void OffscreenCanvasRenderingContext2D::stroke_internal(Gfx::Path const& path)
+{
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = drawing_state();
+    auto paint_style = state.stroke_style.to_gfx_paint_style();
+    if (!paint_style->is_visible())
+        return;
+
+    auto line_cap = to_gfx_cap(state.line_cap);
+    auto line_join = to_gfx_join(state.line_join);
+    // FIXME: Need a Vector<float> for rendering dash_array, but state.dash_list is Vector<double>.
+    // Maybe possible to avoid creating copies?
+    auto dash_array = Vector<float> {};
+    dash_array.ensure_capacity(state.dash_list.size());
+    for (auto const& dash : state.dash_list) {
+        dash_array.append(static_cast<float>(dash));
+    }
+    paint_shadow_for_stroke_internal(path, line_cap, line_join, dash_array);
+    painter->stroke_path(path, paint_style, state.filter, state.line_width, state.global_alpha, state.current_compositing_and_blending_operator, line_cap, line_join, state.miter_limit, dash_array, state.line_dash_offset);
+
+    did_draw(path.bounding_box());
 }
 
 void OffscreenCanvasRenderingContext2D::stroke()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke()");
+    stroke_internal(path());
 }
 
-void OffscreenCanvasRenderingContext2D::stroke(Path2D const&)
+void OffscreenCanvasRenderingContext2D::stroke(Path2D const& path)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke(Path2D)");
+    stroke_internal(path.path());
 }
 
-void OffscreenCanvasRenderingContext2D::fill_text(Utf16String const&, float, float, Optional<double>)
+static Gfx::WindingRule parse_fill_rule(StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill_text()");
+    if (fill_rule == "evenodd"sv)
+        return Gfx::WindingRule::EvenOdd;
+    if (fill_rule == "nonzero"sv)
+        return Gfx::WindingRule::Nonzero;
+    dbgln("Unrecognized fillRule for OffscreenCRC2D.fill() - this problem goes away once we pass an enum instead of a string");
+    return Gfx::WindingRule::Nonzero;
 }
 
-void OffscreenCanvasRenderingContext2D::stroke_text(Utf16String const&, float, float, Optional<double>)
+void OffscreenCanvasRenderingContext2D::fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::stroke_text()");
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = this->drawing_state();
+    auto paint_style = state.fill_style.to_gfx_paint_style();
+    if (!paint_style->is_visible())
+        return;
+
+    paint_shadow_for_fill_internal(path, winding_rule);
+
+    painter->fill_path(path, paint_style, state.filter, state.global_alpha, state.current_compositing_and_blending_operator, winding_rule);
+
+    did_draw(path.bounding_box());
 }
 
-void OffscreenCanvasRenderingContext2D::fill(StringView)
+void OffscreenCanvasRenderingContext2D::fill(StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill(StringView)");
+    fill_internal(path(), parse_fill_rule(fill_rule));
 }
 
-void OffscreenCanvasRenderingContext2D::fill(Path2D&, StringView)
+void OffscreenCanvasRenderingContext2D::fill(Path2D& path, StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::fill(Path2D&, StringView)");
+    fill_internal(path.path(), parse_fill_rule(fill_rule));
+}
+
+RefPtr<Gfx::FontCascadeList const> OffscreenCanvasRenderingContext2D::font_cascade_list()
+{
+    // When font style value is empty load default font
+    if (!drawing_state().font_style_value) {
+        set_font("10px sans-serif"sv);
+    }
+
+    // Get current loaded font
+    return drawing_state().current_font_cascade_list;
+}
+
+Gfx::Path OffscreenCanvasRenderingContext2D::text_path(Utf16String const& text, float x, float y, Optional<double> max_width)
+{
+    if (max_width.has_value() && max_width.value() <= 0)
+        return {};
+
+    auto& drawing_state = this->drawing_state();
+
+    auto const& font_cascade_list = this->font_cascade_list();
+    auto const& font = font_cascade_list->first();
+    auto glyph_runs = Gfx::shape_text({ x, y }, text.utf16_view(), *font_cascade_list);
+    Gfx::Path path;
+    for (auto const& glyph_run : glyph_runs) {
+        path.glyph_run(glyph_run);
+    }
+
+    auto text_width = path.bounding_box().width();
+    Gfx::AffineTransform transform = {};
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#text-preparation-algorithm:
+    // 9. If maxWidth was provided and the hypothetical width of the inline box in the hypothetical line box
+    // is greater than maxWidth CSS pixels, then change font to have a more condensed font (if one is
+    // available or if a reasonably readable one can be synthesized by applying a horizontal scale
+    // factor to the font) or a smaller font, and return to the previous step.
+    if (max_width.has_value() && text_width > float(*max_width)) {
+        auto horizontal_scale = float(*max_width) / text_width;
+        transform = Gfx::AffineTransform {}.scale({ horizontal_scale, 1 });
+        text_width *= horizontal_scale;
+    }
+
+    // Apply text align
+    // FIXME: CanvasTextAlign::Start and CanvasTextAlign::End currently do not nothing for right-to-left languages:
+    //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-textalign-start
+    // Default alignment of draw_text is left so do nothing by CanvasTextAlign::Start and CanvasTextAlign::Left
+    if (drawing_state.text_align == Bindings::CanvasTextAlign::Center) {
+        transform = Gfx::AffineTransform {}.set_translation({ -text_width / 2, 0 }).multiply(transform);
+    }
+    if (drawing_state.text_align == Bindings::CanvasTextAlign::End || drawing_state.text_align == Bindings::CanvasTextAlign::Right) {
+        transform = Gfx::AffineTransform {}.set_translation({ -text_width, 0 }).multiply(transform);
+    }
+
+    // Apply text baseline
+    // FIXME: Implement CanvasTextBaseline::Hanging, Bindings::CanvasTextAlign::Alphabetic and Bindings::CanvasTextAlign::Ideographic for real
+    //        right now they are just handled as textBaseline = top or bottom.
+    //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-textbaseline-hanging
+    // Default baseline of draw_text is top so do nothing by CanvasTextBaseline::Top and CanvasTextBaseline::Hanging
+    if (drawing_state.text_baseline == Bindings::CanvasTextBaseline::Middle) {
+        transform = Gfx::AffineTransform {}.set_translation({ 0, font.pixel_size() / 2 }).multiply(transform);
+    }
+    if (drawing_state.text_baseline == Bindings::CanvasTextBaseline::Top || drawing_state.text_baseline == Bindings::CanvasTextBaseline::Hanging) {
+        transform = Gfx::AffineTransform {}.set_translation({ 0, font.pixel_size() }).multiply(transform);
+    }
+
+    return path.copy_transformed(transform);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-filltext
+void OffscreenCanvasRenderingContext2D::fill_text(Utf16String const& text, float x, float y, Optional<double> max_width)
+{
+    if (!isfinite(x) || !isfinite(y) || (max_width.has_value() && !isfinite(max_width.value())))
+        return;
+
+    fill_internal(text_path(text, x, y, max_width), Gfx::WindingRule::Nonzero);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-stroketext
+void OffscreenCanvasRenderingContext2D::stroke_text(Utf16String const& text, float x, float y, Optional<double> max_width)
+{
+    if (!isfinite(x) || !isfinite(y) || (max_width.has_value() && !isfinite(max_width.value())))
+        return;
+
+    stroke_internal(text_path(text, x, y, max_width));
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-createimagedata
-WebIDL::ExceptionOr<GC::Ref<ImageData>> OffscreenCanvasRenderingContext2D::create_image_data(int, int, Optional<ImageDataSettings> const&) const
+WebIDL::ExceptionOr<GC::Ref<ImageData>> OffscreenCanvasRenderingContext2D::create_image_data(int width, int height, Optional<ImageDataSettings> const& settings) const
 {
-    return WebIDL::NotSupportedError::create(realm(), "(STUBBED) OffscreenCanvasRenderingContext2D::create_image_data(int, int)"_utf16);
+    // 1. If one or both of sw and sh are zero, then throw an "IndexSizeError" DOMException.
+    if (width == 0 || height == 0)
+        return WebIDL::IndexSizeError::create(realm(), "Width and height must not be zero"_utf16);
+
+    int abs_width = abs(width);
+    int abs_height = abs(height);
+
+    // 2. Let newImageData be a new ImageData object.
+    // 3. Initialize newImageData given the absolute magnitude of sw, the absolute magnitude of sh, settings set to settings, and defaultColorSpace set to this's color space.
+    auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
+
+    // 4. Initialize the image data of newImageData to transparent black.
+    // ... this is handled by ImageData::create()
+
+    // 5. Return newImageData.
+    return image_data;
 }
 
-WebIDL::ExceptionOr<GC::Ref<ImageData>> OffscreenCanvasRenderingContext2D::create_image_data(ImageData const&) const
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-createimagedata-imagedata
+WebIDL::ExceptionOr<GC::Ref<ImageData>> OffscreenCanvasRenderingContext2D::create_image_data(ImageData const& image_data) const
 {
-    return WebIDL::NotSupportedError::create(realm(), "(STUBBED) OffscreenCanvasRenderingContext2D::create_image_data(ImageData&)"_utf16);
+    // 1. Let newImageData be a new ImageData object.
+    // 2. Initialize newImageData given the value of imageData's width attribute, the value of imageData's height attribute, and defaultColorSpace set to the value of imageData's colorSpace attribute.
+    // FIXME: Set defaultColorSpace to the value of image_data's colorSpace attribute
+    // 3. Initialize the image data of newImageData to transparent black.
+    // NOTE: No-op, already done during creation.
+    // 4. Return newImageData.
+    return TRY(ImageData::create(realm(), image_data.width(), image_data.height()));
 }
 
-WebIDL::ExceptionOr<GC::Ptr<ImageData>> OffscreenCanvasRenderingContext2D::get_image_data(int, int, int, int, Optional<ImageDataSettings> const&) const
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-getimagedata
+WebIDL::ExceptionOr<GC::Ptr<ImageData>> OffscreenCanvasRenderingContext2D::get_image_data(int x, int y, int width, int height, Optional<ImageDataSettings> const& settings) const
 {
-    return WebIDL::NotSupportedError::create(realm(), "(STUBBED) OffscreenCanvasRenderingContext2D::get_image_data()"_utf16);
+    // 1. If either the sw or sh arguments are zero, then throw an "IndexSizeError" DOMException.
+    if (width == 0 || height == 0)
+        return WebIDL::IndexSizeError::create(realm(), "Width and height must not be zero"_utf16);
+
+    // 2. If the OffscreenCanvasRenderingContext2D's origin-clean flag is set to false, then throw a "SecurityError" DOMException.
+    if (!m_origin_clean)
+        return WebIDL::SecurityError::create(realm(), "OffscreenCanvasRenderingContext2D is not origin-clean"_utf16);
+
+    // ImageData initialization requires positive width and height
+    // https://html.spec.whatwg.org/multipage/canvas.html#initialize-an-imagedata-object
+    int abs_width = abs(width);
+    int abs_height = abs(height);
+
+    // 3. Let imageData be a new ImageData object.
+    // 4. Initialize imageData given sw, sh, settings set to settings, and defaultColorSpace set to this's color space.
+    auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
+
+    // NOTE: If the canvas has no bitmap, it's like copying only transparent black pixels (which is a no-op).
+    auto bitmap = canvas_element().bitmap();
+    if (!bitmap)
+        return image_data;
+    auto const snapshot = Gfx::ImmutableBitmap::create(bitmap.release_nonnull());
+
+    // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
+    auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
+
+    // NOTE: The spec doesn't seem to define this behavior, but MDN does and the WPT tests
+    // assume it works this way.
+    // https://developer.mozilla.org/en-US/docs/Web/API/CanvasRenderingContext2D/getImageData#sw
+    if (width < 0 || height < 0) {
+        source_rect = source_rect.translated(min(width, 0), min(height, 0));
+    }
+    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
+
+    // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
+    // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
+    //       might result in a loss of precision, but is according to spec.
+    //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
+    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
+
+    // NOTE: Map the readable part of the source rectangle to the same position within imageData, leaving areas
+    //       outside the bitmap transparent black rather than stretching the readable part over them.
+    auto destination_rect = source_rect_intersected.translated(-source_rect.location());
+
+    auto painter = Gfx::Painter::create(image_data->bitmap());
+    painter->draw_bitmap(destination_rect.to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+
+    // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
+    // NOTE: No-op, already done during creation.
+
+    // 8. Return imageData.
+    return image_data;
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_image_data(ImageData&, float, float)
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata-short
+WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_image_data(ImageData& image_data, float dx, float dy)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::put_image_data()");
+    // The putImageData(imageData, dx, dy) method steps are to put pixels from an ImageData onto a bitmap,
+    // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
+    if (auto* painter = this->painter())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, dx, dy, 0, 0, image_data.width(), image_data.height()));
+
     return {};
 }
 
-WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_image_data(ImageData&, float, float, float, float, float, float)
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata
+WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_image_data(ImageData& image_data, float x, float y, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::put_image_data()");
+    // The putImageData(imageData, dx, dy, dirtyX, dirtyY, dirtyWidth, dirtyHeight) method steps are to put pixels
+    // from an ImageData onto a bitmap, given imageData, this's output bitmap, dx, dy, dirtyX, dirtyY, dirtyWidth, and
+    // dirtyHeight.
+    if (auto* painter = this->painter())
+        TRY(put_pixels_from_an_image_data_onto_a_bitmap(image_data, *painter, x, y, dirty_x, dirty_y, dirty_width, dirty_height));
+
     return {};
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
+WebIDL::ExceptionOr<void> OffscreenCanvasRenderingContext2D::put_pixels_from_an_image_data_onto_a_bitmap(ImageData& image_data, Gfx::Painter& painter, float dx, float dy, float dirty_x, float dirty_y, float dirty_width, float dirty_height)
+{
+    // 1. Let buffer be imageData's data attribute value's [[ViewedArrayBuffer]] internal slot.
+    auto* buffer = image_data.data()->viewed_array_buffer();
+
+    // 2. If IsDetachedBuffer(buffer) is true, then throw an "InvalidStateError" DOMException
+    if (buffer->is_detached())
+        return WebIDL::InvalidStateError::create(image_data.realm(), "ImageData's underlying buffer is detached"_utf16);
+
+    // 3. If dirtyWidth is negative, then let dirtyX be dirtyX+dirtyWidth, and let dirtyWidth be equal to the
+    //    absolute magnitude of dirtyWidth.
+    if (dirty_width < 0) {
+        dirty_x += dirty_width;
+        dirty_width = abs(dirty_width);
+    }
+    // If dirtyHeight is negative, then let dirtyY be dirtyY+dirtyHeight, and let dirtyHeight be equal to the absolute
+    // magnitude of dirtyHeight.
+    if (dirty_height < 0) {
+        dirty_y += dirty_height;
+        dirty_height = abs(dirty_height);
+    }
+
+    // 4. If dirtyX is negative, then let dirtyWidth be dirtyWidth+dirtyX, and let dirtyX be 0.
+    if (dirty_x < 0) {
+        dirty_width += dirty_x;
+        dirty_x = 0;
+    }
+
+    // If dirtyY is negative, then let dirtyHeight be dirtyHeight+dirtyY, and let dirtyY be 0.
+    if (dirty_y < 0) {
+        dirty_height += dirty_y;
+        dirty_y = 0;
+    }
+
+    // 5. If dirtyX+dirtyWidth is greater than the width attribute of the imageData argument, then let dirtyWidth be
+    //    the value of that width attribute, minus the value of dirtyX.
+    if (dirty_x + dirty_width > image_data.width()) {
+        dirty_width = image_data.width() - dirty_x;
+    }
+    // If dirtyY+dirtyHeight is greater than the height attribute of the imageData argument, then let dirtyHeight be
+    // the value of that height attribute, minus the value of dirtyY.
+    if (dirty_y + dirty_height > image_data.height()) {
+        dirty_height = image_data.height() - dirty_y;
+    }
+
+    // 6. If, after those changes, either dirtyWidth or dirtyHeight are negative or zero, then return without affecting
+    //    any bitmaps.
+    if (dirty_width <= 0 || dirty_height <= 0)
+        return {};
+
+    // 7. For all integer values of x and y where dirtyX ≤ x < dirtyX+dirtyWidth and dirtyY ≤ y < dirtyY+dirtyHeight,
+    //    set the pixel with coordinate (dx+x, dy+y) in bitmap to the color of the pixel at coordinate (x, y) in the
+    //    imageData data structure's bitmap, converted from imageData's colorSpace to the color space of bitmap using
+    //    'relative-colorimetric' rendering intent.
+    auto dst_rect = Gfx::FloatRect { dx + dirty_x, dy + dirty_y, dirty_width, dirty_height };
+    painter.save();
+    painter.set_transform({});
+    painter.draw_bitmap(
+        dst_rect,
+        Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
+        Gfx::IntRect { dirty_x, dirty_y, dirty_width, dirty_height },
+        Gfx::ScalingMode::NearestNeighbor,
+        {},
+        1.0f,
+        Gfx::CompositingAndBlendingOperator::SourceOver);
+    painter.restore();
+
+    did_draw(dst_rect);
+
+    return {};
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
 void OffscreenCanvasRenderingContext2D::reset_to_default_state()
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::reset_to_default_state()");
+    auto* painter = this->painter();
+
+    // 1. Clear canvas's bitmap to transparent black.
+    if (painter) {
+        painter->clear_rect(m_surface->rect().to_type<float>(), clear_color());
+    }
+
+    // 2. Empty the list of subpaths in context's current default path.
+    path().clear();
+
+    // 3. Clear the context's drawing state stack.
+    clear_drawing_state_stack();
+
+    // 4. Reset everything that drawing state consists of to their initial values.
+    reset_drawing_state();
+
+    if (painter) {
+        painter->reset();
+        did_draw(m_surface->rect().to_type<float>());
+    }
 }
 
 GC::Ref<TextMetrics> OffscreenCanvasRenderingContext2D::measure_text(Utf16String const&)
@@ -181,26 +646,41 @@ GC::Ref<TextMetrics> OffscreenCanvasRenderingContext2D::measure_text(Utf16String
     return metrics;
 }
 
-void OffscreenCanvasRenderingContext2D::clip(StringView)
+void OffscreenCanvasRenderingContext2D::clip_internal(Gfx::Path& path, Gfx::WindingRule winding_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::clip(StringView)");
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    painter->clip(path, winding_rule);
+}
+
+void OffscreenCanvasRenderingContext2D::clip(StringView fill_rule)
+{
+    clip_internal(path(), parse_fill_rule(fill_rule));
 }
 
-void OffscreenCanvasRenderingContext2D::clip(Path2D&, StringView)
+void OffscreenCanvasRenderingContext2D::clip(Path2D& path, StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::clip(Path2D&, StringView)");
+    clip_internal(path.path(), parse_fill_rule(fill_rule));
 }
 
-bool OffscreenCanvasRenderingContext2D::is_point_in_path(double, double, StringView)
+static bool is_point_in_path_internal(Gfx::Path path, Gfx::AffineTransform const& transform, double x, double y, StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::is_point_in_path(double, double, StringView)");
-    return false;
+    auto point = Gfx::FloatPoint(x, y);
+    if (auto inverse_transform = transform.inverse(); inverse_transform.has_value())
+        point = inverse_transform->map(point);
+    return path.contains(point, parse_fill_rule(fill_rule));
 }
 
-bool OffscreenCanvasRenderingContext2D::is_point_in_path(Path2D const&, double, double, StringView)
+bool OffscreenCanvasRenderingContext2D::is_point_in_path(double x, double y, StringView fill_rule)
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::clip(Path2D const&, double, double, StringView)");
-    return false;
+    return is_point_in_path_internal(path(), drawing_state().transform, x, y, fill_rule);
+}
+
+bool OffscreenCanvasRenderingContext2D::is_point_in_path(Path2D const& path, double x, double y, StringView fill_rule)
+{
+    return is_point_in_path_internal(path.path(), drawing_state().transform, x, y, fill_rule);
 }
 
 bool OffscreenCanvasRenderingContext2D::image_smoothing_enabled() const
@@ -305,6 +785,73 @@ void OffscreenCanvasRenderingContext2D::set_shadow_color(String color)
     }
 }
 
+void OffscreenCanvasRenderingContext2D::paint_shadow_for_fill_internal(Gfx::Path const& path, Gfx::WindingRule winding_rule)
+{
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = this->drawing_state();
+    if (state.shadow_blur == 0.0f && state.shadow_offset_x == 0.0f && state.shadow_offset_y == 0.0f)
+        return;
+
+    if (state.current_compositing_and_blending_operator == Gfx::CompositingAndBlendingOperator::Copy)
+        return;
+
+    auto alpha = state.global_alpha * (state.shadow_color.alpha() / 255.0f);
+    auto fill_style_color = state.fill_style.as_color();
+    if (fill_style_color.has_value() && fill_style_color->alpha() > 0)
+        alpha = (fill_style_color->alpha() / 255.0f) * state.global_alpha;
+    if (alpha == 0.0f)
+        return;
+
+    painter->save();
+
+    Gfx::AffineTransform transform;
+    transform.translate(state.shadow_offset_x, state.shadow_offset_y);
+    transform.multiply(state.transform);
+    painter->set_transform(transform);
+    painter->fill_path(path, state.shadow_color.with_opacity(alpha), winding_rule, state.shadow_blur, state.current_compositing_and_blending_operator);
+
+    painter->restore();
+
+    did_draw(path.bounding_box());
+}
+
+void OffscreenCanvasRenderingContext2D::paint_shadow_for_stroke_internal(Gfx::Path const& path, Gfx::Path::CapStyle line_cap, Gfx::Path::JoinStyle line_join, Vector<float> const& dash_array)
+{
+    auto* painter = this->painter();
+    if (!painter)
+        return;
+
+    auto& state = drawing_state();
+
+    if (state.current_compositing_and_blending_operator == Gfx::CompositingAndBlendingOperator::Copy)
+        return;
+
+    if (state.shadow_blur == 0.0f && state.shadow_offset_x == 0.0f && state.shadow_offset_y == 0.0f)
+        return;
+
+    auto alpha = state.global_alpha * (state.shadow_color.alpha() / 255.0f);
+    auto fill_style_color = state.fill_style.as_color();
+    if (fill_style_color.has_value() && fill_style_color->alpha() > 0)
+        alpha = (fill_style_color->alpha() / 255.0f) * state.global_alpha;
+    if (alpha == 0.0f)
+        return;
+
+    painter->save();
+
+    Gfx::AffineTransform transform;
+    transform.translate(state.shadow_offset_x, state.shadow_offset_y);
+    transform.multiply(state.transform);
+    painter->set_transform(transform);
+    painter->stroke_path(path, state.shadow_color.with_opacity(alpha), state.line_width, state.shadow_blur, state.current_compositing_and_blending_operator, line_cap, line_join, state.miter_limit, dash_array, state.line_dash_offset);
+
+    painter->restore();
+
+    did_draw(path.bounding_box());
+}
+
 float OffscreenCanvasRenderingContext2D::global_alpha() const
 {
     return drawing_state().global_alpha;
@@ -321,22 +868,66 @@ void OffscreenCanvasRenderingContext2D::set_global_alpha(float alpha)
     drawing_state().global_alpha = alpha;
 }
 
+#define ENUMERATE_COMPOSITE_OPERATIONS(E)  \
+    E("normal", Normal)                    \
+    E("multiply", Multiply)                \
+    E("screen", Screen)                    \
+    E("overlay", Overlay)                  \
+    E("darken", Darken)                    \
+    E("lighten", Lighten)                  \
+    E("color-dodge", ColorDodge)           \
+    E("color-burn", ColorBurn)             \
+    E("hard-light", HardLight)             \
+    E("soft-light", SoftLight)             \
+    E("difference", Difference)            \
+    E("exclusion", Exclusion)              \
+    E("hue", Hue)                          \
+    E("saturation", Saturation)            \
+    E("color", Color)                      \
+    E("luminosity", Luminosity)            \
+    E("clear", Clear)                      \
+    E("copy", Copy)                        \
+    E("source-over", SourceOver)           \
+    E("destination-over", DestinationOver) \
+    E("source-in", SourceIn)               \
+    E("destination-in", DestinationIn)     \
+    E("source-out", SourceOut)             \
+    E("destination-out", DestinationOut)   \
+    E("source-atop", SourceATop)           \
+    E("destination-atop", DestinationATop) \
+    E("xor", Xor)                          \
+    E("lighter", Lighter)                  \
+    E("plus-darker", PlusDarker)           \
+    E("plus-lighter", PlusLighter)
+
 String OffscreenCanvasRenderingContext2D::global_composite_operation() const
 {
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::global_composite_operation()");
-    return String::from_utf8_without_validation(""sv.bytes());
+    auto current_compositing_and_blending_operator = drawing_state().current_compositing_and_blending_operator;
+    switch (current_compositing_and_blending_operator) {
+#undef __ENUMERATE
+#define __ENUMERATE(operation, compositing_and_blending_operator)                \
+    case Gfx::CompositingAndBlendingOperator::compositing_and_blending_operator: \
+        return operation##_string;
+        ENUMERATE_COMPOSITE_OPERATIONS(__ENUMERATE)
+#undef __ENUMERATE
+    default:
+        VERIFY_NOT_REACHED();
+    }
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-globalcompositeoperation
-void OffscreenCanvasRenderingContext2D::set_global_composite_operation(String)
-{
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::set_global_composite_operation()");
-}
-
-[[nodiscard]] Gfx::Painter* OffscreenCanvasRenderingContext2D::painter()
-{
-    dbgln("(STUBBED) OffscreenCanvasRenderingContext2D::painter()");
-    return nullptr;
+void OffscreenCanvasRenderingContext2D::set_global_composite_operation(String global_composite_operation)
+{
+    // 1. If the given value is not identical to any of the values that the <blend-mode> or the <composite-mode> properties are defined to take, then return.
+    // 2. Otherwise, set this's current compositing and blending operator to the given value.
+#undef __ENUMERATE
+#define __ENUMERATE(operation, compositing_and_blending_operator)                                                                           \
+    if (global_composite_operation == operation##sv) {                                                                                      \
+        drawing_state().current_compositing_and_blending_operator = Gfx::CompositingAndBlendingOperator::compositing_and_blending_operator; \
+        return;                                                                                                                             \
+    }
+    ENUMERATE_COMPOSITE_OPERATIONS(__ENUMERATE)
+#undef __ENUMERATE
 }
 
 }
@@ -38,6 +38,7 @@
 #include <LibWeb/HTML/HTMLTemplateElement.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
@@ -3316,6 +3317,10 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 5. If the parser's Document has a style sheet that is blocking scripts
                     //    or the script's ready to be parser-executed is false:
                     if (m_document->has_a_style_sheet_that_is_blocking_scripts() || the_script->is_ready_to_be_parser_executed() == false) {
+                        // OPTIMIZATION: While we wait for the script, speculatively scan the rest of the input and
+                        //               start fetching resources it references.
+                        scan_for_speculative_preloads(*m_document, m_tokenizer.remaining_unconsumed_input());
+
                         // spin the event loop until the parser's Document has no style sheet that is blocking scripts
                         // and the script's ready to be parser-executed becomes true.
                         main_thread_event_loop().spin_until(GC::create_function(heap(), [&] {
@@ -5014,7 +5019,19 @@ DOM::Document& HTMLParser::document()
 WebIDL::ExceptionOr<Vector<GC::Root<DOM::Node>>> HTMLParser::parse_html_fragment(DOM::Element& context_element, StringView markup, AllowDeclarativeShadowRoots allow_declarative_shadow_roots)
 {
     // 1. Let document be a Document node whose type is "html".
-    auto temp_document = DOM::Document::create_for_fragment_parsing(context_element.realm());
+    // OPTIMIZATION: Creating a document is expensive, so we reuse the temporary document from the
+    //               previous fragment parse if the context element's document has one cached. The
+    //               cache entry is taken out while we parse, so a reentrant fragment parse simply
+    //               creates (and afterwards caches) its own document.
+    auto temp_document = [&]() -> GC::Ref<DOM::Document> {
+        if (auto cached_document = context_element.document().take_cached_document_for_fragment_parsing({})) {
+            cached_document->remove_all_children();
+            cached_document->set_quirks_mode(DOM::QuirksMode::No);
+            cached_document->set_allow_declarative_shadow_roots(false);
+            return *cached_document;
+        }
+        return DOM::Document::create_for_fragment_parsing(context_element.realm());
+    }();
     temp_document->set_document_type(DOM::Document::Type::HTML);
 
     // AD-HOC: We set the about base URL of the document to the same as the context element's document.
@@ -5111,6 +5128,9 @@ WebIDL::ExceptionOr<Vector<GC::Root<DOM::Node>>> HTMLParser::parse_html_fragment
         context_element.document().adopt_node(*child);
         children.append(GC::make_root(*child));
     }
+
+    context_element.document().set_cached_document_for_fragment_parsing({}, temp_document);
+
     return children;
 }
 
@@ -5139,30 +5159,51 @@ enum class AttributeMode {
 };
 
 template<OneOf<Utf8View, Utf16View> ViewType>
-static String escape_string(ViewType const& string, AttributeMode attribute_mode)
+static void append_escaped_string(StringBuilder& builder, ViewType const& string, AttributeMode attribute_mode)
 {
     // https://html.spec.whatwg.org/multipage/parsing.html#escapingString
-    StringBuilder builder;
-    for (auto code_point : string) {
+    // OPTIMIZATION: Write straight into the caller's builder, so serializing doesn't allocate a
+    //               temporary string for every attribute value and text node, and append runs of
+    //               code points that need no escaping in one go instead of one at a time.
+    auto offset_of = [&](auto const& iterator) {
+        if constexpr (IsSame<ViewType, Utf8View>)
+            return string.byte_offset_of(iterator);
+        else
+            return string.iterator_offset(iterator);
+    };
+
+    size_t run_start = 0;
+    for (auto iterator = string.begin(); iterator != string.end(); ++iterator) {
+        StringView replacement;
+
         // 1. Replace any occurrence of the "&" character by the string "&amp;".
-        if (code_point == '&')
-            builder.append("&amp;"sv);
+        if (*iterator == '&')
+            replacement = "&amp;"sv;
         // 2. Replace any occurrences of the U+00A0 NO-BREAK SPACE character by the string "&nbsp;".
-        else if (code_point == 0xA0)
-            builder.append("&nbsp;"sv);
+        else if (*iterator == 0xA0)
+            replacement = "&nbsp;"sv;
         // 3. Replace any occurrences of the "<" character by the string "&lt;".
-        else if (code_point == '<')
-            builder.append("&lt;"sv);
+        else if (*iterator == '<')
+            replacement = "&lt;"sv;
         // 4. Replace any occurrences of the ">" character by the string "&gt;".
-        else if (code_point == '>')
-            builder.append("&gt;"sv);
+        else if (*iterator == '>')
+            replacement = "&gt;"sv;
         // 5. If the algorithm was invoked in the attribute mode, then replace any occurrences of the """ character by the string "&quot;".
-        else if (code_point == '"' && attribute_mode == AttributeMode::Yes)
-            builder.append("&quot;"sv);
+        else if (*iterator == '"' && attribute_mode == AttributeMode::Yes)
+            replacement = "&quot;"sv;
         else
-            builder.append_code_point(code_point);
+            continue;
+
+        auto run_end = offset_of(iterator);
+        if (run_end > run_start)
+            builder.append(string.substring_view(run_start, run_end - run_start));
+        builder.append(replacement);
+
+        auto next_iterator = iterator;
+        ++next_iterator;
+        run_start = offset_of(next_iterator);
     }
-    return builder.to_string_without_validation();
+    builder.append(string.substring_view(run_start));
 }
 
 // https://html.spec.whatwg.org/multipage/parsing.html#html-fragment-serialisation-algorithm
@@ -5195,7 +5236,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
         // followed by a U+0022 QUOTATION MARK character (").
         if (element.is_value().has_value() && !element.has_attribute(AttributeNames::is)) {
             builder.append(" is=\""sv);
-            builder.append(escape_string(element.is_value().value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, element.is_value().value().code_points(), AttributeMode::Yes);
             builder.append('"');
         }
 
@@ -5245,7 +5286,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             builder.append("=\""sv);
-            builder.append(escape_string(attribute.value().code_points(), AttributeMode::Yes));
+            append_escaped_string(builder, attribute.value().code_points(), AttributeMode::Yes);
             builder.append('"');
         });
 
@@ -5368,7 +5409,7 @@ String HTMLParser::serialize_html_fragment(DOM::Node const& node, SerializableSh
             }
 
             // Otherwise, append the value of current node's data IDL attribute, escaped as described below.
-            builder.append(escape_string(text_node.data().utf16_view(), AttributeMode::No));
+            append_escaped_string(builder, text_node.data().utf16_view(), AttributeMode::No);
         }
 
         if (is<DOM::Comment>(current_node)) {
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/TagNames.h>
+
+namespace Web::HTML {
+
+static void start_speculative_fetch(DOM::Document& document, StringView url_string, Fetch::Infrastructure::Request::Destination destination, Optional<String> const& crossorigin)
+{
+    auto url = document.encoding_parse_url(url_string);
+    if (!url.has_value())
+        return;
+
+    // Speculative fetches are only worthwhile (and safe to fire blindly) for network resources.
+    if (!url->scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    // Build the same potential-CORS request the element would once the parser reaches it, and run
+    // it through the full fetch algorithm, so Content Security Policy and mixed content blocking
+    // apply to the speculative load exactly as they would to the load it anticipates.
+    auto request = create_potential_CORS_request(document.vm(), url.release_value(), destination, cors_setting_attribute_from_keyword(crossorigin));
+    request->set_client(&document.relevant_settings_object());
+
+    // Speculative work shouldn't compete with resources the current page actually needs.
+    request->set_priority(Fetch::Infrastructure::Request::Priority::Low);
+
+    (void)Fetch::Fetching::fetch(document.realm(), request, Fetch::Infrastructure::FetchAlgorithms::create(document.vm(), {}));
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#link-type-preload
+static Optional<Fetch::Infrastructure::Request::Destination> translate_preload_destination(Optional<String> const& as_value)
+{
+    if (!as_value.has_value())
+        return {};
+    auto as = as_value->to_ascii_lowercase();
+    if (as == "font"sv)
+        return Fetch::Infrastructure::Request::Destination::Font;
+    if (as == "image"sv)
+        return Fetch::Infrastructure::Request::Destination::Image;
+    if (as == "script"sv)
+        return Fetch::Infrastructure::Request::Destination::Script;
+    if (as == "style"sv)
+        return Fetch::Infrastructure::Request::Destination::Style;
+    if (as == "track"sv)
+        return Fetch::Infrastructure::Request::Destination::Track;
+    return {};
+}
+
+void scan_for_speculative_preloads(DOM::Document& document, StringView remaining_input)
+{
+    HTMLTokenizer tokenizer { remaining_input, "utf-8" };
+
+    while (true) {
+        auto token = tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+        auto crossorigin = token->attribute(AttributeNames::crossorigin);
+
+        if (tag_name == TagNames::img || tag_name == TagNames::script) {
+            auto destination = tag_name == TagNames::img
+                ? Fetch::Infrastructure::Request::Destination::Image
+                : Fetch::Infrastructure::Request::Destination::Script;
+            if (auto src = token->attribute(AttributeNames::src); src.has_value() && !src->is_empty())
+                start_speculative_fetch(document, *src, destination, crossorigin);
+        } else if (tag_name == TagNames::link) {
+            // Only fetch link relationships that name a concrete resource we know the document will
+            // want, with the destination the link itself would use so the right CSP directive applies.
+            Optional<Fetch::Infrastructure::Request::Destination> destination;
+            if (auto rel = token->attribute(AttributeNames::rel); rel.has_value()) {
+                rel->bytes_as_string_view().for_each_split_view(' ', SplitBehavior::Nothing, [&](StringView part) {
+                    if (part.equals_ignoring_ascii_case("stylesheet"sv))
+                        destination = Fetch::Infrastructure::Request::Destination::Style;
+                    else if (part.equals_ignoring_ascii_case("modulepreload"sv))
+                        destination = Fetch::Infrastructure::Request::Destination::Script;
+                    else if (part.equals_ignoring_ascii_case("preload"sv))
+                        destination = translate_preload_destination(token->attribute(AttributeNames::as));
+                });
+            }
+            if (destination.has_value()) {
+                if (auto href = token->attribute(AttributeNames::href); href.has_value() && !href->is_empty())
+                    start_speculative_fetch(document, *href, *destination, crossorigin);
+            }
+        }
+
+        // There is no tree builder driving this tokenizer, so we have to switch it in and out of
+        // the raw text states ourselves. Otherwise, script and style payloads would be misread as
+        // markup and we'd fetch garbage.
+        if (tag_name == TagNames::script)
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes))
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+        else if (tag_name.is_one_of(TagNames::title, TagNames::textarea))
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+    }
+}
+
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StringView.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// A simplified speculative scan of input the parser hasn't consumed yet. While the parser is
+// blocked waiting for a script, this tokenizes the remaining input and starts fetches for
+// resources it discovers, so they're already in flight (or cached) once parsing resumes.
+void scan_for_speculative_preloads(DOM::Document&, StringView remaining_input);
+
+}
@@ -154,12 +154,17 @@ namespace Web::HTML {
         return m_queued_tokens.dequeue();               \
     } while (0)
 
-#define EMIT_CHARACTER(code_point)                      \
-    do {                                                \
-        create_new_token(HTMLToken::Type::Character);   \
-        m_current_token.set_code_point(code_point);     \
-        m_queued_tokens.enqueue(move(m_current_token)); \
-        return m_queued_tokens.dequeue();               \
+// OPTIMIZATION: Hand the token straight back to the caller when nothing else is queued, instead of
+//               bouncing every character token through the queue. Text runs emit one token per code
+//               point, so this is by far the hottest emission path on large pages.
+#define EMIT_CHARACTER(code_point)                          \
+    do {                                                    \
+        create_new_token(HTMLToken::Type::Character);       \
+        m_current_token.set_code_point(code_point);         \
+        if (m_queued_tokens.is_empty()) [[likely]]          \
+            return move(m_current_token);                   \
+        m_queued_tokens.enqueue(move(m_current_token));     \
+        return m_queued_tokens.dequeue();                   \
     } while (0)
 
 #define EMIT_CURRENT_CHARACTER \
@@ -273,6 +278,23 @@ _StartOfFunction:
     if (m_aborted)
         return {};
 
+    // OPTIMIZATION: The text-bearing states all emit plain code points unchanged, and the vast
+    //               majority of input is exactly that. Emit those without dispatching through the
+    //               state machine or the CR/LF normalization peeks. Anything special ('<', '&',
+    //               NUL, or a carriage return) falls through to the full state machine below.
+    if (m_state == State::Data || m_state == State::RCDATA || m_state == State::RAWTEXT || m_state == State::ScriptData) {
+        if (!(stop_at_insertion_point == StopAtInsertionPoint::Yes && is_insertion_point_reached())
+            && m_current_offset < static_cast<ssize_t>(m_decoded_input.size())) {
+            auto code_point = m_decoded_input[m_current_offset];
+            if (code_point != '<' && code_point != '&' && code_point != 0 && code_point != '\r') {
+                skip(1);
+                create_new_token(HTMLToken::Type::Character);
+                m_current_token.set_code_point(code_point);
+                return move(m_current_token);
+            }
+        }
+    }
+
     for (;;) {
         if (stop_at_insertion_point == StopAtInsertionPoint::Yes && is_insertion_point_reached())
             return {};
@@ -1293,7 +1315,7 @@ _StartOfFunction:
             {
                 ON('"')
                 {
-                    m_current_token.last_attribute().value = consume_current_builder();
+                    m_current_token.last_attribute().value = consume_current_builder_as_attribute_value();
                     SWITCH_TO(AfterAttributeValueQuoted);
                 }
                 ON('&')
@@ -1325,7 +1347,7 @@ _StartOfFunction:
             {
                 ON('\'')
                 {
-                    m_current_token.last_attribute().value = consume_current_builder();
+                    m_current_token.last_attribute().value = consume_current_builder_as_attribute_value();
                     SWITCH_TO(AfterAttributeValueQuoted);
                 }
                 ON('&')
@@ -1357,7 +1379,7 @@ _StartOfFunction:
             {
                 ON_WHITESPACE
                 {
-                    m_current_token.last_attribute().value = consume_current_builder();
+                    m_current_token.last_attribute().value = consume_current_builder_as_attribute_value();
                     m_current_token.last_attribute().value_end_position = nth_last_position(1);
                     SWITCH_TO(BeforeAttributeName);
                 }
@@ -1368,7 +1390,7 @@ _StartOfFunction:
                 }
                 ON('>')
                 {
-                    m_current_token.last_attribute().value = consume_current_builder();
+                    m_current_token.last_attribute().value = consume_current_builder_as_attribute_value();
                     m_current_token.last_attribute().value_end_position = nth_last_position(1);
                     SWITCH_TO_AND_EMIT_CURRENT_TOKEN(Data);
                 }
@@ -2911,26 +2933,46 @@ void HTMLTokenizer::parser_did_run(Badge<HTMLParser>)
 
 void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
 {
-    Vector<u32> new_decoded_input;
-    new_decoded_input.ensure_capacity(m_decoded_input.size() + input.length());
-
-    auto before = m_decoded_input.span().slice(0, *m_insertion_point);
-    new_decoded_input.append(before.data(), before.size());
-
     auto utf8_to_insert = MUST(String::from_utf8(input));
     ssize_t code_points_inserted = 0;
-    for (auto code_point : utf8_to_insert.code_points()) {
-        new_decoded_input.append(code_point);
-        ++code_points_inserted;
-    }
 
-    auto after = m_decoded_input.span().slice(*m_insertion_point);
-    new_decoded_input.append(after.data(), after.size());
-    m_decoded_input = move(new_decoded_input);
+    // OPTIMIZATION: document.write() usually inserts at the end of the current input, in which
+    //               case the new code points can be appended in place. Rebuilding the buffer on
+    //               every call made a long series of small writes quadratic.
+    if (*m_insertion_point == static_cast<ssize_t>(m_decoded_input.size())) {
+        m_decoded_input.ensure_capacity(m_decoded_input.size() + input.length());
+        for (auto code_point : utf8_to_insert.code_points()) {
+            m_decoded_input.append(code_point);
+            ++code_points_inserted;
+        }
+    } else {
+        Vector<u32> new_decoded_input;
+        new_decoded_input.ensure_capacity(m_decoded_input.size() + input.length());
+
+        auto before = m_decoded_input.span().slice(0, *m_insertion_point);
+        new_decoded_input.append(before.data(), before.size());
+
+        for (auto code_point : utf8_to_insert.code_points()) {
+            new_decoded_input.append(code_point);
+            ++code_points_inserted;
+        }
+
+        auto after = m_decoded_input.span().slice(*m_insertion_point);
+        new_decoded_input.append(after.data(), after.size());
+        m_decoded_input = move(new_decoded_input);
+    }
 
     m_insertion_point.value() += code_points_inserted;
 }
 
+String HTMLTokenizer::remaining_unconsumed_input() const
+{
+    StringBuilder builder;
+    for (size_t i = max<ssize_t>(m_current_offset, 0); i < m_decoded_input.size(); ++i)
+        builder.append_code_point(m_decoded_input[i]);
+    return builder.to_string_without_validation();
+}
+
 void HTMLTokenizer::insert_eof()
 {
     m_explicit_eof_inserted = true;
@@ -3004,4 +3046,25 @@ String HTMLTokenizer::consume_current_builder()
     return string;
 }
 
+String HTMLTokenizer::consume_current_builder_as_attribute_value()
+{
+    auto string = consume_current_builder();
+
+    // OPTIMIZATION: Documents tend to repeat the same attribute values over and over (class lists,
+    //               input types, ARIA states, and so on), and every repetition would otherwise keep
+    //               its own heap buffer alive in the DOM. Hand out the buffer of the first occurrence
+    //               instead. Short strings are stored inline and have nothing to share, and the cache
+    //               is capped so a document full of unique values cannot grow it without bound.
+    if (string.is_short_string())
+        return string;
+
+    if (auto existing = m_deduplicated_attribute_values.find(string); existing != m_deduplicated_attribute_values.end())
+        return *existing;
+
+    constexpr size_t maximum_deduplicated_attribute_values = 4096;
+    if (m_deduplicated_attribute_values.size() < maximum_deduplicated_attribute_values)
+        m_deduplicated_attribute_values.set(string);
+    return string;
+}
+
 }
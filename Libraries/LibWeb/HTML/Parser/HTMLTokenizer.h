@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/HashTable.h>
 #include <AK/Queue.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
@@ -142,6 +143,9 @@ public:
     void restore_insertion_point() { m_insertion_point = move(m_old_insertion_point); }
     void update_insertion_point() { m_insertion_point = m_current_offset; }
 
+    // Returns the part of the input that hasn't been consumed yet, for the speculative preload scanner.
+    String remaining_unconsumed_input() const;
+
     // This permanently cuts off the tokenizer input stream.
     void abort() { m_aborted = true; }
 
@@ -162,6 +166,7 @@ private:
     void create_new_token(HTMLToken::Type);
     bool current_end_tag_token_is_appropriate() const;
     String consume_current_builder();
+    String consume_current_builder_as_attribute_value();
 
     static char const* state_name(State state)
     {
@@ -203,6 +208,9 @@ private:
     HTMLToken m_current_token;
     StringBuilder m_current_builder;
 
+    // Repeated attribute values share the buffer of their first occurrence, see consume_current_builder_as_attribute_value().
+    HashTable<String> m_deduplicated_attribute_values;
+
     NamedCharacterReferenceMatcher m_named_character_reference_matcher;
 
     Optional<FlyString> m_last_emitted_start_tag_name;
@@ -5,7 +5,9 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/HashMap.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
@@ -18,6 +20,26 @@ namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(ClassicScript);
 
+// OPTIMIZATION: Parsing large scripts is expensive, so we keep a process-wide cache of parsed
+//               programs. Loading the same script into multiple documents, or revisiting a page
+//               whose documents still share this process, then skips the parser entirely.
+//               The AST is realm-independent (state lazily attached to it during execution is
+//               derived from the source alone), so sharing it between scripts is safe.
+struct CachedScriptProgram {
+    String source;
+    ByteString filename;
+    size_t source_line_number { 0 };
+    NonnullRefPtr<JS::Program const> program;
+};
+
+static HashMap<u32, Vector<CachedScriptProgram>>& cached_script_programs()
+{
+    static HashMap<u32, Vector<CachedScriptProgram>> cache;
+    return cache;
+}
+
+static constexpr size_t max_cached_script_programs = 256;
+
 // https://html.spec.whatwg.org/multipage/webappapis.html#creating-a-classic-script
 // https://whatpr.org/html/9893/webappapis.html#creating-a-classic-script
 GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView source, JS::Realm& realm, URL::URL base_url, size_t source_line_number, MutedErrors muted_errors)
@@ -49,6 +71,19 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
     // FIXME: 9. Record classic script creation time given script and sourceURLForWindowScripts .
 
     // 10. Let result be ParseScript(source, realm, script).
+    auto source_hash = source.hash();
+    if (auto it = cached_script_programs().find(source_hash); it != cached_script_programs().end()) {
+        for (auto const& entry : it->value) {
+            if (entry.source == source && entry.filename == script->filename() && entry.source_line_number == source_line_number) {
+                // 12. Set script's record to result.
+                script->m_script_record = JS::Script::create(entry.program, realm, script->filename(), script);
+
+                // 13. Return script.
+                return script;
+            }
+        }
+    }
+
     auto parse_timer = Core::ElapsedTimer::start_new();
     auto result = JS::Script::parse(source, realm, script->filename(), script, source_line_number);
     dbgln_if(HTML_SCRIPT_DEBUG, "ClassicScript: Parsed {} in {}ms", script->filename(), parse_timer.elapsed_milliseconds());
@@ -67,7 +102,12 @@ GC::Ref<ClassicScript> ClassicScript::create(ByteString filename, StringView sou
     }
 
     // 12. Set script's record to result.
-    script->m_script_record = *result.release_value();
+    auto script_record = result.release_value();
+    script->m_script_record = *script_record;
+
+    if (cached_script_programs().size() >= max_cached_script_programs)
+        cached_script_programs().clear();
+    cached_script_programs().ensure(source_hash).append({ MUST(String::from_utf8(source)), script->filename(), source_line_number, script_record->parse_node() });
 
     // 13. Return script.
     return script;
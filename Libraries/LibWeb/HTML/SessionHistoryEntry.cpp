@@ -23,16 +23,21 @@ void SessionHistoryEntry::visit_edges(Cell::Visitor& visitor)
 }
 
 SessionHistoryEntry::SessionHistoryEntry()
-    : m_classic_history_api_state(MUST(structured_serialize_for_storage(vm(), JS::js_null())))
-    , m_navigation_api_state(MUST(structured_serialize_for_storage(vm(), JS::js_undefined())))
-    , m_navigation_api_key(MUST(Crypto::generate_random_uuid()))
+    : m_navigation_api_key(MUST(Crypto::generate_random_uuid()))
     , m_navigation_api_id(MUST(Crypto::generate_random_uuid()))
 {
+    // OPTIMIZATION: Every new entry starts out with the same serialized null / undefined states, so
+    //               serialize them once and share the bytes across all entries instead of running
+    //               the structured serialization machinery for each one.
+    static SerializationRecord const default_classic_history_api_state = MUST(structured_serialize_for_storage(vm(), JS::js_null()));
+    static SerializationRecord const default_navigation_api_state = MUST(structured_serialize_for_storage(vm(), JS::js_undefined()));
+    m_classic_history_api_state = default_classic_history_api_state;
+    m_navigation_api_state = default_navigation_api_state;
 }
 
 GC::Ref<SessionHistoryEntry> SessionHistoryEntry::clone() const
 {
-    GC::Ref<SessionHistoryEntry> entry = *heap().allocate<SessionHistoryEntry>();
+    GC::Ref<SessionHistoryEntry> entry = *heap().allocate<SessionHistoryEntry>(ForCloning::Tag);
     entry->m_step = m_step;
     entry->m_url = m_url;
     entry->m_document_state = m_document_state->clone();
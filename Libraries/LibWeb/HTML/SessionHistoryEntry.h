@@ -79,6 +79,13 @@ public:
     void set_original_source_browsing_context(GC::Ptr<BrowsingContext> original_source_browsing_context) { m_original_source_browsing_context = original_source_browsing_context; }
 
 private:
+    // Used by clone() to skip generating the UUIDs and default serialized states that cloning
+    // immediately overwrites.
+    enum class ForCloning {
+        Tag,
+    };
+    explicit SessionHistoryEntry(ForCloning) { }
+
     // https://html.spec.whatwg.org/multipage/browsing-the-web.html#she-step
     // step, a non-negative integer or "pending", initially "pending".
     Variant<int, Pending> m_step { Pending::Tag };
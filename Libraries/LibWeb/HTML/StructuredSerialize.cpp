@@ -158,93 +158,28 @@ static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, TransferData
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize detached ArrayBuffer"_utf16);
 
         // 2. Let size be value.[[ArrayBufferByteLength]].
-        auto size = array_buffer.byte_length();
-
         // 3. Let dataCopy be ? CreateByteDataBlock(size).
-        //    NOTE: This can throw a RangeError exception upon allocation failure.
-        auto data_copy = TRY(JS::create_byte_data_block(vm, size));
-
         // 4. Perform CopyDataBlockBytes(dataCopy, 0, value.[[ArrayBufferData]], 0, size).
-        JS::copy_data_block_bytes(data_copy.buffer(), 0, array_buffer.buffer(), 0, size);
+        // OPTIMIZATION: Encoding the contents into the record is itself the copy (and spills large
+        //               payloads into anonymous shared memory), so don't make a separate dataCopy
+        //               first.
 
         // 5. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "ResizableArrayBuffer",
         //    [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size, [[ArrayBufferMaxByteLength]]: value.[[ArrayBufferMaxByteLength]] }.
         if (!array_buffer.is_fixed_length()) {
             data_holder.encode(ValueTag::ResizeableArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode(array_buffer.buffer());
             data_holder.encode(array_buffer.max_byte_length());
         }
         // 6. Otherwise, set serialized to { [[Type]]: "ArrayBuffer", [[ArrayBufferData]]: dataCopy, [[ArrayBufferByteLength]]: size }.
         else {
             data_holder.encode(ValueTag::ArrayBuffer);
-            data_holder.encode(data_copy.buffer());
+            data_holder.encode(array_buffer.buffer());
         }
     }
     return {};
 }
 
-// https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
-template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
-static WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(JS::VM& vm, TransferDataEncoder& data_holder, ViewType const& view, bool for_storage, SerializationMemory& memory)
-{
-    // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
-
-    auto view_record = [&]() {
-        if constexpr (IsSame<ViewType, JS::DataView>)
-            return JS::make_data_view_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
-        else
-            return JS::make_typed_array_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
-    }();
-
-    // 1. If IsArrayBufferViewOutOfBounds(value) is true, then throw a "DataCloneError" DOMException.
-    if constexpr (IsSame<ViewType, JS::DataView>) {
-        if (JS::is_view_out_of_bounds(view_record))
-            return WebIDL::DataCloneError::create(*vm.current_realm(), Utf16String::formatted(JS::ErrorType::BufferOutOfBounds.format(), "DataView"sv));
-    } else {
-        if (JS::is_typed_array_out_of_bounds(view_record))
-            return WebIDL::DataCloneError::create(*vm.current_realm(), Utf16String::formatted(JS::ErrorType::BufferOutOfBounds.format(), "TypedArray"sv));
-    }
-
-    // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
-    JS::Value buffer = view.viewed_array_buffer();
-
-    // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
-    auto buffer_serialized = TRY(structured_serialize_internal(vm, buffer, for_storage, memory));
-
-    // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
-    // NOTE: Object reference + memory check is required when ArrayBuffer is transferred.
-    auto tag = TransferDataDecoder { buffer_serialized }.decode<ValueTag>();
-
-    VERIFY(first_is_one_of(tag, ValueTag::ArrayBuffer, ValueTag::ResizeableArrayBuffer, ValueTag::SharedArrayBuffer, ValueTag::GrowableSharedArrayBuffer)
-        || (tag == ValueTag::ObjectReference && memory.contains(buffer)));
-
-    // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
-    //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
-    if constexpr (IsSame<ViewType, JS::DataView>) {
-        data_holder.encode(ValueTag::ArrayBufferView);
-        data_holder.append(move(buffer_serialized)); // [[ArrayBufferSerialized]]
-        data_holder.encode("DataView"_utf16);        // [[Constructor]]
-        data_holder.encode(JS::get_view_byte_length(view_record));
-        data_holder.encode(view.byte_offset());
-    }
-    // 6. Otherwise:
-    else {
-        // 1. Assert: value has a [[TypedArrayName]] internal slot.
-        //    NOTE: Handled by constexpr check and template constraints
-        // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
-        //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
-        //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
-        data_holder.encode(ValueTag::ArrayBufferView);
-        data_holder.append(move(buffer_serialized));               // [[ArrayBufferSerialized]]
-        data_holder.encode(view.element_name().to_utf16_string()); // [[Constructor]]
-        data_holder.encode(JS::typed_array_byte_length(view_record));
-        data_holder.encode(view.byte_offset());
-        data_holder.encode(JS::typed_array_length(view_record));
-    }
-
-    return {};
-}
-
 // Serializing and deserializing are each two passes:
 // 1. Fill up the memory with all the values, but without translating references
 // 2. Translate all the references into the appropriate form
@@ -258,17 +193,26 @@ public:
     {
     }
 
-    // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
-    // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
     WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
     {
+        // OPTIMIZATION: Nested values are serialized directly into the same record instead of each
+        //               one going through a temporary encoder that is then copied into its parent,
+        //               so deep object graphs only allocate a single buffer.
         TransferDataEncoder serialized;
+        TRY(serialize(serialized, value));
+        return serialized.take_buffer().take_data();
+    }
 
+private:
+    // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
+    // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
+    WebIDL::ExceptionOr<void> serialize(TransferDataEncoder& serialized, JS::Value value)
+    {
         // 2. If memory[value] exists, then return memory[value].
         if (m_memory.contains(value)) {
             serialized.encode(ValueTag::ObjectReference);
             serialized.encode(m_memory.get(value).value());
-            return serialized.take_buffer().take_data();
+            return {};
         }
 
         // 3. Let deep be false.
@@ -298,7 +242,7 @@ public:
         }
 
         if (return_primitive_type)
-            return serialized.take_buffer().take_data();
+            return {};
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -359,9 +303,9 @@ public:
 
             // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
             else if (auto const* typed_array_base = as_if<JS::TypedArrayBase>(object)) {
-                TRY(serialize_viewed_array_buffer(m_vm, serialized, *typed_array_base, m_for_storage, m_memory));
+                TRY(serialize_viewed_array_buffer(serialized, *typed_array_base));
             } else if (auto const* data_view = as_if<JS::DataView>(object)) {
-                TRY(serialize_viewed_array_buffer(m_vm, serialized, *data_view, m_for_storage, m_memory));
+                TRY(serialize_viewed_array_buffer(serialized, *data_view));
             }
 
             // 15. Otherwise, if value has a [[MapData]] internal slot, then:
@@ -488,10 +432,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(serialized, copied_value));
                 }
             }
 
@@ -512,10 +454,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    serialized.append(move(serialized_value));
+                    TRY(serialize(serialized, copied_value));
                 }
             }
 
@@ -539,11 +479,9 @@ public:
                         auto input_value = TRY(object.internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
                         serialized.encode(key.as_string().utf16_string());
-                        serialized.append(move(output_value));
+                        TRY(serialize(serialized, input_value));
 
                         ++property_count;
                     }
@@ -557,10 +495,70 @@ public:
         }
 
         // 27. Return serialized.
-        return serialized.take_buffer().take_data();
+        return {};
+    }
+
+    // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
+    template<OneOf<JS::TypedArrayBase, JS::DataView> ViewType>
+    WebIDL::ExceptionOr<void> serialize_viewed_array_buffer(TransferDataEncoder& data_holder, ViewType const& view)
+    {
+        // 14. Otherwise, if value has a [[ViewedArrayBuffer]] internal slot, then:
+
+        auto view_record = [&]() {
+            if constexpr (IsSame<ViewType, JS::DataView>)
+                return JS::make_data_view_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
+            else
+                return JS::make_typed_array_with_buffer_witness_record(view, JS::ArrayBuffer::Order::SeqCst);
+        }();
+
+        // 1. If IsArrayBufferViewOutOfBounds(value) is true, then throw a "DataCloneError" DOMException.
+        if constexpr (IsSame<ViewType, JS::DataView>) {
+            if (JS::is_view_out_of_bounds(view_record))
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), Utf16String::formatted(JS::ErrorType::BufferOutOfBounds.format(), "DataView"sv));
+        } else {
+            if (JS::is_typed_array_out_of_bounds(view_record))
+                return WebIDL::DataCloneError::create(*m_vm.current_realm(), Utf16String::formatted(JS::ErrorType::BufferOutOfBounds.format(), "TypedArray"sv));
+        }
+
+        // 2. Let buffer be the value of value's [[ViewedArrayBuffer]] internal slot.
+        JS::Value buffer = view.viewed_array_buffer();
+
+        data_holder.encode(ValueTag::ArrayBufferView);
+
+        // 3. Let bufferSerialized be ? StructuredSerializeInternal(buffer, forStorage, memory).
+        auto buffer_tag_offset = data_holder.buffer().data().size();
+        TRY(serialize(data_holder, buffer)); // [[ArrayBufferSerialized]]
+
+        // 4. Assert: bufferSerialized.[[Type]] is "ArrayBuffer", "ResizableArrayBuffer", "SharedArrayBuffer", or "GrowableSharedArrayBuffer".
+        // NOTE: Object reference + memory check is required when ArrayBuffer is transferred.
+        auto tag = static_cast<ValueTag>(data_holder.buffer().data()[buffer_tag_offset]);
+
+        VERIFY(first_is_one_of(tag, ValueTag::ArrayBuffer, ValueTag::ResizeableArrayBuffer, ValueTag::SharedArrayBuffer, ValueTag::GrowableSharedArrayBuffer)
+            || (tag == ValueTag::ObjectReference && m_memory.contains(buffer)));
+
+        // 5. If value has a [[DataView]] internal slot, then set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: "DataView",
+        //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]], [[ByteOffset]]: value.[[ByteOffset]] }.
+        if constexpr (IsSame<ViewType, JS::DataView>) {
+            data_holder.encode("DataView"_utf16); // [[Constructor]]
+            data_holder.encode(JS::get_view_byte_length(view_record));
+            data_holder.encode(view.byte_offset());
+        }
+        // 6. Otherwise:
+        else {
+            // 1. Assert: value has a [[TypedArrayName]] internal slot.
+            //    NOTE: Handled by constexpr check and template constraints
+            // 2. Set serialized to { [[Type]]: "ArrayBufferView", [[Constructor]]: value.[[TypedArrayName]],
+            //    [[ArrayBufferSerialized]]: bufferSerialized, [[ByteLength]]: value.[[ByteLength]],
+            //    [[ByteOffset]]: value.[[ByteOffset]], [[ArrayLength]]: value.[[ArrayLength]] }.
+            data_holder.encode(view.element_name().to_utf16_string()); // [[Constructor]]
+            data_holder.encode(JS::typed_array_byte_length(view_record));
+            data_holder.encode(view.byte_offset());
+            data_holder.encode(JS::typed_array_length(view_record));
+        }
+
+        return {};
     }
 
-private:
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
     u32 m_next_id { 0 };
@@ -995,7 +993,7 @@ private:
 
     JS::VM& m_vm;
     TransferDataDecoder& m_serialized;
-    GC::RootVector<JS::Value> m_memory;
+    DeserializationMemory& m_memory;
 };
 
 // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializewithtransfer
@@ -8,6 +8,7 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibWeb/HTML/Timer.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/HighResolutionTime/TimeOrigin.h>
 
 namespace Web::HTML {
 
@@ -23,6 +24,7 @@ Timer::Timer(JS::Object& window_or_worker_global_scope, i32 milliseconds, GC::Re
     : m_window_or_worker_global_scope(window_or_worker_global_scope)
     , m_callback(move(callback))
     , m_id(id)
+    , m_milliseconds(milliseconds)
 {
     m_timer = Core::Timer::create_single_shot(milliseconds, [this] {
         m_callback->function()();
@@ -43,6 +45,7 @@ Timer::~Timer()
 
 void Timer::start()
 {
+    m_fire_time_estimate = HighResolutionTime::unsafe_shared_current_time() + m_milliseconds;
     m_timer->start();
 }
 
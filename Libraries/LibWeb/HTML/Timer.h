@@ -28,6 +28,9 @@ public:
     void start();
     void stop();
 
+    // The moment on the monotonic clock (in milliseconds) at which this timer is expected to fire.
+    double fire_time_estimate() const { return m_fire_time_estimate; }
+
 private:
     Timer(JS::Object& window, i32 milliseconds, GC::Ref<GC::Function<void()>> callback, i32 id);
 
@@ -37,6 +40,8 @@ private:
     GC::Ref<JS::Object> m_window_or_worker_global_scope;
     GC::Ref<GC::Function<void()>> m_callback;
     i32 m_id { 0 };
+    i32 m_milliseconds { 0 };
+    double m_fire_time_estimate { 0 };
 };
 
 }
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/QuickSort.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -44,10 +45,48 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
     if (m_emulated_position_data.has<GC::Ref<Geolocation::GeolocationCoordinates>>())
         visitor.visit(m_emulated_position_data.get<GC::Ref<Geolocation::GeolocationCoordinates>>());
     visitor.visit(m_session_history_entries);
+    visitor.visit(m_back_forward_cache_documents);
     visitor.visit(m_session_history_traversal_queue);
     visitor.visit(m_storage_shed);
 }
 
+void TraversableNavigable::store_in_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    m_back_forward_cache_documents.append(document);
+
+    // Evict the oldest cached document when over budget.
+    if (m_back_forward_cache_documents.size() > back_forward_cache_capacity)
+        evict_from_back_forward_cache(m_back_forward_cache_documents.first());
+}
+
+void TraversableNavigable::remove_from_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    m_back_forward_cache_documents.remove_first_matching([&](auto& cached_document) { return cached_document == document; });
+}
+
+// AD-HOC: destroy_a_document_and_its_descendants() queues its work as tasks for the documents being
+//         destroyed, but tasks for a cached document are not runnable because it is no longer fully
+//         active, so evicted documents are destroyed synchronously instead.
+static void destroy_a_cached_document_and_its_descendants(GC::Ref<DOM::Document> document)
+{
+    for (auto& child_navigable : document->document_tree_child_navigables())
+        destroy_a_cached_document_and_its_descendants(*child_navigable->active_document());
+    document->destroy();
+}
+
+void TraversableNavigable::evict_from_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    remove_from_back_forward_cache(document);
+
+    // Session history entries referencing the document go back to being populated on traversal.
+    for (auto& entry : m_session_history_entries) {
+        if (entry->document().ptr() == document.ptr())
+            entry->document_state()->set_document(nullptr);
+    }
+
+    destroy_a_cached_document_and_its_descendants(document);
+}
+
 static OrderedHashTable<TraversableNavigable*>& user_agent_top_level_traversable_set()
 {
     static OrderedHashTable<TraversableNavigable*> set;
@@ -192,11 +231,14 @@ Vector<int> TraversableNavigable::get_all_used_history_steps() const
     OrderedHashTable<int> steps;
 
     // 3. Let entryLists be the ordered set « traversable's session history entries ».
-    Vector<Vector<GC::Ref<SessionHistoryEntry>>> entry_lists { session_history_entries() };
+    // NOTE: This runs on every push/replace, so walk the entry lists in place instead of copying
+    //       them; the cost would otherwise grow with the session history length.
+    Vector<Vector<GC::Ref<SessionHistoryEntry>> const&> entry_lists;
+    entry_lists.append(session_history_entries());
 
     // 4. For each entryList of entryLists:
     while (!entry_lists.is_empty()) {
-        auto entry_list = entry_lists.take_first();
+        auto const& entry_list = entry_lists.take_first();
 
         // 1. For each entry of entryList:
         for (auto& entry : entry_list) {
@@ -1009,7 +1051,7 @@ TraversableNavigable::CheckIfUnloadingIsCanceledResult TraversableNavigable::che
 Vector<GC::Ref<SessionHistoryEntry>> TraversableNavigable::get_session_history_entries_for_the_navigation_api(GC::Ref<Navigable> navigable, int target_step)
 {
     // 1. Let rawEntries be the result of getting session history entries for navigable.
-    auto raw_entries = navigable->get_session_history_entries();
+    auto const& raw_entries = navigable->get_session_history_entries();
 
     if (raw_entries.is_empty())
         return {};
@@ -1106,6 +1148,15 @@ void TraversableNavigable::clear_the_forward_session_history()
             }
         }
     }
+
+    // Not in the spec: cached documents whose session history entries were just removed can never be
+    // traversed to again, so evict them now instead of waiting for the cache to fill up.
+    auto cached_documents = m_back_forward_cache_documents;
+    for (auto& document : cached_documents) {
+        auto is_still_referenced = any_of(m_session_history_entries, [&](auto& entry) { return entry->document().ptr() == document.ptr(); });
+        if (!is_still_referenced)
+            evict_from_back_forward_cache(document);
+    }
 }
 
 bool TraversableNavigable::can_go_forward() const
@@ -1412,7 +1463,9 @@ void TraversableNavigable::process_screenshot_requests()
                 continue;
             }
             auto rect = page().enclosing_device_rect(dom_node->paintable_box()->absolute_border_box_rect());
-            auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
+            // OPTIMIZATION: Render straight into a shared-memory bitmap, so handing the screenshot
+            //               to the client doesn't have to copy the whole surface afterwards.
+            auto bitmap = Gfx::Bitmap::create_shareable(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
             auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
             PaintConfig paint_config { .canvas_fill_rect = rect.to_type<int>() };
             start_display_list_rendering(painting_surface, paint_config, [bitmap, &client] {
@@ -1421,7 +1474,9 @@ void TraversableNavigable::process_screenshot_requests()
         } else {
             auto scrollable_overflow_rect = active_document()->layout_node()->paintable_box()->scrollable_overflow_rect();
             auto rect = page().enclosing_device_rect(scrollable_overflow_rect.value());
-            auto bitmap = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
+            // OPTIMIZATION: As above, render straight into a shared-memory bitmap. Full-document
+            //               screenshots can be tens of megabytes, so the saved copy is substantial.
+            auto bitmap = Gfx::Bitmap::create_shareable(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, rect.size().to_type<int>()).release_value_but_fixme_should_propagate_errors();
             auto painting_surface = Gfx::PaintingSurface::wrap_bitmap(*bitmap);
             PaintConfig paint_config { .paint_overlay = true, .canvas_fill_rect = rect.to_type<int>() };
             start_display_list_rendering(painting_surface, paint_config, [bitmap, &client] {
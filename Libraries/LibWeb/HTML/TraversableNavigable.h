@@ -79,6 +79,11 @@ public:
     Vector<GC::Root<Navigable>> get_all_navigables_that_only_need_history_object_length_index_update(int) const;
     Vector<GC::Root<Navigable>> get_all_navigables_that_might_experience_a_cross_document_traversal(int) const;
 
+    // Documents in the back/forward cache are kept alive after the user navigates away from them, so
+    // that history traversal can reactivate them instead of fetching and parsing them from scratch.
+    void store_in_back_forward_cache(GC::Ref<DOM::Document>);
+    void remove_from_back_forward_cache(GC::Ref<DOM::Document>);
+
     Vector<int> get_all_used_history_steps() const;
     void clear_the_forward_session_history();
     void traverse_the_history_by_delta(int delta, GC::Ptr<DOM::Document> source_document = {});
@@ -146,12 +151,20 @@ private:
 
     [[nodiscard]] bool can_go_forward() const;
 
+    void evict_from_back_forward_cache(GC::Ref<DOM::Document>);
+
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-current-session-history-step
     int m_current_session_history_step { 0 };
 
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-entries
     Vector<GC::Ref<SessionHistoryEntry>> m_session_history_entries;
 
+    // Documents stored in the back/forward cache, oldest first.
+    // NOTE: The capacity acts as a crude memory budget; every cached document retains its full DOM,
+    //       JS heap and subframes until it is evicted or restored.
+    static constexpr size_t back_forward_cache_capacity = 3;
+    Vector<GC::Ref<DOM::Document>> m_back_forward_cache_documents;
+
     // FIXME: https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-traversal-queue
 
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-running-nested-apply-history-step
@@ -1692,14 +1692,49 @@ u32 Window::request_idle_callback(WebIDL::CallbackType& callback, RequestIdleCal
     m_idle_request_callbacks.append(adopt_ref(*new IdleCallback(move(handler), handle)));
 
     // 5. Return handle and then continue running this algorithm asynchronously.
+    // 6. If the timeout property is present in options and has a positive value:
+    if (options.timeout.value_or(0) > 0) {
+        // 1. Wait for timeout milliseconds.
+        // FIXME: 2. Wait until all invocations of this algorithm, whose timeout added to their posted time occurred before this one's, have completed.
+        // 3. Optionally, wait a further user-agent defined length of time.
+        // 4. Queue a task on the queue associated with the idle-task task source, which performs the invoke idle callback timeout algorithm, passing handle and window as arguments.
+        run_steps_after_a_timeout(static_cast<i32>(*options.timeout), [this, handle] {
+            queue_global_task(Task::Source::IdleTask, *this, GC::create_function(heap(), [this, handle] {
+                invoke_idle_callback_timeout(handle);
+            }));
+        });
+    }
+
     return handle;
+}
+
+// https://w3c.github.io/requestidlecallback/#invoke-idle-callback-timeout-algorithm
+void Window::invoke_idle_callback_timeout(u32 handle)
+{
+    // 1. If there is no entry in window's list of idle request callbacks or window's list of runnable idle callbacks
+    //    that is associated with handle, return from this algorithm.
+    auto matches_handle = [&](NonnullRefPtr<IdleCallback> const& callback) { return callback->handle() == handle; };
+    auto entry = m_idle_request_callbacks.first_matching(matches_handle);
+    if (!entry.has_value())
+        entry = m_runnable_idle_callbacks.first_matching(matches_handle);
+    if (!entry.has_value())
+        return;
+
+    // 2. Let callback be the callback associated with handle.
+    auto callback = entry.release_value();
+
+    // 3. Remove the entry associated with handle from window's list of idle request callbacks and window's
+    //    list of runnable idle callbacks.
+    m_idle_request_callbacks.remove_first_matching(matches_handle);
+    m_runnable_idle_callbacks.remove_first_matching(matches_handle);
+
+    // 4. Let deadlineArg be a new IdleDeadline whose didTimeout flag is set.
+    auto deadline_arg = RequestIdleCallback::IdleDeadline::create(realm(), true);
 
-    // FIXME: 6. If the timeout property is present in options and has a positive value:
-    // FIXME:    1. Wait for timeout milliseconds.
-    // FIXME:    2. Wait until all invocations of this algorithm, whose timeout added to their posted time occurred before this one's, have completed.
-    // FIXME:    3. Optionally, wait a further user-agent defined length of time.
-    // FIXME:    4. Queue a task on the queue associated with the idle-task task source, which performs the invoke idle callback timeout algorithm, passing handle and window as arguments.
-    (void)options;
+    // 5. Call callback with deadlineArg as its argument. If an uncaught runtime script error occurs, then report the exception.
+    auto result = callback->invoke(deadline_arg);
+    if (result.is_error())
+        report_exception(result, realm());
 }
 
 // https://w3c.github.io/requestidlecallback/#dom-window-cancelidlecallback
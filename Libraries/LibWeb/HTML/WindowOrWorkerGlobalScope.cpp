@@ -19,6 +19,7 @@
 #include <LibWeb/Bindings/MainThreadVM.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Crypto/Crypto.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/FetchMethod.h>
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/ErrorEvent.h>
@@ -46,6 +47,7 @@
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/Scheduler/Scheduler.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/TrustedTypes/TrustedTypePolicyFactory.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
@@ -88,6 +90,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_cache_storage);
     visitor.visit(m_resource_timing_secondary_buffer);
     visitor.visit(m_trusted_type_policy_factory);
+    visitor.visit(m_scheduler);
 }
 
 void WindowOrWorkerGlobalScopeMixin::finalize()
@@ -532,6 +535,18 @@ void WindowOrWorkerGlobalScopeMixin::clear_map_of_active_timers()
     m_timers.clear();
 }
 
+// https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#map-of-active-timers
+Vector<double> WindowOrWorkerGlobalScopeMixin::timer_callback_estimates() const
+{
+    // The values of the map of active timers are the moments at which the corresponding timers are
+    // expected to fire. They feed into the idle deadline computation of the event loop processing model.
+    Vector<double> estimates;
+    estimates.ensure_capacity(m_timers.size());
+    for (auto const& it : m_timers)
+        estimates.unchecked_append(it.value->fire_time_estimate());
+    return estimates;
+}
+
 // https://html.spec.whatwg.org/multipage/timers-and-user-prompts.html#timer-initialisation-steps
 // With no active script fix from https://github.com/whatwg/html/pull/9712
 i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler handler, i32 timeout, GC::RootVector<JS::Value> arguments, Repeat repeat, Optional<i32> previous_id)
@@ -549,6 +564,15 @@ i32 WindowOrWorkerGlobalScopeMixin::run_timer_initialization_steps(TimerHandler
 
     // FIXME: 5. If nesting level is greater than 5, and timeout is less than 4, then set timeout to 4.
 
+    // OPTIMIZATION: Clamp timers in hidden windows to at most once per second, so background tabs don't burn
+    //               CPU in tight setTimeout() / setInterval() loops the user can't see. Repeating timers pass
+    //               through here again on every tick, so the clamp lifts as soon as the page becomes visible.
+    static constexpr i32 hidden_window_minimum_timeout = 1000;
+    if (timeout < hidden_window_minimum_timeout && is<Window>(this_impl())) {
+        if (static_cast<Window&>(this_impl()).associated_document().hidden())
+            timeout = hidden_window_minimum_timeout;
+    }
+
     // 6. Let realm be global's relevant realm.
     auto& realm = relevant_realm(this_impl());
 
@@ -1330,4 +1354,13 @@ GC::Ref<TrustedTypes::TrustedTypePolicyFactory> WindowOrWorkerGlobalScopeMixin::
     return *m_trusted_type_policy_factory;
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<Scheduler::Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    auto& realm = this_impl().realm();
+    if (!m_scheduler)
+        m_scheduler = Scheduler::Scheduler::create(realm);
+    return GC::Ref { *m_scheduler };
+}
+
 }
@@ -48,6 +48,7 @@ public:
     void clear_timeout(i32);
     void clear_interval(i32);
     void clear_map_of_active_timers();
+    Vector<double> timer_callback_estimates() const;
 
     enum class CheckIfPerformanceBufferIsFull {
         No,
@@ -83,6 +84,7 @@ public:
         Yes,
     };
     AffectedAnyWebSockets make_disappear_all_web_sockets();
+    bool has_registered_web_sockets() const { return !m_registered_web_sockets.is_empty(); }
 
     void run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step);
 
@@ -106,6 +108,8 @@ public:
 
     [[nodiscard]] GC::Ref<TrustedTypes::TrustedTypePolicyFactory> trusted_types();
 
+    [[nodiscard]] GC::Ref<Scheduler::Scheduler> scheduler();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -156,6 +160,8 @@ private:
 
     GC::Ptr<TrustedTypes::TrustedTypePolicyFactory> m_trusted_type_policy_factory;
 
+    GC::Ptr<Scheduler::Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
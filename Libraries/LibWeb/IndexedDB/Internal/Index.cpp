@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -49,13 +48,60 @@ void Index::set_name(String name)
     m_name = move(name);
 }
 
+// OPTIMIZATION: The record list is sorted primarily by key, so the records inside a key range form
+//               one contiguous span. Finding its ends by binary search keeps range queries from
+//               scanning every record in the index.
+size_t Index::index_of_first_record_in_range(GC::Ref<IDBKeyRange> range) const
+{
+    auto lower_key = range->lower_key();
+    if (!lower_key)
+        return 0;
+
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(m_records[middle].key, *lower_key);
+        if (comparison < 0 || (comparison == 0 && range->lower_open()))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+size_t Index::index_of_first_record_past_range(GC::Ref<IDBKeyRange> range) const
+{
+    auto upper_key = range->upper_key();
+    if (!upper_key)
+        return m_records.size();
+
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(m_records[middle].key, *upper_key);
+        if (comparison < 0 || (comparison == 0 && !range->upper_open()))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::compare_two_keys(m_records[middle].key, key) < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
 
-    return index != m_records.end();
+    return low < m_records.size() && Key::equals(m_records[low].key, key);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -63,13 +109,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->record_with_key(index_record.value).value().value;
 }
 
 void Index::clear_records()
@@ -79,17 +119,21 @@ void Index::clear_records()
 
 Optional<IndexRecord&> Index::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+    if (begin < end)
+        return m_records[begin];
+    return {};
 }
 
 GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto i = begin; i < end; ++i) {
+        records.append(m_records[i]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -100,10 +144,12 @@ GC::ConservativeVector<IndexRecord> Index::first_n_in_range(GC::Ref<IDBKeyRange>
 
 GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+
     GC::ConservativeVector<IndexRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto i = end; i > begin; --i) {
+        records.append(m_records[i - 1]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -114,26 +160,27 @@ GC::ConservativeVector<IndexRecord> Index::last_n_in_range(GC::Ref<IDBKeyRange>
 
 u64 Index::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+    return begin < end ? end - begin : 0;
 }
 
 void Index::store_a_record(IndexRecord const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in index’s list of records such that the list is sorted primarily on the records keys, and secondarily on the records values, in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        auto key_comparison = Key::compare_two_keys(a.key, b.key);
-        if (key_comparison != 0)
-            return key_comparison < 0;
-
-        return Key::compare_two_keys(a.value, b.value) < 0;
-    });
+    // OPTIMIZATION: The list is already sorted, so insert at the position found by binary search
+    //               instead of re-sorting the whole list on every store.
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto key_comparison = Key::compare_two_keys(m_records[middle].key, record.key);
+        if (key_comparison < 0 || (key_comparison == 0 && Key::compare_two_keys(m_records[middle].value, record.value) <= 0))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    m_records.insert(low, record);
 }
 
 void Index::remove_records_with_value_in_range(GC::Ref<IDBKeyRange> range)
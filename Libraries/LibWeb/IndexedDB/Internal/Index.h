@@ -51,6 +51,9 @@ protected:
 private:
     Index(GC::Ref<ObjectStore>, String const&, KeyPath const&, bool, bool);
 
+    size_t index_of_first_record_in_range(GC::Ref<IDBKeyRange> range) const;
+    size_t index_of_first_record_past_range(GC::Ref<IDBKeyRange> range) const;
+
     // An index [...] has a referenced object store.
     GC::Ref<ObjectStore> m_object_store;
 
@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
 
@@ -41,47 +40,108 @@ void ObjectStore::visit_edges(Visitor& visitor)
     }
 }
 
+// OPTIMIZATION: The record list is sorted by key, so the records inside a key range form one
+//               contiguous span. Finding its ends by binary search keeps range queries from
+//               scanning every record in the store.
+size_t ObjectStore::index_of_first_record_in_range(GC::Ref<IDBKeyRange> range) const
+{
+    auto lower_key = range->lower_key();
+    if (!lower_key)
+        return 0;
+
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(m_records[middle].key, *lower_key);
+        if (comparison < 0 || (comparison == 0 && range->lower_open()))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+size_t ObjectStore::index_of_first_record_past_range(GC::Ref<IDBKeyRange> range) const
+{
+    auto upper_key = range->upper_key();
+    if (!upper_key)
+        return m_records.size();
+
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(m_records[middle].key, *upper_key);
+        if (comparison < 0 || (comparison == 0 && !range->upper_open()))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+    if (begin < end)
+        m_records.remove(begin, end - begin);
 }
 
-bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
+Optional<ObjectStoreRecord const&> ObjectStore::record_with_key(GC::Ref<Key> key) const
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::compare_two_keys(m_records[middle].key, key) < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
 
-    return index != m_records.end();
+    if (low < m_records.size() && Key::equals(m_records[low].key, key))
+        return m_records[low];
+    return {};
 }
 
-void ObjectStore::store_a_record(ObjectStoreRecord const& record)
+bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    m_records.append(record);
+    return record_with_key(key).has_value();
+}
 
+void ObjectStore::store_a_record(ObjectStoreRecord const& record)
+{
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    // OPTIMIZATION: The list is already sorted, so insert at the position found by binary search
+    //               instead of re-sorting the whole list on every store.
+    size_t low = 0;
+    size_t high = m_records.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (Key::compare_two_keys(m_records[middle].key, record.key) <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    m_records.insert(low, record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+    return begin < end ? end - begin : 0;
 }
 
 Optional<ObjectStoreRecord&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+    if (begin < end)
+        return m_records[begin];
+    return {};
 }
 
 void ObjectStore::clear_records()
@@ -91,10 +151,12 @@ void ObjectStore::clear_records()
 
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto i = begin; i < end; ++i) {
+        records.append(m_records[i]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -105,10 +167,12 @@ GC::ConservativeVector<ObjectStoreRecord> ObjectStore::first_n_in_range(GC::Ref<
 
 GC::ConservativeVector<ObjectStoreRecord> ObjectStore::last_n_in_range(GC::Ref<IDBKeyRange> range, Optional<WebIDL::UnsignedLong> count)
 {
+    auto begin = index_of_first_record_in_range(range);
+    auto end = index_of_first_record_past_range(range);
+
     GC::ConservativeVector<ObjectStoreRecord> records(range->heap());
-    for (auto const& record : m_records.in_reverse()) {
-        if (range->is_in_range(record.key))
-            records.append(record);
+    for (auto i = end; i > begin; --i) {
+        records.append(m_records[i - 1]);
 
         if (count.has_value() && records.size() >= *count)
             break;
@@ -47,6 +47,7 @@ public:
 
     void remove_records_in_range(GC::Ref<IDBKeyRange> range);
     bool has_record_with_key(GC::Ref<Key> key);
+    Optional<ObjectStoreRecord const&> record_with_key(GC::Ref<Key> key) const;
     void store_a_record(ObjectStoreRecord const& record);
     u64 count_records_in_range(GC::Ref<IDBKeyRange> range);
     Optional<ObjectStoreRecord&> first_in_range(GC::Ref<IDBKeyRange> range);
@@ -60,6 +61,9 @@ protected:
 private:
     ObjectStore(GC::Ref<Database> database, String name, bool auto_increment, Optional<KeyPath> const& key_path);
 
+    size_t index_of_first_record_in_range(GC::Ref<IDBKeyRange> range) const;
+    size_t index_of_first_record_past_range(GC::Ref<IDBKeyRange> range) const;
+
     // AD-HOC: An ObjectStore needs to know what Database it belongs to...
     GC::Ref<Database> m_database;
 
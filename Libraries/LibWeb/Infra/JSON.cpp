@@ -5,9 +5,11 @@
  */
 
 #include <AK/String.h>
+#include <AK/Utf8View.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/Completion.h>
+#include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Infra/JSON.h>
@@ -30,6 +32,18 @@ WebIDL::ExceptionOr<JS::Value> parse_json_bytes_to_javascript_value(JS::Realm& r
     auto& vm = realm.vm();
 
     // 1. Let string be the result of running UTF-8 decode on bytes.
+    // OPTIMIZATION: UTF-8 decode only strips a leading BOM and replaces invalid sequences with
+    //               U+FFFD. When the bytes are already valid UTF-8 (they almost always are), we
+    //               can hand them to the JSON parser in place instead of materializing a decoded
+    //               copy of the entire payload first.
+    auto bytes_without_bom = bytes;
+    if (bytes.size() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
+        bytes_without_bom = bytes.slice(3);
+    if (Utf8View { StringView { bytes_without_bom } }.validate()) {
+        // 2. Return the result of parsing a JSON string to an Infra value given string.
+        return TRY(JS::JSONObject::parse_json(vm, StringView { bytes_without_bom }));
+    }
+
     TextCodec::UTF8Decoder decoder;
     auto string = TRY_OR_THROW_OOM(vm, decoder.to_utf8(bytes));
 
@@ -145,6 +145,10 @@ void IntersectionObserver::observe(DOM::Element& target)
 
     // 4. Add target to observer’s internal [[ObservationTargets]] slot.
     m_observation_targets.append(target);
+
+    // NOTE: A newly observed target must always receive an initial observation, even if nothing on the
+    //       page has moved since the last update intersection observations steps ran.
+    target.document().page().invalidate_intersection_observations();
 }
 
 // https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-unobserve
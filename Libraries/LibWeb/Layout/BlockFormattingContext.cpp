@@ -51,7 +51,7 @@ CSSPixels BlockFormattingContext::automatic_content_width() const
     return greatest_child_width(root());
 }
 
-CSSPixels BlockFormattingContext::automatic_content_height() const
+CSSPixels BlockFormattingContext::compute_automatic_content_height() const
 {
     return compute_auto_height_for_block_formatting_context_root(root());
 }
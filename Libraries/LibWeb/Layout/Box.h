@@ -25,6 +25,16 @@ struct IntrinsicSizes {
     HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
 };
 
+// Cached output of the table column width distribution algorithm, stored on table root boxes.
+// The distribution is a pure function of the table's content (invariant for as long as the box
+// doesn't need a layout update) and the sizes below, which serve as the cache key.
+struct CachedTableColumnWidths {
+    CSSPixels containing_block_width;
+    CSSPixels containing_block_height;
+    CSSPixels table_width;
+    Vector<CSSPixels> used_widths;
+};
+
 class WEB_API Box : public NodeWithStyleAndBoxModelMetrics {
     GC_CELL(Box, NodeWithStyleAndBoxModelMetrics);
 
@@ -67,7 +77,13 @@ public:
             m_cached_intrinsic_sizes = make<IntrinsicSizes>();
         return *m_cached_intrinsic_sizes;
     }
-    void reset_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes.clear(); }
+    void reset_cached_intrinsic_sizes() const
+    {
+        m_cached_intrinsic_sizes.clear();
+        m_cached_table_column_widths.clear();
+    }
+
+    OwnPtr<CachedTableColumnWidths>& cached_table_column_widths() const { return m_cached_table_column_widths; }
 
 protected:
     Box(DOM::Document&, DOM::Node*, GC::Ref<CSS::ComputedProperties>);
@@ -83,6 +99,7 @@ private:
     Vector<GC::Ref<Node>> m_contained_abspos_children;
 
     OwnPtr<IntrinsicSizes> mutable m_cached_intrinsic_sizes;
+    OwnPtr<CachedTableColumnWidths> mutable m_cached_table_column_widths;
 };
 
 template<>
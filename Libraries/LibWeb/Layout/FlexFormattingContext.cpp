@@ -47,7 +47,7 @@ CSSPixels FlexFormattingContext::automatic_content_width() const
     return m_flex_container_state.content_width();
 }
 
-CSSPixels FlexFormattingContext::automatic_content_height() const
+CSSPixels FlexFormattingContext::compute_automatic_content_height() const
 {
     return m_flex_container_state.content_height();
 }
@@ -983,6 +983,21 @@ void FlexFormattingContext::resolve_flexible_lengths_for_line(FlexLine& line)
     };
     auto const initial_free_space = calculate_remaining_free_space();
 
+    // OPTIMIZATION: Resolve each item's used min and max main sizes once, before entering the loop below.
+    //               The loop clamps every unfrozen item on each iteration, and in the worst case it runs
+    //               once per item, so re-resolving automatic minimum sizes inside it made this step
+    //               quadratic in the number of items on the line. Nothing these sizes depend on changes
+    //               while the loop runs.
+    for (auto& item : line.items) {
+        item.used_min_main_size = has_main_min_size(item.box)
+            ? specified_main_min_size(item)
+            : automatic_minimum_size(item);
+
+        item.used_max_main_size = has_main_max_size(item.box)
+            ? specified_main_max_size(item)
+            : CSSPixels::max();
+    }
+
     // 5. Loop
     while (true) {
         // a. Check for flexible items.
@@ -1052,16 +1067,8 @@ void FlexFormattingContext::resolve_flexible_lengths_for_line(FlexLine& line)
         for (auto& item : line.items) {
             if (item.frozen)
                 continue;
-            auto used_min_main_size = has_main_min_size(item.box)
-                ? specified_main_min_size(item)
-                : automatic_minimum_size(item);
-
-            auto used_max_main_size = has_main_max_size(item.box)
-                ? specified_main_max_size(item)
-                : CSSPixels::max();
-
             auto original_target_main_size = item.target_main_size;
-            item.target_main_size = css_clamp(item.target_main_size, used_min_main_size, used_max_main_size);
+            item.target_main_size = css_clamp(item.target_main_size, item.used_min_main_size, item.used_max_main_size);
             item.target_main_size = max(item.target_main_size, CSSPixels(0));
 
             // If the item’s target main size was made smaller by this, it’s a max violation.
@@ -20,7 +20,7 @@ public:
 
     virtual void run(AvailableSpace const&) override;
     virtual CSSPixels automatic_content_width() const override;
-    virtual CSSPixels automatic_content_height() const override;
+    virtual CSSPixels compute_automatic_content_height() const override;
 
     Box const& flex_container() const { return context_box(); }
 
@@ -66,6 +66,10 @@ private:
         bool frozen { false };
         Optional<double> flex_factor {};
         double scaled_flex_shrink_factor { 0 };
+
+        // The used min/max main sizes, resolved once before resolving flexible lengths.
+        CSSPixels used_min_main_size { 0 };
+        CSSPixels used_max_main_size { CSSPixels::max() };
         double desired_flex_fraction { 0 };
 
         CSSPixels outer_hypothetical_main_size() const
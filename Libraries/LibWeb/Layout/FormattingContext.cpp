@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/Box.h>
@@ -30,6 +31,13 @@ FormattingContext::FormattingContext(Type type, LayoutMode layout_mode, LayoutSt
 
 FormattingContext::~FormattingContext() = default;
 
+CSSPixels FormattingContext::automatic_content_height() const
+{
+    if (m_reused_automatic_content_height.has_value())
+        return *m_reused_automatic_content_height;
+    return compute_automatic_content_height();
+}
+
 // https://developer.mozilla.org/en-US/docs/Web/Guide/CSS/Block_formatting_context
 bool FormattingContext::creates_block_formatting_context(Box const& box)
 {
@@ -181,7 +189,7 @@ struct ReplacedFormattingContext : public FormattingContext {
     {
     }
     virtual CSSPixels automatic_content_width() const override { return 0; }
-    virtual CSSPixels automatic_content_height() const override { return 0; }
+    virtual CSSPixels compute_automatic_content_height() const override { return 0; }
     virtual void run(AvailableSpace const&) override { }
 };
 
@@ -192,7 +200,7 @@ struct DummyFormattingContext : public FormattingContext {
     {
     }
     virtual CSSPixels automatic_content_width() const override { return 0; }
-    virtual CSSPixels automatic_content_height() const override { return 0; }
+    virtual CSSPixels compute_automatic_content_height() const override { return 0; }
     virtual void run(AvailableSpace const&) override { }
 };
 
@@ -226,6 +234,27 @@ OwnPtr<FormattingContext> FormattingContext::create_independent_formatting_conte
     }
 }
 
+// A formatting context's previous layout results can only be reused if everything the parent
+// context needs from it afterwards works purely off the LayoutState, without any state produced
+// by run(). (The automatic content height is covered separately, by recording it at layout time;
+// see LayoutState::record_independent_formatting_context_layout().)
+static bool previous_layout_results_are_reusable(FormattingContext const& formatting_context, Box const& box)
+{
+    switch (formatting_context.type()) {
+    case FormattingContext::Type::Block:
+    case FormattingContext::Type::Flex:
+    case FormattingContext::Type::Table:
+    case FormattingContext::Type::SVG:
+        return true;
+    case FormattingContext::Type::Grid:
+        // Grid places absolutely positioned children into grid areas using track state built
+        // during run(), so results are only reusable if there are no such children.
+        return box.contained_abspos_children().is_empty();
+    default:
+        return false;
+    }
+}
+
 OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box, LayoutMode layout_mode, AvailableSpace const& available_space)
 {
     {
@@ -246,10 +275,29 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
         return {};
 
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, layout_mode, child_box);
-    if (independent_formatting_context)
-        independent_formatting_context->run(available_space);
-    else
+    if (independent_formatting_context) {
+        // OPTIMIZATION: If nothing inside `child_box` has been invalidated since the previous
+        //               layout pass, and we're giving it the same amount of space as last time,
+        //               we reuse the previous results instead of laying out the subtree again.
+        bool reused_previous_layout = false;
+        if (layout_mode == LayoutMode::Normal
+            && previous_layout_results_are_reusable(*independent_formatting_context, child_box)
+            && !child_box.needs_layout_update()) {
+            if (auto const* previous_layout_state = child_box.document().previous_layout_state()) {
+                if (auto reused_automatic_content_height = m_state.try_to_reuse_independent_formatting_context_layout(child_box, available_space, *previous_layout_state); reused_automatic_content_height.has_value()) {
+                    independent_formatting_context->m_reused_automatic_content_height = reused_automatic_content_height;
+                    reused_previous_layout = true;
+                }
+            }
+        }
+        if (!reused_previous_layout) {
+            independent_formatting_context->run(available_space);
+            if (layout_mode == LayoutMode::Normal)
+                m_state.record_independent_formatting_context_layout(child_box, available_space, independent_formatting_context->automatic_content_height());
+        }
+    } else {
         run(available_space);
+    }
 
     return independent_formatting_context;
 }
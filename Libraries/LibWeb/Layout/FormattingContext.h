@@ -42,7 +42,11 @@ public:
     virtual CSSPixels automatic_content_width() const = 0;
 
     // This function returns the automatic content height of the context's root box.
-    virtual CSSPixels automatic_content_height() const = 0;
+    // If the previous pass's layout results were reused for this context (see layout_inside()),
+    // this returns the height recorded during that pass instead of computing it, since the
+    // compute_automatic_content_height() implementations generally depend on state produced by run().
+    CSSPixels automatic_content_height() const;
+    virtual CSSPixels compute_automatic_content_height() const = 0;
 
     Box const& context_box() const { return m_context_box; }
 
@@ -165,6 +169,9 @@ protected:
     GC::Ref<Box const> m_context_box;
 
     LayoutState& m_state;
+
+    // Only set if this context's layout was skipped in favor of the previous pass's results.
+    Optional<CSSPixels> m_reused_automatic_content_height;
 };
 
 }
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Bitmap.h>
+#include <AK/QuickSort.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
@@ -737,17 +738,28 @@ void GridFormattingContext::resolve_intrinsic_track_sizes(GridDimension dimensio
 
     // FIXME: 1. Shim baseline-aligned items so their intrinsic size contributions reflect their baseline alignment.
 
+    // OPTIMIZATION: Group the items by their span size up front, instead of sweeping the entire item list
+    //               once for every span size between 1 and the largest one. In a grid where one item spans
+    //               hundreds of tracks (a sidebar next to hundreds of auto rows, say), those sweeps would
+    //               walk the item list hundreds of times and find nothing.
+    HashMap<size_t, Vector<GridItem&>> items_by_span;
+    for (auto& item : m_grid_items)
+        items_by_span.ensure(item.span(dimension)).append(item);
+    auto spans = items_by_span.keys();
+    quick_sort(spans);
+
     // 2. Size tracks to fit non-spanning items:
-    increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, 1);
+    if (auto it = items_by_span.find(1); it != items_by_span.end())
+        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, it->value);
 
     // 3. Increase sizes to accommodate spanning items crossing content-sized tracks: Next, consider the
     // items with a span of 2 that do not span a track with a flexible sizing function.
     // Repeat incrementally for items with greater spans until all items have been considered.
-    size_t max_item_span = 1;
-    for (auto& item : m_grid_items)
-        max_item_span = max(item.span(dimension), max_item_span);
-    for (size_t span = 2; span <= max_item_span; span++)
-        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, span);
+    for (auto span : spans) {
+        if (span < 2)
+            continue;
+        increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(dimension, items_by_span.find(span)->value);
+    }
 
     // 4. Increase sizes to accommodate spanning items crossing flexible tracks: Next, repeat the previous
     // step instead considering (together, rather than grouped by span size) all items that do span a
@@ -933,15 +945,11 @@ void GridFormattingContext::distribute_extra_space_across_spanned_tracks_growth_
     }
 }
 
-void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, size_t span)
+void GridFormattingContext::increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension dimension, Vector<GridItem&> const& items)
 {
     auto& available_size = dimension == GridDimension::Column ? m_available_space->width : m_available_space->height;
     auto& tracks = dimension == GridDimension::Column ? m_grid_columns : m_grid_rows;
-    for (auto& item : m_grid_items) {
-        auto const item_span = item.span(dimension);
-        if (item_span != span)
-            continue;
-
+    for (auto& item : items) {
         Vector<GridTrack&> spanned_tracks;
         for_each_spanned_track_by_item(item, dimension, [&](GridTrack& track) {
             spanned_tracks.append(track);
@@ -2302,7 +2310,7 @@ CSSPixels GridFormattingContext::automatic_content_width() const
     return m_grid_container_used_values.content_width();
 }
 
-CSSPixels GridFormattingContext::automatic_content_height() const
+CSSPixels GridFormattingContext::compute_automatic_content_height() const
 {
     return m_automatic_content_height;
 }
@@ -187,7 +187,7 @@ public:
 
     virtual void run(AvailableSpace const& available_space) override;
     virtual CSSPixels automatic_content_width() const override;
-    virtual CSSPixels automatic_content_height() const override;
+    virtual CSSPixels compute_automatic_content_height() const override;
     StaticPositionRect calculate_static_position_rect(Box const&) const;
 
     Box const& grid_container() const { return context_box(); }
@@ -374,7 +374,7 @@ private:
 
     void initialize_track_sizes(GridDimension);
     void resolve_intrinsic_track_sizes(GridDimension);
-    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, size_t span);
+    void increase_sizes_to_accommodate_spanning_items_crossing_content_sized_tracks(GridDimension, Vector<GridItem&> const& items);
     void increase_sizes_to_accommodate_spanning_items_crossing_flexible_tracks(GridDimension);
     void maximize_tracks_using_available_size(AvailableSpace const& available_space, GridDimension dimension);
     void maximize_tracks(GridDimension);
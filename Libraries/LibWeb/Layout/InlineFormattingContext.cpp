@@ -75,7 +75,7 @@ CSSPixels InlineFormattingContext::automatic_content_width() const
     return m_automatic_content_width;
 }
 
-CSSPixels InlineFormattingContext::automatic_content_height() const
+CSSPixels InlineFormattingContext::compute_automatic_content_height() const
 {
     return m_automatic_content_height;
 }
@@ -24,7 +24,7 @@ public:
     BlockContainer const& containing_block() const { return static_cast<BlockContainer const&>(context_box()); }
 
     virtual void run(AvailableSpace const&) override;
-    virtual CSSPixels automatic_content_height() const override;
+    virtual CSSPixels compute_automatic_content_height() const override;
     virtual CSSPixels automatic_content_width() const override;
     StaticPositionRect calculate_static_position_rect(Box const&) const;
 
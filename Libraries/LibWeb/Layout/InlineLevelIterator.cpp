@@ -593,7 +593,12 @@ Optional<InlineLevelIterator::Item> InlineLevelIterator::next_without_lookahead(
         }
 
         auto shape_features = create_and_merge_font_features();
-        auto glyph_run = Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, shape_features);
+
+        // NOTE: Chunks that start at a tab stop bake the tab offset into their glyph positions, so they
+        //       can't go through the text node's shaped text cache.
+        auto glyph_run = x == 0
+            ? text_node->shape_text(chunk.start, chunk.view, chunk.font, text_type, shape_features, letter_spacing.to_float())
+            : Gfx::shape_text({ x, 0 }, letter_spacing.to_float(), chunk.view, chunk.font, text_type, shape_features);
 
         CSSPixels chunk_width = CSSPixels::nearest_value_for(glyph_run->width() + x);
 
@@ -22,6 +22,52 @@ LayoutState::~LayoutState()
 {
 }
 
+void LayoutState::record_independent_formatting_context_layout(Box const& box, AvailableSpace const& available_space, CSSPixels automatic_content_height)
+{
+    completed_independent_formatting_context_layouts.set(box, IndependentFormattingContextLayout { available_space, automatic_content_height });
+}
+
+Optional<CSSPixels> LayoutState::try_to_reuse_independent_formatting_context_layout(Box const& box, AvailableSpace const& available_space, LayoutState const& previous_state)
+{
+    auto recorded_layout = previous_state.completed_independent_formatting_context_layouts.get(box);
+    if (!recorded_layout.has_value() || recorded_layout->available_space != available_space)
+        return {};
+
+    auto const* previous_root_used_values = previous_state.used_values_per_layout_node.get(box).value_or(nullptr);
+    if (!previous_root_used_values)
+        return {};
+
+    // The box's own size and position are determined by the formatting context it participates in,
+    // which is running right now; only the results of the layout *inside* the box are copied.
+    auto& root_used_values = get_mutable(box);
+    root_used_values.line_boxes = previous_root_used_values->line_boxes;
+    for (auto const& floating_descendant : previous_root_used_values->floating_descendants())
+        root_used_values.add_floating_descendant(*floating_descendant);
+
+    box.for_each_in_subtree([&](auto const& descendant) {
+        auto const* previous_used_values = previous_state.used_values_per_layout_node.get(descendant).value_or(nullptr);
+        if (!previous_used_values)
+            return TraversalDecision::Continue;
+        // NOTE: Since we traverse in pre-order, the containing block of `descendant` has already
+        //       been (re)created in this state, so get_mutable() wires it up correctly.
+        auto& used_values = get_mutable(as<NodeWithStyle>(descendant));
+        auto const* containing_block_used_values = used_values.containing_block_used_values();
+        used_values = *previous_used_values;
+        used_values.set_containing_block_used_values(containing_block_used_values);
+
+        // Carry forward recordings for nested formatting context roots, so they remain
+        // individually reusable even if this subtree is invalidated later.
+        if (auto const* descendant_box = as_if<Box>(descendant)) {
+            if (auto recorded = previous_state.completed_independent_formatting_context_layouts.get(*descendant_box); recorded.has_value())
+                completed_independent_formatting_context_layouts.set(*descendant_box, *recorded);
+        }
+        return TraversalDecision::Continue;
+    });
+
+    record_independent_formatting_context_layout(box, available_space, recorded_layout->automatic_content_height);
+    return recorded_layout->automatic_content_height;
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
     if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
@@ -215,8 +261,10 @@ static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable =
 void LayoutState::commit(Box& root)
 {
     // Go through the layout tree and detach all paintables. The layout tree should only point to the new paintable tree
-    // which we're about to build.
+    // which we're about to build. Paintables that are candidates for reuse are stashed on their layout node first, so
+    // they stay alive until we get to them below.
     root.for_each_in_inclusive_subtree([](Node& node) {
+        node.stash_paintable_for_reuse({});
         node.clear_paintables();
         return TraversalDecision::Continue;
     });
@@ -272,7 +320,14 @@ void LayoutState::commit(Box& root)
         auto& used_values = *it.value;
         auto& node = used_values.node();
 
-        auto paintable = node.create_paintable();
+        // OPTIMIZATION: If the layout node survived from the previous layout pass, reuse its old paintable instead of
+        //               allocating a fresh one. reset_for_reuse() wipes everything derived from the old pass, while
+        //               resources that stay valid across layouts (scroll state, fragment storage) remain attached.
+        auto paintable = node.take_stashed_paintable({});
+        if (paintable)
+            paintable->reset_for_reuse();
+        else
+            paintable = node.create_paintable();
         node.add_paintable(paintable);
 
         // For boxes, transfer all the state needed for painting.
@@ -365,8 +420,20 @@ void LayoutState::commit(Box& root)
         paintable.set_offset(offset);
     }
 
-    for (auto* text_node : text_nodes)
-        text_node->add_paintable(text_node->create_paintable());
+    for (auto* text_node : text_nodes) {
+        auto paintable = text_node->take_stashed_paintable({});
+        if (paintable)
+            paintable->reset_for_reuse();
+        else
+            paintable = text_node->create_paintable();
+        text_node->add_paintable(paintable);
+    }
+
+    // Drop any stashed paintables that did not end up being reused, so they don't linger past this pass.
+    root.for_each_in_inclusive_subtree([](Node& node) {
+        node.clear_stashed_paintable({});
+        return TraversalDecision::Continue;
+    });
 
     build_paint_tree(root);
 
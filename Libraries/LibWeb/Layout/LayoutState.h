@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
+#include <LibWeb/Layout/AvailableSpace.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/LineBox.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -22,9 +23,6 @@ enum class SizeConstraint {
     MaxContent,
 };
 
-class AvailableSize;
-class AvailableSpace;
-
 // https://www.w3.org/TR/css-position-3/#static-position-rectangle
 struct StaticPositionRect {
     enum class Alignment {
@@ -83,6 +81,8 @@ struct LayoutState {
         // the constraint is used in that axis instead.
         AvailableSpace available_inner_space_or_constraints_from(AvailableSpace const& outer_space) const;
 
+        void set_containing_block_used_values(UsedValues const* used_values) { m_containing_block_used_values = used_values; }
+
         void set_content_offset(CSSPixelPoint new_offset) { offset = new_offset; }
         void set_content_x(CSSPixels x) { offset.set_x(x); }
         void set_content_y(CSSPixels y) { offset.set_y(y); }
@@ -196,6 +196,9 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    LayoutState() = default;
+    LayoutState(LayoutState&&) = default;
+    LayoutState& operator=(LayoutState&&) = default;
     ~LayoutState();
 
     // Commits the used values produced by layout and builds a paintable tree.
@@ -204,8 +207,26 @@ struct LayoutState {
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
+    // OPTIMIZATION: Nothing inside an independent formatting context can affect layout outside of
+    //               it, so a later layout pass may reuse its results wholesale, as long as nothing
+    //               in the subtree has been invalidated and it's laid out against the same amount
+    //               of available space. (The state from the previous pass is kept alive by
+    //               Document::update_layout for exactly this purpose.) Along with the available
+    //               space, we record the automatic content height reported after layout, since
+    //               most formatting contexts can only compute it while running.
+    struct IndependentFormattingContextLayout {
+        AvailableSpace available_space;
+        CSSPixels automatic_content_height;
+    };
+    void record_independent_formatting_context_layout(Box const&, AvailableSpace const&, CSSPixels automatic_content_height);
+
+    // Returns the recorded automatic content height on success.
+    [[nodiscard]] Optional<CSSPixels> try_to_reuse_independent_formatting_context_layout(Box const&, AvailableSpace const&, LayoutState const& previous_state);
+
     OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
 
+    HashMap<GC::Ref<Box const>, IndependentFormattingContextLayout> completed_independent_formatting_context_layouts;
+
 private:
     void resolve_relative_positions();
 };
@@ -55,6 +55,7 @@ void Node::visit_edges(Cell::Visitor& visitor)
     for (auto const& paintable : m_paintable) {
         visitor.visit(GC::Ptr { &paintable });
     }
+    visitor.visit(m_stashed_paintable);
     visitor.visit(m_containing_block);
     visitor.visit(m_pseudo_element_generator);
     TreeNode::visit_edges(visitor);
@@ -1112,6 +1113,22 @@ void Node::clear_paintables()
     m_paintable.clear();
 }
 
+void Node::stash_paintable_for_reuse(Badge<LayoutState>)
+{
+    // Only the simple case of a single paintable is worth reusing; inline nodes get one
+    // paintable per line box and are always rebuilt from scratch.
+    m_stashed_paintable = nullptr;
+    if (!is_inline_node() && m_paintable.size_slow() == 1)
+        m_stashed_paintable = m_paintable.first();
+}
+
+GC::Ptr<Painting::Paintable> Node::take_stashed_paintable(Badge<LayoutState>)
+{
+    auto paintable = m_stashed_paintable;
+    m_stashed_paintable = nullptr;
+    return paintable;
+}
+
 GC::Ptr<Painting::Paintable> Node::create_paintable() const
 {
     return nullptr;
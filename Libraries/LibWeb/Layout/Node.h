@@ -70,6 +70,12 @@ public:
     void add_paintable(GC::Ptr<Painting::Paintable>);
     void clear_paintables();
 
+    // Used by LayoutState::commit() to carry a reusable paintable across a relayout: the stash
+    // keeps the paintable alive between tearing down the old paint tree and building the new one.
+    void stash_paintable_for_reuse(Badge<LayoutState>);
+    GC::Ptr<Painting::Paintable> take_stashed_paintable(Badge<LayoutState>);
+    void clear_stashed_paintable(Badge<LayoutState>) { m_stashed_paintable = nullptr; }
+
     virtual GC::Ptr<Painting::Paintable> create_paintable() const;
 
     DOM::Document& document();
@@ -216,6 +222,7 @@ private:
 
     GC::Ref<DOM::Node> m_dom_node;
     PaintableList m_paintable;
+    GC::Ptr<Painting::Paintable> m_stashed_paintable;
 
     GC::Ptr<Box> m_containing_block;
 
@@ -44,7 +44,7 @@ CSSPixels SVGFormattingContext::automatic_content_width() const
     return 0;
 }
 
-CSSPixels SVGFormattingContext::automatic_content_height() const
+CSSPixels SVGFormattingContext::compute_automatic_content_height() const
 {
     return 0;
 }
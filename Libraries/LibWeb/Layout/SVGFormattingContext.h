@@ -22,7 +22,7 @@ public:
 
     virtual void run(AvailableSpace const&) override;
     virtual CSSPixels automatic_content_width() const override;
-    virtual CSSPixels automatic_content_height() const override;
+    virtual CSSPixels compute_automatic_content_height() const override;
 
 private:
     void layout_svg_element(Box const&);
@@ -1683,7 +1683,38 @@ void TableFormattingContext::run(AvailableSpace const& available_space)
     }
 
     // Distribute the width of the table among columns.
-    distribute_width_to_columns();
+    // OPTIMIZATION: The width distribution is a pure function of the table's content and the widths
+    //               in the cache key below. If nothing in the table has been invalidated since the
+    //               last layout pass, reuse the cached distribution instead of redistributing from
+    //               scratch. Intrinsic sizing passes run on throwaway state under artificial
+    //               constraints, so only the normal pass consults and updates the cache.
+    auto const& containing_block_state = m_state.get(*table_wrapper().containing_block());
+    auto& cached_distribution = table_box().cached_table_column_widths();
+    auto cached_distribution_matches = [&] {
+        return m_layout_mode == LayoutMode::Normal
+            && cached_distribution
+            && cached_distribution->containing_block_width == containing_block_state.content_width()
+            && cached_distribution->containing_block_height == containing_block_state.content_height()
+            && cached_distribution->table_width == m_state.get(table_box()).content_width()
+            && cached_distribution->used_widths.size() == m_columns.size();
+    };
+    if (cached_distribution_matches()) {
+        for (size_t column_index = 0; column_index < m_columns.size(); ++column_index)
+            m_columns[column_index].used_width = cached_distribution->used_widths[column_index];
+    } else {
+        distribute_width_to_columns();
+        if (m_layout_mode == LayoutMode::Normal) {
+            Vector<CSSPixels> used_widths;
+            used_widths.ensure_capacity(m_columns.size());
+            for (auto const& column : m_columns)
+                used_widths.unchecked_append(column.used_width);
+            cached_distribution = make<CachedTableColumnWidths>(
+                containing_block_state.content_width(),
+                containing_block_state.content_height(),
+                m_state.get(table_box()).content_width(),
+                move(used_widths));
+        }
+    }
 
     compute_table_height();
 
@@ -1709,7 +1740,7 @@ CSSPixels TableFormattingContext::automatic_content_width() const
     return greatest_child_width(context_box());
 }
 
-CSSPixels TableFormattingContext::automatic_content_height() const
+CSSPixels TableFormattingContext::compute_automatic_content_height() const
 {
     return m_automatic_content_height;
 }
@@ -296,6 +296,32 @@ void TextNode::invalidate_text_for_rendering()
 {
     m_text_for_rendering = {};
     m_grapheme_segmenter.clear();
+    m_shaped_text_cache.clear();
+}
+
+NonnullRefPtr<Gfx::GlyphRun> TextNode::shape_text(size_t offset, Utf16View const& view, Gfx::Font const& font, Gfx::GlyphRun::TextType text_type, Gfx::ShapeFeatures const& features, float letter_spacing) const
+{
+    // OPTIMIZATION: Shaping is by far the most expensive part of inline layout, and the same chunks get
+    //               shaped again for every intrinsic sizing pass and every relayout, even though the result
+    //               only depends on the text and the style. Cache the shaped runs here; the cache is
+    //               dropped whenever the text changes, and an entry is re-shaped if the style-derived
+    //               inputs no longer match.
+    auto& entry = m_shaped_text_cache.ensure(offset);
+    if (!entry.glyph_run
+        || entry.font.ptr() != &font
+        || entry.length_in_code_units != view.length_in_code_units()
+        || entry.letter_spacing != letter_spacing
+        || entry.features != features) {
+        entry.font = font;
+        entry.length_in_code_units = view.length_in_code_units();
+        entry.letter_spacing = letter_spacing;
+        entry.features = features;
+        entry.glyph_run = Gfx::shape_text({}, letter_spacing, view, font, text_type, features);
+    }
+
+    // NOTE: Line building translates glyph positions within the run in place, so we must hand out a copy
+    //       and never the cached run itself.
+    return entry.glyph_run->clone();
 }
 
 Utf16String const& TextNode::text_for_rendering() const
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/Utf16String.h>
 #include <AK/Utf16View.h>
 #include <LibGfx/TextLayout.h>
@@ -74,6 +75,8 @@ public:
 
     Unicode::Segmenter& grapheme_segmenter() const;
 
+    NonnullRefPtr<Gfx::GlyphRun> shape_text(size_t offset, Utf16View const&, Gfx::Font const&, Gfx::GlyphRun::TextType, Gfx::ShapeFeatures const&, float letter_spacing) const;
+
     virtual GC::Ptr<Painting::Paintable> create_paintable() const override;
 
 private:
@@ -81,8 +84,18 @@ private:
 
     void compute_text_for_rendering();
 
+    // Shaped glyph runs, keyed by the chunk's starting offset in text_for_rendering().
+    struct ShapedTextEntry {
+        RefPtr<Gfx::Font const> font;
+        size_t length_in_code_units { 0 };
+        float letter_spacing { 0 };
+        Gfx::ShapeFeatures features;
+        RefPtr<Gfx::GlyphRun> glyph_run;
+    };
+
     Optional<Utf16String> m_text_for_rendering;
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
+    mutable HashMap<size_t, ShapedTextEntry> m_shaped_text_cache;
 };
 
 template<>
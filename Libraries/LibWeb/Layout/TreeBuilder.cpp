@@ -661,10 +661,15 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
 
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
+    auto element_skips_its_contents = [&dom_node]() {
         if (is<DOM::Element>(dom_node)) {
             auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
+            // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+            // This covers content-visibility: hidden, and content-visibility: auto on elements that are not
+            // relevant to the user. A skipped element keeps its principal box (so its size and proximity to
+            // the viewport can still be determined), but none of its contents get layout nodes, keeping them
+            // out of layout and paint entirely.
+            return element.skips_its_contents();
         }
         return false;
     }();
@@ -678,11 +683,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
             CSS::resolve_counters(element_reference);
         }
 
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
     }
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -718,7 +723,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     if (is<HTML::HTMLSlotElement>(dom_node)) {
         auto& slot_element = static_cast<HTML::HTMLSlotElement&>(dom_node);
 
-        if (slot_element.computed_properties()->content_visibility() != CSS::ContentVisibility::Hidden) {
+        if (!slot_element.skips_its_contents()) {
             auto slottables = slot_element.assigned_nodes_internal();
             push_parent(as<NodeWithStyle>(*layout_node));
 
@@ -735,7 +740,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -801,10 +806,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::PseudoElement::Before, AppendOrPrepend::Prepend);
@@ -813,7 +818,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     if (is<SVG::SVGGraphicsElement>(dom_node)) {
         auto& graphics_element = static_cast<SVG::SVGGraphicsElement&>(dom_node);
@@ -834,7 +839,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
 
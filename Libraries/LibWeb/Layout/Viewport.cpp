@@ -93,6 +93,7 @@ void Viewport::update_text_blocks()
         text_blocks.append({ builder.to_utf16_string(), text_positions });
 
     m_text_blocks = move(text_blocks);
+    ++m_text_blocks_generation;
 }
 
 }
@@ -31,6 +31,10 @@ public:
     Vector<TextBlock> const& text_blocks();
     void invalidate_text_blocks_cache() { m_text_blocks.clear(); }
 
+    // Bumped every time the text blocks are rebuilt, so consumers caching derived data (like
+    // find-in-page match offsets) can tell whether their cache is still valid.
+    u64 text_blocks_generation() const { return m_text_blocks_generation; }
+
     DOM::Document const& dom_node() const { return static_cast<DOM::Document const&>(*Node::dom_node()); }
 
     virtual void visit_edges(Visitor&) override;
@@ -43,6 +47,7 @@ private:
     virtual bool is_viewport() const override { return true; }
 
     Optional<Vector<TextBlock>> m_text_blocks;
+    u64 m_text_blocks_generation { 0 };
 };
 
 template<>
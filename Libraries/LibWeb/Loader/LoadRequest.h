@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -44,6 +45,16 @@ public:
     bool store_set_cookie_headers() const { return m_store_set_cookie_headers; }
     void set_store_set_cookie_headers(bool store_set_cookie_headers) { m_store_set_cookie_headers = store_set_cookie_headers; }
 
+    // Scheduling hint passed on to RequestServer; render-blocking resources should be fetched
+    // ahead of other subresources, and speculative loads behind them.
+    Requests::RequestPriority priority() const { return m_priority; }
+    void set_priority(Requests::RequestPriority priority) { m_priority = priority; }
+
+    // Keepalive requests (sendBeacon() and fetch() with keepalive set) may outlive the page that
+    // issued them; RequestServer lets them finish even after this process disconnects.
+    bool is_keepalive() const { return m_is_keepalive; }
+    void set_keepalive(bool keepalive) { m_is_keepalive = keepalive; }
+
     void start_timer() { m_load_timer.start(); }
     AK::Duration load_time() const { return m_load_timer.elapsed_time(); }
 
@@ -88,6 +99,8 @@ private:
     GC::Root<Page> m_page;
     bool m_main_resource { false };
     bool m_store_set_cookie_headers { true };
+    bool m_is_keepalive { false };
+    Requests::RequestPriority m_priority { Requests::RequestPriority::Normal };
 };
 
 }
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/QuickSort.h>
 #include <LibCore/Directory.h>
 #include <LibCore/MimeData.h>
 #include <LibCore/Resource.h>
@@ -16,7 +17,9 @@
 #include <LibURL/Parser.h>
 #include <LibWeb/Cookie/Cookie.h>
 #include <LibWeb/Cookie/ParsedCookie.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Loader/ContentFilter.h>
 #include <LibWeb/Loader/GeneratedPagesLoader.h>
 #include <LibWeb/Loader/LoadRequest.h>
@@ -96,6 +99,72 @@ void ResourceLoader::preconnect(URL::URL const& url)
         m_request_client->ensure_connection(url, RequestServer::CacheLevel::CreateConnection);
 }
 
+void ResourceLoader::predict_connections_for_navigation(URL::URL const& url)
+{
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    // Warm up the connection for the document itself, ...
+    preconnect(url);
+
+    auto it = m_subresource_origins_by_document_origin.find(url.origin().serialize());
+    if (it == m_subresource_origins_by_document_origin.end())
+        return;
+
+    // ... and for the origins that documents from this origin pulled subresources from before.
+    static constexpr size_t max_predicted_preconnects = 6;
+    struct OriginAndCount {
+        String origin;
+        u32 count;
+    };
+    Vector<OriginAndCount> subresource_origins;
+    subresource_origins.ensure_capacity(it->value.size());
+    for (auto const& [origin, count] : it->value)
+        subresource_origins.unchecked_append({ origin, count });
+    quick_sort(subresource_origins, [](auto const& a, auto const& b) { return a.count > b.count; });
+
+    for (size_t i = 0; i < min(subresource_origins.size(), max_predicted_preconnects); ++i) {
+        if (auto origin_url = URL::Parser::basic_parse(subresource_origins[i].origin); origin_url.has_value())
+            preconnect(origin_url.release_value());
+    }
+}
+
+void ResourceLoader::learn_subresource_origin(LoadRequest const& request)
+{
+    auto page = request.page();
+    if (!page || request.is_main_resource())
+        return;
+
+    auto const& url = request.url().value();
+    if (!url.scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    auto document = page->top_level_traversable()->active_document();
+    if (!document)
+        return;
+
+    auto document_origin = document->origin();
+    if (document_origin.is_opaque() || document_origin.is_same_origin(url.origin()))
+        return;
+    if (!document->url().scheme().is_one_of("http"sv, "https"sv))
+        return;
+
+    static constexpr size_t max_tracked_document_origins = 64;
+    static constexpr size_t max_tracked_subresource_origins = 16;
+
+    auto serialized_document_origin = document_origin.serialize();
+    if (!m_subresource_origins_by_document_origin.contains(serialized_document_origin)
+        && m_subresource_origins_by_document_origin.size() >= max_tracked_document_origins)
+        return;
+
+    auto& subresource_origins = m_subresource_origins_by_document_origin.ensure(serialized_document_origin);
+    auto serialized_origin = url.origin().serialize();
+    if (auto existing = subresource_origins.find(serialized_origin); existing != subresource_origins.end())
+        ++existing->value;
+    else if (subresource_origins.size() < max_tracked_subresource_origins)
+        subresource_origins.set(move(serialized_origin), 1);
+}
+
 static HashMap<LoadRequest, NonnullRefPtr<Resource>> s_resource_cache;
 
 RefPtr<Resource> ResourceLoader::load_resource(Resource::Type type, LoadRequest& request)
@@ -485,7 +554,7 @@ void ResourceLoader::load(LoadRequest& request, GC::Root<SuccessCallback> succes
     }
 }
 
-void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersReceived> on_headers_received, GC::Root<OnDataReceived> on_data_received, GC::Root<OnComplete> on_complete)
+RefPtr<Requests::Request> ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersReceived> on_headers_received, GC::Root<OnDataReceived> on_data_received, GC::Root<OnComplete> on_complete)
 {
     auto const& url = request.url().value();
 
@@ -494,19 +563,19 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersRec
 
     if (should_block_request(request)) {
         on_complete->function()(false, {}, "Request was blocked"sv);
-        return;
+        return nullptr;
     }
 
     if (!url.scheme().is_one_of("http"sv, "https"sv)) {
         // FIXME: Non-network requests from fetch should not go through this path.
         on_complete->function()(false, {}, "Cannot establish connection non-network scheme"sv);
-        return;
+        return nullptr;
     }
 
     auto protocol_request = start_network_request(request);
     if (!protocol_request) {
         on_complete->function()(false, {}, "Failed to start network request"sv);
-        return;
+        return nullptr;
     }
 
     auto protocol_headers_received = [this, on_headers_received, request](auto const& response_headers, auto status_code, auto const& reason_phrase) {
@@ -531,6 +600,7 @@ void ResourceLoader::load_unbuffered(LoadRequest& request, GC::Root<OnHeadersRec
     };
 
     protocol_request->set_unbuffered_request_callbacks(move(protocol_headers_received), move(protocol_data_received), move(protocol_complete));
+    return protocol_request;
 }
 
 RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest const& request)
@@ -552,12 +622,14 @@ RefPtr<Requests::Request> ResourceLoader::start_network_request(LoadRequest cons
         return nullptr;
     }
 
-    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy);
+    auto protocol_request = m_request_client->start_request(request.method(), request.url().value(), headers, request.body(), proxy, request.priority(), request.is_keepalive() ? Requests::IsKeepalive::Yes : Requests::IsKeepalive::No);
     if (!protocol_request) {
         log_failure(request, "Failed to initiate load"sv);
         return nullptr;
     }
 
+    learn_subresource_origin(request);
+
     protocol_request->on_certificate_requested = []() -> Requests::Request::CertificateAndKey {
         return {};
     };
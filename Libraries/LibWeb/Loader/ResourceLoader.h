@@ -9,6 +9,7 @@
 
 #include <AK/ByteString.h>
 #include <AK/Function.h>
+#include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <LibCore/EventReceiver.h>
 #include <LibRequests/Forward.h>
@@ -39,13 +40,20 @@ public:
     using OnDataReceived = GC::Function<void(ReadonlyBytes data)>;
     using OnComplete = GC::Function<void(bool success, Requests::RequestTimingInfo const& timing_info, Optional<StringView> error_message)>;
 
-    void load_unbuffered(LoadRequest&, GC::Root<OnHeadersReceived>, GC::Root<OnDataReceived>, GC::Root<OnComplete>);
+    // Returns the underlying request, so the caller can pause and resume data delivery for
+    // backpressure. May be null if the request could not be started.
+    RefPtr<Requests::Request> load_unbuffered(LoadRequest&, GC::Root<OnHeadersReceived>, GC::Root<OnDataReceived>, GC::Root<OnComplete>);
 
     RefPtr<Requests::RequestClient>& request_client() { return m_request_client; }
 
     void prefetch_dns(URL::URL const&);
     void preconnect(URL::URL const&);
 
+    // OPTIMIZATION: Warms up connections for a navigation target and the cross-origin subresource
+    //               origins that documents from the same origin pulled in earlier this session, so
+    //               that DNS and TLS handshakes overlap with fetching the HTML.
+    void predict_connections_for_navigation(URL::URL const&);
+
     Function<void()> on_load_counter_change;
 
     int pending_loads() const { return m_pending_loads; }
@@ -78,6 +86,7 @@ private:
     explicit ResourceLoader(GC::Heap&, NonnullRefPtr<Requests::RequestClient>);
 
     RefPtr<Requests::Request> start_network_request(LoadRequest const&);
+    void learn_subresource_origin(LoadRequest const&);
     void handle_network_response_headers(LoadRequest const&, HTTP::HeaderMap const&);
     void finish_network_request(NonnullRefPtr<Requests::Request>);
 
@@ -92,6 +101,10 @@ private:
     Vector<String> m_preferred_languages = { "en"_string };
     NavigatorCompatibilityMode m_navigator_compatibility_mode;
     bool m_enable_global_privacy_control { false };
+
+    // Maps the serialized origin of a top-level document to the cross-origin subresource origins
+    // fetched while it was active, along with how often each of them was seen.
+    HashMap<String, HashMap<String, u32>> m_subresource_origins_by_document_origin;
 };
 
 }
@@ -24,6 +24,8 @@
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Selection/Selection.h>
 
@@ -744,6 +746,40 @@ Page::FindInPageResult Page::find_in_page_previous_match()
     return result;
 }
 
+Vector<Page::TextRun> Page::extract_text_runs()
+{
+    if (!top_level_traversable_is_initialized())
+        return {};
+
+    Vector<TextRun> runs;
+
+    for (auto const& document : documents_in_active_window()) {
+        document->update_layout(DOM::UpdateLayoutReason::PageExtractTextRuns);
+
+        auto* viewport_paintable = document->paintable();
+        if (!viewport_paintable)
+            continue;
+
+        viewport_paintable->for_each_in_inclusive_subtree([&](auto const& paintable) {
+            if (!paintable.is_visible())
+                return TraversalDecision::Continue;
+
+            if (auto const* paintable_with_lines = as_if<Painting::PaintableWithLines>(paintable)) {
+                for (auto const& fragment : paintable_with_lines->fragments()) {
+                    auto text = fragment.text();
+                    if (text.is_empty())
+                        continue;
+                    runs.append({ Utf16String::from_utf16(text), fragment.absolute_rect().to_type<float>() });
+                }
+            }
+
+            return TraversalDecision::Continue;
+        });
+    }
+
+    return runs;
+}
+
 void Page::update_find_in_page_selection(Vector<GC::Root<DOM::Range>> matches)
 {
     if (matches.is_empty())
@@ -798,3 +834,29 @@ ErrorOr<Web::Page::MediaContextMenu> IPC::decode(Decoder& decoder)
         .is_looping = TRY(decoder.decode<bool>()),
     };
 }
+
+template<>
+ErrorOr<void> IPC::encode(Encoder& encoder, Web::Page::TextRun const& run)
+{
+    TRY(encoder.encode(run.text));
+    TRY(encoder.encode(run.rect.x()));
+    TRY(encoder.encode(run.rect.y()));
+    TRY(encoder.encode(run.rect.width()));
+    TRY(encoder.encode(run.rect.height()));
+    return {};
+}
+
+template<>
+ErrorOr<Web::Page::TextRun> IPC::decode(Decoder& decoder)
+{
+    auto text = TRY(decoder.decode<Utf16String>());
+    auto x = TRY(decoder.decode<float>());
+    auto y = TRY(decoder.decode<float>());
+    auto width = TRY(decoder.decode<float>());
+    auto height = TRY(decoder.decode<float>());
+
+    return Web::Page::TextRun {
+        .text = move(text),
+        .rect = { x, y, width, height },
+    };
+}
@@ -224,9 +224,28 @@ public:
     FindInPageResult find_in_page_previous_match();
     Optional<FindInPageQuery> last_find_in_page_query() const { return m_last_find_in_page_query; }
 
+    struct TextRun {
+        Utf16String text;
+        Gfx::FloatRect rect; // In CSS pixels, relative to the top-level document's origin.
+    };
+    // Walks the paintable trees of every document in the active window and returns each text
+    // fragment together with its absolute geometry, in paint order. This hands reader mode and
+    // similar text consumers the whole page in one batch instead of them walking the DOM from
+    // script and forcing a layout per node.
+    Vector<TextRun> extract_text_runs();
+
     bool listen_for_dom_mutations() const { return m_listen_for_dom_mutations; }
     void set_listen_for_dom_mutations(bool listen_for_dom_mutations) { m_listen_for_dom_mutations = listen_for_dom_mutations; }
 
+    // OPTIMIZATION: Incremented whenever something happens that could change an intersection observation
+    //               anywhere in the page: a layout pass, a scroll, or a new target being observed. Each
+    //               document remembers the epoch it last processed, so the per-frame update intersection
+    //               observations steps cost nothing while the page is visually idle. This lives on the Page
+    //               (rather than the Document) because an observer may watch targets in other documents,
+    //               e.g. inside an iframe.
+    u64 intersection_observation_epoch() const { return m_intersection_observation_epoch; }
+    void invalidate_intersection_observations() { ++m_intersection_observation_epoch; }
+
 private:
     explicit Page(GC::Ref<PageClient>);
     virtual void visit_edges(Visitor&) override;
@@ -298,6 +317,8 @@ private:
     URL::URL m_last_find_in_page_url;
 
     bool m_listen_for_dom_mutations { false };
+
+    u64 m_intersection_observation_epoch { 1 };
 };
 
 enum class DisplayListPlayerType {
@@ -428,4 +449,10 @@ WEB_API ErrorOr<void> encode(Encoder&, Web::Page::MediaContextMenu const&);
 template<>
 WEB_API ErrorOr<Web::Page::MediaContextMenu> decode(Decoder&);
 
+template<>
+WEB_API ErrorOr<void> encode(Encoder&, Web::Page::TextRun const&);
+
+template<>
+WEB_API ErrorOr<Web::Page::TextRun> decode(Decoder&);
+
 }
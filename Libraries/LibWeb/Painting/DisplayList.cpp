@@ -5,6 +5,7 @@
  */
 
 #include <AK/TemporaryChange.h>
+#include <LibCore/Tracing.h>
 #include <LibWeb/Painting/DevicePixelConverter.h>
 #include <LibWeb/Painting/DisplayList.h>
 
@@ -68,6 +69,8 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
 
 void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
 {
+    TRACE_SCOPE("DisplayListPlayer::execute");
+
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
@@ -125,23 +128,27 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
-    auto translate_command_by_scroll = [&](auto& command, int scroll_frame_id) {
+    auto scroll_offset_for_frame = [&](int scroll_frame_id) {
         auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id);
-        auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
-        command.visit(
-            [scroll_offset](auto& command) {
-                if constexpr (requires { command.translate_by(scroll_offset); }) {
-                    command.translate_by(scroll_offset);
-                }
+        return cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+    };
+
+    auto command_can_be_translated_by_scroll = [](DisplayListCommand const& command) {
+        return command.visit(
+            []<typename CommandType>(CommandType const&) {
+                return requires(CommandType& command) { command.translate_by(Gfx::IntPoint {}); };
             });
     };
 
     auto compute_stacking_context_bounds = [&](PushStackingContext const& push_stacking_context, size_t push_stacking_context_index) {
         Gfx::IntRect bounding_rect;
-        display_list.for_each_command_in_range(push_stacking_context_index + 1, push_stacking_context.matching_pop_index, [&](auto command, auto scroll_frame_id) {
+        // OPTIMIZATION: Translating a command's geometry means copying the whole command, so
+        //               translate its bounding rectangle by the scroll offset instead.
+        display_list.for_each_command_in_range(push_stacking_context_index + 1, push_stacking_context.matching_pop_index, [&](auto const& command, auto scroll_frame_id) {
+            auto command_rect = *command_bounding_rectangle(command);
             if (scroll_frame_id.has_value())
-                translate_command_by_scroll(command, scroll_frame_id.value());
-            bounding_rect.unite(*command_bounding_rectangle(command));
+                command_rect.translate_by(scroll_offset_for_frame(scroll_frame_id.value()));
+            bounding_rect.unite(command_rect);
             return IterationDecision::Continue;
         });
         return bounding_rect;
@@ -150,7 +157,7 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
-        auto [scroll_frame_id, clip_frame, command] = commands[command_index];
+        auto const& [scroll_frame_id, clip_frame, recorded_command] = commands[command_index];
 
         if (clip_frames_stack.last() != clip_frame) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
@@ -166,45 +173,80 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         // This is necessary when the stacking context has a CSS transform, and all
         // nested ClipFrames aggregate clip rectangles only up to the stacking context
         // node.
-        if (command.has<PushStackingContext>()) {
+        if (recorded_command.has<PushStackingContext>()) {
             clip_frames_stack.append({});
-        } else if (command.has<PopStackingContext>()) {
+        } else if (recorded_command.has<PopStackingContext>()) {
             if (auto clip_frame = clip_frames_stack.take_last()) {
                 remove_clip_frame(*clip_frame);
             }
         }
 
-        if (command.has<PaintScrollBar>()) {
-            auto& paint_scroll_bar = command.get<PaintScrollBar>();
-            auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
+        Gfx::IntPoint scroll_offset;
+        if (scroll_frame_id.has_value())
+            scroll_offset = scroll_offset_for_frame(scroll_frame_id.value());
+
+        // OPTIMIZATION: Commands are executed straight out of the recorded display list, with the
+        //               scroll offset late-bound through a painter translation instead of being
+        //               baked into a copy of each command's geometry. Only a handful of commands
+        //               still need to be patched into a copy before execution:
+        //               - PaintScrollBar bakes the current thumb position into the command.
+        //               - PushStackingContext may get its aggregated children bounds filled in,
+        //                 and its transform persists until the matching pop, so its geometry is
+        //                 translated the old-fashioned way.
+        //               - Translate shifts the coordinate system rather than geometry, so a
+        //                 balanced painter translation around it would cancel out.
+        Optional<DisplayListCommand> patched_command;
+
+        if (recorded_command.has<PaintScrollBar>()) {
+            patched_command = recorded_command;
+            auto& paint_scroll_bar = patched_command->get<PaintScrollBar>();
+            auto own_scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
             if (paint_scroll_bar.vertical) {
-                auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
+                auto offset = own_scroll_offset.y() * paint_scroll_bar.scroll_size;
                 paint_scroll_bar.thumb_rect.translate_by(0, -offset.to_int() * device_pixels_per_css_pixel);
             } else {
-                auto offset = scroll_offset.x() * paint_scroll_bar.scroll_size;
+                auto offset = own_scroll_offset.x() * paint_scroll_bar.scroll_size;
                 paint_scroll_bar.thumb_rect.translate_by(-offset.to_int() * device_pixels_per_css_pixel, 0);
             }
+            paint_scroll_bar.translate_by(scroll_offset);
+        } else if (recorded_command.has<PushStackingContext>() || recorded_command.has<Translate>()) {
+            if (!scroll_offset.is_zero()) {
+                patched_command = recorded_command;
+                patched_command->visit([&](auto& command) {
+                    if constexpr (requires { command.translate_by(scroll_offset); })
+                        command.translate_by(scroll_offset);
+                });
+            }
         }
 
-        if (scroll_frame_id.has_value())
-            translate_command_by_scroll(command, scroll_frame_id.value());
+        bool const translate_through_painter = !patched_command.has_value() && !scroll_offset.is_zero() && command_can_be_translated_by_scroll(recorded_command);
 
-        auto bounding_rect = command_bounding_rectangle(command);
+        auto bounding_rect = command_bounding_rectangle(patched_command.has_value() ? *patched_command : recorded_command);
+        if (bounding_rect.has_value() && translate_through_painter)
+            bounding_rect->translate_by(scroll_offset);
 
-        if (command.has<PushStackingContext>()) {
-            auto& push_stacking_context = command.get<PushStackingContext>();
+        if (recorded_command.has<PushStackingContext>()) {
+            auto const& push_stacking_context = recorded_command.get<PushStackingContext>();
             if (push_stacking_context.can_aggregate_children_bounds && !push_stacking_context.bounding_rect.has_value()) {
-                bounding_rect = compute_stacking_context_bounds(push_stacking_context, command_index);
-                push_stacking_context.bounding_rect = bounding_rect;
+                if (!patched_command.has_value())
+                    patched_command = recorded_command;
+                auto& patched_push_stacking_context = patched_command->get<PushStackingContext>();
+                bounding_rect = compute_stacking_context_bounds(patched_push_stacking_context, command_index);
+                patched_push_stacking_context.bounding_rect = bounding_rect;
             }
         }
 
+        auto const& command = patched_command.has_value() ? *patched_command : recorded_command;
+
         if (bounding_rect.has_value() && (bounding_rect->is_empty() || would_be_fully_clipped_by_painter(*bounding_rect))) {
             // Any clip or mask that's located outside of the visible region is equivalent to a simple clip-rect,
             // so replace it with one to avoid doing unnecessary work.
             if (command_is_clip_or_mask(command)) {
                 if (command.has<AddClipRect>()) {
-                    add_clip_rect(command.get<AddClipRect>());
+                    auto add_clip_rect_command = command.get<AddClipRect>();
+                    if (translate_through_painter)
+                        add_clip_rect_command.translate_by(scroll_offset);
+                    add_clip_rect(add_clip_rect_command);
                 } else {
                     add_clip_rect({ bounding_rect.release_value() });
                 }
@@ -217,6 +259,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
             continue;
         }
 
+        if (translate_through_painter)
+            translate({ .delta = scroll_offset });
+
 #define HANDLE_COMMAND(command_type, executor_method) \
     if (command.has<command_type>()) {                \
         executor_method(command.get<command_type>()); \
@@ -260,6 +305,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         else HANDLE_COMMAND(ApplyMaskBitmap, apply_mask_bitmap)
         else VERIFY_NOT_REACHED();
         // clang-format on
+
+        if (translate_through_painter)
+            translate({ .delta = -scroll_offset });
     }
 
     while (!clip_frames_stack.is_empty()) {
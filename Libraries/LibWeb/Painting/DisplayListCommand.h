@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/Forward.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/Vector.h>
@@ -36,6 +37,14 @@ namespace Web::Painting {
 
 class DisplayList;
 
+// Opaque slot where the display list player stashes the backend shader object it builds for a
+// gradient command, so that replaying the same display list doesn't rebuild the shader every frame.
+// This is safe because the recorded gradient geometry is immutable; scroll offsets are applied
+// through the painter during replay instead of by rewriting commands.
+struct GradientShaderCache : AtomicRefCounted<GradientShaderCache> {
+    virtual ~GradientShaderCache() = default;
+};
+
 struct DrawGlyphRun {
     NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
     double scale { 1 };
@@ -168,12 +177,15 @@ struct PopStackingContext {
 struct PaintLinearGradient {
     Gfx::IntRect gradient_rect;
     LinearGradientData linear_gradient_data;
+    mutable RefPtr<GradientShaderCache> shader_cache;
 
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return gradient_rect; }
 
     void translate_by(Gfx::IntPoint const& offset)
     {
         gradient_rect.translate_by(offset);
+        // The cached shader bakes in the gradient's position, so moving the rect invalidates it.
+        shader_cache = nullptr;
     }
     void dump(StringBuilder&) const;
 };
@@ -332,10 +344,15 @@ struct PaintRadialGradient {
     RadialGradientData radial_gradient_data;
     Gfx::IntPoint center;
     Gfx::IntSize size;
+    mutable RefPtr<GradientShaderCache> shader_cache;
 
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
 
-    void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
+    void translate_by(Gfx::IntPoint const& offset)
+    {
+        rect.translate_by(offset);
+        shader_cache = nullptr;
+    }
     void dump(StringBuilder&) const;
 };
 
@@ -343,10 +360,15 @@ struct PaintConicGradient {
     Gfx::IntRect rect;
     ConicGradientData conic_gradient_data;
     Gfx::IntPoint position;
+    mutable RefPtr<GradientShaderCache> shader_cache;
 
     [[nodiscard]] Gfx::IntRect bounding_rect() const { return rect; }
 
-    void translate_by(Gfx::IntPoint const& offset) { rect.translate_by(offset); }
+    void translate_by(Gfx::IntPoint const& offset)
+    {
+        rect.translate_by(offset);
+        shader_cache = nullptr;
+    }
     void dump(StringBuilder&) const;
 };
 
@@ -146,7 +146,7 @@ void DisplayListPlayerSkia::draw_scaled_immutable_bitmap(DrawScaledImmutableBitm
     SkPaint paint;
     canvas.save();
     canvas.clipRect(clip_rect);
-    canvas.drawImageRect(command.bitmap->sk_image(), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
+    canvas.drawImageRect(command.bitmap->sk_image_for_context(m_context), dst_rect, to_skia_sampling_options(command.scaling_mode), &paint);
     canvas.restore();
 }
 
@@ -161,7 +161,7 @@ void DisplayListPlayerSkia::draw_repeated_immutable_bitmap(DrawRepeatedImmutable
 
     auto tile_mode_x = command.repeat.x ? SkTileMode::kRepeat : SkTileMode::kDecal;
     auto tile_mode_y = command.repeat.y ? SkTileMode::kRepeat : SkTileMode::kDecal;
-    auto shader = command.bitmap->sk_image()->makeShader(tile_mode_x, tile_mode_y, sampling_options, matrix);
+    auto shader = command.bitmap->sk_image_for_context(m_context)->makeShader(tile_mode_x, tile_mode_y, sampling_options, matrix);
 
     SkPaint paint;
     paint.setShader(shader);
@@ -396,47 +396,61 @@ static SkGradientShader::Interpolation to_skia_interpolation(CSS::InterpolationM
     return interpolation;
 }
 
-void DisplayListPlayerSkia::paint_linear_gradient(PaintLinearGradient const& command)
-{
-    auto const& linear_gradient_data = command.linear_gradient_data;
-    auto const& color_stop_list = linear_gradient_data.color_stops.list;
-    auto const& repeat_length = linear_gradient_data.color_stops.repeat_length;
-    VERIFY(!color_stop_list.is_empty());
-
-    auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
+// Cached on the gradient commands so replaying the same display list reuses the shader built on
+// the first replay instead of rebuilding the stop arrays and SkShader for every frame.
+struct SkiaGradientShaderCache final : GradientShaderCache {
+    explicit SkiaGradientShaderCache(sk_sp<SkShader> shader)
+        : shader(move(shader))
+    {
+    }
 
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
-    auto const first_position = repeat_length.has_value() ? stops_with_replaced_transition_hints.first().position : 0.f;
-    for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
-        auto const& stop = stops_with_replaced_transition_hints[stop_index];
-        if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
-            continue;
+    sk_sp<SkShader> shader;
+};
 
-        colors.append(to_skia_color4f(stop.color));
-        positions.append((stop.position - first_position) / repeat_length.value_or(1));
-    }
+void DisplayListPlayerSkia::paint_linear_gradient(PaintLinearGradient const& command)
+{
+    if (!command.shader_cache) {
+        auto const& linear_gradient_data = command.linear_gradient_data;
+        auto const& color_stop_list = linear_gradient_data.color_stops.list;
+        auto const& repeat_length = linear_gradient_data.color_stops.repeat_length;
+        VERIFY(!color_stop_list.is_empty());
+
+        auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
+
+        Vector<SkColor4f> colors;
+        Vector<SkScalar> positions;
+        auto const first_position = repeat_length.has_value() ? stops_with_replaced_transition_hints.first().position : 0.f;
+        for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
+            auto const& stop = stops_with_replaced_transition_hints[stop_index];
+            if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
+                continue;
+
+            colors.append(to_skia_color4f(stop.color));
+            positions.append((stop.position - first_position) / repeat_length.value_or(1));
+        }
 
-    auto rect = command.gradient_rect.to_type<float>();
-    auto length = calculate_gradient_length<float>(rect.size(), linear_gradient_data.gradient_angle);
+        auto rect = command.gradient_rect.to_type<float>();
+        auto length = calculate_gradient_length<float>(rect.size(), linear_gradient_data.gradient_angle);
 
-    // Starting and ending points before rotation (0deg / "to top")
-    auto rect_center = rect.center();
-    auto start = rect_center.translated(0, (.5f - first_position) * length);
-    auto end = start.translated(0, repeat_length.value_or(1) * -length);
-    Array const points { to_skia_point(start), to_skia_point(end) };
+        // Starting and ending points before rotation (0deg / "to top")
+        auto rect_center = rect.center();
+        auto start = rect_center.translated(0, (.5f - first_position) * length);
+        auto end = start.translated(0, repeat_length.value_or(1) * -length);
+        Array const points { to_skia_point(start), to_skia_point(end) };
 
-    SkMatrix matrix;
-    matrix.setRotate(linear_gradient_data.gradient_angle, rect_center.x(), rect_center.y());
+        SkMatrix matrix;
+        matrix.setRotate(linear_gradient_data.gradient_angle, rect_center.x(), rect_center.y());
 
-    auto color_space = SkColorSpace::MakeSRGB();
-    auto interpolation = to_skia_interpolation(linear_gradient_data.interpolation_method);
-    auto shader = SkGradientShader::MakeLinear(points.data(), colors.data(), color_space, positions.data(), positions.size(), SkTileMode::kRepeat, interpolation, &matrix);
+        auto color_space = SkColorSpace::MakeSRGB();
+        auto interpolation = to_skia_interpolation(linear_gradient_data.interpolation_method);
+        auto shader = SkGradientShader::MakeLinear(points.data(), colors.data(), color_space, positions.data(), positions.size(), SkTileMode::kRepeat, interpolation, &matrix);
+        command.shader_cache = adopt_ref(*new SkiaGradientShaderCache(move(shader)));
+    }
 
     SkPaint paint;
     paint.setDither(true);
-    paint.setShader(shader);
-    surface().canvas().drawRect(to_skia_rect(rect), paint);
+    paint.setShader(static_cast<SkiaGradientShaderCache const&>(*command.shader_cache).shader);
+    surface().canvas().drawRect(to_skia_rect(command.gradient_rect), paint);
 }
 
 static void add_spread_distance_to_border_radius(int& border_radius, int spread_distance)
@@ -786,86 +800,90 @@ void DisplayListPlayerSkia::draw_rect(DrawRect const& command)
 
 void DisplayListPlayerSkia::paint_radial_gradient(PaintRadialGradient const& command)
 {
-    auto const& radial_gradient_data = command.radial_gradient_data;
-
-    auto color_stop_list = radial_gradient_data.color_stops.list;
-    VERIFY(!color_stop_list.is_empty());
-    auto const& repeat_length = radial_gradient_data.color_stops.repeat_length;
-    if (repeat_length.has_value())
-        color_stop_list = expand_repeat_length(color_stop_list, repeat_length.value());
-
-    auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
-
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
-    for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
-        auto const& stop = stops_with_replaced_transition_hints[stop_index];
-        if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
-            continue;
-        colors.append(to_skia_color4f(stop.color));
-        positions.append(stop.position);
-    }
+    if (!command.shader_cache) {
+        auto const& radial_gradient_data = command.radial_gradient_data;
+
+        auto color_stop_list = radial_gradient_data.color_stops.list;
+        VERIFY(!color_stop_list.is_empty());
+        auto const& repeat_length = radial_gradient_data.color_stops.repeat_length;
+        if (repeat_length.has_value())
+            color_stop_list = expand_repeat_length(color_stop_list, repeat_length.value());
+
+        auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
+
+        Vector<SkColor4f> colors;
+        Vector<SkScalar> positions;
+        for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
+            auto const& stop = stops_with_replaced_transition_hints[stop_index];
+            if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
+                continue;
+            colors.append(to_skia_color4f(stop.color));
+            positions.append(stop.position);
+        }
 
-    auto const& rect = command.rect;
-    auto center = to_skia_point(command.center.translated(command.rect.location()));
+        auto center = to_skia_point(command.center.translated(command.rect.location()));
 
-    auto const size = command.size.to_type<float>();
-    SkMatrix matrix;
-    // Skia does not support specifying of horizontal and vertical radius's separately,
-    // so instead we apply scale matrix
-    matrix.setScale(size.width() / size.height(), 1.0f, center.x(), center.y());
+        auto const size = command.size.to_type<float>();
+        SkMatrix matrix;
+        // Skia does not support specifying of horizontal and vertical radius's separately,
+        // so instead we apply scale matrix
+        matrix.setScale(size.width() / size.height(), 1.0f, center.x(), center.y());
 
-    SkTileMode tile_mode = SkTileMode::kClamp;
-    if (repeat_length.has_value())
-        tile_mode = SkTileMode::kRepeat;
+        SkTileMode tile_mode = SkTileMode::kClamp;
+        if (repeat_length.has_value())
+            tile_mode = SkTileMode::kRepeat;
 
-    auto color_space = SkColorSpace::MakeSRGB();
-    auto interpolation = to_skia_interpolation(radial_gradient_data.interpolation_method);
-    auto shader = SkGradientShader::MakeRadial(center, size.height(), colors.data(), color_space, positions.data(), positions.size(), tile_mode, interpolation, &matrix);
+        auto color_space = SkColorSpace::MakeSRGB();
+        auto interpolation = to_skia_interpolation(radial_gradient_data.interpolation_method);
+        auto shader = SkGradientShader::MakeRadial(center, size.height(), colors.data(), color_space, positions.data(), positions.size(), tile_mode, interpolation, &matrix);
+        command.shader_cache = adopt_ref(*new SkiaGradientShaderCache(move(shader)));
+    }
 
     SkPaint paint;
     paint.setDither(true);
     paint.setAntiAlias(true);
-    paint.setShader(shader);
-    surface().canvas().drawRect(to_skia_rect(rect), paint);
+    paint.setShader(static_cast<SkiaGradientShaderCache const&>(*command.shader_cache).shader);
+    surface().canvas().drawRect(to_skia_rect(command.rect), paint);
 }
 
 void DisplayListPlayerSkia::paint_conic_gradient(PaintConicGradient const& command)
 {
-    auto const& conic_gradient_data = command.conic_gradient_data;
-
-    auto color_stop_list = conic_gradient_data.color_stops.list;
-    auto const& repeat_length = conic_gradient_data.color_stops.repeat_length;
-    if (repeat_length.has_value())
-        color_stop_list = expand_repeat_length(color_stop_list, repeat_length.value());
+    if (!command.shader_cache) {
+        auto const& conic_gradient_data = command.conic_gradient_data;
+
+        auto color_stop_list = conic_gradient_data.color_stops.list;
+        auto const& repeat_length = conic_gradient_data.color_stops.repeat_length;
+        if (repeat_length.has_value())
+            color_stop_list = expand_repeat_length(color_stop_list, repeat_length.value());
+
+        VERIFY(!color_stop_list.is_empty());
+        auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
+
+        Vector<SkColor4f> colors;
+        Vector<SkScalar> positions;
+        for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
+            auto const& stop = stops_with_replaced_transition_hints[stop_index];
+            if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
+                continue;
+            colors.append(to_skia_color4f(stop.color));
+            positions.append(stop.position);
+        }
 
-    VERIFY(!color_stop_list.is_empty());
-    auto stops_with_replaced_transition_hints = replace_transition_hints_with_normal_color_stops(color_stop_list);
+        auto center = command.position.translated(command.rect.location()).to_type<float>();
 
-    Vector<SkColor4f> colors;
-    Vector<SkScalar> positions;
-    for (size_t stop_index = 0; stop_index < stops_with_replaced_transition_hints.size(); stop_index++) {
-        auto const& stop = stops_with_replaced_transition_hints[stop_index];
-        if (stop_index > 0 && stop == stops_with_replaced_transition_hints[stop_index - 1])
-            continue;
-        colors.append(to_skia_color4f(stop.color));
-        positions.append(stop.position);
+        SkMatrix matrix;
+        matrix.setRotate(-90 + conic_gradient_data.start_angle, center.x(), center.y());
+        auto color_space = SkColorSpace::MakeSRGB();
+        auto interpolation = to_skia_interpolation(conic_gradient_data.interpolation_method);
+        auto shader = SkGradientShader::MakeSweep(center.x(), center.y(), colors.data(), color_space, positions.data(), positions.size(), SkTileMode::kRepeat, 0, 360, interpolation, &matrix);
+        command.shader_cache = adopt_ref(*new SkiaGradientShaderCache(move(shader)));
     }
 
-    auto const& rect = command.rect;
-    auto center = command.position.translated(rect.location()).to_type<float>();
-
-    SkMatrix matrix;
-    matrix.setRotate(-90 + conic_gradient_data.start_angle, center.x(), center.y());
-    auto color_space = SkColorSpace::MakeSRGB();
-    auto interpolation = to_skia_interpolation(conic_gradient_data.interpolation_method);
-    auto shader = SkGradientShader::MakeSweep(center.x(), center.y(), colors.data(), color_space, positions.data(), positions.size(), SkTileMode::kRepeat, 0, 360, interpolation, &matrix);
-
     SkPaint paint;
     paint.setDither(true);
     paint.setAntiAlias(true);
-    paint.setShader(shader);
-    surface().canvas().drawRect(to_skia_rect(rect), paint);
+    paint.setShader(static_cast<SkiaGradientShaderCache const&>(*command.shader_cache).shader);
+    surface().canvas().drawRect(to_skia_rect(command.rect), paint);
 }
 
 void DisplayListPlayerSkia::add_rounded_rect_clip(AddRoundedRectClip const& command)
@@ -984,7 +1002,7 @@ void DisplayListPlayerSkia::apply_mask_bitmap(ApplyMaskBitmap const& command)
 {
     auto& canvas = surface().canvas();
 
-    auto const* mask_image = command.bitmap->sk_image();
+    auto const* mask_image = command.bitmap->sk_image_for_context(m_context);
 
     auto compile_effect = [](char const* sksl_shader) {
         auto [effect, error] = SkRuntimeEffect::MakeForShader(SkString(sksl_shader));
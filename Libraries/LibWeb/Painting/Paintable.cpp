@@ -6,6 +6,7 @@
  */
 
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 #include <LibWeb/Painting/DisplayListRecordingContext.h>
 #include <LibWeb/Painting/Paintable.h>
@@ -17,6 +18,12 @@ namespace Web::Painting {
 Paintable::Paintable(Layout::Node const& layout_node)
     : m_layout_node(layout_node)
 {
+    reset_style_derived_flags();
+}
+
+void Paintable::reset_style_derived_flags()
+{
+    auto& layout_node = this->layout_node();
     auto& computed_values = layout_node.computed_values();
     if (layout_node.is_grid_item() && computed_values.z_index().has_value()) {
         // https://www.w3.org/TR/css-grid-2/#z-order
@@ -33,6 +40,18 @@ Paintable::Paintable(Layout::Node const& layout_node)
     m_inline = layout_node.is_inline();
 }
 
+void Paintable::reset_for_reuse()
+{
+    // NOTE: The old paint tree is discarded wholesale, so nobody cares about the stale
+    //       links our old neighbors keep to us.
+    detach_all_tree_links();
+    m_containing_block = {};
+    m_selection_state = SelectionState::None;
+    m_visible_for_hit_testing = true;
+    m_needs_paint_only_properties_update = true;
+    reset_style_derived_flags();
+}
+
 Paintable::~Paintable()
 {
 }
@@ -302,6 +321,10 @@ void Paintable::set_needs_paint_only_properties_update(bool needs_update)
 
     if (needs_update) {
         document().set_needs_to_resolve_paint_only_properties();
+
+        // NOTE: Paint-only properties include transforms, which move elements around without
+        //       causing a layout, so intersection observations have to be refreshed as well.
+        document().page().invalidate_intersection_observations();
     }
 }
 
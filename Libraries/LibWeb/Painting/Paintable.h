@@ -59,6 +59,12 @@ public:
 
     void detach_from_layout_node();
 
+    // Called by LayoutState::commit() when this paintable's layout node survived a relayout, so the
+    // paintable can be reused for the new paint tree instead of being replaced by a fresh allocation.
+    // Resets all state derived from the previous layout pass, while keeping attached paint resources
+    // that remain valid across layouts.
+    virtual void reset_for_reuse();
+
     [[nodiscard]] bool is_visible() const;
     [[nodiscard]] bool is_positioned() const { return m_positioned; }
     [[nodiscard]] bool is_fixed_position() const { return m_fixed_position; }
@@ -164,6 +170,8 @@ protected:
     virtual void visit_edges(Cell::Visitor&) override;
 
 private:
+    void reset_style_derived_flags();
+
     IntrusiveListNode<Paintable> m_list_node;
     GC::Ptr<DOM::Node> m_dom_node;
     GC::Ref<Layout::Node const> m_layout_node;
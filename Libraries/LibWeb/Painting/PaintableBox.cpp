@@ -263,6 +263,23 @@ CSSPixelRect PaintableBox::absolute_paint_rect() const
     return *m_absolute_paint_rect;
 }
 
+CSSPixelRect PaintableBox::hit_test_bounding_rect() const
+{
+    if (!m_hit_test_bounding_rect.has_value())
+        m_hit_test_bounding_rect = compute_hit_test_bounding_rect();
+    return *m_hit_test_bounding_rect;
+}
+
+CSSPixelRect PaintableBox::compute_hit_test_bounding_rect() const
+{
+    auto rect = absolute_border_box_rect();
+    for (auto const* child = first_child(); child; child = child->next_sibling()) {
+        if (auto const* child_box = as_if<PaintableBox>(*child))
+            rect = rect.united(child_box->hit_test_bounding_rect());
+    }
+    return rect;
+}
+
 template<typename Callable>
 static CSSPixelRect united_rect_for_continuation_chain(PaintableBox const& start, Callable get_rect)
 {
@@ -547,6 +564,35 @@ void PaintableBox::paint_inspector_overlay_internal(DisplayListRecordingContext&
     context.display_list_recorder().draw_text(size_text_device_rect, size_text, font->with_size(font->point_size() * context.device_pixels_per_css_pixel()), Gfx::TextAlignment::Center, context.palette().color(Gfx::ColorRole::TooltipText));
 }
 
+void PaintableBox::reset_for_reuse()
+{
+    Paintable::reset_for_reuse();
+    m_stacking_context = nullptr;
+    m_overflow_data = {};
+    m_absolute_rect = {};
+    m_absolute_paint_rect = {};
+    m_hit_test_bounding_rect = {};
+    m_override_borders_data = {};
+    m_table_cell_coordinates = {};
+    m_used_values_for_grid_template_columns = nullptr;
+    m_used_values_for_grid_template_rows = nullptr;
+    // NOTE: Scroll and clip frames are reassigned after every layout, and a stale frame pointer
+    //       would be picked up by nearest_scroll_frame() during that reassignment, so they must
+    //       not survive. Scroll offsets themselves live on the DOM element and are unaffected.
+    m_enclosing_scroll_frame = nullptr;
+    m_own_scroll_frame = nullptr;
+    m_enclosing_clip_frame = nullptr;
+    m_own_clip_frame = nullptr;
+    // NOTE: Paint-only properties (borders, shadows, transforms) are kept, since the paintable
+    //       is already flagged for a paint-only property update.
+}
+
+void PaintableWithLines::reset_for_reuse()
+{
+    PaintableBox::reset_for_reuse();
+    m_fragments.clear_with_capacity();
+}
+
 void PaintableBox::set_stacking_context(NonnullOwnPtr<StackingContext> stacking_context)
 {
     m_stacking_context = move(stacking_context);
@@ -1284,12 +1330,34 @@ TraversalDecision PaintableBox::hit_test_children(CSSPixelPoint position, HitTes
             continue;
         if (child->has_stacking_context())
             continue;
+        // OPTIMIZATION: For exact hit tests, skip the child's entire subtree if the position lies outside
+        //               its cached bounding rect. Descendants in nested scroll frames adjust the position
+        //               further than we do here, but those are clipped by their scroll container, whose
+        //               border box is part of the bounding rect, so we can't wrongly reject them.
+        //               TextCursor hit tests match the nearest fragment rather than a containing one, so
+        //               they must not prune anything.
+        if (type == HitTestType::Exact) {
+            if (auto const* child_box = as_if<PaintableBox>(*child)) {
+                if (!child_box->hit_test_bounding_rect().contains(child_box->adjust_position_for_cumulative_scroll_offset(position)))
+                    continue;
+            }
+        }
         if (child->hit_test(position, type, callback) == TraversalDecision::Break)
             return TraversalDecision::Break;
     }
     return TraversalDecision::Continue;
 }
 
+CSSPixelRect PaintableWithLines::compute_hit_test_bounding_rect() const
+{
+    // NOTE: Inline content can stick out of its block container (a long unbreakable word, for example),
+    //       so the fragment rects have to be part of the bounding rect as well.
+    auto rect = PaintableBox::compute_hit_test_bounding_rect();
+    for (auto const& fragment : m_fragments)
+        rect = rect.united(fragment.absolute_rect());
+    return rect;
+}
+
 TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
     if (clip_rect_for_hit_testing().has_value() && !clip_rect_for_hit_testing()->contains(position))
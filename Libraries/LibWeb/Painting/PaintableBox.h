@@ -33,6 +33,8 @@ public:
     static GC::Ref<PaintableBox> create(Layout::InlineNode const&);
     virtual ~PaintableBox();
 
+    virtual void reset_for_reuse() override;
+
     virtual void before_paint(DisplayListRecordingContext&, PaintPhase) const override;
     virtual void after_paint(DisplayListRecordingContext&, PaintPhase) const override;
 
@@ -88,6 +90,10 @@ public:
     CSSPixelRect overflow_clip_edge_rect() const;
     CSSPixelRect absolute_paint_rect() const;
 
+    // The union of this box's absolute border box rect and the bounding rects of all the boxes and
+    // fragments in its paintable subtree. Used to skip entire subtrees during exact hit testing.
+    CSSPixelRect hit_test_bounding_rect() const;
+
     // These united versions of the above rects take continuation into account.
     CSSPixelRect absolute_united_border_box_rect() const;
     CSSPixelRect absolute_united_content_rect() const;
@@ -276,6 +282,7 @@ protected:
 
     virtual CSSPixelRect compute_absolute_rect() const;
     virtual CSSPixelRect compute_absolute_paint_rect() const;
+    virtual CSSPixelRect compute_hit_test_bounding_rect() const;
 
     struct ScrollbarData {
         CSSPixelRect gutter_rect;
@@ -316,6 +323,7 @@ private:
 
     Optional<CSSPixelRect> mutable m_absolute_rect;
     Optional<CSSPixelRect> mutable m_absolute_paint_rect;
+    Optional<CSSPixelRect> mutable m_hit_test_bounding_rect;
 
     RefPtr<ScrollFrame const> m_enclosing_scroll_frame;
     RefPtr<ScrollFrame const> m_own_scroll_frame;
@@ -357,6 +365,8 @@ public:
     static GC::Ref<PaintableWithLines> create(Layout::InlineNode const&, size_t line_index);
     virtual ~PaintableWithLines() override;
 
+    virtual void reset_for_reuse() override;
+
     Vector<PaintableFragment> const& fragments() const { return m_fragments; }
     Vector<PaintableFragment>& fragments() { return m_fragments; }
 
@@ -378,6 +388,8 @@ public:
 
     virtual void resolve_paint_properties() override;
 
+    virtual CSSPixelRect compute_hit_test_bounding_rect() const override;
+
     size_t line_index() const { return m_line_index; }
 
 protected:
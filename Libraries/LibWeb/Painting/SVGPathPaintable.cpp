@@ -74,9 +74,21 @@ void SVGPathPaintable::paint(DisplayListRecordingContext& context, PaintPhase ph
     auto offset = context.rounded_device_point(svg_element_rect.location()).to_type<int>().to_type<float>();
     auto maybe_view_box = svg_node->dom_node().view_box();
 
+    auto affine_transforms_are_equal = [](Gfx::AffineTransform const& a, Gfx::AffineTransform const& b) {
+        return a.a() == b.a() && a.b() == b.b() && a.c() == b.c() && a.d() == b.d() && a.e() == b.e() && a.f() == b.f();
+    };
+
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
-    path.offset(offset);
+    if (!m_cached_device_space_path.has_value()
+        || !affine_transforms_are_equal(m_cached_device_space_transform, paint_transform)
+        || m_cached_device_space_offset != offset) {
+        auto transformed_path = computed_path()->copy_transformed(paint_transform);
+        transformed_path.offset(offset);
+        m_cached_device_space_path = move(transformed_path);
+        m_cached_device_space_transform = paint_transform;
+        m_cached_device_space_offset = offset;
+    }
+    auto const& path = *m_cached_device_space_path;
 
     auto svg_viewport = [&] {
         if (maybe_view_box.has_value())
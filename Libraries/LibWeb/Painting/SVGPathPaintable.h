@@ -29,6 +29,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_cached_device_space_path.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -46,6 +47,14 @@ private:
     float m_stroke_thickness { 0 };
     float m_stroke_dashoffset { 0 };
     Vector<float> m_stroke_dasharray;
+
+    // OPTIMIZATION: The computed path transformed into device space, cached between paints. Reusing it while
+    //               the transform is unchanged not only skips the per-paint copy, but also keeps the path's
+    //               identity stable from one frame to the next, which lets the rasterizer's internal caches
+    //               recognize it instead of re-tessellating.
+    mutable Optional<Gfx::Path> m_cached_device_space_path;
+    mutable Gfx::AffineTransform m_cached_device_space_transform;
+    mutable Gfx::FloatPoint m_cached_device_space_offset;
 };
 
 template<>
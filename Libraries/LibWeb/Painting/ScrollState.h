@@ -88,6 +88,11 @@ public:
         return ScrollStateSnapshot::create(m_scroll_frames);
     }
 
+    void clear()
+    {
+        m_scroll_frames.clear();
+    }
+
 private:
     Vector<NonnullRefPtr<ScrollFrame>> m_scroll_frames;
 };
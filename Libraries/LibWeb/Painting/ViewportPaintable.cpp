@@ -29,6 +29,15 @@ ViewportPaintable::ViewportPaintable(Layout::Viewport const& layout_viewport)
 
 ViewportPaintable::~ViewportPaintable() = default;
 
+void ViewportPaintable::reset_for_reuse()
+{
+    PaintableWithLines::reset_for_reuse();
+    m_scroll_state.clear();
+    clip_state.clear();
+    m_paintable_boxes_with_auto_content_visibility.clear();
+    m_needs_to_refresh_scroll_state = true;
+}
+
 void ViewportPaintable::build_stacking_context_tree_if_needed()
 {
     if (stacking_context())
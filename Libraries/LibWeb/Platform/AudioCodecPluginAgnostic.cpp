@@ -4,7 +4,6 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/MemoryStream.h>
 #include <AK/String.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/EventLoop.h>
@@ -35,36 +34,32 @@ ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::creat
     auto update_timer = Core::Timer::create();
     update_timer->set_interval(update_interval);
 
-    auto plugin = TRY(adopt_nonnull_own_or_enomem(new (nothrow) AudioCodecPluginAgnostic(loader, duration, move(update_timer))));
+    // Buffer roughly half a second of interleaved stereo samples. The update timer tops the buffer up
+    // every 50ms while playing, so this leaves a comfortable margin before the buffer can run dry.
+    auto sample_buffer = TRY(Audio::SampleRingBuffer::create(loader->sample_rate()));
+
+    auto plugin = TRY(adopt_nonnull_own_or_enomem(new (nothrow) AudioCodecPluginAgnostic(loader, duration, move(update_timer), move(sample_buffer))));
 
     constexpr u32 latency_ms = 100;
     // FIXME: Audio loaders are hard-coded to output stereo audio. Once that changes, the channel count provided
     //        below should be retrieved from the audio loader instead of being hard-coded to 2.
     RefPtr<Audio::PlaybackStream> output = TRY(Audio::PlaybackStream::create(
         Audio::OutputState::Suspended, loader->sample_rate(), /* channels = */ 2, latency_ms,
-        [&plugin = *plugin, loader](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) -> ReadonlyBytes {
+        [&plugin = *plugin](Bytes buffer, Audio::PcmSampleFormat format, size_t) -> ReadonlyBytes {
             VERIFY(format == Audio::PcmSampleFormat::Float32);
 
-            auto samples_result = loader->get_more_samples(sample_count);
-            if (samples_result.is_error()) {
-                dbgln("Error while loading samples: {}", samples_result.error());
-                plugin.on_decoder_error(MUST(String::formatted("Decoding failure: {}", samples_result.error())));
-                return buffer.trim(0);
-            }
-
-            auto samples = samples_result.release_value();
-            VERIFY(samples.size() <= sample_count);
+            // NOTE: This runs on the platform's real-time audio thread, so it must not lock or
+            //       allocate. It only copies samples out of the preallocated ring buffer that the
+            //       main thread keeps filled.
+            auto output_samples = Span<float> { reinterpret_cast<float*>(buffer.data()), buffer.size() / sizeof(float) };
+            auto samples_read = plugin.m_sample_buffer->read(output_samples);
 
-            FixedMemoryStream writing_stream { buffer };
-
-            for (auto& sample : samples) {
-                MUST(writing_stream.write_value(sample.left));
-                MUST(writing_stream.write_value(sample.right));
-            }
+            if (samples_read == 0 && plugin.m_loader_at_end_of_stream.load())
+                return buffer.trim(0);
 
-            // FIXME: Check if we have loaded samples past the current known duration, and if so, update it
-            //        and notify the media element.
-            return buffer.trim(writing_stream.offset());
+            // If decoding fell behind, play silence for the remainder rather than stopping the stream.
+            output_samples.slice(samples_read).fill(0);
+            return buffer;
         }));
 
     output->set_underrun_callback([&plugin = *plugin, loader, output]() {
@@ -81,21 +76,60 @@ ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::creat
     return plugin;
 }
 
-AudioCodecPluginAgnostic::AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration duration, NonnullRefPtr<Core::Timer> update_timer)
+AudioCodecPluginAgnostic::AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration duration, NonnullRefPtr<Core::Timer> update_timer, NonnullOwnPtr<Audio::SampleRingBuffer> sample_buffer)
     : m_loader(move(loader))
     , m_duration(duration)
     , m_main_thread_event_loop(Core::EventLoop::current())
     , m_update_timer(move(update_timer))
+    , m_sample_buffer(move(sample_buffer))
 {
     m_update_timer->on_timeout = [self = make_weak_ptr<AudioCodecPluginAgnostic>()]() {
-        if (self)
+        if (self) {
+            self->fill_sample_buffer();
             self->update_timestamp();
+        }
     };
 }
 
+void AudioCodecPluginAgnostic::fill_sample_buffer()
+{
+    while (!m_loader_at_end_of_stream.load()) {
+        // The real-time thread only consumes samples, so the free space we see here can only grow
+        // underneath us, and everything we decode below is guaranteed to fit.
+        auto available_frames = m_sample_buffer->available() / 2;
+        if (available_frames == 0)
+            break;
+
+        auto samples_result = m_loader->get_more_samples(available_frames);
+        if (samples_result.is_error()) {
+            dbgln("Error while loading samples: {}", samples_result.error());
+            on_decoder_error(MUST(String::formatted("Decoding failure: {}", samples_result.error())));
+            break;
+        }
+
+        auto samples = samples_result.release_value();
+        if (samples.is_empty()) {
+            m_loader_at_end_of_stream.store(true);
+            break;
+        }
+
+        // FIXME: Check if we have loaded samples past the current known duration, and if so, update it
+        //        and notify the media element.
+        m_interleave_buffer.clear_with_capacity();
+        m_interleave_buffer.ensure_capacity(samples.size() * 2);
+        for (auto& sample : samples) {
+            m_interleave_buffer.unchecked_append(sample.left);
+            m_interleave_buffer.unchecked_append(sample.right);
+        }
+        m_sample_buffer->write(m_interleave_buffer);
+    }
+}
+
 void AudioCodecPluginAgnostic::resume_playback()
 {
     m_paused = false;
+    // Make sure the real-time thread has samples to play from the very first buffer request.
+    fill_sample_buffer();
     m_output->resume()
         ->when_resolved([self = make_weak_ptr<AudioCodecPluginAgnostic>()](AK::Duration new_device_time) {
             if (!self)
@@ -122,7 +156,9 @@ void AudioCodecPluginAgnostic::pause_playback()
             if (!self)
                 return {};
 
-            auto new_media_time = timestamp_from_samples(self->m_loader->loaded_samples(), self->m_loader->sample_rate());
+            // Samples still sitting in the ring buffer haven't been played yet, so don't count them.
+            auto buffered_frames = static_cast<int>(self->m_sample_buffer->used() / 2);
+            auto new_media_time = timestamp_from_samples(self->m_loader->loaded_samples() - buffered_frames, self->m_loader->sample_rate());
             auto new_device_time = TRY(self->m_output->total_time_played());
 
             self->m_main_thread_event_loop.deferred_invoke([self, new_media_time, new_device_time]() {
@@ -161,6 +197,11 @@ void AudioCodecPluginAgnostic::seek(double position)
             if (seek_result.is_error())
                 return Error::from_string_literal("Seeking in audio loader failed");
 
+            // The output stream is suspended at this point, so the real-time thread is not reading
+            // and the stale buffered samples can be discarded safely.
+            self->m_sample_buffer->discard_all_samples();
+            self->m_loader_at_end_of_stream.store(false);
+
             auto new_media_time = get_loader_timestamp(self->m_loader);
             auto new_device_time = self->m_output->total_time_played().release_value_but_fixme_should_propagate_errors();
 
@@ -174,6 +215,7 @@ void AudioCodecPluginAgnostic::seek(double position)
                 if (was_paused) {
                     self->update_timestamp();
                 } else {
+                    self->fill_sample_buffer();
                     self->m_output->resume()->when_rejected([](Error&&) {
                         // FIXME: Propagate errors.
                     });
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
 #include <LibCore/Timer.h>
 #include <LibMedia/Audio/PlaybackStream.h>
+#include <LibMedia/Audio/SampleRingBuffer.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Platform/AudioCodecPlugin.h>
 
@@ -25,12 +28,19 @@ public:
     virtual AK::Duration duration() override;
 
 private:
-    explicit AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration, NonnullRefPtr<Core::Timer> update_timer);
+    explicit AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration, NonnullRefPtr<Core::Timer> update_timer, NonnullOwnPtr<Audio::SampleRingBuffer> sample_buffer);
 
     void update_timestamp();
+    void fill_sample_buffer();
 
     NonnullRefPtr<Audio::Loader> m_loader;
     RefPtr<Audio::PlaybackStream> m_output { nullptr };
+    // Interleaved samples decoded on the main thread, waiting to be consumed by the real-time audio
+    // thread. The real-time thread only ever copies out of this preallocated buffer; all decoding,
+    // allocation and error handling stays on the main thread.
+    NonnullOwnPtr<Audio::SampleRingBuffer> m_sample_buffer;
+    Vector<float> m_interleave_buffer;
+    Atomic<bool> m_loader_at_end_of_stream { false };
     AK::Duration m_duration { AK::Duration::zero() };
     AK::Duration m_last_resume_in_media_time { AK::Duration::zero() };
     AK::Duration m_last_resume_in_device_time { AK::Duration::zero() };
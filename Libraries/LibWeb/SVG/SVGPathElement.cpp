@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <LibGfx/Path.h>
 #include <LibWeb/Bindings/SVGPathElementPrototype.h>
@@ -27,12 +28,28 @@ void SVGPathElement::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+// OPTIMIZATION: Pages with many repeated vector icons can contain thousands of <path> elements that share a
+//               handful of distinct `d` attributes. Keep a cache of parsed path data so each distinct string
+//               is only parsed once.
+static Path parse_path_data_with_cache(String const& data)
+{
+    static HashMap<String, Path> s_parsed_path_data_cache;
+    if (auto cached_path = s_parsed_path_data_cache.get(data); cached_path.has_value())
+        return cached_path.release_value();
+    auto path = AttributeParser::parse_path_data(data);
+    // NOTE: The cache must not grow without bound, so simply throw it away once it gets big.
+    if (s_parsed_path_data_cache.size() >= 512)
+        s_parsed_path_data_cache.clear();
+    s_parsed_path_data_cache.set(data, path);
+    return path;
+}
+
 void SVGPathElement::attribute_changed(FlyString const& name, Optional<String> const& old_value, Optional<String> const& value, Optional<FlyString> const& namespace_)
 {
     Base::attribute_changed(name, old_value, value, namespace_);
 
     if (name == "d")
-        m_path = AttributeParser::parse_path_data(value.value_or(String {}));
+        m_path = parse_path_data_with_cache(value.value_or(String {}));
 }
 
 Gfx::Path SVGPathElement::get_path(CSSPixelSize)
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2025, Tim Ledbetter <tim.ledbetter@ladybird.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/Function.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/Scheduler/Scheduler.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Scheduler {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+void Scheduler::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    auto visit_entries = [&](auto const& entries) {
+        for (auto const& entry : entries) {
+            visitor.visit(entry.callback);
+            visitor.visit(entry.promise);
+            visitor.visit(entry.signal);
+        }
+    };
+    for (auto const& queue : m_continuation_queues)
+        visit_entries(queue);
+    for (auto const& queue : m_task_queues)
+        visit_entries(queue);
+    visit_entries(m_delayed_entries);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+GC::Ref<WebIDL::Promise> Scheduler::post_task(WebIDL::CallbackType& callback, SchedulerPostTaskOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if it exists, or null otherwise.
+    auto signal = options.signal;
+
+    // 3. If signal is aborted, then reject result with signal's abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Determine the task's priority: options["priority"] if it exists, otherwise the default "user-visible".
+    // AD-HOC: TaskSignal is not implemented yet, so a signal only controls abortion and never carries a priority.
+    auto priority = options.priority.value_or(Bindings::TaskPriority::UserVisible);
+
+    auto id = ++m_next_entry_id;
+    Entry entry {
+        .id = id,
+        .priority = priority,
+        .callback = callback,
+        .promise = result,
+        .signal = signal,
+    };
+
+    // 5. If signal is not null, then add the following abort steps to it: remove the entry from its
+    //    queue and reject result with signal's abort reason.
+    if (signal) {
+        (void)signal->add_abort_algorithm([this, id] {
+            remove_aborted_entry(id);
+        });
+    }
+
+    // 6. If options["delay"] is greater than 0, enqueue the entry once the delay has passed;
+    //    otherwise, enqueue it right away.
+    if (options.delay > 0) {
+        m_delayed_entries.append(move(entry));
+        auto& window_or_worker = as<HTML::WindowOrWorkerGlobalScopeMixin>(HTML::relevant_global_object(*this));
+        window_or_worker.run_steps_after_a_timeout(static_cast<i32>(options.delay), [this, id] {
+            auto index = m_delayed_entries.find_first_index_if([&](auto const& entry) { return entry.id == id; });
+            // NOTE: The entry may have been aborted while it was waiting out its delay.
+            if (!index.has_value())
+                return;
+            auto entry = move(m_delayed_entries[*index]);
+            m_delayed_entries.remove(*index);
+            enqueue_entry(move(entry));
+        });
+    } else {
+        enqueue_entry(move(entry));
+    }
+
+    // 7. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. The continuation inherits the priority of the scheduler entry currently being run, if any.
+    //    Continuations queued from outside a scheduler entry get the default "user-visible" priority.
+    auto priority = m_current_entry_priority.value_or(Bindings::TaskPriority::UserVisible);
+
+    // 3. Enqueue a continuation entry whose resolution resumes the yielding caller.
+    m_continuation_queues[to_underlying(priority)].append(Entry {
+        .id = ++m_next_entry_id,
+        .priority = priority,
+        .callback = nullptr,
+        .promise = result,
+        .signal = nullptr,
+    });
+    queue_servicing_task();
+
+    // 4. Return result.
+    return result;
+}
+
+void Scheduler::enqueue_entry(Entry entry)
+{
+    m_task_queues[to_underlying(entry.priority)].append(move(entry));
+    queue_servicing_task();
+}
+
+void Scheduler::queue_servicing_task()
+{
+    // One servicing task is queued on the event loop per enqueued entry. Each one runs the most urgent
+    // entry still pending, which is not necessarily the entry it was queued for; this is what lets
+    // user-blocking work posted later overtake queued background work. Because every entry runs as its
+    // own event loop task, rendering and input processing are serviced in between and a flood of
+    // background tasks cannot starve them.
+    HTML::queue_global_task(HTML::Task::Source::Scheduler, HTML::relevant_global_object(*this), GC::create_function(heap(), [this] {
+        service_next_entry();
+    }));
+}
+
+void Scheduler::service_next_entry()
+{
+    auto& realm = this->realm();
+
+    // Continuations queued by yield() always run ahead of tasks, most urgent priority first.
+    for (auto& queue : m_continuation_queues) {
+        if (queue.is_empty())
+            continue;
+        auto entry = queue.take_first();
+        WebIDL::resolve_promise(realm, *entry.promise);
+        return;
+    }
+
+    for (auto& queue : m_task_queues) {
+        if (queue.is_empty())
+            continue;
+        auto entry = queue.take_first();
+
+        // Run the callback with the entry's priority as the inherited priority for yield().
+        m_current_entry_priority = entry.priority;
+        auto completion = WebIDL::invoke_callback(*entry.callback, {}, ReadonlySpan<JS::Value> {});
+        m_current_entry_priority.clear();
+
+        // Resolve the result promise with the callback's return value, or reject it with the thrown error.
+        if (completion.is_error())
+            WebIDL::reject_promise(realm, *entry.promise, completion.value());
+        else
+            WebIDL::resolve_promise(realm, *entry.promise, completion.value());
+        return;
+    }
+
+    // NOTE: Reaching this point means every entry this servicing task could have run was aborted in the meantime.
+}
+
+void Scheduler::remove_aborted_entry(u64 id)
+{
+    auto& realm = this->realm();
+    auto reject_and_remove = [&](Vector<Entry>& entries) {
+        auto index = entries.find_first_index_if([&](auto const& entry) { return entry.id == id; });
+        if (!index.has_value())
+            return false;
+        auto entry = move(entries[*index]);
+        entries.remove(*index);
+        WebIDL::reject_promise(realm, *entry.promise, entry.signal->reason());
+        return true;
+    };
+
+    for (auto& queue : m_task_queues) {
+        if (reject_and_remove(queue))
+            return;
+    }
+    (void)reject_and_remove(m_delayed_entries);
+}
+
+}
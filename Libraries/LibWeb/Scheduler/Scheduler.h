@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, Tim Ledbetter <tim.ledbetter@ladybird.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Scheduler {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    u64 delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#sec-scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(WebIDL::CallbackType&, SchedulerPostTaskOptions const&);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // A scheduler entry is either a task posted by postTask(), or a continuation queued by yield(),
+    // in which case its callback is null and resolving its promise resumes the yielding caller.
+    struct Entry {
+        u64 id { 0 };
+        Bindings::TaskPriority priority { Bindings::TaskPriority::UserVisible };
+        GC::Ptr<WebIDL::CallbackType> callback;
+        GC::Ptr<WebIDL::Promise> promise;
+        GC::Ptr<DOM::AbortSignal> signal;
+    };
+
+    // NOTE: This relies on TaskPriority being declared from most urgent to least urgent.
+    static constexpr size_t priority_count = 3;
+
+    void enqueue_entry(Entry);
+    void queue_servicing_task();
+    void service_next_entry();
+    void remove_aborted_entry(u64 id);
+
+    u64 m_next_entry_id { 0 };
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queues
+    // One queue per TaskPriority; continuations always run ahead of tasks.
+    Array<Vector<Entry>, priority_count> m_continuation_queues;
+    Array<Vector<Entry>, priority_count> m_task_queues;
+
+    // Entries waiting out the delay option before they are enqueued.
+    Vector<Entry> m_delayed_entries;
+
+    // The priority of the entry currently being run, inherited by yield() continuations.
+    Optional<Bindings::TaskPriority> m_current_entry_priority;
+};
+
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2025, Aliaksandr Kalenik <kalenik.aliaksandr@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Error.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(Cache);
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm)
+{
+    return realm.create<Cache>(realm);
+}
+
+Cache::Cache(JS::Realm& realm)
+    : Bindings::PlatformObject(realm)
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+}
+
+void Cache::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto& request_response : m_request_response_list) {
+        visitor.visit(request_response.request);
+        visitor.visit(request_response.response);
+    }
+}
+
+WebIDL::ExceptionOr<GC::Ref<Fetch::Infrastructure::Request>> Cache::inner_request_from_request_info(JS::Realm& realm, Fetch::RequestInfo const& request)
+{
+    // If request is a Request object, the inner request is request's request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>())
+        return (*request_object)->request();
+
+    // Otherwise, it is the associated request of the result of invoking the initial value of Request as constructor
+    // with request as its argument.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, request));
+    return request_object->request();
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be the result of running the algorithm specified in matchAll(request, options) method with request and options as the arguments.
+    auto promise = match_all(request, options);
+
+    // 2. Return the result of reacting to promise with a fulfillment handler that, when called with argument responses, performs the following substeps:
+    return WebIDL::react_to_promise(promise,
+        GC::create_function(realm.heap(), [](JS::Value responses) -> WebIDL::ExceptionOr<JS::Value> {
+            auto& responses_array = as<JS::Array>(responses.as_object());
+
+            // 1. If responses is an empty list, resolve promise with undefined.
+            if (responses_array.indexed_properties().array_like_size() == 0)
+                return JS::js_undefined();
+
+            // 2. Else, resolve promise with the first element of responses.
+            return TRY(responses_array.get(0));
+        }),
+        nullptr);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+
+    // 2. If the optional argument request is not omitted, then:
+    if (request.has_value()) {
+        // 1. If request is a Request object, then:
+        if (auto const* request_object = request->get_pointer<GC::Root<Fetch::Request>>()) {
+            // 1. Set r to request's request.
+            inner_request = (*request_object)->request();
+
+            // 2. If r's method is not `GET` and options["ignoreMethod"] is false, return a promise resolved with an empty array.
+            if (inner_request->method() != "GET"sv.bytes() && !options.ignore_method)
+                return WebIDL::create_resolved_promise(realm, JS::Array::create(realm, 0));
+        }
+        // 2. Else if request is a string, then:
+        else {
+            // 1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+            //    with request as its argument. If this throws an exception, return a promise rejected with that exception.
+            auto inner_request_or_error = inner_request_from_request_info(realm, *request);
+            if (inner_request_or_error.is_exception())
+                return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+            inner_request = inner_request_or_error.release_value();
+        }
+    }
+
+    // 3-5. Query the cache and resolve the promise with a copy of every matching response.
+    // NOTE: The request response list lives in memory, so there is no need to run these steps in parallel.
+    auto matching = query_cache(inner_request, options);
+
+    GC::RootVector<JS::Value> responses(realm.heap());
+    for (auto const& request_response : matching)
+        responses.append(Fetch::Response::create(realm, request_response.response->clone(realm), Fetch::Headers::Guard::Immutable));
+
+    return WebIDL::create_resolved_promise(realm, JS::Array::create_from(realm, responses));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response)
+{
+    auto& realm = this->realm();
+
+    // 1-3. Let innerRequest be request's request if request is a Request object, and the associated request of the
+    //      result of invoking the initial value of Request as constructor with request as its argument otherwise.
+    //      If the constructor throws an exception, return a promise rejected with that exception.
+    auto inner_request_or_error = inner_request_from_request_info(realm, request);
+    if (inner_request_or_error.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+    auto inner_request = inner_request_or_error.release_value();
+
+    // 4. If innerRequest's url's scheme is not one of "http" and "https", or innerRequest's method is not `GET`,
+    //    return a promise rejected with a TypeError.
+    if (!Fetch::Infrastructure::is_http_or_https_scheme(inner_request->url().scheme()) || inner_request->method() != "GET"sv.bytes())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Request scheme must be HTTP(S) and request method must be GET"sv));
+
+    // 5. Let innerResponse be response's response.
+    auto inner_response = response->response();
+
+    // 6. If innerResponse's status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Partial responses cannot be stored in a cache"sv));
+
+    // 7. If innerResponse's header list contains `Vary`, then: for each fieldValue of the parsed header values:
+    //    if fieldValue matches "*", return a promise rejected with a TypeError.
+    if (auto field_values = inner_response->header_list()->get_decode_and_split("Vary"sv.bytes()); field_values.has_value()) {
+        for (auto const& field_value : *field_values) {
+            if (field_value == "*"sv)
+                return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Responses with a 'Vary: *' header cannot be stored in a cache"sv));
+        }
+    }
+
+    // 8. If innerResponse's body is disturbed or locked, return a promise rejected with a TypeError.
+    if (response->is_unusable())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Response body is disturbed or locked"sv));
+
+    // 9. Let clonedResponse be a clone of innerResponse.
+    auto cloned_response = inner_response->clone(realm);
+
+    // 10. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 11. If innerResponse's body is null, store the record right away.
+    if (!inner_response->body()) {
+        store_request_response_pair(inner_request, cloned_response);
+        WebIDL::resolve_promise(realm, promise);
+        return promise;
+    }
+
+    // 12. Otherwise, fully read innerResponse's body. Upon success, set clonedResponse's body to the read bytes as a
+    //     body, store the record, and resolve promise with undefined. Upon failure, reject promise with a TypeError.
+    auto process_body = GC::create_function(realm.heap(), [self = GC::Ref { *this }, promise, &realm, inner_request, cloned_response](ByteBuffer bytes) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        cloned_response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, bytes));
+        self->store_request_response_pair(inner_request, cloned_response);
+        WebIDL::resolve_promise(realm, promise);
+    });
+    auto process_body_error = GC::create_function(realm.heap(), [promise, &realm](JS::Value) {
+        HTML::TemporaryExecutionContext execution_context { realm };
+        WebIDL::reject_promise(realm, promise, JS::TypeError::create(realm, "Failed to read response body"sv));
+    });
+    inner_response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { HTML::relevant_global_object(*this) });
+
+    // 13. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1-2. Convert request into a request, as in matchAll().
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        inner_request = (*request_object)->request();
+
+        // If r's method is not `GET` and options["ignoreMethod"] is false, resolve promise with false.
+        if (inner_request->method() != "GET"sv.bytes() && !options.ignore_method)
+            return WebIDL::create_resolved_promise(realm, JS::Value(false));
+    } else {
+        auto inner_request_or_error = inner_request_from_request_info(realm, request);
+        if (inner_request_or_error.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+        inner_request = inner_request_or_error.release_value();
+    }
+
+    // 3-5. Run the "delete" batch operation and resolve the promise with whether any records were removed.
+    auto removed_any = m_request_response_list.remove_all_matching([&](auto const& request_response) {
+        return request_matches_cached_item(*inner_request, request_response.request, request_response.response, options);
+    });
+
+    return WebIDL::create_resolved_promise(realm, JS::Value(removed_any));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1-2. Convert request into a request, as in matchAll().
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+    if (request.has_value()) {
+        if (auto const* request_object = request->get_pointer<GC::Root<Fetch::Request>>()) {
+            inner_request = (*request_object)->request();
+
+            if (inner_request->method() != "GET"sv.bytes() && !options.ignore_method)
+                return WebIDL::create_resolved_promise(realm, JS::Array::create(realm, 0));
+        } else {
+            auto inner_request_or_error = inner_request_from_request_info(realm, *request);
+            if (inner_request_or_error.is_exception())
+                return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+            inner_request = inner_request_or_error.release_value();
+        }
+    }
+
+    // 3-5. Resolve the promise with a new Request object for every matching record.
+    auto matching = query_cache(inner_request, options);
+
+    GC::RootVector<JS::Value> requests(realm.heap());
+    for (auto const& request_response : matching) {
+        auto signal = MUST(DOM::AbortSignal::construct_impl(realm));
+        requests.append(Fetch::Request::create(realm, request_response.request->clone(realm), Fetch::Headers::Guard::Immutable, signal));
+    }
+
+    return WebIDL::create_resolved_promise(realm, JS::Array::create_from(realm, requests));
+}
+
+// https://w3c.github.io/ServiceWorker/#query-cache-algorithm
+Vector<Cache::RequestResponsePair> Cache::query_cache(GC::Ptr<Fetch::Infrastructure::Request> request_query, CacheQueryOptions const& options) const
+{
+    // 1. Let resultList be an empty list.
+    Vector<RequestResponsePair> result;
+
+    // 2. Let storage be the relevant request response list.
+    // 3. For each requestResponse of storage:
+    for (auto const& request_response : m_request_response_list) {
+        // 1. If requestQuery is null, or Request Matches Cached Item returns true for the record, add a copy of
+        //    requestResponse to resultList.
+        if (!request_query || request_matches_cached_item(*request_query, request_response.request, request_response.response, options))
+            result.append(request_response);
+    }
+
+    // 4. Return resultList.
+    return result;
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+bool Cache::request_matches_cached_item(GC::Ref<Fetch::Infrastructure::Request> request_query, GC::Ref<Fetch::Infrastructure::Request> request, GC::Ptr<Fetch::Infrastructure::Response> response, CacheQueryOptions const& options)
+{
+    // 1. If options["ignoreMethod"] is false and request's method is not `GET`, return false.
+    if (!options.ignore_method && request->method() != "GET"sv.bytes())
+        return false;
+
+    // 2. Let queryURL be requestQuery's url.
+    auto query_url = request_query->url();
+
+    // 3. Let cachedURL be request's url.
+    auto cached_url = request->url();
+
+    // 4. If options["ignoreSearch"] is true, then set cachedURL's query to the empty string, and set queryURL's query to the empty string.
+    if (options.ignore_search) {
+        cached_url.set_query(String {});
+        query_url.set_query(String {});
+    }
+
+    // 5. If queryURL does not equal cachedURL with the exclude fragment flag set, then return false.
+    if (!query_url.equals(cached_url, URL::ExcludeFragment::Yes))
+        return false;
+
+    // 6. If options["ignoreVary"] is true, or response is null or its header list does not contain `Vary`, then return true.
+    if (options.ignore_vary || !response || !response->header_list()->contains("Vary"sv.bytes()))
+        return true;
+
+    // 7. Let fieldValues be the list containing the items corresponding to the Vary header's field-values.
+    auto field_values = response->header_list()->get_decode_and_split("Vary"sv.bytes());
+
+    // 8. For each fieldValue of fieldValues:
+    for (auto const& field_value : *field_values) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request's header list does not
+        //    match the combined value given fieldValue and requestQuery's header list, then return false.
+        if (field_value == "*"sv)
+            return false;
+        if (request->header_list()->get(field_value.bytes()) != request_query->header_list()->get(field_value.bytes()))
+            return false;
+    }
+
+    // 9. Return true.
+    return true;
+}
+
+// https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+void Cache::store_request_response_pair(GC::Ref<Fetch::Infrastructure::Request> request, GC::Ref<Fetch::Infrastructure::Response> response)
+{
+    // A "put" batch operation replaces any records matching the request before appending the new record.
+    m_request_response_list.remove_all_matching([&](auto const& request_response) {
+        return request_matches_cached_item(request, request_response.request, request_response.response, {});
+    });
+
+    m_request_response_list.append({ request, response });
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, Aliaksandr Kalenik <kalenik.aliaksandr@gmail.com>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options);
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options);
+
+    // https://w3c.github.io/ServiceWorker/#dfn-request-response-list
+    struct RequestResponsePair {
+        GC::Ref<Fetch::Infrastructure::Request> request;
+        GC::Ref<Fetch::Infrastructure::Response> response;
+    };
+
+    Vector<RequestResponsePair> query_cache(GC::Ptr<Fetch::Infrastructure::Request> request_query, CacheQueryOptions const& options) const;
+
+    static WebIDL::ExceptionOr<GC::Ref<Fetch::Infrastructure::Request>> inner_request_from_request_info(JS::Realm&, Fetch::RequestInfo const&);
+
+private:
+    explicit Cache(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    static bool request_matches_cached_item(GC::Ref<Fetch::Infrastructure::Request> request_query, GC::Ref<Fetch::Infrastructure::Request> request, GC::Ptr<Fetch::Infrastructure::Response> response, CacheQueryOptions const& options);
+
+    void store_request_response_pair(GC::Ref<Fetch::Infrastructure::Request>, GC::Ref<Fetch::Infrastructure::Response>);
+
+    // https://w3c.github.io/ServiceWorker/#dfn-relevant-request-response-list
+    Vector<RequestResponsePair> m_request_response_list;
+};
+
+}
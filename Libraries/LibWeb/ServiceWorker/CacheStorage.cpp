@@ -4,8 +4,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/PrimitiveString.h>
 #include <LibWeb/Bindings/CacheStoragePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Response.h>
 #include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/WebIDL/Promise.h>
 
@@ -24,17 +30,92 @@ void CacheStorage::initialize(JS::Realm& realm)
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
 }
 
-// https://w3c.github.io/ServiceWorker/#cache-storage-open
-GC::Ref<WebIDL::Promise> CacheStorage::open(String const&)
+void CacheStorage::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_name_to_cache_map);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
 {
-    return WebIDL::create_rejected_promise(realm(), WebIDL::NotSupportedError::create(realm(), "CacheStorage.open() is not yet implemented"_utf16));
+    auto& realm = this->realm();
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. If the relevant name to cache map contains options["cacheName"], resolve promise with the result of
+        //    matching the request against that cache.
+        if (auto cache = m_name_to_cache_map.get(*options.cache_name); cache.has_value())
+            return (*cache)->match(request, options);
+
+        // 2. Otherwise, resolve promise with undefined.
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // 2. Otherwise, match the request against each cache in order and resolve promise with the first matching
+    //    response, or undefined if there is none.
+    GC::Ptr<Fetch::Infrastructure::Request> inner_request;
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>()) {
+        inner_request = (*request_object)->request();
+
+        if (inner_request->method() != "GET"sv.bytes() && !options.ignore_method)
+            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    } else {
+        auto inner_request_or_error = Cache::inner_request_from_request_info(realm, request);
+        if (inner_request_or_error.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, inner_request_or_error.release_error());
+        inner_request = inner_request_or_error.release_value();
+    }
+
+    for (auto const& it : m_name_to_cache_map) {
+        auto matching = it.value->query_cache(inner_request, options);
+        if (!matching.is_empty())
+            return WebIDL::create_resolved_promise(realm, Fetch::Response::create(realm, matching.first().response->clone(realm), Fetch::Headers::Guard::Immutable));
+    }
+
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
 }
 
 // https://w3c.github.io/ServiceWorker/#cache-storage-has
-GC::Ref<WebIDL::Promise> CacheStorage::has(String const&)
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
+{
+    // Return a promise resolved with whether the relevant name to cache map contains cacheName.
+    return WebIDL::create_resolved_promise(realm(), JS::Value(m_name_to_cache_map.contains(cache_name)));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    // 1-2. If the relevant name to cache map contains cacheName, resolve promise with its Cache object.
+    if (auto cache = m_name_to_cache_map.get(cache_name); cache.has_value())
+        return WebIDL::create_resolved_promise(realm, *cache);
+
+    // 3-5. Otherwise, create a new cache, add it to the map, and resolve promise with its Cache object.
+    auto cache = Cache::create(realm);
+    m_name_to_cache_map.set(cache_name, cache);
+    return WebIDL::create_resolved_promise(realm, cache);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
+{
+    // Remove the cache from the relevant name to cache map and resolve the promise with whether it was present.
+    return WebIDL::create_resolved_promise(realm(), JS::Value(m_name_to_cache_map.remove(cache_name)));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
 {
-    dbgln("FIXME: CacheStorage::has() is not implemented yet");
-    return WebIDL::create_rejected_promise(realm(), JS::Value(false));
+    auto& realm = this->realm();
+
+    // Resolve the promise with the list of cache names, in the order they were created.
+    GC::RootVector<JS::Value> names(realm.heap());
+    for (auto const& it : m_name_to_cache_map)
+        names.append(JS::PrimitiveString::create(realm.vm(), it.key));
+
+    return WebIDL::create_resolved_promise(realm, JS::Array::create_from(realm, names));
 }
 
 }
@@ -7,23 +7,38 @@
 #pragma once
 
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/ServiceWorker/Cache.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::ServiceWorker {
 
+// https://w3c.github.io/ServiceWorker/#dictdef-multicachequeryoptions
+struct MultiCacheQueryOptions : public CacheQueryOptions {
+    Optional<String> cache_name;
+};
+
 // https://w3c.github.io/ServiceWorker/#cachestorage-interface
 class CacheStorage : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(CacheStorage, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(CacheStorage);
 
 public:
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options);
     GC::Ref<WebIDL::Promise> has(String const& cache_name);
     GC::Ref<WebIDL::Promise> open(String const& cache_name);
+    GC::Ref<WebIDL::Promise> delete_(String const& cache_name);
+    GC::Ref<WebIDL::Promise> keys();
 
 private:
     explicit CacheStorage(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-relevant-name-to-cache-map
+    // FIXME: This map should live in the user agent's storage bottle map, keyed by storage key, so that every global
+    //        with the same storage key observes the same caches and their contents persist across sessions.
+    OrderedHashMap<String, GC::Ref<Cache>> m_name_to_cache_map;
 };
 
 }
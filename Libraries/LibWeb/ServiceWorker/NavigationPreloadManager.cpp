@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, Tim Ledbetter <tim.ledbetter@ladybird.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/NavigationPreloadManagerPrototype.h>
+#include <LibWeb/ServiceWorker/NavigationPreloadManager.h>
+#include <LibWeb/ServiceWorker/Registration.h>
+#include <LibWeb/ServiceWorker/ServiceWorkerRegistration.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(NavigationPreloadManager);
+
+NavigationPreloadManager::NavigationPreloadManager(JS::Realm& realm, GC::Ref<ServiceWorkerRegistration> registration)
+    : Bindings::PlatformObject(realm)
+    , m_registration(registration)
+{
+}
+
+void NavigationPreloadManager::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(NavigationPreloadManager);
+    Base::initialize(realm);
+}
+
+void NavigationPreloadManager::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_registration);
+}
+
+GC::Ref<NavigationPreloadManager> NavigationPreloadManager::create(JS::Realm& realm, GC::Ref<ServiceWorkerRegistration> registration)
+{
+    return realm.create<NavigationPreloadManager>(realm, registration);
+}
+
+// https://w3c.github.io/ServiceWorker/#dom-navigationpreloadmanager-enable
+GC::Ref<WebIDL::Promise> NavigationPreloadManager::enable()
+{
+    return set_navigation_preload_enabled(true);
+}
+
+// https://w3c.github.io/ServiceWorker/#dom-navigationpreloadmanager-disable
+GC::Ref<WebIDL::Promise> NavigationPreloadManager::disable()
+{
+    return set_navigation_preload_enabled(false);
+}
+
+GC::Ref<WebIDL::Promise> NavigationPreloadManager::set_navigation_preload_enabled(bool enabled)
+{
+    auto& realm = this->realm();
+
+    // 1. Let registration be the service worker registration associated with this.
+    auto registration = Registration::get(m_registration->registration().storage_key(), m_registration->registration().scope_url());
+
+    // 2. If registration's active worker is null, return a promise rejected with an "InvalidStateError" DOMException.
+    if (!registration.has_value() || !registration->active_worker())
+        return WebIDL::create_rejected_promise(realm, WebIDL::InvalidStateError::create(realm, "Registration does not have an active worker"_utf16));
+
+    // 3. Set (or unset) registration's navigation preload enabled flag.
+    registration->set_navigation_preload_enabled(enabled);
+
+    // 4. Return a promise resolved with undefined.
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+// https://w3c.github.io/ServiceWorker/#dom-navigationpreloadmanager-setheadervalue
+GC::Ref<WebIDL::Promise> NavigationPreloadManager::set_header_value(String const& value)
+{
+    auto& realm = this->realm();
+
+    // 1. Let registration be the service worker registration associated with this.
+    auto registration = Registration::get(m_registration->registration().storage_key(), m_registration->registration().scope_url());
+
+    // 2. If registration's active worker is null, return a promise rejected with an "InvalidStateError" DOMException.
+    if (!registration.has_value() || !registration->active_worker())
+        return WebIDL::create_rejected_promise(realm, WebIDL::InvalidStateError::create(realm, "Registration does not have an active worker"_utf16));
+
+    // 3. Set registration's navigation preload header value to value.
+    registration->set_navigation_preload_header_value(value.to_byte_string());
+
+    // 4. Return a promise resolved with undefined.
+    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+}
+
+// https://w3c.github.io/ServiceWorker/#dom-navigationpreloadmanager-getstate
+GC::Ref<WebIDL::Promise> NavigationPreloadManager::get_state()
+{
+    auto& realm = this->realm();
+    auto& vm = realm.vm();
+
+    // 1. Let state be a new NavigationPreloadState dictionary.
+    auto state = JS::Object::create(realm, realm.intrinsics().object_prototype());
+
+    // 2. Let registration be the service worker registration associated with this.
+    auto registration = Registration::get(m_registration->registration().storage_key(), m_registration->registration().scope_url());
+
+    // 3. If registration's navigation preload enabled flag is set, set state["enabled"] to true.
+    // 4. Set state["headerValue"] to registration's navigation preload header value.
+    bool enabled = registration.has_value() && registration->navigation_preload_enabled();
+    auto header_value = registration.has_value() ? registration->navigation_preload_header_value() : ByteString {};
+    MUST(state->create_data_property("enabled"_utf16_fly_string, JS::Value(enabled)));
+    MUST(state->create_data_property("headerValue"_utf16_fly_string, JS::PrimitiveString::create(vm, header_value.view())));
+
+    // 5. Return a promise resolved with state.
+    return WebIDL::create_resolved_promise(realm, state);
+}
+
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2025, Tim Ledbetter <tim.ledbetter@ladybird.org>
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#navigationpreloadmanager
+class NavigationPreloadManager final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(NavigationPreloadManager, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(NavigationPreloadManager);
+
+public:
+    [[nodiscard]] static GC::Ref<NavigationPreloadManager> create(JS::Realm&, GC::Ref<ServiceWorkerRegistration>);
+
+    GC::Ref<WebIDL::Promise> enable();
+    GC::Ref<WebIDL::Promise> disable();
+    GC::Ref<WebIDL::Promise> set_header_value(String const& value);
+    GC::Ref<WebIDL::Promise> get_state();
+
+private:
+    NavigationPreloadManager(JS::Realm&, GC::Ref<ServiceWorkerRegistration>);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    GC::Ref<WebIDL::Promise> set_navigation_preload_enabled(bool);
+
+    GC::Ref<ServiceWorkerRegistration> m_registration;
+};
+
+}
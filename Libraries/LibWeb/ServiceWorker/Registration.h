@@ -52,6 +52,12 @@ public:
 
     bool is_stale() const;
 
+    bool navigation_preload_enabled() const { return m_navigation_preload_enabled; }
+    void set_navigation_preload_enabled(bool enabled) { m_navigation_preload_enabled = enabled; }
+
+    ByteString const& navigation_preload_header_value() const { return m_navigation_preload_header_value; }
+    void set_navigation_preload_header_value(ByteString value) { m_navigation_preload_header_value = move(value); }
+
 private:
     Registration(StorageAPI::StorageKey, URL::URL, Bindings::ServiceWorkerUpdateViaCache);
 
@@ -69,9 +75,8 @@ private:
     // FIXME: Spec bug: A service worker registration has an associated NavigationPreloadManager object.
     //        This can't possibly be true. The association is the other way around.
 
-    // FIXME: Investigate if this is implemented.
-    [[maybe_unused]] bool m_navigation_preload_enabled = { false }; // https://w3c.github.io/ServiceWorker/#service-worker-registration-navigation-preload-enabled-flag
-    ByteString m_navigation_preload_header_value;                   // https://w3c.github.io/ServiceWorker/#service-worker-registration-navigation-preload-header-value
+    bool m_navigation_preload_enabled = { false }; // https://w3c.github.io/ServiceWorker/#service-worker-registration-navigation-preload-enabled-flag
+    ByteString m_navigation_preload_header_value;  // https://w3c.github.io/ServiceWorker/#service-worker-registration-navigation-preload-header-value
 };
 
 struct RegistrationKey {
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/FlyString.h>
+#include <AK/Vector.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Bindings/ServiceWorkerPrototype.h>
 #include <LibWeb/Bindings/WorkerPrototype.h>
@@ -33,6 +35,12 @@ struct ServiceWorkerRecord {
     // A service worker has an associated classic scripts imported flag. It is initially unset.
     bool classic_scripts_imported { false };
 
+    // https://w3c.github.io/ServiceWorker/#dfn-set-of-event-types-to-handle
+    // A service worker has an associated set of event types to handle (a set) whose item is an event listener's event type. It is initially set to an empty set.
+    // NOTE: Once "Handle Fetch" is implemented, fetches for clients whose active worker never registered a
+    //       fetch listener must not wake the worker; this set is what that bypass decision is based on.
+    Vector<FlyString> set_of_event_types_to_handle;
+
     // FIXME: A lot more fields after this...
 };
 
@@ -7,6 +7,7 @@
 #include <LibJS/Runtime/Realm.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ServiceWorkerRegistrationPrototype.h>
+#include <LibWeb/ServiceWorker/NavigationPreloadManager.h>
 #include <LibWeb/ServiceWorker/ServiceWorker.h>
 #include <LibWeb/ServiceWorker/ServiceWorkerRegistration.h>
 
@@ -32,6 +33,15 @@ void ServiceWorkerRegistration::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_installing);
     visitor.visit(m_waiting);
     visitor.visit(m_active);
+    visitor.visit(m_navigation_preload_manager);
+}
+
+// https://w3c.github.io/ServiceWorker/#dom-serviceworkerregistration-navigationpreload
+GC::Ref<NavigationPreloadManager> ServiceWorkerRegistration::navigation_preload()
+{
+    if (!m_navigation_preload_manager)
+        m_navigation_preload_manager = NavigationPreloadManager::create(realm(), *this);
+    return *m_navigation_preload_manager;
 }
 
 GC::Ref<ServiceWorkerRegistration> ServiceWorkerRegistration::create(JS::Realm& realm, Registration const& registration)
@@ -29,6 +29,9 @@ public:
     GC::Ptr<ServiceWorker> active() const { return m_active; }
     void set_active(GC::Ptr<ServiceWorker> active) { m_active = active; }
 
+    // https://w3c.github.io/ServiceWorker/#dom-serviceworkerregistration-navigationpreload
+    GC::Ref<NavigationPreloadManager> navigation_preload();
+
     // https://w3c.github.io/ServiceWorker/#dom-serviceworkerregistration-scope
     String scope() const { return m_registration.scope_url().serialize(); }
 
@@ -46,6 +49,7 @@ private:
     GC::Ptr<ServiceWorker> m_installing;
     GC::Ptr<ServiceWorker> m_waiting;
     GC::Ptr<ServiceWorker> m_active;
+    GC::Ptr<NavigationPreloadManager> m_navigation_preload_manager;
 };
 
 }
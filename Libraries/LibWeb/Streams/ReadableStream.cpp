@@ -301,16 +301,16 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     auto pull_size = min(available, desired_size);
 
     // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
-
     // 7. Remove the first pullSize bytes from bytes.
-    if (pull_size != available)
-        bytes = MUST(bytes.slice(pull_size, available - pull_size));
+    // NOTE: Steps 6 and 7 are inlined below so that neither of them costs an allocation and a copy;
+    //       the removed remainder is dead after this algorithm anyway.
 
     // 8. If stream’s current BYOB request view is non-null, then:
     if (auto byob_view = current_byob_request_view()) {
         // 1. Write pulled into stream’s current BYOB request view.
-        byob_view->write(pulled);
+        // OPTIMIZATION: Write into the consumer's buffer straight out of `bytes` instead of
+        //               materializing `pulled` first.
+        byob_view->write(bytes.span().trim(pull_size));
 
         // 2. Perform ? ReadableByteStreamControllerRespond(stream.[[controller]], pullSize).
         TRY(readable_byte_stream_controller_respond(controller, pull_size));
@@ -318,6 +318,9 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     // 9. Otherwise,
     else {
         // 1. Set view to the result of creating a Uint8Array from pulled in stream’s relevant Realm.
+        // OPTIMIZATION: When the whole chunk is pulled (the common case), the ArrayBuffer adopts
+        //               the buffer instead of copying it.
+        auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
         auto array_buffer = JS::ArrayBuffer::create(realm, move(pulled));
         auto view = JS::Uint8Array::create(realm, array_buffer->byte_length(), *array_buffer);
 
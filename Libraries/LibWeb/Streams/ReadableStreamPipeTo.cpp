@@ -100,6 +100,7 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_reader);
     visitor.visit(m_writer);
     visitor.visit(m_signal);
+    visitor.visit(m_read_request);
     visitor.visit(m_pending_writes);
     visitor.visit(m_unwritten_chunks);
 }
@@ -217,34 +218,41 @@ void ReadableStreamPipeTo::read_chunk()
     if (check_for_error_and_close_states())
         return;
 
-    auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
-        m_unwritten_chunks.append(chunk);
+    // OPTIMIZATION: The read request and its reactions are identical for every chunk, and the pipe
+    //               only ever has one read in flight, so they are allocated once and reused. This
+    //               also registers the writer-closed watchdog a single time, instead of piling a
+    //               fresh pair of reactions onto the same promise for every chunk.
+    if (!m_read_request) {
+        auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
+            m_unwritten_chunks.append(chunk);
+
+            if (check_for_error_and_close_states())
+                return;
+
+            HTML::queue_a_microtask(nullptr, GC::create_function(m_realm->heap(), [this]() {
+                HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+                write_chunk();
+                process();
+            }));
+        });
 
-        if (check_for_error_and_close_states())
-            return;
+        auto on_complete = GC::create_function(heap(), [this]() {
+            if (!check_for_error_and_close_states())
+                finish();
+        });
 
-        HTML::queue_a_microtask(nullptr, GC::create_function(m_realm->heap(), [this]() {
-            HTML::TemporaryExecutionContext execution_context { m_realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-            write_chunk();
-            process();
-        }));
-    });
+        auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+            check_for_error_and_close_states();
+            return JS::js_undefined();
+        });
 
-    auto on_complete = GC::create_function(heap(), [this]() {
-        if (!check_for_error_and_close_states())
-            finish();
-    });
-
-    auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
-        check_for_error_and_close_states();
-        return JS::js_undefined();
-    });
+        m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
 
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
+        if (auto promise = m_writer->closed())
+            WebIDL::react_to_promise(*promise, shutdown, shutdown);
+    }
 
-    if (auto promise = m_writer->closed())
-        WebIDL::react_to_promise(*promise, shutdown, shutdown);
+    readable_stream_default_reader_read(m_reader, *m_read_request);
 }
 
 void ReadableStreamPipeTo::write_chunk()
@@ -68,6 +68,9 @@ private:
     GC::Ptr<DOM::AbortSignal> m_signal;
     DOM::AbortSignal::AbortAlgorithmID m_signal_id { 0 };
 
+    // Allocated once and reused for every chunk; the pipe only ever has one read in flight.
+    GC::Ptr<ReadRequest> m_read_request;
+
     Vector<GC::Ref<WebIDL::Promise>> m_pending_writes;
     Vector<JS::Value, 1> m_unwritten_chunks;
 
@@ -136,6 +136,18 @@ public:
         m_parent->remove_child(*static_cast<T*>(this));
     }
 
+    // Clears this node's parent/child/sibling pointers without unlinking from the neighbors,
+    // which keep dangling links to this node. Only safe when the entire tree this node belongs
+    // to is being dismantled anyway.
+    void detach_all_tree_links()
+    {
+        m_parent = nullptr;
+        m_first_child = nullptr;
+        m_last_child = nullptr;
+        m_next_sibling = nullptr;
+        m_previous_sibling = nullptr;
+    }
+
     size_t child_count() const
     {
         size_t count = 0;
@@ -176,30 +176,27 @@ WebIDL::ExceptionOr<void> AnalyserNode::get_byte_frequency_data(GC::Root<WebIDL:
     // FIXME: Ensure sizes are correct after the fourier transform is implemented
     //        Spec says to write frequencyBinCount bytes, not fftSize
     Vector<f32> dB_data = current_frequency_data();
-    Vector<u8> byte_data;
-    byte_data.ensure_capacity(dB_data.size());
+
+    // Write the current frequency data into array. If array’s byte length is less than frequencyBinCount,
+    // the excess elements will be dropped. If array’s byte length is greater than the frequencyBinCount ,
+    // the excess elements will be ignored. The most recent fftSize frames are used in computing the frequency data.
+    auto& output_buffer = array->viewed_array_buffer()->buffer();
+    size_t bytes_to_write = min(array->byte_length(), frequency_bin_count());
 
     // For getByteFrequencyData(), the 𝑌[𝑘] is clipped to lie between minDecibels and maxDecibels
     // and then scaled to fit in an unsigned byte such that minDecibels is represented by the
     // value 0 and maxDecibels is represented by the value 255.
-    // FIXME: Naive
+    // OPTIMIZATION: Convert straight into the destination buffer rather than building a temporary
+    //               byte vector and copying it over afterwards.
     f32 delta_dB = m_max_decibels - m_min_decibels;
-    for (auto x : dB_data) {
+    for (size_t i = 0; i < bytes_to_write; i++) {
+        auto x = dB_data[i];
         x = max(x, m_min_decibels);
         x = min(x, m_max_decibels);
 
-        byte_data.unchecked_append(static_cast<u8>(255 * (x - m_min_decibels) / delta_dB));
+        output_buffer[i] = static_cast<u8>(255 * (x - m_min_decibels) / delta_dB);
     }
 
-    // Write the current frequency data into array. If array’s byte length is less than frequencyBinCount,
-    // the excess elements will be dropped. If array’s byte length is greater than the frequencyBinCount ,
-    // the excess elements will be ignored. The most recent fftSize frames are used in computing the frequency data.
-    auto& output_buffer = array->viewed_array_buffer()->buffer();
-    size_t bytes_to_write = min(array->byte_length(), frequency_bin_count());
-
-    for (size_t i = 0; i < bytes_to_write; i++)
-        output_buffer[i] = byte_data[i];
-
     return {};
 }
 
@@ -236,23 +233,18 @@ WebIDL::ExceptionOr<void> AnalyserNode::get_byte_time_domain_data(GC::Root<WebID
     Vector<f32> time_domain_data = current_time_domain_data();
     VERIFY(time_domain_data.size() == m_fft_size);
 
-    Vector<u8> byte_data;
-    byte_data.ensure_capacity(m_fft_size);
+    auto& output_buffer = array->viewed_array_buffer()->buffer();
+    size_t bytes_to_write = min(array->byte_length(), fft_size());
 
-    // FIXME: Naive
-    for (size_t i = 0; i < m_fft_size; i++) {
+    // OPTIMIZATION: Convert straight into the destination buffer rather than building a temporary
+    //               byte vector and copying it over afterwards.
+    for (size_t i = 0; i < bytes_to_write; i++) {
         auto x = 128 * (1 + time_domain_data[i]);
         x = max(x, 0);
         x = min(x, 255);
-        byte_data.unchecked_append(static_cast<u8>(x));
+        output_buffer[i] = static_cast<u8>(x);
     }
 
-    auto& output_buffer = array->viewed_array_buffer()->buffer();
-    size_t bytes_to_write = min(array->byte_length(), fft_size());
-
-    for (size_t i = 0; i < bytes_to_write; i++)
-        output_buffer[i] = byte_data[i];
-
     return {};
 }
 
@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Base64.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibThreading/BackgroundAction.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/ElementFactory.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -72,27 +75,45 @@ ErrorOr<GC::Ref<HTML::HTMLCanvasElement>, WebDriver::Error> draw_bounding_box_fr
 }
 
 // https://w3c.github.io/webdriver/#dfn-encoding-a-canvas-as-base64
-Response encode_canvas_element(HTML::HTMLCanvasElement& canvas)
+void encode_canvas_element(HTML::HTMLCanvasElement& canvas, Function<void(Response)> on_complete)
 {
     // FIXME: 1. If the canvas element’s bitmap’s origin-clean flag is set to false, return error with error code unable to capture screen.
 
     // 2. If the canvas element’s bitmap has no pixels (i.e. either its horizontal dimension or vertical dimension is zero) then return error with error code unable to capture screen.
-    if (canvas.surface()->size().is_empty())
-        return Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv);
-
-    // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
-    // 4. Let data url be a data: URL representing file. [RFC2397]
-    auto data_url = canvas.to_data_url("image/png"sv, JS::js_undefined());
-
-    // 5. Let index be the index of "," in data url.
-    auto index = data_url.find_byte_offset(',');
-    VERIFY(index.has_value());
-
-    // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
-    auto encoded_string = MUST(data_url.substring_from_byte_offset(*index + 1));
-
-    // 7. Return success with data encoded string.
-    return JsonValue { move(encoded_string) };
+    if (canvas.surface()->size().is_empty()) {
+        on_complete(Error::from_code(ErrorCode::UnableToCaptureScreen, "Captured screenshot is empty"sv));
+        return;
+    }
+
+    // OPTIMIZATION: PNG-encoding and base64-serializing a large screenshot takes long enough that
+    //               we don't want to stall the page's event loop for it. We snapshot the canvas
+    //               bitmap here and hand it over to a background thread, which performs the
+    //               encoding and invokes on_complete back on the event loop.
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, canvas.surface()->size()));
+    canvas.surface()->read_into_bitmap(*bitmap);
+
+    (void)Threading::BackgroundAction<Response>::construct(
+        [bitmap = move(bitmap)](auto&) -> ErrorOr<Response> {
+            // 3. Let file be a serialization of the canvas element’s bitmap as a file, using "image/png" as an argument.
+            auto file = Gfx::PNGWriter::encode(*bitmap);
+            if (file.is_error())
+                return Response { Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to encode screenshot as PNG"sv) };
+
+            // 4. Let data url be a data: URL representing file. [RFC2397]
+            // 5. Let index be the index of "," in data url.
+            // 6. Let encoded string be a substring of data url using (index + 1) as the start argument.
+            // NOTE: We skip the data: URL roundtrip and just base64-encode the file directly.
+            auto encoded_string = encode_base64(file.value());
+            if (encoded_string.is_error())
+                return Response { Error::from_code(ErrorCode::UnableToCaptureScreen, "Failed to base64-encode screenshot"sv) };
+
+            return Response { JsonValue { encoded_string.release_value() } };
+        },
+        [on_complete = move(on_complete)](Response result) -> ErrorOr<void> {
+            // 7. Return success with data encoded string.
+            on_complete(move(result));
+            return {};
+        });
 }
 
 }
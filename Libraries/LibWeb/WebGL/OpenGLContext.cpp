@@ -50,6 +50,14 @@ struct OpenGLContext::Impl {
 #endif
 };
 
+#ifdef ENABLE_WEBGL
+// OPTIMIZATION: Every WebGL call makes its context current before issuing GL commands, and
+//               eglMakeCurrent() is not free even when the context doesn't change. All contexts
+//               are used from the same thread, so shadow the most recently bound context and let
+//               make_current() skip the call when this context is already current.
+static OpenGLContext const* s_current_context = nullptr;
+#endif
+
 OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend_context, Impl impl, WebGLVersion webgl_version)
     : m_skia_backend_context(move(skia_backend_context))
     , m_impl(make<Impl>(impl))
@@ -62,6 +70,7 @@ OpenGLContext::~OpenGLContext()
 #ifdef ENABLE_WEBGL
     free_surface_resources();
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    s_current_context = nullptr;
     eglDestroyContext(m_impl->display, m_impl->context);
 #endif
 }
@@ -70,6 +79,7 @@ void OpenGLContext::free_surface_resources()
 {
 #ifdef ENABLE_WEBGL
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    s_current_context = this;
 
     if (m_impl->framebuffer) {
         glDeleteFramebuffers(1, &m_impl->framebuffer);
@@ -290,6 +300,7 @@ void OpenGLContext::allocate_iosurface_painting_surface()
     m_impl->surface = eglCreatePbufferFromClientBuffer(m_impl->display, EGL_IOSURFACE_ANGLE, iosurface.core_foundation_pointer(), m_impl->config, surface_attributes);
 
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    s_current_context = this;
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(m_impl->texture_target == EGL_TEXTURE_RECTANGLE_ANGLE ? GL_TEXTURE_RECTANGLE_ANGLE : GL_TEXTURE_2D, m_impl->color_buffer);
@@ -354,6 +365,7 @@ void OpenGLContext::allocate_vkimage_painting_surface()
 
     m_impl->surface = EGL_NO_SURFACE;
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    s_current_context = this;
 
     glGenTextures(1, &m_impl->color_buffer);
     glBindTexture(GL_TEXTURE_2D, m_impl->color_buffer);
@@ -407,7 +419,10 @@ void OpenGLContext::make_current()
 {
 #ifdef ENABLE_WEBGL
     allocate_painting_surface_if_needed();
+    if (s_current_context == this)
+        return;
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, m_impl->context);
+    s_current_context = this;
 #endif
 }
 
@@ -112,6 +112,48 @@ ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source)
     return bytes;
 }
 
+// Like get_buffer_source_copy(), but returns a view of the underlying bytes instead of copying them.
+// The view is only valid as long as no script can run and the underlying buffer cannot be detached
+// or resized; callers must consume it before returning to the event loop.
+ReadonlyBytes get_buffer_source_view(JS::Object const& buffer_source)
+{
+    JS::ArrayBuffer* es_array_buffer;
+    u32 offset = 0;
+    u32 length = 0;
+
+    if (is<JS::TypedArrayBase>(buffer_source)) {
+        auto const& es_buffer_source = static_cast<JS::TypedArrayBase const&>(buffer_source);
+
+        auto typed_array_record = JS::make_typed_array_with_buffer_witness_record(es_buffer_source, JS::ArrayBuffer::Order::SeqCst);
+        if (JS::is_typed_array_out_of_bounds(typed_array_record))
+            return {};
+
+        es_array_buffer = es_buffer_source.viewed_array_buffer();
+        offset = es_buffer_source.byte_offset();
+        length = JS::typed_array_byte_length(typed_array_record);
+    } else if (is<JS::DataView>(buffer_source)) {
+        auto const& es_buffer_source = static_cast<JS::DataView const&>(buffer_source);
+
+        auto view_record = JS::make_data_view_with_buffer_witness_record(es_buffer_source, JS::ArrayBuffer::Order::SeqCst);
+        if (JS::is_view_out_of_bounds(view_record))
+            return {};
+
+        es_array_buffer = es_buffer_source.viewed_array_buffer();
+        offset = es_buffer_source.byte_offset();
+        length = JS::get_view_byte_length(view_record);
+    } else {
+        VERIFY(is<JS::ArrayBuffer>(buffer_source));
+        auto const& es_buffer_source = static_cast<JS::ArrayBuffer const&>(buffer_source);
+        es_array_buffer = &const_cast<JS::ArrayBuffer&>(es_buffer_source);
+        length = es_buffer_source.byte_length();
+    }
+
+    if (es_array_buffer->is_detached())
+        return {};
+
+    return es_array_buffer->buffer().bytes().slice(offset, length);
+}
+
 // https://webidl.spec.whatwg.org/#call-user-object-operation-return
 // https://whatpr.org/webidl/1437.html#call-user-object-operation-return
 inline JS::Completion clean_up_on_return(JS::Realm& stored_realm, JS::Realm& relevant_realm, JS::Completion& completion, OperationReturnsPromise operation_returns_promise)
@@ -230,12 +272,12 @@ JS::ThrowCompletionOr<String> to_byte_string(JS::VM& vm, JS::Value value)
     return x;
 }
 
-JS::ThrowCompletionOr<String> to_string(JS::VM& vm, JS::Value value)
+JS::ThrowCompletionOr<String> to_string_slow_case(JS::VM& vm, JS::Value value)
 {
     return value.to_string(vm);
 }
 
-JS::ThrowCompletionOr<Utf16String> to_utf16_string(JS::VM& vm, JS::Value value)
+JS::ThrowCompletionOr<Utf16String> to_utf16_string_slow_case(JS::VM& vm, JS::Value value)
 {
     return value.to_utf16_string(vm);
 }
@@ -457,6 +499,20 @@ double integer_part(double n)
 template<Integral T>
 JS::ThrowCompletionOr<T> convert_to_int(JS::VM& vm, JS::Value value, EnforceRange enforce_range, Clamp clamp)
 {
+    // OPTIMIZATION: Almost every integer reaching a binding is already an Int32-tagged Value that fits
+    //               the target type, in which case enforcing, clamping, and the modulo wrap below are
+    //               all the identity.
+    if (value.is_int32()) {
+        auto int32_value = value.as_i32();
+        bool fits = false;
+        if constexpr (sizeof(T) == 8)
+            fits = IsSigned<T> || int32_value >= 0;
+        else
+            fits = int32_value >= static_cast<i64>(NumericLimits<T>::min()) && int32_value <= static_cast<i64>(NumericLimits<T>::max());
+        if (fits)
+            return static_cast<T>(int32_value);
+    }
+
     double upper_bound = 0;
     double lower_bound = 0;
 
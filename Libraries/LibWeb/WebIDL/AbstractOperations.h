@@ -12,6 +12,8 @@
 #include <LibGC/Ptr.h>
 #include <LibGC/RootVector.h>
 #include <LibJS/Forward.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/Value.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
 
@@ -20,11 +22,30 @@ namespace Web::WebIDL {
 bool is_buffer_source_type(JS::Value);
 GC::Ptr<JS::ArrayBuffer> underlying_buffer_source(JS::Object& buffer_source);
 WEB_API ErrorOr<ByteBuffer> get_buffer_source_copy(JS::Object const& buffer_source);
+WEB_API ReadonlyBytes get_buffer_source_view(JS::Object const& buffer_source);
 
 JS::Completion call_user_object_operation(CallbackType& callback, Utf16FlyString const& operation_name, Optional<JS::Value> this_argument, ReadonlySpan<JS::Value> args);
 
-WEB_API JS::ThrowCompletionOr<String> to_string(JS::VM&, JS::Value);
-WEB_API JS::ThrowCompletionOr<Utf16String> to_utf16_string(JS::VM&, JS::Value);
+WEB_API JS::ThrowCompletionOr<String> to_string_slow_case(JS::VM&, JS::Value);
+WEB_API JS::ThrowCompletionOr<Utf16String> to_utf16_string_slow_case(JS::VM&, JS::Value);
+
+// OPTIMIZATION: Generated bindings funnel every DOMString argument through these two. The value is
+//               almost always already a string, so that case is handled inline without going through
+//               the generic ToString machinery.
+ALWAYS_INLINE JS::ThrowCompletionOr<String> to_string(JS::VM& vm, JS::Value value)
+{
+    if (value.is_string())
+        return value.as_string().utf8_string();
+    return to_string_slow_case(vm, value);
+}
+
+ALWAYS_INLINE JS::ThrowCompletionOr<Utf16String> to_utf16_string(JS::VM& vm, JS::Value value)
+{
+    if (value.is_string())
+        return value.as_string().utf16_string();
+    return to_utf16_string_slow_case(vm, value);
+}
+
 WEB_API JS::ThrowCompletionOr<String> to_usv_string(JS::VM&, JS::Value);
 JS::ThrowCompletionOr<Utf16String> to_utf16_usv_string(JS::VM&, JS::Value);
 JS::ThrowCompletionOr<String> to_byte_string(JS::VM&, JS::Value);
@@ -343,9 +343,12 @@ libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
 libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
+libweb_js_bindings(Scheduler/Scheduler)
 libweb_js_bindings(Serial/Serial)
 libweb_js_bindings(Serial/SerialPort)
+libweb_js_bindings(ServiceWorker/Cache)
 libweb_js_bindings(ServiceWorker/CacheStorage)
+libweb_js_bindings(ServiceWorker/NavigationPreloadManager)
 libweb_js_bindings(ServiceWorker/ServiceWorker)
 libweb_js_bindings(ServiceWorker/ServiceWorkerContainer)
 libweb_js_bindings(ServiceWorker/ServiceWorkerGlobalScope GLOBAL)
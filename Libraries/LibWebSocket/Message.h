@@ -9,6 +9,8 @@
 #include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/Optional.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
 
 namespace WebSocket {
 
@@ -28,6 +30,7 @@ public:
 
     bool is_text() const { return m_is_text; }
     ByteBuffer const& data() const { return m_data; }
+    ByteBuffer& data() { return m_data; }
 
 private:
     bool m_is_text { false };
@@ -35,3 +38,23 @@ private:
 };
 
 }
+
+namespace IPC {
+
+template<>
+inline ErrorOr<void> encode(Encoder& encoder, WebSocket::Message const& message)
+{
+    TRY(encoder.encode(message.is_text()));
+    TRY(encoder.encode(message.data()));
+    return {};
+}
+
+template<>
+inline ErrorOr<WebSocket::Message> decode(Decoder& decoder)
+{
+    auto is_text = TRY(decoder.decode<bool>());
+    auto data = TRY(decoder.decode<ByteBuffer>());
+    return WebSocket::Message { move(data), is_text };
+}
+
+}
@@ -6,6 +6,7 @@
  */
 
 #include <AK/Base64.h>
+#include <AK/Memory.h>
 #include <AK/Random.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibCrypto/SecureRandom.h>
@@ -167,7 +168,19 @@ void WebSocket::drain_read()
         do {
             if (auto maybe_error = read_frame(); maybe_error.is_error())
                 break;
-        } while (!m_buffered_data.is_empty());
+        } while (m_buffered_data_offset < m_buffered_data.size());
+
+        // OPTIMIZATION: Compact consumed bytes away once per drain instead of once per frame, so
+        //               processing a burst of small frames stays linear in the amount of data read.
+        if (m_buffered_data_offset == m_buffered_data.size()) {
+            m_buffered_data.clear_with_capacity();
+            m_buffered_data_offset = 0;
+        } else if (m_buffered_data_offset > 0) {
+            m_buffered_data.remove(0, m_buffered_data_offset);
+            m_buffered_data_offset = 0;
+        }
+
+        flush_message_batch();
     } break;
     case InternalState::Closed:
     case InternalState::Errored: {
@@ -409,7 +422,7 @@ ErrorOr<void> WebSocket::read_frame()
     VERIFY(m_impl);
     VERIFY(m_state == WebSocket::InternalState::Open || m_state == WebSocket::InternalState::Closing);
 
-    size_t cursor = 0;
+    size_t cursor = m_buffered_data_offset;
     auto get_buffered_bytes = [&](size_t count) -> ReadonlyBytes {
         if (cursor + count > m_buffered_data.size())
             return {};
@@ -488,19 +501,26 @@ ErrorOr<void> WebSocket::read_frame()
         read_length += payload_part.size();
     }
 
-    if (cursor == m_buffered_data.size()) {
-        m_buffered_data.clear();
-    } else {
-        Vector<u8> new_buffered_data;
-        new_buffered_data.append(m_buffered_data.data() + cursor, m_buffered_data.size() - cursor);
-        m_buffered_data = move(new_buffered_data);
-    }
+    // The frame is complete; commit the consumed bytes. The caller compacts the buffer when it is
+    // done parsing frames.
+    m_buffered_data_offset = cursor;
 
     if (is_masked) {
-        // Unmask the payload
-        for (size_t i = 0; i < payload.size(); ++i) {
-            payload[i] = payload[i] ^ (masking_key[i % 4]);
+        // Unmask the payload, XOR-ing a word at a time; the compiler vectorizes this loop, which
+        // matters for high-frequency feeds of masked frames.
+        u32 mask_word;
+        memcpy(&mask_word, masking_key, sizeof(mask_word));
+        u64 wide_mask = (static_cast<u64>(mask_word) << 32) | mask_word;
+
+        size_t i = 0;
+        for (; i + sizeof(u64) <= payload.size(); i += sizeof(u64)) {
+            u64 word;
+            memcpy(&word, payload.offset_pointer(i), sizeof(word));
+            word ^= wide_mask;
+            memcpy(payload.offset_pointer(i), &word, sizeof(word));
         }
+        for (; i < payload.size(); ++i)
+            payload[i] = payload[i] ^ (masking_key[i % 4]);
     }
 
     if (op_code == WebSocket::OpCode::ConnectionClose) {
@@ -672,6 +692,9 @@ void WebSocket::notify_open()
 
 void WebSocket::notify_close(u16 code, ByteString reason, bool was_clean)
 {
+    // Deliver any batched messages before announcing the close.
+    flush_message_batch();
+
     if (!on_close)
         return;
     on_close(code, move(reason), was_clean);
@@ -679,6 +702,8 @@ void WebSocket::notify_close(u16 code, ByteString reason, bool was_clean)
 
 void WebSocket::notify_error(WebSocket::Error error)
 {
+    flush_message_batch();
+
     if (!on_error)
         return;
     on_error(error);
@@ -686,11 +711,23 @@ void WebSocket::notify_error(WebSocket::Error error)
 
 void WebSocket::notify_message(Message message)
 {
+    if (on_message_batch) {
+        m_message_batch.append(move(message));
+        return;
+    }
+
     if (!on_message)
         return;
     on_message(move(message));
 }
 
+void WebSocket::flush_message_batch()
+{
+    if (m_message_batch.is_empty())
+        return;
+    on_message_batch(exchange(m_message_batch, {}));
+}
+
 void WebSocket::set_state(InternalState state)
 {
     if (m_state == state)
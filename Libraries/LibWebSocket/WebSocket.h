@@ -60,6 +60,11 @@ public:
     Function<void()> on_open;
     Function<void(u16 code, ByteString reason, bool was_clean)> on_close;
     Function<void(Message message)> on_message;
+
+    // When set, takes precedence over on_message: every message parsed from one socket read is
+    // collected and delivered in a single callback, so a burst of small frames results in one
+    // wakeup for the consumer instead of one per message.
+    Function<void(Vector<Message> messages)> on_message_batch;
     Function<void(ReadyState)> on_ready_state_change;
     Function<void(ByteString)> on_subprotocol;
 
@@ -96,6 +101,7 @@ private:
     void notify_close(u16 code, ByteString reason, bool was_clean);
     void notify_error(Error);
     void notify_message(Message);
+    void flush_message_batch();
 
     void fatal_error(Error);
     void discard_connection();
@@ -134,6 +140,10 @@ private:
     RefPtr<WebSocketImpl> m_impl;
 
     Vector<u8> m_buffered_data;
+    // Number of bytes at the front of m_buffered_data that have already been consumed by parsed
+    // frames. The buffer is only compacted once per drain, not once per frame.
+    size_t m_buffered_data_offset { 0 };
+    Vector<Message> m_message_batch;
     ByteBuffer m_fragmented_data_buffer;
     WebSocket::OpCode m_initial_fragment_opcode;
 };
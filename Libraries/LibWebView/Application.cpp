@@ -5,6 +5,8 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/QuickSort.h>
+#include <AK/Time.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
 #include <LibCore/StandardPaths.h>
@@ -96,6 +98,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Vector<ByteString> raw_urls;
     Vector<ByteString> certificates;
     Optional<HeadlessMode> headless_mode;
+    Optional<size_t> benchmark_run_count;
     Optional<int> window_width;
     Optional<int> window_height;
     bool new_window = false;
@@ -133,7 +136,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
-        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', or 'text'.",
+        .help_string = "Run Ladybird without a browser window. Mode may be 'screenshot' (default), 'layout-tree', 'text', or 'benchmark'.",
         .long_name = "headless",
         .value_name = "mode",
         .accept_value = [&](StringView value) {
@@ -146,11 +149,14 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
                 headless_mode = HeadlessMode::LayoutTree;
             else if (value.equals_ignoring_ascii_case("text"sv))
                 headless_mode = HeadlessMode::Text;
+            else if (value.equals_ignoring_ascii_case("benchmark"sv))
+                headless_mode = HeadlessMode::Benchmark;
 
             return headless_mode.has_value();
         },
     });
 
+    args_parser.add_option(benchmark_run_count, "Number of measured page loads in headless benchmark mode (default: 10)", "benchmark-run-count", 0, "count");
     args_parser.add_option(window_width, "Set viewport width in pixels (default: 800) (currently only supported for headless mode)", "window-width", 0, "pixels");
     args_parser.add_option(window_height, "Set viewport height in pixels (default: 600) (currently only supported for headless mode)", "window-height", 0, "pixels");
     args_parser.add_option(certificates, "Path to a certificate file", "certificate", 'C', "certificate");
@@ -250,6 +256,8 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .enable_content_filter = disable_content_filter ? EnableContentFilter::No : EnableContentFilter::Yes,
     };
 
+    if (benchmark_run_count.has_value() && *benchmark_run_count > 0)
+        m_browser_options.benchmark_run_count = *benchmark_run_count;
     if (window_width.has_value())
         m_browser_options.window_width = *window_width;
     if (window_height.has_value())
@@ -306,10 +314,16 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
     return WebView::launch_spare_web_content_process(move(image_decoder_socket), move(request_server_socket));
 }
 
+// Keeping a few initialized WebContent processes parked makes opening a burst of tabs
+// IPC-roundtrip-bound instead of paying dynamic linking and initialization per tab. Each parked
+// process costs memory, so the pool is kept small; it refills itself in the background as tabs
+// consume it.
+static constexpr size_t max_spare_web_content_processes = 2;
+
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
+    if (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
         launch_spare_web_content_process();
 
         web_content_client->assign_view({}, view);
@@ -329,6 +343,9 @@ void Application::launch_spare_web_content_process()
     if (browser_options().profile_helper_process == ProcessType::WebContent)
         return;
 
+    if (m_spare_web_content_processes.size() >= max_spare_web_content_processes)
+        return;
+
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
@@ -336,16 +353,78 @@ void Application::launch_spare_web_content_process()
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
+        if (m_spare_web_content_processes.size() >= max_spare_web_content_processes)
+            return;
+
         auto web_content_client = create_web_content_client({});
         if (web_content_client.is_error()) {
             dbgln("Unable to create spare web content client: {}", web_content_client.error());
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
-
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(web_content_client.value()->pid()); process.has_value())
             process->set_title("(spare)"_utf16);
+
+        m_spare_web_content_processes.append(web_content_client.release_value());
+
+        // Top the pool up one process per event-loop pass until it is full, so refilling never
+        // blocks whatever the user is doing right now.
+        launch_spare_web_content_process();
+    });
+}
+
+// Pages that use workers tend to create several in a quick burst, and WebContent blocks on the
+// reply to its RequestWorkerAgent message, so every spawn sits directly on the page's critical
+// path. Only dedicated workers are parked; shared and service workers are long-lived singletons
+// that aren't worth holding a process for.
+static constexpr size_t max_spare_web_worker_processes = 2;
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType agent_type)
+{
+    if (agent_type == Web::Bindings::AgentType::DedicatedWorker) {
+        if (!m_spare_web_worker_processes.is_empty()) {
+            auto web_worker_client = m_spare_web_worker_processes.take_first();
+            launch_spare_web_worker_process();
+
+            return web_worker_client;
+        }
+
+        launch_spare_web_worker_process();
+    }
+
+    return WebView::launch_web_worker_process(agent_type);
+}
+
+void Application::launch_spare_web_worker_process()
+{
+    // Disable spare processes when debugging or profiling WebWorker, for the same reasons as WebContent above.
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_spare_web_worker_processes.size() >= max_spare_web_worker_processes)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_web_worker_process)
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_process = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_web_worker_process = false;
+
+        if (m_spare_web_worker_processes.size() >= max_spare_web_worker_processes)
+            return;
+
+        auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_web_worker_processes.append(web_worker_client.release_value());
+
+        launch_spare_web_worker_process();
     });
 }
 
@@ -512,6 +591,45 @@ static void load_page_for_info_and_exit(Core::EventLoop& event_loop, HeadlessWeb
     view.load(url);
 }
 
+static void load_page_repeatedly_and_exit(Core::EventLoop& event_loop, HeadlessWebView& view, URL::URL const& url, size_t run_count)
+{
+    // The first load is a warm-up: it spins up the helper processes and fills the HTTP cache, so it
+    // is reported separately and excluded from the percentiles. With --enable-http-disk-cache, the
+    // measured loads replay the recorded responses and are largely independent of the network.
+    view.on_load_finish = [&view, &event_loop, url, run_count, samples = Vector<AK::Duration> {}, load_start = MonotonicTime::now()](auto const& loaded_url) mutable {
+        if (!url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            return;
+
+        samples.append(MonotonicTime::now() - load_start);
+
+        if (samples.size() <= run_count) {
+            load_start = MonotonicTime::now();
+            view.load(url);
+            return;
+        }
+
+        auto warm_up_load = samples.take_first();
+        quick_sort(samples, [](auto const& a, auto const& b) { return a < b; });
+
+        auto milliseconds = [](AK::Duration duration) {
+            return static_cast<double>(duration.to_nanoseconds()) / 1e6;
+        };
+        auto percentile = [&](size_t p) {
+            return milliseconds(samples[(samples.size() - 1) * p / 100]);
+        };
+
+        outln("Loaded {} {} times (warm-up load took {:.1}ms)", url, run_count, milliseconds(warm_up_load));
+        outln("  min:    {:.1}ms", percentile(0));
+        outln("  median: {:.1}ms", percentile(50));
+        outln("  p90:    {:.1}ms", percentile(90));
+        outln("  max:    {:.1}ms", percentile(100));
+
+        event_loop.quit(0);
+    };
+
+    view.load(url);
+}
+
 ErrorOr<int> Application::execute()
 {
     OwnPtr<HeadlessWebView> view;
@@ -537,6 +655,9 @@ ErrorOr<int> Application::execute()
             case HeadlessMode::Text:
                 load_page_for_info_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), WebView::PageInfoType::Text);
                 break;
+            case HeadlessMode::Benchmark:
+                load_page_repeatedly_and_exit(*m_event_loop, *view, m_browser_options.urls.first(), m_browser_options.benchmark_run_count);
+                break;
             case HeadlessMode::Test:
                 VERIFY_NOT_REACHED();
             }
@@ -823,6 +944,7 @@ void Application::initialize_actions()
             warnln("\033[33;1mDumped GC-graph into {}\033[0m", gc_graph_path);
         }
     }));
+    m_debug_menu->add_action(Action::create("Dump GC Heap Statistics"sv, ActionID::DumpGCHeapStats, debug_request("dump-gc-heap-stats"sv)));
     m_debug_menu->add_separator();
 
     m_show_line_box_borders_action = Action::create_checkable("Show Line Box Borders"sv, ActionID::ShowLineBoxBorders, check(m_show_line_box_borders_action, "set-line-box-borders"sv));
@@ -19,6 +19,7 @@
 #include <LibMain/Main.h>
 #include <LibRequests/RequestClient.h>
 #include <LibURL/URL.h>
+#include <LibWeb/Bindings/AgentType.h>
 #include <LibWeb/CSS/PreferredColorScheme.h>
 #include <LibWeb/CSS/PreferredContrast.h>
 #include <LibWeb/CSS/PreferredMotion.h>
@@ -31,6 +32,10 @@
 #include <LibWebView/Settings.h>
 #include <LibWebView/StorageJar.h>
 
+namespace Web::HTML {
+class WebWorkerClient;
+}
+
 namespace WebView {
 
 struct ApplicationSettingsObserver;
@@ -60,6 +65,7 @@ public:
     static ProcessManager& process_manager() { return *the().m_process_manager; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
 
     virtual Optional<ViewImplementation&> active_web_view() const { return {}; }
     virtual Optional<ViewImplementation&> open_blank_new_tab(Web::HTML::ActivateTab) const { return {}; }
@@ -131,6 +137,7 @@ protected:
 private:
     ErrorOr<void> launch_services();
     void launch_spare_web_content_process();
+    void launch_spare_web_worker_process();
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -182,9 +189,12 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>> m_spare_web_worker_processes;
+    bool m_has_queued_task_to_launch_spare_web_worker_process { false };
+
     RefPtr<Database::Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
     OwnPtr<StorageJar> m_storage_jar;
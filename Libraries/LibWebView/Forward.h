@@ -29,8 +29,10 @@ class MachPortServer;
 #endif
 
 struct Attribute;
+struct AttributeMutation;
 struct AutocompleteEngine;
 struct BrowserOptions;
+struct CharacterDataMutation;
 struct ConsoleOutput;
 struct CookieStorageKey;
 struct DOMNodeProperties;
@@ -79,6 +79,7 @@ enum class ActionID {
     DumpCookies,
     DumpLocalStorage,
     DumpGCGraph,
+    DumpGCHeapStats,
     ShowLineBoxBorders,
     CollectGarbage,
     ClearCache,
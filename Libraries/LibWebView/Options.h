@@ -19,6 +19,7 @@ enum class HeadlessMode {
     Screenshot,
     LayoutTree,
     Text,
+    Benchmark,
     Test,
 };
 
@@ -77,6 +78,7 @@ struct BrowserOptions {
     Vector<URL::URL> urls;
     Vector<ByteString> raw_urls;
     Optional<HeadlessMode> headless_mode;
+    size_t benchmark_run_count { 10 };
     int window_width { 800 };
     int window_height { 600 };
     NewWindow new_window { NewWindow::No };
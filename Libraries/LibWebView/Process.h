@@ -35,6 +35,11 @@ public:
     Optional<Utf16String> const& title() const { return m_title; }
     void set_title(Optional<Utf16String> title) { m_title = move(title); }
 
+    // Only meaningful for WebContent processes, which report their heap size when asked for
+    // performance statistics.
+    u64 gc_heap_size() const { return m_gc_heap_size; }
+    void set_gc_heap_size(u64 gc_heap_size) { m_gc_heap_size = gc_heap_size; }
+
     template<typename ConnectionFromClient>
     Optional<ConnectionFromClient&> client()
     {
@@ -63,6 +68,7 @@ private:
     Core::Process m_process;
     ProcessType m_type;
     Optional<Utf16String> m_title;
+    u64 m_gc_heap_size { 0 };
     WeakPtr<IPC::ConnectionBase> m_connection;
 };
 
@@ -146,6 +146,7 @@ JsonValue ProcessManager::serialize_json()
         object.set("pid"sv, process.pid);
         object.set("cpu"sv, process.cpu_percent);
         object.set("memory"sv, process.memory_usage_bytes);
+        object.set("gcHeap"sv, process_handle.gc_heap_size());
         serialized.must_append(move(object));
     });
 
@@ -14,6 +14,8 @@ namespace WebView {
 // Quota size is specified in https://storage.spec.whatwg.org/#registered-storage-endpoints
 static constexpr size_t LOCAL_STORAGE_QUOTA = 5 * MiB;
 
+static constexpr auto DATABASE_SYNCHRONIZATION_TIMER = AK::Duration::from_seconds(30);
+
 ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& database)
 {
     Statements statements {};
@@ -30,10 +32,9 @@ ErrorOr<NonnullOwnPtr<StorageJar>> StorageJar::create(Database::Database& databa
 
     statements.set_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO WebStorage VALUES (?, ?, ?, ?);"sv));
     statements.delete_item = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
-    statements.get_item = TRY(database.prepare_statement("SELECT bottle_value FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key = ?;"sv));
-    statements.clear = TRY(database.prepare_statement("DELETE FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.get_keys = TRY(database.prepare_statement("SELECT bottle_key FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ?;"sv));
-    statements.calculate_size_excluding_key = TRY(database.prepare_statement("SELECT SUM(LENGTH(bottle_key) + LENGTH(bottle_value)) FROM WebStorage WHERE storage_endpoint = ? AND storage_key = ? AND bottle_key != ?;"sv));
+    statements.select_all_items = TRY(database.prepare_statement("SELECT storage_endpoint, storage_key, bottle_key, bottle_value FROM WebStorage;"sv));
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
 
     return adopt_own(*new StorageJar { PersistedStorage { database, statements } });
 }
@@ -46,124 +47,104 @@ NonnullOwnPtr<StorageJar> StorageJar::create()
 StorageJar::StorageJar(Optional<PersistedStorage> persisted_storage)
     : m_persisted_storage(move(persisted_storage))
 {
+    if (!m_persisted_storage.has_value())
+        return;
+
+    // OPTIMIZATION: The in-memory map is authoritative; the database is only read once at startup
+    //               and written on a timer, so storage operations never wait on disk.
+    // FIXME: Make storage item retrieval lazy so we don't need to load the whole table up front.
+    m_transient_storage.set_items(m_persisted_storage->select_all_items());
+
+    m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
+        static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
+        [this]() {
+            m_persisted_storage->sync_dirty_items(m_transient_storage.take_dirty_items());
+        });
+    m_persisted_storage->synchronization_timer->start();
 }
 
-StorageJar::~StorageJar() = default;
+StorageJar::~StorageJar()
+{
+    if (m_persisted_storage.has_value()) {
+        m_persisted_storage->synchronization_timer->stop();
+        m_persisted_storage->synchronization_timer->on_timeout();
+    }
+}
 
 Optional<String> StorageJar::get_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key)
 {
-    StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_item(storage_location);
-    return m_transient_storage.get_item(storage_location);
+    return m_transient_storage.get_item({ storage_endpoint, storage_key, bottle_key });
 }
 
 StorageOperationError StorageJar::set_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& bottle_key, String const& bottle_value)
 {
-    StorageLocation storage_location { storage_endpoint, storage_key, bottle_key };
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->set_item(storage_location, bottle_value);
-    return m_transient_storage.set_item(storage_location, bottle_value);
+    return m_transient_storage.set_item({ storage_endpoint, storage_key, bottle_key }, bottle_value);
 }
 
 void StorageJar::remove_item(StorageEndpointType storage_endpoint, String const& storage_key, String const& key)
 {
-    StorageLocation storage_location { storage_endpoint, storage_key, key };
-    if (m_persisted_storage.has_value()) {
-        m_persisted_storage->delete_item(storage_location);
-    } else {
-        m_transient_storage.delete_item(storage_location);
-    }
+    m_transient_storage.delete_item({ storage_endpoint, storage_key, key });
 }
 
 void StorageJar::clear_storage_key(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    if (m_persisted_storage.has_value()) {
-        m_persisted_storage->clear(storage_endpoint, storage_key);
-    } else {
-        m_transient_storage.clear(storage_endpoint, storage_key);
-    }
+    m_transient_storage.clear(storage_endpoint, storage_key);
 }
 
 Vector<String> StorageJar::get_all_keys(StorageEndpointType storage_endpoint, String const& storage_key)
 {
-    if (m_persisted_storage.has_value())
-        return m_persisted_storage->get_keys(storage_endpoint, storage_key);
     return m_transient_storage.get_keys(storage_endpoint, storage_key);
 }
 
-StorageOperationError StorageJar::PersistedStorage::set_item(StorageLocation const& key, String const& value)
-{
-    size_t current_size = 0;
-    database.execute_statement(
-        statements.calculate_size_excluding_key,
-        [&](auto statement_id) {
-            current_size = database.result_column<int>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
-
-    auto new_size = key.bottle_key.bytes().size() + value.bytes().size();
-    if (current_size + new_size > LOCAL_STORAGE_QUOTA) {
-        return StorageOperationError::QuotaExceededError;
+void StorageJar::PersistedStorage::sync_dirty_items(TransientStorage::DirtyItems dirty_items)
+{
+    if (dirty_items.is_empty())
+        return;
+
+    // Group the pending writes into a single transaction so the database commits (and syncs the
+    // journal to disk) once per synchronization interval instead of once per mutation.
+    database.execute_statement(statements.begin_transaction, {});
+
+    for (auto const& [key, value] : dirty_items) {
+        if (value.has_value()) {
+            database.execute_statement(
+                statements.set_item,
+                {},
+                static_cast<int>(to_underlying(key.storage_endpoint)),
+                key.storage_key,
+                key.bottle_key,
+                *value);
+        } else {
+            database.execute_statement(
+                statements.delete_item,
+                {},
+                static_cast<int>(to_underlying(key.storage_endpoint)),
+                key.storage_key,
+                key.bottle_key);
+        }
     }
 
-    database.execute_statement(
-        statements.set_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key,
-        value);
-
-    return StorageOperationError::None;
-}
-
-void StorageJar::PersistedStorage::delete_item(StorageLocation const& key)
-{
-    database.execute_statement(
-        statements.delete_item,
-        {},
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
+    database.execute_statement(statements.commit_transaction, {});
 }
 
-Optional<String> StorageJar::PersistedStorage::get_item(StorageLocation const& key)
+StorageJar::TransientStorage::StorageItems StorageJar::PersistedStorage::select_all_items()
 {
-    Optional<String> result;
+    StorageJar::TransientStorage::StorageItems items;
     database.execute_statement(
-        statements.get_item,
+        statements.select_all_items,
         [&](auto statement_id) {
-            result = database.result_column<String>(statement_id, 0);
-        },
-        static_cast<int>(to_underlying(key.storage_endpoint)),
-        key.storage_key,
-        key.bottle_key);
-    return result;
+            auto storage_endpoint = static_cast<StorageEndpointType>(database.result_column<int>(statement_id, 0));
+            auto storage_key = database.result_column<String>(statement_id, 1);
+            auto bottle_key = database.result_column<String>(statement_id, 2);
+            auto bottle_value = database.result_column<String>(statement_id, 3);
+            items.set({ storage_endpoint, move(storage_key), move(bottle_key) }, move(bottle_value));
+        });
+    return items;
 }
 
-void StorageJar::PersistedStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
+void StorageJar::TransientStorage::set_items(StorageItems items)
 {
-    database.execute_statement(
-        statements.clear,
-        {},
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
-}
-
-Vector<String> StorageJar::PersistedStorage::get_keys(StorageEndpointType storage_endpoint, String const& storage_key)
-{
-    Vector<String> keys;
-    database.execute_statement(
-        statements.get_keys,
-        [&](auto statement_id) {
-            keys.append(database.result_column<String>(statement_id, 0));
-        },
-        static_cast<int>(to_underlying(storage_endpoint)),
-        storage_key);
-    return keys;
+    m_storage_items = move(items);
 }
 
 StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation const& key, String const& value)
@@ -182,6 +163,7 @@ StorageOperationError StorageJar::TransientStorage::set_item(StorageLocation con
     }
 
     m_storage_items.set(key, value);
+    m_dirty_items.set(key, value);
     return StorageOperationError::None;
 }
 
@@ -194,7 +176,8 @@ Optional<String> StorageJar::TransientStorage::get_item(StorageLocation const& k
 
 void StorageJar::TransientStorage::delete_item(StorageLocation const& key)
 {
-    m_storage_items.remove(key);
+    if (m_storage_items.remove(key))
+        m_dirty_items.set(key, OptionalNone {});
 }
 
 void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, String const& storage_key)
@@ -207,6 +190,7 @@ void StorageJar::TransientStorage::clear(StorageEndpointType storage_endpoint, S
 
     for (auto const& key : keys_to_remove) {
         m_storage_items.remove(key);
+        m_dirty_items.set(key, OptionalNone {});
     }
 }
 
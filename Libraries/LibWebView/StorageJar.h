@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <AK/Traits.h>
+#include <LibCore/Timer.h>
 #include <LibDatabase/Forward.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWebView/Forward.h>
@@ -46,33 +47,39 @@ private:
     struct Statements {
         Database::StatementID set_item { 0 };
         Database::StatementID delete_item { 0 };
-        Database::StatementID get_item { 0 };
-        Database::StatementID clear { 0 };
-        Database::StatementID get_keys { 0 };
-        Database::StatementID calculate_size_excluding_key { 0 };
+        Database::StatementID select_all_items { 0 };
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
     };
 
     class TransientStorage {
     public:
+        using StorageItems = HashMap<StorageLocation, String>;
+
+        // Modified entries waiting to be flushed to the database. An entry without a value is a deletion.
+        using DirtyItems = HashMap<StorageLocation, Optional<String>>;
+
+        void set_items(StorageItems);
         StorageOperationError set_item(StorageLocation const& key, String const& value);
         Optional<String> get_item(StorageLocation const& key);
         void delete_item(StorageLocation const& key);
         void clear(StorageEndpointType storage_endpoint, String const& storage_key);
         Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
 
+        auto take_dirty_items() { return move(m_dirty_items); }
+
     private:
-        HashMap<StorageLocation, String> m_storage_items;
+        StorageItems m_storage_items;
+        DirtyItems m_dirty_items;
     };
 
     struct PersistedStorage {
-        StorageOperationError set_item(StorageLocation const& key, String const& value);
-        Optional<String> get_item(StorageLocation const& key);
-        void delete_item(StorageLocation const& key);
-        void clear(StorageEndpointType storage_endpoint, String const& storage_key);
-        Vector<String> get_keys(StorageEndpointType storage_endpoint, String const& storage_key);
+        void sync_dirty_items(TransientStorage::DirtyItems);
+        TransientStorage::StorageItems select_all_items();
 
         Database::Database& database;
         Statements statements;
+        RefPtr<Core::Timer> synchronization_timer {};
     };
 
     explicit StorageJar(Optional<PersistedStorage>);
@@ -270,6 +270,11 @@ Optional<String> ViewImplementation::selected_text_with_whitespace_collapsed()
     return selected_text;
 }
 
+Vector<Web::Page::TextRun> ViewImplementation::extract_text_runs()
+{
+    return client().extract_text_runs(page_id());
+}
+
 void ViewImplementation::select_all()
 {
     client().async_select_all(page_id());
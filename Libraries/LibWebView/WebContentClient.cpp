@@ -155,6 +155,12 @@ void WebContentClient::did_find_in_page(u64 page_id, size_t current_match_index,
     }
 }
 
+void WebContentClient::did_collect_performance_statistics(u64 gc_heap_size)
+{
+    if (auto process = Application::process_manager().find_process(pid()); process.has_value())
+        process->set_gc_heap_size(gc_heap_size);
+}
+
 void WebContentClient::did_request_refresh(u64 page_id)
 {
     if (auto view = view_for_page_id(page_id); view.has_value())
@@ -700,7 +706,7 @@ void WebContentClient::did_allocate_backing_stores(u64 page_id, i32 front_bitmap
 Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         return worker_client->clone_transport();
     }
 
@@ -6,6 +6,7 @@
 
 #include <LibWebView/Application.h>
 #include <LibWebView/ProcessManager.h>
+#include <LibWebView/WebContentClient.h>
 #include <LibWebView/WebUI/ProcessesUI.h>
 
 namespace WebView {
@@ -22,6 +23,14 @@ void ProcessesUI::update_process_statistics()
     auto& process_manager = Application::process_manager();
     process_manager.update_all_process_statistics();
 
+    // Ask every WebContent process for its engine-side statistics as well. The replies arrive
+    // asynchronously and are picked up by the next update, which is fine at the refresh rates
+    // this page uses.
+    WebContentClient::for_each_client([](WebContentClient& client) {
+        client.async_collect_performance_statistics();
+        return IterationDecision::Continue;
+    });
+
     async_send_message("loadProcessStatistics"sv, process_manager.serialize_json());
 }
 
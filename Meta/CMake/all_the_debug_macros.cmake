@@ -15,6 +15,7 @@ set(EDITOR_DEBUG ON)
 set(EMOJI_DEBUG ON)
 set(FILE_WATCHER_DEBUG ON)
 set(FLAC_ENCODER_DEBUG ON)
+set(FORCED_LAYOUT_DEBUG ON)
 set(GENERATE_DEBUG ON)
 set(GHASH_PROCESS_DEBUG ON)
 set(GIF_DEBUG ON)
@@ -3573,15 +3573,25 @@ static void generate_prototype_or_global_mixin_initialization(IDL::Interface con
 
     bool define_on_existing_object = is_global_interface || generate_unforgeables == GenerateUnforgeables::Yes;
 
+    // OPTIMIZATION: Attributes and operations are defined as intrinsic accessors, which reserve a
+    //               property slot up front but only materialize the NativeFunction / Accessor
+    //               objects on first access. Most prototype properties are never touched, so this
+    //               cuts both realm setup time and memory. Unforgeable members are defined on
+    //               arbitrary platform object instances and stay eager, as the intrinsic accessor
+    //               registry is per-object.
+    bool use_lazy_definitions = generate_unforgeables == GenerateUnforgeables::No;
+
     if (define_on_existing_object) {
         generator.set("define_direct_property", "object.define_direct_property");
         generator.set("define_native_accessor", "object.define_native_accessor");
         generator.set("define_native_function", "object.define_native_function");
+        generator.set("define_intrinsic_accessor", "object.define_intrinsic_accessor");
         generator.set("set_prototype", "object.set_prototype");
     } else {
         generator.set("define_direct_property", "define_direct_property");
         generator.set("define_native_accessor", "define_native_accessor");
         generator.set("define_native_function", "define_native_function");
+        generator.set("define_intrinsic_accessor", "define_intrinsic_accessor");
         generator.set("set_prototype", "set_prototype");
     }
 
@@ -3684,7 +3694,8 @@ void @class_name@::initialize(JS::Realm& realm)
         attribute_generator.set("attribute.name", attribute.name);
         attribute_generator.set("attribute.getter_callback", attribute.getter_callback_name);
 
-        if (!attribute.readonly || attribute.extended_attributes.contains("Replaceable"sv) || attribute.extended_attributes.contains("PutForwards"sv))
+        bool has_setter = !attribute.readonly || attribute.extended_attributes.contains("Replaceable"sv) || attribute.extended_attributes.contains("PutForwards"sv);
+        if (has_setter)
             attribute_generator.set("attribute.setter_callback", attribute.setter_callback_name);
         else
             attribute_generator.set("attribute.setter_callback", "nullptr");
@@ -3695,9 +3706,28 @@ void @class_name@::initialize(JS::Realm& realm)
 )~~~");
         }
 
-        attribute_generator.append(R"~~~(
+        if (use_lazy_definitions) {
+            if (has_setter) {
+                attribute_generator.append(R"~~~(
+    @define_intrinsic_accessor@("@attribute.name@"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        auto getter = JS::NativeFunction::create(realm, @attribute.getter_callback@, 0, "@attribute.name@"_utf16_fly_string, &realm, "get"sv);
+        auto setter = JS::NativeFunction::create(realm, @attribute.setter_callback@, 1, "@attribute.name@"_utf16_fly_string, &realm, "set"sv);
+        return JS::Accessor::create(realm.vm(), getter, setter);
+    });
+)~~~");
+            } else {
+                attribute_generator.append(R"~~~(
+    @define_intrinsic_accessor@("@attribute.name@"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        auto getter = JS::NativeFunction::create(realm, @attribute.getter_callback@, 0, "@attribute.name@"_utf16_fly_string, &realm, "get"sv);
+        return JS::Accessor::create(realm.vm(), getter, nullptr);
+    });
+)~~~");
+            }
+        } else {
+            attribute_generator.append(R"~~~(
     @define_native_accessor@(realm, "@attribute.name@"_utf16_fly_string, @attribute.getter_callback@, @attribute.setter_callback@, default_attributes);
 )~~~");
+        }
     }
 
     for (auto& function : interface.functions) {
@@ -3750,9 +3780,17 @@ void @class_name@::initialize(JS::Realm& realm)
 )~~~");
         }
 
-        function_generator.append(R"~~~(
+        if (use_lazy_definitions) {
+            function_generator.append(R"~~~(
+    @define_intrinsic_accessor@("@function.name@"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        return JS::NativeFunction::create(realm, @function.name:snakecase@, @function.length@, "@function.name@"_utf16_fly_string, &realm);
+    });
+)~~~");
+        } else {
+            function_generator.append(R"~~~(
     @define_native_function@(realm, "@function.name@"_utf16_fly_string, @function.name:snakecase@, @function.length@, default_attributes);
 )~~~");
+        }
     }
 
     bool should_generate_stringifier = true;
@@ -3766,9 +3804,17 @@ void @class_name@::initialize(JS::Realm& realm)
         auto stringifier_generator = interface.stringifier_extended_attributes.has_value()
             ? generator_for_member("stringifier"sv, *interface.stringifier_extended_attributes)
             : generator.fork();
-        stringifier_generator.append(R"~~~(
+        if (use_lazy_definitions) {
+            stringifier_generator.append(R"~~~(
+    @define_intrinsic_accessor@("toString"_utf16_fly_string, default_attributes, [](auto& realm) -> JS::Value {
+        return JS::NativeFunction::create(realm, to_string, 0, "toString"_utf16_fly_string, &realm);
+    });
+)~~~");
+        } else {
+            stringifier_generator.append(R"~~~(
     @define_native_function@(realm, "toString"_utf16_fly_string, to_string, 0, default_attributes);
 )~~~");
+        }
     }
 
     // https://webidl.spec.whatwg.org/#define-the-iteration-methods
@@ -3869,7 +3915,13 @@ void @class_name@::initialize(JS::Realm& realm)
     }
 
     if (!define_on_existing_object) {
+        // OPTIMIZATION: Give the prototype its unique shape now instead of when the first instance
+        //               adopts it. Lazily materialized property values must never be reachable
+        //               through an inline cache keyed on a shape shared with a sibling prototype,
+        //               which a unique shape rules out.
         generator.append(R"~~~(
+    convert_to_prototype_if_needed();
+
     Base::initialize(realm);
 )~~~");
     }
@@ -5426,6 +5478,7 @@ void generate_prototype_implementation(IDL::Interface const& interface, StringBu
     generator.append(R"~~~(
 #include <AK/Function.h>
 #include <LibIDL/Types.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/DataView.h>
@@ -5433,6 +5486,7 @@ void generate_prototype_implementation(IDL::Interface const& interface, StringBu
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseConstructor.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
@@ -5847,12 +5901,14 @@ void generate_global_mixin_implementation(IDL::Interface const& interface, Strin
     generator.append(R"~~~(
 #include <AK/Function.h>
 #include <LibIDL/Types.h>
+#include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/DataView.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/FunctionObject.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
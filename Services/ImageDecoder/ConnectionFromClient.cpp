@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <AK/Debug.h>
 #include <AK/IDAllocator.h>
+#include <AK/Memory.h>
 #include <ImageDecoder/ConnectionFromClient.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <LibGfx/Bitmap.h>
@@ -84,21 +86,65 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Gfx::BitmapSequence& sequence, Vector<u32>& durations)
 {
+    auto& bitmaps = sequence.bitmaps;
     bitmaps.ensure_capacity(decoder.frame_count());
     durations.ensure_capacity(decoder.frame_count());
+
+    // OPTIMIZATION: Copy each frame into the AnonymousBuffer destined for IPC as soon as it is
+    //               decoded, so the decoder's staging bitmap can be thrown away immediately and
+    //               serialization doesn't have to collate the frames into yet another buffer.
+    //               The buffer is sized assuming all frames match the first one; if a frame
+    //               doesn't fit that layout, we fall back to staging the frames individually.
+    Core::AnonymousBuffer collated_buffer;
+    size_t write_offset = 0;
+    bool all_frames_collated = true;
+
     for (size_t i = 0; i < decoder.frame_count(); ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
             bitmaps.unchecked_append({});
             durations.unchecked_append(0);
+            continue;
+        }
+        auto frame = frame_or_error.release_value();
+        durations.unchecked_append(frame.duration);
+
+        if (!frame.image) {
+            bitmaps.unchecked_append({});
+            continue;
+        }
+
+        if (i == 0) {
+            Checked<size_t> total_size = frame.image->size_in_bytes();
+            total_size *= decoder.frame_count();
+            if (!total_size.has_overflow()) {
+                if (auto buffer_or_error = Core::AnonymousBuffer::create_with_size(total_size.value()); !buffer_or_error.is_error())
+                    collated_buffer = buffer_or_error.release_value();
+            }
+        }
+
+        RefPtr<Gfx::Bitmap> stored_frame = frame.image;
+        if (collated_buffer.is_valid() && write_offset + frame.image->size_in_bytes() <= collated_buffer.size()) {
+            auto* frame_data = collated_buffer.data<u8>() + write_offset;
+            memcpy(frame_data, frame.image->scanline(0), frame.image->size_in_bytes());
+            auto wrapper_or_error = Gfx::Bitmap::create_wrapper(frame.image->format(), frame.image->alpha_type(), frame.image->size(), frame.image->pitch(), frame_data, [collated_buffer] { });
+            if (!wrapper_or_error.is_error()) {
+                stored_frame = wrapper_or_error.release_value();
+                write_offset += frame.image->size_in_bytes();
+            } else {
+                all_frames_collated = false;
+            }
         } else {
-            auto frame = frame_or_error.release_value();
-            bitmaps.unchecked_append(frame.image);
-            durations.unchecked_append(frame.duration);
+            all_frames_collated = false;
         }
+
+        bitmaps.unchecked_append(move(stored_frame));
     }
+
+    if (collated_buffer.is_valid() && all_frames_collated)
+        sequence.collated_buffer = move(collated_buffer);
 }
 
 static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
@@ -120,8 +166,6 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     else
         dbgln("Invalid color profile: {}", maybe_icc_data.error());
 
-    Vector<RefPtr<Gfx::Bitmap>> bitmaps;
-
     if (auto maybe_metadata = decoder->metadata(); maybe_metadata.has_value() && is<Gfx::ExifMetadata>(*maybe_metadata)) {
         auto const& exif = static_cast<Gfx::ExifMetadata const&>(maybe_metadata.value());
         if (exif.x_resolution().has_value() && exif.y_resolution().has_value()) {
@@ -134,13 +178,11 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), result.bitmaps, result.durations);
 
-    if (bitmaps.is_empty())
+    if (result.bitmaps.bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
 
-    result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
-
     return result;
 }
 
@@ -26,10 +26,30 @@ ErrorOr<CacheIndex> CacheIndex::create(Database::Database& database)
     statements.insert_entry = TRY(database.prepare_statement("INSERT OR REPLACE INTO CacheIndex VALUES (?, ?, ?, ?, ?, ?);"sv));
     statements.remove_entry = TRY(database.prepare_statement("DELETE FROM CacheIndex WHERE cache_key = ?;"sv));
     statements.remove_all_entries = TRY(database.prepare_statement("DELETE FROM CacheIndex;"sv));
-    statements.select_entry = TRY(database.prepare_statement("SELECT * FROM CacheIndex WHERE cache_key = ?;"sv));
+    statements.select_all_entries = TRY(database.prepare_statement("SELECT * FROM CacheIndex;"sv));
     statements.update_last_access_time = TRY(database.prepare_statement("UPDATE CacheIndex SET last_access_time = ? WHERE cache_key = ?;"sv));
 
-    return CacheIndex { database, statements };
+    CacheIndex index { database, statements };
+    index.load_all_entries();
+
+    return index;
+}
+
+void CacheIndex::load_all_entries()
+{
+    m_database.execute_statement(m_statements.select_all_entries, [&](auto statement_id) {
+        int column = 0;
+
+        auto cache_key = m_database.result_column<u64>(statement_id, column++);
+        auto url = m_database.result_column<String>(statement_id, column++);
+        auto data_size = m_database.result_column<u64>(statement_id, column++);
+        auto request_time = m_database.result_column<UnixDateTime>(statement_id, column++);
+        auto response_time = m_database.result_column<UnixDateTime>(statement_id, column++);
+        auto last_access_time = m_database.result_column<UnixDateTime>(statement_id, column++);
+
+        Entry entry { cache_key, move(url), data_size, request_time, response_time, last_access_time };
+        m_entries.set(cache_key, move(entry));
+    });
 }
 
 CacheIndex::CacheIndex(Database::Database& database, Statements statements)
@@ -81,25 +101,6 @@ void CacheIndex::update_last_access_time(u64 cache_key)
 
 Optional<CacheIndex::Entry&> CacheIndex::find_entry(u64 cache_key)
 {
-    if (auto entry = m_entries.get(cache_key); entry.has_value())
-        return entry;
-
-    m_database.execute_statement(
-        m_statements.select_entry, [&](auto statement_id) {
-            int column = 0;
-
-            auto cache_key = m_database.result_column<u64>(statement_id, column++);
-            auto url = m_database.result_column<String>(statement_id, column++);
-            auto data_size = m_database.result_column<u64>(statement_id, column++);
-            auto request_time = m_database.result_column<UnixDateTime>(statement_id, column++);
-            auto response_time = m_database.result_column<UnixDateTime>(statement_id, column++);
-            auto last_access_time = m_database.result_column<UnixDateTime>(statement_id, column++);
-
-            Entry entry { cache_key, move(url), data_size, request_time, response_time, last_access_time };
-            m_entries.set(cache_key, move(entry));
-        },
-        cache_key);
-
     return m_entries.get(cache_key);
 }
 
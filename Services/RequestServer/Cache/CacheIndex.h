@@ -16,6 +16,9 @@ namespace RequestServer {
 
 // The cache index is a SQL database containing metadata about each cache entry. An entry in the index is created once
 // the entire cache entry has been successfully written to disk.
+//
+// The entire index is loaded into memory at startup, so lookups (including misses) are a single hash table probe. The
+// database is only touched to persist mutations.
 class CacheIndex {
     struct Entry {
         u64 cache_key { 0 };
@@ -44,16 +47,18 @@ private:
         Database::StatementID insert_entry { 0 };
         Database::StatementID remove_entry { 0 };
         Database::StatementID remove_all_entries { 0 };
-        Database::StatementID select_entry { 0 };
+        Database::StatementID select_all_entries { 0 };
         Database::StatementID update_last_access_time { 0 };
     };
 
     CacheIndex(Database::Database&, Statements);
 
+    void load_all_entries();
+
     Database::Database& m_database;
     Statements m_statements;
 
-    HashMap<u32, Entry> m_entries;
+    HashMap<u64, Entry> m_entries;
 };
 
 }
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/ScopeGuard.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibURL/URL.h>
+#include <RequestServer/Cache/MemoryCache.h>
+#include <RequestServer/Cache/Utilities.h>
+
+namespace RequestServer {
+
+MemoryCacheEntry::MemoryCacheEntry(String url, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer body, UnixDateTime request_time, UnixDateTime response_time)
+    : m_url(move(url))
+    , m_status_code(status_code)
+    , m_reason_phrase(move(reason_phrase))
+    , m_headers(move(headers))
+    , m_body(move(body))
+    , m_request_time(request_time)
+    , m_response_time(response_time)
+    , m_last_access_time(UnixDateTime::now())
+{
+}
+
+MemoryCacheReader::MemoryCacheReader(MemoryCache& cache, NonnullRefPtr<MemoryCacheEntry> entry)
+    : m_cache(cache)
+    , m_entry(move(entry))
+{
+}
+
+void MemoryCacheReader::pipe_to(int pipe_fd, Function<void(u64)> on_complete, Function<void(u64)> on_error)
+{
+    VERIFY(m_pipe_fd == -1);
+    m_pipe_fd = pipe_fd;
+
+    m_on_pipe_complete = move(on_complete);
+    m_on_pipe_error = move(on_error);
+
+    m_pipe_write_notifier = Core::Notifier::construct(m_pipe_fd, Core::NotificationType::Write);
+    m_pipe_write_notifier->set_enabled(false);
+
+    m_pipe_write_notifier->on_activation = [this]() {
+        m_pipe_write_notifier->set_enabled(false);
+        pipe_without_blocking();
+    };
+
+    pipe_without_blocking();
+}
+
+void MemoryCacheReader::pipe_without_blocking()
+{
+    auto remaining_bytes = m_entry->body().slice(m_bytes_piped);
+
+    auto result = Core::System::write(m_pipe_fd, remaining_bytes);
+
+    if (result.is_error()) {
+        if (result.error().code() != EAGAIN && result.error().code() != EWOULDBLOCK)
+            pipe_error(result.release_error());
+        else
+            m_pipe_write_notifier->set_enabled(true);
+
+        return;
+    }
+
+    m_bytes_piped += result.value();
+
+    if (m_bytes_piped == m_entry->body().size()) {
+        pipe_complete();
+        return;
+    }
+
+    pipe_without_blocking();
+}
+
+void MemoryCacheReader::pipe_complete()
+{
+    m_entry->update_last_access_time();
+
+    if (m_on_pipe_complete)
+        m_on_pipe_complete(m_bytes_piped);
+
+    m_cache.reader_closed({}, *this);
+}
+
+void MemoryCacheReader::pipe_error(Error error)
+{
+    dbgln("\033[31;1mError transferring memory cache entry to pipe for\033[0m {}: {}", m_entry->url(), error);
+
+    if (m_on_pipe_error)
+        m_on_pipe_error(m_bytes_piped);
+
+    m_cache.reader_closed({}, *this);
+}
+
+MemoryCacheWriter::MemoryCacheWriter(MemoryCache& cache, u64 cache_key, String url, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, UnixDateTime request_time)
+    : m_cache(cache)
+    , m_cache_key(cache_key)
+    , m_url(move(url))
+    , m_status_code(status_code)
+    , m_reason_phrase(move(reason_phrase))
+    , m_headers(move(headers))
+    , m_request_time(request_time)
+{
+}
+
+ErrorOr<void> MemoryCacheWriter::write_data(ReadonlyBytes data)
+{
+    if (m_body.size() + data.size() > MemoryCache::max_entry_size) {
+        auto& cache = m_cache;
+        cache.writer_closed({}, *this);
+
+        return Error::from_string_literal("Response is too large for the memory cache");
+    }
+
+    TRY(m_body.try_append(data));
+    return {};
+}
+
+ErrorOr<void> MemoryCacheWriter::flush()
+{
+    auto& cache = m_cache;
+    ScopeGuard guard { [&]() { cache.writer_closed({}, *this); } };
+
+    // Guard against storing a response that was truncated by a failed transfer.
+    if (auto content_length = m_headers.get("Content-Length"sv); content_length.has_value()) {
+        if (auto expected_size = content_length->to_number<u64>(); expected_size.has_value() && *expected_size != m_body.size())
+            return Error::from_string_literal("Response body size does not match Content-Length");
+    }
+
+    auto entry = adopt_ref(*new MemoryCacheEntry { move(m_url), m_status_code, move(m_reason_phrase), move(m_headers), move(m_body), m_request_time, UnixDateTime::now() });
+    cache.store_entry({}, m_cache_key, move(entry));
+
+    return {};
+}
+
+Optional<MemoryCacheWriter&> MemoryCache::create_entry(URL::URL const& url, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const& headers, UnixDateTime request_time)
+{
+    if (!is_cacheable(method, status_code, headers))
+        return {};
+
+    if (auto freshness = calculate_freshness_lifetime(headers); freshness.is_negative() || freshness.is_zero())
+        return {};
+
+    auto serialized_url = serialize_url_for_cache_storage(url);
+    auto cache_key = create_cache_key(serialized_url, method);
+
+    HTTP::HeaderMap stored_headers;
+    for (auto const& header : headers.headers()) {
+        if (!is_header_exempted_from_storage(header.name))
+            stored_headers.set(header.name, header.value);
+    }
+
+    auto writer = make<MemoryCacheWriter>(*this, cache_key, move(serialized_url), status_code, move(reason_phrase), move(stored_headers), request_time);
+
+    auto address = reinterpret_cast<FlatPtr>(writer.ptr());
+    m_open_writers.set(address, move(writer));
+
+    return static_cast<MemoryCacheWriter&>(**m_open_writers.get(address));
+}
+
+Optional<MemoryCacheReader&> MemoryCache::open_entry(URL::URL const& url, StringView method)
+{
+    auto serialized_url = serialize_url_for_cache_storage(url);
+    auto cache_key = create_cache_key(serialized_url, method);
+
+    auto entry = m_entries.get(cache_key);
+    if (!entry.has_value())
+        return {};
+
+    auto freshness_lifetime = calculate_freshness_lifetime((*entry)->headers());
+    auto current_age = calculate_age((*entry)->headers(), (*entry)->request_time(), (*entry)->response_time());
+
+    if (!is_response_fresh(freshness_lifetime, current_age)) {
+        dbgln("\033[33;1mMemory cache entry expired for\033[0m {} (lifetime={}s age={}s)", url, freshness_lifetime.to_seconds(), current_age.to_seconds());
+
+        m_total_size -= (*entry)->body().size();
+        m_entries.remove(cache_key);
+
+        return {};
+    }
+
+    dbgln("\033[32;1mOpened memory cache entry for\033[0m {} ({} bytes)", url, (*entry)->body().size());
+
+    auto reader = make<MemoryCacheReader>(*this, **entry);
+
+    auto address = reinterpret_cast<FlatPtr>(reader.ptr());
+    m_open_readers.set(address, move(reader));
+
+    return static_cast<MemoryCacheReader&>(**m_open_readers.get(address));
+}
+
+void MemoryCache::clear_cache()
+{
+    dbgln("Cleared {} memory cache entries", m_entries.size());
+
+    m_entries.clear();
+    m_total_size = 0;
+}
+
+void MemoryCache::store_entry(Badge<MemoryCacheWriter>, u64 cache_key, NonnullRefPtr<MemoryCacheEntry> entry)
+{
+    // Replacing an existing entry for the same key must not leave its size behind.
+    if (auto existing_entry = m_entries.get(cache_key); existing_entry.has_value())
+        m_total_size -= (*existing_entry)->body().size();
+
+    evict_entries_to_fit(entry->body().size());
+
+    dbgln("\033[34;1mStored memory cache entry for\033[0m {} ({} bytes)", entry->url(), entry->body().size());
+
+    m_total_size += entry->body().size();
+    m_entries.set(cache_key, move(entry));
+}
+
+void MemoryCache::evict_entries_to_fit(size_t incoming_entry_size)
+{
+    if (m_total_size + incoming_entry_size <= max_cache_size)
+        return;
+
+    Vector<u64> cache_keys;
+    cache_keys.ensure_capacity(m_entries.size());
+
+    for (auto const& it : m_entries)
+        cache_keys.unchecked_append(it.key);
+
+    quick_sort(cache_keys, [&](u64 a, u64 b) {
+        return m_entries.get(a).value()->last_access_time() < m_entries.get(b).value()->last_access_time();
+    });
+
+    for (auto cache_key : cache_keys) {
+        if (m_total_size + incoming_entry_size <= max_cache_size)
+            break;
+
+        auto entry = m_entries.take(cache_key);
+        m_total_size -= (*entry)->body().size();
+    }
+}
+
+void MemoryCache::writer_closed(Badge<MemoryCacheWriter>, MemoryCacheWriter const& writer)
+{
+    auto address = reinterpret_cast<FlatPtr>(&writer);
+    m_open_writers.remove(address);
+}
+
+void MemoryCache::reader_closed(Badge<MemoryCacheReader>, MemoryCacheReader const& reader)
+{
+    auto address = reinterpret_cast<FlatPtr>(&reader);
+    m_open_readers.remove(address);
+}
+
+}
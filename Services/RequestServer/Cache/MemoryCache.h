@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Badge.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <LibCore/Notifier.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/Forward.h>
+#include <RequestServer/Forward.h>
+
+namespace RequestServer {
+
+// A complete HTTP response held in memory. Entries are refcounted so that in-flight consumers keep
+// a response alive even if it is evicted from the cache while being piped to a client.
+class MemoryCacheEntry : public RefCounted<MemoryCacheEntry> {
+public:
+    MemoryCacheEntry(String url, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap headers, ByteBuffer body, UnixDateTime request_time, UnixDateTime response_time);
+
+    String const& url() const { return m_url; }
+    u32 status_code() const { return m_status_code; }
+    Optional<String> const& reason_phrase() const { return m_reason_phrase; }
+    HTTP::HeaderMap const& headers() const { return m_headers; }
+    ReadonlyBytes body() const { return m_body; }
+
+    UnixDateTime request_time() const { return m_request_time; }
+    UnixDateTime response_time() const { return m_response_time; }
+
+    UnixDateTime last_access_time() const { return m_last_access_time; }
+    void update_last_access_time() { m_last_access_time = UnixDateTime::now(); }
+
+private:
+    String m_url;
+    u32 m_status_code { 0 };
+    Optional<String> m_reason_phrase;
+    HTTP::HeaderMap m_headers;
+    ByteBuffer m_body;
+
+    UnixDateTime m_request_time;
+    UnixDateTime m_response_time;
+    UnixDateTime m_last_access_time;
+};
+
+// Streams a cached response body into a response pipe without blocking, mirroring what
+// CacheEntryReader does for disk cache entries.
+class MemoryCacheReader {
+public:
+    MemoryCacheReader(MemoryCache&, NonnullRefPtr<MemoryCacheEntry>);
+
+    u32 status_code() const { return m_entry->status_code(); }
+    Optional<String> const& reason_phrase() const { return m_entry->reason_phrase(); }
+    HTTP::HeaderMap const& headers() const { return m_entry->headers(); }
+
+    void pipe_to(int pipe_fd, Function<void(u64 bytes_piped)> on_complete, Function<void(u64 bytes_piped)> on_error);
+
+private:
+    void pipe_without_blocking();
+    void pipe_complete();
+    void pipe_error(Error);
+
+    MemoryCache& m_cache;
+    NonnullRefPtr<MemoryCacheEntry> m_entry;
+
+    RefPtr<Core::Notifier> m_pipe_write_notifier;
+    int m_pipe_fd { -1 };
+
+    Function<void(u64)> m_on_pipe_complete;
+    Function<void(u64)> m_on_pipe_error;
+    u64 m_bytes_piped { 0 };
+};
+
+// Accumulates a response body as it is streamed to the client, and publishes the finished entry to
+// the cache once the transfer completes.
+class MemoryCacheWriter {
+public:
+    MemoryCacheWriter(MemoryCache&, u64 cache_key, String url, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap, UnixDateTime request_time);
+
+    ErrorOr<void> write_data(ReadonlyBytes);
+    ErrorOr<void> flush();
+
+private:
+    MemoryCache& m_cache;
+
+    u64 m_cache_key { 0 };
+    String m_url;
+    u32 m_status_code { 0 };
+    Optional<String> m_reason_phrase;
+    HTTP::HeaderMap m_headers;
+    ByteBuffer m_body;
+
+    UnixDateTime m_request_time;
+};
+
+// An in-memory layer above the disk cache holding hot response bodies. It is shared by every
+// WebContent client of this RequestServer instance, so opening a second tab of the same site
+// serves its assets without touching the network or the disk.
+//
+// FIXME: Entries are keyed like the disk cache (request method + serialized URL). Double-keying
+//        them by the requesting top-level site would require plumbing that site through the
+//        start_request IPC.
+class MemoryCache {
+public:
+    MemoryCache() = default;
+
+    Optional<MemoryCacheWriter&> create_entry(URL::URL const&, StringView method, u32 status_code, Optional<String> reason_phrase, HTTP::HeaderMap const&, UnixDateTime request_time);
+    Optional<MemoryCacheReader&> open_entry(URL::URL const&, StringView method);
+    void clear_cache();
+
+    void store_entry(Badge<MemoryCacheWriter>, u64 cache_key, NonnullRefPtr<MemoryCacheEntry>);
+    void writer_closed(Badge<MemoryCacheWriter>, MemoryCacheWriter const&);
+    void reader_closed(Badge<MemoryCacheReader>, MemoryCacheReader const&);
+
+    // Hot shared assets tend to be small; anything larger is left to the disk cache alone.
+    static constexpr size_t max_entry_size = 4 * MiB;
+    static constexpr size_t max_cache_size = 64 * MiB;
+
+private:
+    void evict_entries_to_fit(size_t incoming_entry_size);
+
+    HashMap<u64, NonnullRefPtr<MemoryCacheEntry>> m_entries;
+    size_t m_total_size { 0 };
+
+    HashMap<FlatPtr, NonnullOwnPtr<MemoryCacheReader>> m_open_readers;
+    HashMap<FlatPtr, NonnullOwnPtr<MemoryCacheWriter>> m_open_writers;
+};
+
+}
@@ -7,9 +7,12 @@
 #include "WebSocketImplCurl.h"
 
 #include <AK/IDAllocator.h>
+#include <AK/LexicalPath.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibCore/Directory.h>
 #include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibCore/Proxy.h>
 #include <LibCore/Socket.h>
 #include <LibCore/StandardPaths.h>
@@ -21,6 +24,7 @@
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/Cache/DiskCache.h>
+#include <RequestServer/Cache/MemoryCache.h>
 #include <RequestServer/ConnectionFromClient.h>
 #include <RequestServer/RequestClientEndpoint.h>
 
@@ -35,6 +39,11 @@ namespace RequestServer {
 
 ByteString g_default_certificate_path;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
+
+// Connections whose client has disconnected, kept alive until their in-flight keepalive
+// requests have drained.
+static Vector<NonnullRefPtr<ConnectionFromClient>> s_draining_connections;
+
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
 static struct {
@@ -46,6 +55,12 @@ static struct {
 } g_dns_info;
 
 Optional<DiskCache> g_disk_cache;
+Optional<MemoryCache> g_memory_cache;
+
+static ByteString dns_cache_path()
+{
+    return LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "DNSCache"sv).string();
+}
 
 static WeakPtr<Resolver> s_resolver {};
 static NonnullRefPtr<Resolver> default_resolver()
@@ -87,9 +102,35 @@ static NonnullRefPtr<Resolver> default_resolver()
     });
 
     s_resolver = resolver;
+
+    // OPTIMIZATION: Reload address records cached by the previous session, so startup doesn't pay
+    //               a fresh DNS round-trip for every host the user is about to revisit.
+    if (auto file = Core::File::open(dns_cache_path(), Core::File::OpenMode::Read); !file.is_error()) {
+        if (auto result = resolver->dns.load_cache(*file.value()); result.is_error())
+            dbgln("RequestServer: Failed to load DNS cache: {}", result.error());
+    }
+
     return resolver;
 }
 
+static void save_dns_cache()
+{
+    auto resolver = s_resolver.strong_ref();
+    if (!resolver)
+        return;
+
+    auto path = dns_cache_path();
+    if (Core::Directory::create(LexicalPath { path }.parent(), Core::Directory::CreateDirectories::Yes).is_error())
+        return;
+
+    auto file = Core::File::open(path, Core::File::OpenMode::Write);
+    if (file.is_error())
+        return;
+
+    if (auto result = resolver->dns.save_cache(*file.value()); result.is_error())
+        dbgln("RequestServer: Failed to save DNS cache: {}", result.error());
+}
+
 ByteString build_curl_resolve_list(DNS::LookupResult const& dns_result, StringView host, u16 port)
 {
     StringBuilder resolve_opt_builder;
@@ -118,6 +159,9 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     WeakPtr<ConnectionFromClient> client;
     int writer_fd { 0 };
     bool is_connect_only { false };
+    bool is_keepalive { false };
+    Requests::RequestPriority priority { Requests::RequestPriority::Normal };
+    bool added_to_multi { false };
     size_t downloaded_so_far { 0 };
     URL::URL url;
     ByteString method;
@@ -128,6 +172,11 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     NonnullRefPtr<Core::Notifier> write_notifier;
     bool done_fetching { false };
 
+    // When the client isn't draining the pipe, we stop accepting bytes from curl once this much
+    // data is queued, instead of buffering the rest of the response in memory.
+    static constexpr size_t send_buffer_high_water_mark = 4 * MiB;
+    bool curl_paused { false };
+
     Optional<long> http_status_code;
     HTTP::HeaderMap headers;
     bool got_all_headers { false };
@@ -136,6 +185,7 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
     size_t bytes_transferred_to_client { 0 };
 
     Optional<CacheEntryWriter&> cache_entry;
+    Optional<MemoryCacheWriter&> memory_cache_entry;
     UnixDateTime request_start_time;
 
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
@@ -160,11 +210,19 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         Core::deferred_invoke([weak_this = make_weak_ptr()] {
             if (!weak_this)
                 return;
-            if (weak_this->client)
-                weak_this->client->m_active_requests.remove(weak_this->request_id);
+            if (auto client = weak_this->client.strong_ref()) {
+                client->m_active_requests.remove(weak_this->request_id);
+                client->finalize_if_draining_complete();
+            }
         });
     }
 
+    bool client_is_gone() const
+    {
+        auto strong_client = client.strong_ref();
+        return !strong_client || strong_client->m_client_disconnected;
+    }
+
     ErrorOr<void> write_queued_bytes_without_blocking()
     {
         auto available_bytes = send_buffer.used_buffer_size();
@@ -199,36 +257,88 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
             }
         }
 
-        Vector<u8> bytes_to_send;
-        bytes_to_send.resize(available_bytes);
-        send_buffer.peek_some(bytes_to_send);
+        // OPTIMIZATION: Drain the queue through a fixed-size stack buffer instead of allocating a
+        //               fresh heap copy of everything that's pending on every call.
+        while (send_buffer.used_buffer_size() > 0) {
+            u8 copy_buffer[64 * KiB];
+            auto bytes_to_send = Bytes { copy_buffer, min(send_buffer.used_buffer_size(), sizeof(copy_buffer)) };
+            send_buffer.peek_some(bytes_to_send);
+
+            auto result = Core::System::write(this->writer_fd, bytes_to_send);
+            if (result.is_error()) {
+                if (result.error().code() != EAGAIN) {
+                    return result.release_error();
+                }
+                write_notifier->set_enabled(true);
+                return {};
+            }
+
+            {
+                auto bytes_sent = bytes_to_send.slice(0, result.value());
 
-        auto result = Core::System::write(this->writer_fd, bytes_to_send);
-        if (result.is_error()) {
-            if (result.error().code() != EAGAIN) {
-                return result.release_error();
+                if (cache_entry.has_value() && cache_entry->write_data(bytes_sent).is_error())
+                    cache_entry.clear();
+                if (memory_cache_entry.has_value() && memory_cache_entry->write_data(bytes_sent).is_error())
+                    memory_cache_entry.clear();
             }
-            write_notifier->set_enabled(true);
-            return {};
-        }
 
-        if (cache_entry.has_value()) {
-            auto bytes_sent = bytes_to_send.span().slice(0, result.value());
+            bytes_transferred_to_client += result.value();
+            MUST(send_buffer.discard(result.value()));
 
-            if (cache_entry->write_data(bytes_sent).is_error())
-                cache_entry.clear();
+            // A short write means the pipe is full; wait for the write notifier before trying again.
+            if (static_cast<size_t>(result.value()) < bytes_to_send.size()) {
+                write_notifier->set_enabled(true);
+                return {};
+            }
         }
 
-        bytes_transferred_to_client += result.value();
-        MUST(send_buffer.discard(result.value()));
+        write_notifier->set_enabled(false);
 
-        write_notifier->set_enabled(!send_buffer.is_eof());
-        if (send_buffer.is_eof() && done_fetching)
+        if (curl_paused) {
+            curl_paused = false;
+            curl_easy_pause(easy, CURLPAUSE_CONT);
+        }
+
+        if (done_fetching)
             schedule_self_destruction();
 
         return {};
     }
 
+    ErrorOr<void> write_bytes_without_blocking(ReadonlyBytes bytes)
+    {
+        // OPTIMIZATION: When nothing is queued up in front of them, write curl's bytes straight to
+        //               the pipe and only queue whatever the pipe didn't accept, so the common case
+        //               doesn't copy every chunk through the send buffer.
+        if (send_buffer.used_buffer_size() == 0 && !start_offset_of_resumed_response.has_value()) {
+            auto result = Core::System::write(this->writer_fd, bytes);
+            if (result.is_error()) {
+                if (result.error().code() != EAGAIN)
+                    return result.release_error();
+            } else {
+                auto bytes_sent = bytes.slice(0, result.value());
+
+                if (cache_entry.has_value() && cache_entry->write_data(bytes_sent).is_error())
+                    cache_entry.clear();
+                if (memory_cache_entry.has_value() && memory_cache_entry->write_data(bytes_sent).is_error())
+                    memory_cache_entry.clear();
+
+                bytes_transferred_to_client += result.value();
+                bytes = bytes.slice(result.value());
+            }
+
+            if (bytes.is_empty())
+                return {};
+
+            TRY(send_buffer.write_some(bytes));
+            write_notifier->set_enabled(true);
+            return {};
+        }
+
+        TRY(send_buffer.write_some(bytes));
+        return write_queued_bytes_without_blocking();
+    }
+
     void notify_about_fetching_completion()
     {
         done_fetching = true;
@@ -245,8 +355,10 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
-        auto result = curl_multi_remove_handle(multi, easy);
-        VERIFY(result == CURLM_OK);
+        if (added_to_multi) {
+            auto result = curl_multi_remove_handle(multi, easy);
+            VERIFY(result == CURLM_OK);
+        }
         curl_easy_cleanup(easy);
 
         for (auto* string_list : curl_string_lists)
@@ -254,6 +366,8 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
 
         if (cache_entry.has_value())
             (void)cache_entry->flush();
+        if (memory_cache_entry.has_value())
+            (void)memory_cache_entry->flush();
     }
 
     void flush_headers_if_needed()
@@ -265,10 +379,15 @@ struct ConnectionFromClient::ActiveRequest : public Weakable<ActiveRequest> {
             return;
         got_all_headers = true;
 
+        if (client_is_gone())
+            return;
+
         client->async_headers_became_available(request_id, headers, *http_status_code, reason_phrase);
 
         if (g_disk_cache.has_value())
             cache_entry = g_disk_cache->create_entry(url, method, *http_status_code, reason_phrase, headers, request_start_time);
+        if (g_memory_cache.has_value())
+            memory_cache_entry = g_memory_cache->create_entry(url, method, *http_status_code, reason_phrase, headers, request_start_time);
     }
 
     long acquire_http_status_code() const
@@ -321,10 +440,21 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     size_t total_size = size * nmemb;
     ReadonlyBytes bytes { static_cast<u8 const*>(buffer), total_size };
 
-    auto maybe_write_error = [&] -> ErrorOr<void> {
-        TRY(request->send_buffer.write_some(bytes));
-        return request->write_queued_bytes_without_blocking();
-    }();
+    // The client is gone and this is a keepalive request that's being allowed to finish; nobody
+    // is interested in the response body, so just discard it.
+    if (request->client_is_gone()) {
+        request->downloaded_so_far += total_size;
+        return total_size;
+    }
+
+    // Backpressure: when the pipe to the client is full and the queue has grown past its limit,
+    // stop accepting data from curl. It will redeliver this chunk once we unpause after draining.
+    if (request->send_buffer.used_buffer_size() >= ActiveRequest::send_buffer_high_water_mark) {
+        request->curl_paused = true;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+
+    auto maybe_write_error = request->write_bytes_without_blocking(bytes);
 
     if (maybe_write_error.is_error()) {
         dbgln("ConnectionFromClient::on_data_received: Aborting request because error occurred whilst writing data to the client: {}", maybe_write_error.error());
@@ -406,6 +536,14 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
     set_option(CURLMOPT_TIMERFUNCTION, &on_timeout_callback);
     set_option(CURLMOPT_TIMERDATA, this);
 
+    // OPTIMIZATION: Keep plenty of warm connections around instead of curl's small default cache,
+    //               so requests to recently-contacted hosts don't pay a fresh TCP+TLS handshake.
+    //               New connections per host are capped at the customary browser limit; with
+    //               CURLOPT_PIPEWAIT set, requests beyond the cap multiplex onto an existing
+    //               HTTP/2 or HTTP/3 connection rather than opening more.
+    set_option(CURLMOPT_MAX_HOST_CONNECTIONS, 6L);
+    set_option(CURLMOPT_MAXCONNECTS, 64L);
+
     m_timer = Core::Timer::create_single_shot(0, [this] {
         auto result = curl_multi_socket_action(m_curl_multi, CURL_SOCKET_TIMEOUT, 0, nullptr);
         VERIFY(result == CURLM_OK);
@@ -421,14 +559,79 @@ ConnectionFromClient::~ConnectionFromClient()
     m_curl_multi = nullptr;
 }
 
+// An unresponsive server shouldn't be able to keep the process alive indefinitely after the
+// client has disconnected, so draining keepalive requests get a bounded grace period.
+static constexpr int drain_timeout_milliseconds = 30'000;
+
 void ConnectionFromClient::die()
 {
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
 
-    if (s_connections.is_empty())
+    m_client_disconnected = true;
+
+    // Keepalive requests (sendBeacon() and fetch() with keepalive set) are allowed to outlive the
+    // page - and the whole WebContent process - that issued them. Their bodies were copied to this
+    // process when the request started, so instead of tearing them down with the rest of the
+    // connection, let them run to completion in the background with their responses discarded.
+    bool has_keepalive_requests_in_flight = false;
+    m_active_requests.remove_all_matching([&](auto&, auto const& request) {
+        if (!request->is_keepalive || request->done_fetching)
+            return true;
+
+        // Nobody will drain the response pipe anymore; drop anything queued for it.
+        MUST(request->send_buffer.discard(request->send_buffer.used_buffer_size()));
+        request->write_notifier->set_enabled(false);
+
+        // A request that was being held back by the scheduler has no reason to wait anymore.
+        if (!request->added_to_multi) {
+            request->added_to_multi = true;
+            auto result = curl_multi_add_handle(m_curl_multi, request->easy);
+            VERIFY(result == CURLM_OK);
+        }
+
+        has_keepalive_requests_in_flight = true;
+        return false;
+    });
+
+    if (has_keepalive_requests_in_flight) {
+        s_draining_connections.append(*this);
+
+        m_drain_timer = Core::Timer::create_single_shot(drain_timeout_milliseconds, [this] {
+            m_active_requests.clear();
+            finalize_if_draining_complete();
+        });
+        m_drain_timer->start();
+        return;
+    }
+
+    if (s_connections.is_empty() && s_draining_connections.is_empty()) {
+        save_dns_cache();
         Core::EventLoop::current().quit(0);
+    }
+}
+
+void ConnectionFromClient::finalize_if_draining_complete()
+{
+    if (!m_client_disconnected)
+        return;
+
+    for (auto const& it : m_active_requests) {
+        if (!it.value->done_fetching)
+            return;
+    }
+
+    // NOTE: Removing ourselves from the draining list may drop the last reference to us.
+    NonnullRefPtr<ConnectionFromClient> protector = *this;
+
+    m_drain_timer = nullptr;
+    s_draining_connections.remove_all_matching([this](auto const& connection) { return connection.ptr() == this; });
+
+    if (s_connections.is_empty() && s_draining_connections.is_empty()) {
+        save_dns_cache();
+        Core::EventLoop::current().quit(0);
+    }
 }
 
 Messages::RequestServer::InitTransportResponse ConnectionFromClient::init_transport([[maybe_unused]] int peer_pid)
@@ -529,21 +732,58 @@ void ConnectionFromClient::set_use_system_dns()
     default_resolver()->dns.reset_connection();
 }
 
+// Maps a request's scheduling priority onto an HTTP/2 stream weight (1-256), so that when several
+// transfers share a multiplexed connection, render-blocking responses get most of the bandwidth.
+static long stream_weight_for_priority(Requests::RequestPriority priority)
+{
+    switch (priority) {
+    case Requests::RequestPriority::Low:
+        return 8;
+    case Requests::RequestPriority::Normal:
+        return 64;
+    case Requests::RequestPriority::High:
+        return 256;
+    }
+    VERIFY_NOT_REACHED();
+}
+
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority, bool)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 
-void ConnectionFromClient::issue_network_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ResumeRequestForFailedCacheEntry>)
+void ConnectionFromClient::issue_network_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority, bool, Optional<ResumeRequestForFailedCacheEntry>)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::issue_network_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Requests::RequestPriority priority, bool is_keepalive)
 {
     dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: start_request({}, {})", request_id, url);
 
+    if (g_memory_cache.has_value()) {
+        if (auto cache_entry = g_memory_cache->open_entry(url, method); cache_entry.has_value()) {
+            auto fds = MUST(Core::System::pipe2(O_NONBLOCK));
+            auto writer_fd = fds[1];
+            auto reader_fd = fds[0];
+
+            async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+            async_headers_became_available(request_id, cache_entry->headers(), cache_entry->status_code(), cache_entry->reason_phrase());
+
+            auto finish_request = [this, request_id, writer_fd](auto bytes_sent) {
+                // FIXME: Implement timing info for cache hits.
+                async_request_finished(request_id, bytes_sent, {}, {});
+                MUST(Core::System::close(writer_fd));
+            };
+
+            // NOTE: Unlike a disk cache entry, piping a memory cache entry can only fail if the
+            //       client went away, so there is no network fallback for the error case.
+            cache_entry->pipe_to(writer_fd, finish_request, finish_request);
+            return;
+        }
+    }
+
     if (g_disk_cache.has_value()) {
         if (auto cache_entry = g_disk_cache->open_entry(url, method); cache_entry.has_value()) {
             auto fds = MUST(Core::System::pipe2(O_NONBLOCK));
@@ -560,24 +800,24 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                     async_request_finished(request_id, bytes_sent, {}, {});
                     MUST(Core::System::close(writer_fd));
                 },
-                [this, request_id, writer_fd, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data](auto bytes_sent) mutable {
+                [this, request_id, writer_fd, method = move(method), url = move(url), request_headers = move(request_headers), request_body = move(request_body), proxy_data, priority, is_keepalive](auto bytes_sent) mutable {
                     // FIXME: We should really also have a way to validate the data once CacheEntry is storing its crc.
                     ResumeRequestForFailedCacheEntry resume_request {
                         .start_offset = bytes_sent,
                         .writer_fd = writer_fd,
                     };
 
-                    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, resume_request);
+                    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, priority, is_keepalive, resume_request);
                 });
 
             return;
         }
     }
 
-    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data);
+    issue_network_request(request_id, move(method), move(url), move(request_headers), move(request_body), proxy_data, priority, is_keepalive);
 }
 
-void ConnectionFromClient::issue_network_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Optional<ResumeRequestForFailedCacheEntry> resume_request)
+void ConnectionFromClient::issue_network_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Requests::RequestPriority priority, bool is_keepalive, Optional<ResumeRequestForFailedCacheEntry> resume_request)
 {
     auto host = url.serialized_host().to_byte_string();
 
@@ -585,19 +825,26 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
         ->when_rejected([this, request_id, resume_request](auto const& error) {
             dbgln("StartRequest: DNS lookup failed: {}", error);
             // FIXME: Implement timing info for DNS lookup failure.
-            async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+            if (!m_client_disconnected)
+                async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
 
             if (resume_request.has_value())
                 MUST(Core::System::close(resume_request->writer_fd));
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, resume_request](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority, is_keepalive, resume_request](auto const& dns_result) mutable {
             if (dns_result->is_empty() || !dns_result->has_cached_addresses()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
                 // FIXME: Implement timing info for DNS lookup failure.
-                async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+                if (!m_client_disconnected)
+                    async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
                 return;
             }
 
+            // The client went away while the lookup was in flight. Keepalive requests still get
+            // sent; anything else is dropped on the floor.
+            if (m_client_disconnected && !is_keepalive)
+                return;
+
             dbgln_if(REQUESTSERVER_DEBUG, "RequestServer: DNS lookup successful");
 
             auto* easy = curl_easy_init();
@@ -621,12 +868,17 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
                 auto reader_fd = fds[0];
                 writer_fd = fds[1];
 
-                async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+                if (!m_client_disconnected)
+                    async_request_started(request_id, IPC::File::adopt_fd(reader_fd));
+                else
+                    MUST(Core::System::close(reader_fd));
             }
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url;
             request->method = method;
+            request->priority = priority;
+            request->is_keepalive = is_keepalive;
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -644,8 +896,19 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
             set_option(CURLOPT_PIPEWAIT, 1L);
+            set_option(CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(priority));
             set_option(CURLOPT_ALTSVC, m_alt_svc_cache_path.characters());
 
+            // If curl was built with an HTTP/3 backend, ask for HTTP/3 with fallback to HTTP/2 or
+            // 1.1 when the QUIC attempt doesn't work out. Without this, HTTP/3 is only ever reached
+            // through a cached Alt-Svc entry from a previous run.
+            static bool const curl_supports_http3 = [] {
+                auto const* version_info = curl_version_info(CURLVERSION_NOW);
+                return (version_info->features & CURL_VERSION_HTTP3) != 0;
+            }();
+            if (curl_supports_http3 && url.scheme() == "https"sv)
+                set_option(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_3);
+
             set_option(CURLOPT_CUSTOMREQUEST, method.characters());
             set_option(CURLOPT_FOLLOWLOCATION, 0);
 
@@ -713,14 +976,86 @@ void ConnectionFromClient::issue_network_request(i32 request_id, ByteString meth
             } else
                 VERIFY_NOT_REACHED();
 
-            auto result = curl_multi_add_handle(m_curl_multi, easy);
-            VERIFY(result == CURLM_OK);
+            // OPTIMIZATION: Hold back speculative (low-priority) requests while render-blocking
+            //               work is still fetching, so prefetches don't compete with it for
+            //               connections and bandwidth.
+            if (should_defer_request(*request)) {
+                m_deferred_request_ids.append(request_id);
+            } else {
+                request->added_to_multi = true;
+                auto result = curl_multi_add_handle(m_curl_multi, easy);
+                VERIFY(result == CURLM_OK);
+            }
 
             m_active_requests.set(request_id, move(request));
         });
 }
 #endif
 
+// Low-priority requests wait while any high-priority request is still fetching, and only a couple
+// of them run concurrently, so that speculative work never starves useful work.
+static constexpr size_t max_concurrent_low_priority_requests = 2;
+
+bool ConnectionFromClient::should_defer_request(ActiveRequest const& request) const
+{
+    if (request.priority != Requests::RequestPriority::Low)
+        return false;
+
+    size_t active_low_priority_requests = 0;
+
+    for (auto const& it : m_active_requests) {
+        auto const& active_request = *it.value;
+        if (!active_request.added_to_multi || active_request.done_fetching || active_request.is_connect_only)
+            continue;
+        if (active_request.priority == Requests::RequestPriority::High)
+            return true;
+        if (active_request.priority == Requests::RequestPriority::Low)
+            ++active_low_priority_requests;
+    }
+
+    return active_low_priority_requests >= max_concurrent_low_priority_requests;
+}
+
+void ConnectionFromClient::start_eligible_deferred_requests()
+{
+    m_deferred_request_ids.remove_all_matching([this](i32 request_id) {
+        auto request = m_active_requests.get(request_id);
+
+        // The request was stopped while it was still queued.
+        if (!request.has_value())
+            return true;
+
+        if (should_defer_request(*request.value()))
+            return false;
+
+        request.value()->added_to_multi = true;
+        auto result = curl_multi_add_handle(m_curl_multi, request.value()->easy);
+        VERIFY(result == CURLM_OK);
+        return true;
+    });
+}
+
+void ConnectionFromClient::set_request_priority(i32 request_id, Requests::RequestPriority priority)
+{
+    auto request = m_active_requests.get(request_id);
+    if (!request.has_value()) {
+        dbgln("SetRequestPriority: Request ID {} not found", request_id);
+        return;
+    }
+
+    if (request.value()->priority == priority)
+        return;
+    request.value()->priority = priority;
+
+    // Updating the stream weight on a live handle reprioritizes the transfer on multiplexed
+    // connections; a request still waiting in the deferred queue may also become eligible now.
+    auto result = curl_easy_setopt(request.value()->easy, CURLOPT_STREAM_WEIGHT, stream_weight_for_priority(priority));
+    if (result != CURLE_OK)
+        dbgln("SetRequestPriority: Failed to set stream weight: {}", curl_easy_strerror(result));
+
+    start_eligible_deferred_requests();
+}
+
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
 {
     switch (code) {
@@ -866,11 +1201,15 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
-            async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
+            if (!m_client_disconnected)
+                async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
         }
 
         request->notify_about_fetching_completion();
     }
+
+    // Completed requests may have freed up room for deferred low-priority ones.
+    start_eligible_deferred_requests();
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
@@ -881,6 +1220,7 @@ Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(
         return false;
     }
 
+    start_eligible_deferred_requests();
     return true;
 }
 
@@ -922,6 +1262,7 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
         set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
         set_option(CURLOPT_CONNECT_ONLY, 1L);
 
+        request->added_to_multi = true;
         auto const result = curl_multi_add_handle(m_curl_multi, easy);
         VERIFY(result == CURLM_OK);
 
@@ -946,6 +1287,8 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
 
 void ConnectionFromClient::clear_cache()
 {
+    if (g_memory_cache.has_value())
+        g_memory_cache->clear_cache();
     if (g_disk_cache.has_value())
         g_disk_cache->clear_cache();
 }
@@ -982,8 +1325,8 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
             connection->on_open = [this, websocket_id]() {
                 async_websocket_connected(websocket_id);
             };
-            connection->on_message = [this, websocket_id](auto message) {
-                async_websocket_received(websocket_id, message.is_text(), message.data());
+            connection->on_message_batch = [this, websocket_id](auto messages) {
+                async_websocket_received(websocket_id, move(messages));
             };
             connection->on_error = [this, websocket_id](auto message) {
                 async_websocket_errored(websocket_id, (i32)message);
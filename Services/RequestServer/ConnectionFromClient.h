@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibWebSocket/WebSocket.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
@@ -44,8 +45,9 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls, bool validate_dnssec_locally) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority, bool is_keepalive) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
+    virtual void set_request_priority(i32 request_id, Requests::RequestPriority) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
 
@@ -60,7 +62,7 @@ private:
         size_t start_offset { 0 };
         int writer_fd { 0 };
     };
-    void issue_network_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Optional<ResumeRequestForFailedCacheEntry> = {});
+    void issue_network_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority, bool is_keepalive, Optional<ResumeRequestForFailedCacheEntry> = {});
 
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
@@ -76,9 +78,22 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
+    bool should_defer_request(ActiveRequest const&) const;
+    void start_eligible_deferred_requests();
+
+    // Requests in m_active_requests that have not been handed to curl yet, in arrival order.
+    Vector<i32> m_deferred_request_ids;
+
     void check_active_requests();
+    void finalize_if_draining_complete();
+
+    // Set when the client has disconnected and we're only sticking around to let keepalive
+    // requests (which are allowed to outlive their page) run to completion.
+    bool m_client_disconnected { false };
+
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
+    RefPtr<Core::Timer> m_drain_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_write_notifiers;
     NonnullRefPtr<Resolver> m_resolver;
@@ -13,5 +13,9 @@ class CacheEntryReader;
 class CacheEntryWriter;
 class CacheIndex;
 class DiskCache;
+class MemoryCache;
+class MemoryCacheEntry;
+class MemoryCacheReader;
+class MemoryCacheWriter;
 
 }
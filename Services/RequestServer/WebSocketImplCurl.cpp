@@ -120,7 +120,11 @@ ErrorOr<ByteBuffer> WebSocketImplCurl::read(int max_size)
 {
     auto buffer = TRY(ByteBuffer::create_uninitialized(max_size));
     auto const read_bytes = TRY(m_read_buffer.read_some(buffer));
-    return buffer.slice(0, read_bytes.size());
+
+    // OPTIMIZATION: Shrink in place instead of slicing, which would copy the bytes into a second
+    //               allocation on every read.
+    buffer.resize(read_bytes.size());
+    return buffer;
 }
 
 ErrorOr<ByteString> WebSocketImplCurl::read_line(size_t)
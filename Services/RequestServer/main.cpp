@@ -15,6 +15,7 @@
 #include <LibIPC/SingleServer.h>
 #include <LibMain/Main.h>
 #include <RequestServer/Cache/DiskCache.h>
+#include <RequestServer/Cache/MemoryCache.h>
 #include <RequestServer/ConnectionFromClient.h>
 
 #if defined(AK_OS_MACOS)
@@ -25,6 +26,7 @@ namespace RequestServer {
 
 extern ByteString g_default_certificate_path;
 extern Optional<DiskCache> g_disk_cache;
+extern Optional<MemoryCache> g_memory_cache;
 
 }
 
@@ -65,6 +67,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
             RequestServer::g_disk_cache = cache.release_value();
     }
 
+    // The memory cache is bounded and reconstructible, so it does not need an opt-in flag.
+    RequestServer::g_memory_cache = RequestServer::MemoryCache {};
+
     auto client = TRY(IPC::take_over_accepted_client_from_system_server<RequestServer::ConnectionFromClient>());
 
     return event_loop.exec();
@@ -247,6 +247,20 @@ void ConnectionFromClient::drag_event(u64 page_id, Web::DragEvent event)
 
 void ConnectionFromClient::pinch_event(u64 page_id, Web::PinchEvent event)
 {
+    // OPTIMIZATION: Coalesce consecutive unprocessed pinch events, so a busy main thread applies one
+    //               accumulated zoom instead of slowly replaying the whole backlog.
+    if (!m_input_event_queue.is_empty() && m_input_event_queue.tail().page_id == page_id) {
+        if (auto const* pinch_event = m_input_event_queue.tail().event.get_pointer<Web::PinchEvent>()) {
+            // NOTE: Scale deltas are applied as `scale * (1 + delta)`, so they compose multiplicatively.
+            event.scale_delta = pinch_event->scale_delta + event.scale_delta + pinch_event->scale_delta * event.scale_delta;
+
+            m_input_event_queue.tail().event = move(event);
+            ++m_input_event_queue.tail().coalesced_event_count;
+
+            return;
+        }
+    }
+
     enqueue_input_event({ page_id, move(event), 0 });
 }
 
@@ -416,6 +430,22 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-gc-heap-stats") {
+        auto stats = Web::Bindings::main_thread_vm().heap().heap_statistics();
+        dbgln("GC heap: {} live cells using {} bytes ({} bytes reserved in blocks)",
+            stats.get_u64("live_cell_count"sv).value_or(0),
+            stats.get_u64("live_cell_bytes"sv).value_or(0),
+            stats.get_u64("block_bytes"sv).value_or(0));
+        stats.get_array("allocators"sv)->for_each([](JsonValue const& value) {
+            auto const& entry = value.as_object();
+            dbgln("{:>10} cells {:>12} bytes  {}",
+                entry.get_u64("live_cell_count"sv).value_or(0),
+                entry.get_u64("live_cell_bytes"sv).value_or(0),
+                entry.get_string("name"sv).value_or({}));
+        });
+        return;
+    }
+
     if (request == "navigator-compatibility-mode") {
         Web::NavigatorCompatibilityMode compatibility_mode;
         if (argument == "chrome") {
@@ -1051,6 +1081,13 @@ Messages::WebContentServer::GetSelectedTextResponse ConnectionFromClient::get_se
     return ByteString {};
 }
 
+Messages::WebContentServer::ExtractTextRunsResponse ConnectionFromClient::extract_text_runs(u64 page_id)
+{
+    if (auto page = this->page(page_id); page.has_value())
+        return page->page().extract_text_runs();
+    return Vector<Web::Page::TextRun> {};
+}
+
 void ConnectionFromClient::select_all(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1347,4 +1384,9 @@ void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
     }
 }
 
+void ConnectionFromClient::collect_performance_statistics()
+{
+    async_did_collect_performance_statistics(Web::Bindings::main_thread_vm().heap().memory_usage());
+}
+
 }
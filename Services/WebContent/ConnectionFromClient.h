@@ -151,6 +151,7 @@ private:
     virtual void request_internal_page_info(u64 page_id, WebView::PageInfoType) override;
 
     virtual Messages::WebContentServer::GetSelectedTextResponse get_selected_text(u64 page_id) override;
+    virtual Messages::WebContentServer::ExtractTextRunsResponse extract_text_runs(u64 page_id) override;
     virtual void select_all(u64 page_id) override;
 
     virtual void find_in_page(u64 page_id, String query, CaseSensitivity) override;
@@ -161,6 +162,7 @@ private:
 
     virtual void system_time_zone_changed() override;
     virtual void cookies_changed(Vector<Web::Cookie::Cookie>) override;
+    virtual void collect_performance_statistics() override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
@@ -68,16 +68,28 @@ PageClient::PageClient(PageHost& owner, u64 id)
 {
     setup_palette();
 
-    // FIXME: This removes the decimal part, so the refresh interval will actually be higher than the maximum FPS.
-    //        For example, 60 FPS = 1000ms / 60 = 16.6666...ms, but it will become 16ms, making the interval equivalent
-    //        to 62.5 FPS.
-    int refresh_interval = static_cast<int>(1000.0 / m_maximum_frames_per_second);
-
-    m_paint_refresh_timer = Core::Timer::create_repeating(refresh_interval, [] {
+    m_paint_refresh_timer = Core::Timer::create_single_shot(0, [this] {
+        // NOTE: Re-arm before running the rendering update, so a slow frame delays the next tick
+        //       instead of silently dropping it.
+        schedule_next_paint_refresh();
         Web::HTML::main_thread_event_loop().queue_task_to_update_the_rendering();
     });
 
-    m_paint_refresh_timer->start();
+    Web::HTML::main_thread_event_loop().set_refresh_rate(m_maximum_frames_per_second);
+    schedule_next_paint_refresh();
+}
+
+void PageClient::schedule_next_paint_refresh()
+{
+    // NOTE: Core::Timer only has whole-millisecond resolution, and at high refresh rates the
+    //       truncation error is significant: 120Hz is 8.333...ms per frame, and ticking every 8ms
+    //       drifts against the display and produces beat patterns of dropped and doubled frames.
+    //       Carry the fractional part over to the next tick so the average cadence matches the
+    //       refresh rate exactly.
+    auto interval = 1000.0 / m_maximum_frames_per_second + m_paint_refresh_error_ms;
+    auto whole_interval = static_cast<int>(interval);
+    m_paint_refresh_error_ms = interval - whole_interval;
+    m_paint_refresh_timer->start(whole_interval);
 }
 
 PageClient::~PageClient() = default;
@@ -207,14 +219,11 @@ void PageClient::set_viewport_size(Web::DevicePixelSize const& size)
 void PageClient::set_maximum_frames_per_second(u64 maximum_frames_per_second)
 {
     m_maximum_frames_per_second = maximum_frames_per_second;
+    m_paint_refresh_error_ms = 0;
 
-    // FIXME: This removes the decimal part, so the refresh interval will actually be higher than the maximum FPS.
-    //        For example, 60 FPS = 1000ms / 60 = 16.6666...ms, but it will become 16ms, making the interval equivalent
-    //        to 62.5 FPS.
-    int refresh_interval = static_cast<int>(1000.0 / m_maximum_frames_per_second);
+    Web::HTML::main_thread_event_loop().set_refresh_rate(m_maximum_frames_per_second);
 
-    VERIFY(m_paint_refresh_timer);
-    m_paint_refresh_timer->set_interval(refresh_interval);
+    // NOTE: The next tick was already scheduled at the old rate; the new rate takes effect once it fires.
 }
 
 void PageClient::page_did_request_cursor_change(Gfx::Cursor const& cursor)
@@ -705,11 +714,19 @@ void PageClient::page_did_mutate_dom(FlyString const& type, Web::DOM::Node const
         VERIFY_NOT_REACHED();
     }
 
-    StringBuilder builder;
-    auto serializer = MUST(JsonObjectSerializer<>::try_create(builder));
-    target.serialize_tree_as_json(serializer);
-    MUST(serializer.finish());
-    auto serialized_target = MUST(builder.to_string());
+    // OPTIMIZATION: Only child list mutations need the target's serialized subtree, so the DevTools
+    //               client can splice the new nodes into its cached DOM tree. Attribute and
+    //               character data mutations are applied from the delta alone, so don't pay for
+    //               subtree serialization (which for a mutation near the root is most of the
+    //               document).
+    String serialized_target;
+    if (type == Web::DOM::MutationType::childList) {
+        StringBuilder builder;
+        auto serializer = MUST(JsonObjectSerializer<>::try_create(builder));
+        target.serialize_tree_as_json(serializer);
+        MUST(serializer.finish());
+        serialized_target = MUST(builder.to_string());
+    }
 
     client().async_did_mutate_dom(m_id, { type.to_string(), target.unique_id(), move(serialized_target), mutation.release_value() });
 }
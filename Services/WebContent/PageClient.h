@@ -180,6 +180,7 @@ private:
     virtual void received_message_from_web_ui(String const& name, JS::Value data) override;
 
     void setup_palette();
+    void schedule_next_paint_refresh();
     ConnectionFromClient& client() const;
 
     PageHost& m_owner;
@@ -203,6 +204,7 @@ private:
     GC::Root<JS::GlobalObject> m_console_global_object;
 
     RefPtr<Core::Timer> m_paint_refresh_timer;
+    double m_paint_refresh_error_ms { 0 };
 };
 
 }
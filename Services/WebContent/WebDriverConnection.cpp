@@ -2528,10 +2528,10 @@ Messages::WebDriverClient::TakeScreenshotResponse WebDriverConnection::take_scre
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 3. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_canvas_element(canvas, [this](Web::WebDriver::Response encoded_string) {
+                // 3. Return success with data encoded string.
+                async_driver_execution_complete(move(encoded_string));
+            });
         }));
     });
 
@@ -2566,10 +2566,10 @@ Messages::WebDriverClient::TakeElementScreenshotResponse WebDriverConnection::ta
 
             // d. Let encoding result be the result of trying encoding a canvas as Base64 canvas.
             // e. Let encoded string be encoding result's data.
-            auto encoded_string = Web::WebDriver::encode_canvas_element(canvas);
-
-            // 6. Return success with data encoded string.
-            async_driver_execution_complete(move(encoded_string));
+            Web::WebDriver::encode_canvas_element(canvas, [this](Web::WebDriver::Response encoded_string) {
+                // 6. Return success with data encoded string.
+                async_driver_execution_complete(move(encoded_string));
+            });
         }));
     });
 
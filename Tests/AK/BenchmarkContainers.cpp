@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/HashMap.h>
+#include <AK/HashTable.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+
+// Keep the iteration counts high enough that each case runs for tens of milliseconds, so the
+// timings reported with --json-output are stable enough for regression tracking.
+
+static constexpr size_t hash_table_size = 100'000;
+static constexpr size_t lookup_rounds = 50;
+
+BENCHMARK_CASE(hash_table_insertion)
+{
+    for (size_t round = 0; round < 10; ++round) {
+        HashTable<u64> table;
+        for (u64 i = 0; i < hash_table_size; ++i)
+            table.set(i * 7919);
+        EXPECT_EQ(table.size(), hash_table_size);
+    }
+}
+
+BENCHMARK_CASE(hash_table_lookup)
+{
+    HashTable<u64> table;
+    for (u64 i = 0; i < hash_table_size; ++i)
+        table.set(i * 7919);
+
+    size_t found = 0;
+    for (size_t round = 0; round < lookup_rounds; ++round) {
+        for (u64 i = 0; i < hash_table_size; ++i) {
+            if (table.contains(i * 7919))
+                ++found;
+        }
+    }
+    EXPECT_EQ(found, hash_table_size * lookup_rounds);
+}
+
+BENCHMARK_CASE(hash_map_string_keys)
+{
+    Vector<String> keys;
+    keys.ensure_capacity(10'000);
+    for (size_t i = 0; i < 10'000; ++i)
+        keys.unchecked_append(MUST(String::formatted("key-number-{}", i)));
+
+    HashMap<String, u64> map;
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.set(keys[i], i);
+
+    u64 sum = 0;
+    for (size_t round = 0; round < lookup_rounds; ++round) {
+        for (auto const& key : keys)
+            sum += map.get(key).value();
+    }
+    EXPECT(sum > 0);
+}
+
+BENCHMARK_CASE(vector_append_and_iterate)
+{
+    u64 sum = 0;
+    for (size_t round = 0; round < 100; ++round) {
+        Vector<u64> vector;
+        for (u64 i = 0; i < hash_table_size; ++i)
+            vector.append(i);
+        for (auto value : vector)
+            sum += value;
+    }
+    EXPECT(sum > 0);
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteBuffer.h>
+#include <AK/StringBuilder.h>
+#include <LibCompress/Deflate.h>
+
+// Repetitive-but-not-constant input, so both the literal and the back-reference paths get exercised.
+static ByteBuffer build_compressible_data()
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i)
+        builder.appendff("The quick brown fox jumps over the lazy dog {} times. ", i % 100);
+    return MUST(ByteBuffer::copy(builder.string_view().bytes()));
+}
+
+static auto const s_uncompressed = build_compressible_data();
+static auto const s_compressed = MUST(Compress::DeflateCompressor::compress_all(s_uncompressed));
+
+BENCHMARK_CASE(deflate_compression)
+{
+    for (size_t i = 0; i < 10; ++i) {
+        auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(s_uncompressed));
+        EXPECT(compressed.size() < s_uncompressed.size());
+    }
+}
+
+BENCHMARK_CASE(deflate_decompression)
+{
+    for (size_t i = 0; i < 50; ++i) {
+        auto decompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(s_compressed));
+        EXPECT_EQ(decompressed.size(), s_uncompressed.size());
+    }
+}
@@ -149,6 +149,18 @@ TEST_CASE(deflate_round_trip_compress_large)
     EXPECT(uncompressed == original);
 }
 
+TEST_CASE(deflate_round_trip_incompressible)
+{
+    // Large random input trips the incompressibility heuristic and gets emitted as stored blocks.
+    auto original = TRY_OR_FAIL(ByteBuffer::create_uninitialized(256 * KiB));
+    fill_with_random(original);
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original));
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+    // Stored blocks only add framing overhead on top of the input.
+    EXPECT(compressed.size() < original.size() + original.size() / 100);
+}
+
 TEST_CASE(deflate_compress_literals)
 {
     // This byte array is known to not produce any back references with our lz77 implementation even at the highest compression settings
@@ -102,3 +102,36 @@ TEST_CASE(test_tls)
 
     EXPECT_EQ(0, loop.exec());
 }
+
+TEST_CASE(test_cache_persistence)
+{
+    DNS::Resolver resolver {
+        [&] -> ErrorOr<DNS::Resolver::SocketResult> {
+            return Error::from_string_literal("No network in this test");
+        }
+    };
+
+    auto now = AK::UnixDateTime::now().seconds_since_epoch();
+    auto contents = ByteString::formatted(
+        "example.com A {} 93.184.216.34\n"
+        "example.com AAAA {} 2606:2800:220:1:248:1893:25c8:1946\n"
+        "expired.example.com A {} 1.2.3.4\n",
+        now + 3600, now + 3600, now - 3600);
+
+    FixedMemoryStream stream { contents.bytes() };
+    TRY_OR_FAIL(resolver.load_cache(stream));
+
+    auto result = resolver.lookup_in_cache("example.com"sv);
+    EXPECT(result);
+    EXPECT(result->has_cached_addresses());
+    EXPECT_EQ(result->cached_addresses().size(), 2uz);
+
+    EXPECT(!resolver.lookup_in_cache("expired.example.com"sv));
+
+    AllocatingMemoryStream out;
+    TRY_OR_FAIL(resolver.save_cache(out));
+    auto saved = TRY_OR_FAIL(out.read_until_eof());
+    EXPECT(StringView { saved }.contains("example.com A"sv));
+    EXPECT(StringView { saved }.contains("example.com AAAA"sv));
+    EXPECT(!StringView { saved }.contains("expired.example.com"sv));
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/StringBuilder.h>
+#include <LibRegex/Regex.h>
+
+static ByteString build_haystack()
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 10'000; ++i)
+        builder.appendff("lorem ipsum dolor sit amet {} consectetur adipiscing elit ", i);
+    return builder.to_byte_string();
+}
+
+static auto const s_haystack = build_haystack();
+
+BENCHMARK_CASE(literal_search)
+{
+    Regex<ECMA262> re("adipiscing elit"sv);
+    for (size_t i = 0; i < 100; ++i)
+        EXPECT(re.has_match(s_haystack.view()));
+}
+
+BENCHMARK_CASE(character_class_scan)
+{
+    Regex<ECMA262> re("[0-9]+"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    auto result = re.match(s_haystack.view());
+    EXPECT(result.success);
+    EXPECT_EQ(result.count, 10'000u);
+}
+
+BENCHMARK_CASE(alternation_with_captures)
+{
+    Regex<ECMA262> re("(lorem|dolor) (ipsum|sit)"sv, (ECMAScriptFlags)regex::AllFlags::Global);
+    auto result = re.match(s_haystack.view());
+    EXPECT(result.success);
+    EXPECT(result.count > 0);
+}
@@ -1469,3 +1469,33 @@ TEST_CASE(backreference_to_undefined_capture_groups)
         EXPECT(result2.capture_group_matches.first()[1].view.is_null());
     }
 }
+
+TEST_CASE(starting_character_scan_respects_sticky_matching)
+{
+    // The single-starting-character scan may only skip ahead when the engine would have kept
+    // searching anyway; a match that isn't at the current position must still be rejected.
+    {
+        Regex<ECMA262> re("ab+"sv, ECMAScriptFlags::Sticky);
+        EXPECT_EQ(re.match("xab"sv).success, false);
+        EXPECT_EQ(re.match("abb"sv).success, true);
+    }
+    {
+        Regex<ECMA262> re("ab+"sv);
+        EXPECT_EQ(re.match("xxab"sv).success, false);
+        EXPECT_EQ(re.match("ab"sv).success, true);
+    }
+}
+
+
+TEST_CASE(substring_search_with_non_latin1_literal)
+{
+    // Literal patterns get rewritten into a substring search that stores one byte per code unit.
+    // A non-unicode literal above 0xff cannot be represented that way; it used to be truncated
+    // (U+65E5 to 0xe5), so the pattern matched U+00E5 instead of its own literal.
+    Regex<ECMA262> re("\\u65e5"sv, ECMAScriptFlags::Global);
+    auto subject = Utf16String::from_utf8("xå日x"sv);
+    auto result = re.match(Utf16View { subject });
+    EXPECT_EQ(result.success, true);
+    EXPECT_EQ(result.matches.size(), 1u);
+    EXPECT_EQ(result.matches.first().view.to_byte_string(), "日"sv);
+}
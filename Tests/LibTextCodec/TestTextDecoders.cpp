@@ -48,3 +48,13 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_x_user_defined_decode)
+{
+    auto decoder = TextCodec::XUserDefinedDecoder();
+    auto test_string = "abc\x80\xff""def"sv;
+
+    // 0x80 and 0xFF map to the private use code points U+F780 and U+F7FF.
+    auto utf8 = MUST(decoder.to_utf8(test_string));
+    EXPECT_EQ(utf8, "abcdef"sv);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/StringBuilder.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+
+// A synthetic but representative document: nested elements, repeated attributes, class lists,
+// text runs and character references, so the tokenizer's main states all see traffic.
+static String build_document()
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html><head><title>Benchmark &amp; friends</title></head><body>"sv);
+    for (size_t i = 0; i < 5'000; ++i) {
+        builder.appendff("<div class=\"row item-{}\" data-index=\"{}\"><a href=\"/item/{}\" title='item'>Item &#{};</a>"
+                         "<span>Some text content with a moderate length, entry number {}.</span></div>",
+            i % 50, i, i, 65 + (i % 26), i);
+    }
+    builder.append("</body></html>"sv);
+    return MUST(builder.to_string());
+}
+
+static auto const s_document = build_document();
+
+BENCHMARK_CASE(tokenize_document)
+{
+    size_t token_count = 0;
+    Web::HTML::HTMLTokenizer tokenizer { s_document.bytes_as_string_view(), "UTF-8" };
+    while (true) {
+        auto maybe_token = tokenizer.next_token();
+        if (!maybe_token.has_value())
+            break;
+        ++token_count;
+        if (maybe_token->is_end_of_file())
+            break;
+    }
+    EXPECT(token_count > 10'000);
+}
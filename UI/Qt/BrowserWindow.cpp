@@ -232,8 +232,10 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
     QObject::connect(open_file_action, &QAction::triggered, this, &BrowserWindow::open_file);
     QObject::connect(m_tabs_container, &QTabWidget::currentChanged, [this](int index) {
         auto* tab = as<Tab>(m_tabs_container->widget(index));
-        if (tab)
+        if (tab) {
             setWindowTitle(QString("%1 - Ladybird").arg(tab->title()));
+            tab->load_pending_navigation();
+        }
 
         set_current_tab(tab);
     });
@@ -260,7 +262,14 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         new_child_tab(Web::HTML::ActivateTab::Yes, *parent_tab, AK::move(page_index));
     } else {
         for (size_t i = 0; i < initial_urls.size(); ++i) {
-            new_tab_from_url(initial_urls[i], (i == 0) ? Web::HTML::ActivateTab::Yes : Web::HTML::ActivateTab::No);
+            if (i == 0) {
+                new_tab_from_url(initial_urls[i], Web::HTML::ActivateTab::Yes);
+            } else {
+                // OPTIMIZATION: Don't load background tabs until they are activated, so opening a large set of URLs
+                //               at startup only pays for the tab the user is actually looking at.
+                auto& tab = create_new_tab(Web::HTML::ActivateTab::No);
+                tab.defer_navigation(initial_urls[i]);
+            }
         }
     }
 
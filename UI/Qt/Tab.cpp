@@ -426,9 +426,31 @@ void Tab::focus_location_editor()
 
 void Tab::navigate(URL::URL const& url)
 {
+    m_pending_navigation_url.clear();
     view().load(url);
 }
 
+void Tab::defer_navigation(URL::URL url)
+{
+    // Show the destination in the tab and location bar right away; the actual load happens when the tab is activated.
+    auto url_serialized = qstring_from_ak_string(url.serialize());
+
+    m_title = url_serialized;
+    emit title_changed(tab_index(), url_serialized);
+
+    m_location_edit->set_url(url);
+    m_location_edit->setCursorPosition(0);
+
+    m_pending_navigation_url = move(url);
+}
+
+void Tab::load_pending_navigation()
+{
+    if (!m_pending_navigation_url.has_value())
+        return;
+    navigate(m_pending_navigation_url.release_value());
+}
+
 void Tab::load_html(StringView html)
 {
     view().load_html(html);
@@ -53,6 +53,8 @@ public:
     WebContentView& view() { return *m_view; }
 
     void navigate(URL::URL const&);
+    void defer_navigation(URL::URL);
+    void load_pending_navigation();
     void load_html(StringView);
 
     void open_file();
@@ -100,6 +102,7 @@ private:
     QString m_title;
     HyperlinkLabel* m_hover_label { nullptr };
     QIcon m_favicon;
+    Optional<URL::URL> m_pending_navigation_url;
 
     QMenu* m_context_menu { nullptr };
     QMenu* m_page_context_menu { nullptr };